@@ -22,9 +22,8 @@ def AA():
     os.system('python3 realsense_D435i_recorder.py')
 
 def BB():
-    os.system('/home/shank/Projects/3D_processing/jetscan/jetscan-final-edit/Open3D-for-Jetson/build/bin/examples/./Run_MakeFragments')
-    os.system('python3 run_regref.py config/intel/config.json --register --refine')
-    os.system('/home/shank/Projects/3D_processing/jetscan/jetscan-final-edit/Open3D-for-Jetson/build/bin/examples/./Run_IntegrateScene')
+    # fragments, registration and integration in one pipelined process
+    os.system('/home/shank/Projects/3D_processing/jetscan/jetscan-final-edit/Open3D-for-Jetson/build/bin/examples/./RunPipeline')
 
 def CC():
     os.system('/home/shank/Projects/3D_processing/jetscan/jetscan-final-edit/Open3D-for-Jetson/build/bin/examples/./ViewPoseGraph')
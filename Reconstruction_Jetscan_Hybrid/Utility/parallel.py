@@ -0,0 +1,40 @@
+# Open3D: www.open3d.org
+# The MIT License (MIT)
+# See license file or visit www.open3d.org for details
+
+# Adopted for Jetscan
+
+import multiprocessing
+import os
+
+# Python threads the cores are split between when a script runs
+# independent registrations concurrently.
+PYTHON_THREADS = 4
+
+
+def omp_num_threads():
+    # OMP_NUM_THREADS may list the threads of nested levels, e.g. "4,2"
+    value = os.environ.get("OMP_NUM_THREADS", "").split(",")[0]
+    if value.isdigit() and int(value) > 0:
+        return int(value)
+    return multiprocessing.cpu_count()
+
+
+def limit_omp_threads():
+    # Every Open3D call runs OpenMP threads on all cores by default, so
+    # Python threads calling it concurrently would oversubscribe the cores.
+    # Give each Python thread a share instead. OpenMP reads the variable when
+    # open3d is loaded, so this must run before it is imported.
+    if "OMP_NUM_THREADS" not in os.environ:
+        os.environ["OMP_NUM_THREADS"] = str(
+            max(1,
+                multiprocessing.cpu_count() // PYTHON_THREADS))
+
+
+def thread_pool_size(num_tasks):
+    # Python threads times the OpenMP threads of every call do not exceed
+    # the number of cores
+    return max(
+        1,
+        min(num_tasks,
+            multiprocessing.cpu_count() // omp_num_threads()))
@@ -65,6 +65,19 @@ def save_intrinsic_as_json(filename, frame):
             indent=4)
 
 
+def open_sequence_writer(filename, frame, depth_scale):
+    import open3d as o3d
+    intrinsics = frame.profile.as_video_stream_profile().intrinsics
+    writer = o3d.io.RGBDSequenceFileWriter()
+    writer.open(
+        filename,
+        o3d.camera.PinholeCameraIntrinsic(intrinsics.width, intrinsics.height,
+                                          intrinsics.fx, intrinsics.fy,
+                                          intrinsics.ppx, intrinsics.ppy),
+        1.0 / depth_scale)
+    return writer
+
+
 if __name__ == "__main__":
 
     parser = argparse.ArgumentParser(
@@ -84,7 +97,14 @@ if __name__ == "__main__":
     parser.add_argument("--playback_rosbag",
                         action='store_true',
                         help="Play recorded realsense.bag file")
+    parser.add_argument(
+        "--record_sequence",
+        action='store_true',
+        help="Recording color and depth frames into a single "
+        "realsense.rgbdseq file instead of image folders")
     args = parser.parse_args()
+    if args.record_sequence:
+        args.record_imgs = False
 
     if sum(o is not False for o in vars(args).values()) != 2:
         parser.print_help()
@@ -98,6 +118,13 @@ if __name__ == "__main__":
         make_clean_folder(path_depth)
         make_clean_folder(path_color)
 
+    path_sequence = join(args.output_folder, "realsense.rgbdseq")
+    sequence_writer = None
+    if args.record_sequence:
+        import open3d as o3d
+        if not exists(path_output):
+            makedirs(path_output)
+
     path_bag = join(args.output_folder, "realsense.bag")
     if args.record_rosbag:
         if exists(path_bag):
@@ -187,6 +214,19 @@ if __name__ == "__main__":
                 print("Saved color + depth image %06d" % frame_count)
                 frame_count += 1
 
+            if args.record_sequence and (frame_count_o % 10 == 0):
+                if sequence_writer is None:
+                    sequence_writer = open_sequence_writer(
+                        path_sequence, color_frame, depth_scale)
+                # the sequence stores RGB colors
+                sequence_writer.write_frame(
+                    o3d.geometry.Image(
+                        np.ascontiguousarray(color_image[:, :, ::-1])),
+                    o3d.geometry.Image(depth_image),
+                    int(color_frame.get_timestamp() * 1000))
+                print("Saved color + depth frame %06d" %
+                      (sequence_writer.num_frames() - 1))
+
             frame_count_o += 1
 
             # Remove background - Set pixels further than clipping_distance to grey
@@ -211,5 +251,7 @@ if __name__ == "__main__":
             
     finally:
         pipeline.stop()
+        if sequence_writer is not None:
+            sequence_writer.close()
 
         
\ No newline at end of file
@@ -144,16 +144,19 @@ def make_posegraph_for_refined_scene(ply_file_names, config):
                 matching_result(s, t, edge.transformation)
 
     if config["python_multi_threading"] == True:
-        from joblib import Parallel, delayed
-        import multiprocessing
-        import subprocess
-        MAX_THREAD = min(multiprocessing.cpu_count(),
-                         max(len(pose_graph.edges), 1))
-        results = Parallel(n_jobs=MAX_THREAD)(
-            delayed(register_point_cloud_pair)(
-                ply_file_names, matching_results[r].s, matching_results[r].t,
-                matching_results[r].transformation, config)
-            for r in matching_results)
+        # registration releases the GIL, so threads run pairs concurrently
+        # without pickling the point clouds into worker processes
+        from concurrent.futures import ThreadPoolExecutor
+        from Utility.parallel import thread_pool_size
+        MAX_THREAD = thread_pool_size(len(pose_graph.edges))
+        with ThreadPoolExecutor(max_workers=MAX_THREAD) as executor:
+            results = list(
+                executor.map(
+                    lambda r: register_point_cloud_pair(
+                        ply_file_names, matching_results[r].s,
+                        matching_results[r].t,
+                        matching_results[r].transformation, config),
+                    matching_results))
         for i, r in enumerate(matching_results):
             matching_results[r].transformation = results[i][0]
             matching_results[r].information = results[i][1]
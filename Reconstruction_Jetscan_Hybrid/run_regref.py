@@ -8,6 +8,7 @@ import argparse
 import time, datetime
 import sys
 from Utility.file import check_folder_structure
+from Utility.parallel import limit_omp_threads
 from reconstruction_system.initialize_config import initialize_config
 
 if __name__ == "__main__":
@@ -43,6 +44,10 @@ if __name__ == "__main__":
     else:
         config['debug_mode'] = False
 
+    # before open3d is imported by the registration scripts
+    if config["python_multi_threading"] == True:
+        limit_omp_threads()
+
     print("====================================")
     print("Configuration")
     print("====================================")
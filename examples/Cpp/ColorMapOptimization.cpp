@@ -46,14 +46,14 @@ int main(int argc, char *argv[]) {
     ListFilesInDirectoryWithExtension(data_path + "/image/", "jpg",
                                       color_filenames);
     assert(depth_filenames.size() == color_filenames.size());
+    utility::LogDebug("reading {:d} keyframes...\n", depth_filenames.size());
+    std::vector<geometry::Image> depths, colors;
+    io::ReadImages(depth_filenames, depths);
+    io::ReadImages(color_filenames, colors);
     std::vector<std::shared_ptr<geometry::RGBDImage>> rgbd_images;
     for (size_t i = 0; i < depth_filenames.size(); i++) {
-        utility::LogDebug("reading {}...\n", depth_filenames[i]);
-        auto depth = io::CreateImageFromFile(depth_filenames[i]);
-        utility::LogDebug("reading {}...\n", color_filenames[i]);
-        auto color = io::CreateImageFromFile(color_filenames[i]);
         auto rgbd_image = geometry::RGBDImage::CreateFromColorAndDepth(
-                *color, *depth, 1000.0, 3.0, false);
+                colors[i], depths[i], 1000.0, 3.0, false);
         rgbd_images.push_back(rgbd_image);
     }
     auto camera = io::CreatePinholeCameraTrajectoryFromFile(data_path +
@@ -10,6 +10,7 @@
 #include <iomanip>
 #include <sstream>
 #include <fstream>
+#include <memory>
 
 namespace open3d {
 struct Match {
@@ -27,6 +28,8 @@ class DatasetConfig : public utility::IJsonConvertible {
 public:
     std::string path_dataset_;
     std::string path_intrinsic_;
+    /** RGB-D sequence file holding the frames instead of image folders **/
+    std::string path_sequence_;
 
     bool use_data_association_;
     bool with_opencv_;
@@ -52,6 +55,7 @@ public:
     double tsdf_truncation_;
 
     camera::PinholeCameraIntrinsic intrinsic_;
+    int num_frames_;
     std::vector<std::string> color_files_;
     std::vector<std::string> depth_files_;
     std::vector<std::string> fragment_files_;
@@ -111,6 +115,21 @@ public:
         return true;
     }
 
+    /** Reads the frames from path_sequence_ if set, else the image files **/
+    std::unique_ptr<io::RGBDSequenceReader> CreateRGBDSequenceReader(
+        int num_threads = 2, size_t lookahead = 4,
+        size_t cache_capacity = 16) const {
+        if (!path_sequence_.empty()) {
+            return std::unique_ptr<io::RGBDSequenceReader>(
+                new io::RGBDSequenceReader(path_sequence_, num_threads,
+                                           lookahead, cache_capacity));
+        }
+        return std::unique_ptr<io::RGBDSequenceReader>(
+            new io::RGBDSequenceReader(color_files_, depth_files_,
+                                       num_threads, lookahead,
+                                       cache_capacity));
+    }
+
     bool GetFragmentFiles() {
         std::string fragment_directory = path_dataset_ + "/fragments";
         if (!utility::filesystem::DirectoryExists(fragment_directory)) {
@@ -225,6 +244,7 @@ public:
 
         path_dataset_ = value.get("path_dataset", "").asString();
         path_intrinsic_ = value.get("path_intrinsic", "").asString();
+        path_sequence_ = value.get("path_sequence", "").asString();
         use_data_association_ = value.get("is_tum", false).asBool();
         with_opencv_ = value.get("with_opencv", true).asBool();
 
@@ -266,15 +286,33 @@ public:
             }
         }
 
-        if (!use_data_association_) {
-            GetColorFiles();
-            GetDepthFiles();
+        if (!path_sequence_.empty()) {
+            /** Intrinsic and depth scale default to the recorded ones **/
+            io::RGBDSequenceFileReader sequence;
+            if (!sequence.Open(path_sequence_)) {
+                utility::LogError("Unable to read RGB-D sequence: %s!\n",
+                           path_sequence_.c_str());
+                return false;
+            }
+            if (path_intrinsic_.empty()) {
+                intrinsic_ = sequence.GetIntrinsic();
+            }
+            if (!value.isMember("depth_factor")) {
+                depth_factor_ = sequence.GetDepthScale();
+            }
+            num_frames_ = (int)sequence.NumFrames();
         } else {
-            GetColorAndDepthFilesForTUM();
+            if (!use_data_association_) {
+                GetColorFiles();
+                GetDepthFiles();
+            } else {
+                GetColorAndDepthFilesForTUM();
+            }
+            assert(color_files_.size() == depth_files_.size());
+            num_frames_ = (int)color_files_.size();
         }
 
-        assert(color_files_.size() > 0);
-        assert(color_files_.size() == depth_files_.size());
+        assert(num_frames_ > 0);
 
         return true;
     }
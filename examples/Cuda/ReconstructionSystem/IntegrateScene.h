@@ -19,6 +19,7 @@ using namespace open3d::registration;
 namespace IntegrateScene {
 void IntegrateFragment(int fragment_id,
                        cuda::ScalableTSDFVolumeCuda &volume,
+                       RGBDSequenceReader &reader,
                        DatasetConfig &config) {
     PoseGraph global_pose_graph;
     ReadPoseGraph(config.GetPoseGraphFileForRefinedScene(true),
@@ -34,14 +35,17 @@ void IntegrateFragment(int fragment_id,
 
     const int begin = fragment_id * config.n_frames_per_fragment_;
     const int end = std::min((fragment_id + 1) * config.n_frames_per_fragment_,
-                             (int)config.color_files_.size());
+                             config.num_frames_);
 
     for (int i = begin; i < end; ++i) {
         //LogDebug("Integrating frame {} ...", i);
 
-        geometry::Image depth, color;
-        ReadImage(config.depth_files_[i], depth);
-        ReadImage(config.color_files_[i], color);
+        auto frame = reader.GetFrame(i);
+        if (frame == nullptr) {
+            continue;
+        }
+        geometry::Image depth = frame->depth_;
+        geometry::Image color = frame->color_;
         rgbd.Upload(depth, color);
 
         /* Use ground truth trajectory */
@@ -71,8 +75,11 @@ int Run(DatasetConfig &config) {
         utility::LogError("Unable to get fragment files");
         return -1;
     }
+    /** Decodes the next frames while the current one is integrated **/
+    auto reader_ptr = config.CreateRGBDSequenceReader();
+    RGBDSequenceReader &reader = *reader_ptr;
     for (int i = 0; i < config.fragment_files_.size(); ++i) {
-        IntegrateFragment(i, tsdf_volume, config);
+        IntegrateFragment(i, tsdf_volume, reader, config);
     }
 
     tsdf_volume.GetAllSubvolumes();
@@ -7,6 +7,7 @@
 #include <iomanip>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <Cuda/Open3DCuda.h>
@@ -24,7 +25,24 @@ using namespace open3d::registration;
 using namespace open3d::geometry;
 
 namespace MakeFragment {
-void MakePoseGraphForFragment(int fragment_id, DatasetConfig &config) {
+/** Frames are decoded once by the reader and copied for the upload **/
+void UploadFrame(RGBDSequenceReader &reader,
+                 int index,
+                 cuda::RGBDImageCuda &rgbd) {
+    auto frame = reader.GetFrame(index);
+    if (frame == nullptr) {
+        return;
+    }
+    Image depth = frame->depth_;
+    Image color = frame->color_;
+    rgbd.Upload(depth, color);
+}
+
+/** The pose graphs are passed along in memory, the files serve the viewers
+ * and the stages run on their own **/
+std::shared_ptr<PoseGraph> MakePoseGraphForFragment(int fragment_id,
+                                                    RGBDSequenceReader &reader,
+                                                    DatasetConfig &config) {
     cuda::RGBDOdometryCuda<3> odometry;
     odometry.SetIntrinsics(config.intrinsic_);
     odometry.SetParameters(OdometryOption({20, 10, 5}, config.max_depth_diff_,
@@ -38,11 +56,12 @@ void MakePoseGraphForFragment(int fragment_id, DatasetConfig &config) {
 
     const int begin = fragment_id * config.n_frames_per_fragment_;
     const int end = std::min((fragment_id + 1) * config.n_frames_per_fragment_,
-                             (int)config.color_files_.size());
+                             config.num_frames_);
 
     // world_to_source
     Eigen::Matrix4d trans_odometry = Eigen::Matrix4d::Identity();
-    PoseGraph pose_graph;
+    auto pose_graph_ptr = std::make_shared<PoseGraph>();
+    PoseGraph &pose_graph = *pose_graph_ptr;
     pose_graph.nodes_.emplace_back(PoseGraphNode(trans_odometry));
 
     /** Add odometry and keyframe info **/
@@ -52,17 +71,25 @@ void MakePoseGraphForFragment(int fragment_id, DatasetConfig &config) {
 #endif
 
     for (int s = begin; s < end; ++s) {
-        Image depth, color;
-
-        ReadImage(config.depth_files_[s], depth);
-        ReadImage(config.color_files_[s], color);
-        rgbd_source.Upload(depth, color);
+        UploadFrame(reader, s, rgbd_source);
 
         /** Insert a keyframe **/
 #ifdef USE_OPENCV
-        if (config.with_opencv_ && s % config.n_keyframes_per_n_frame_ == 0) {
-            cv::Mat im = cv::imread(config.color_files_[s]);
-            cv::cvtColor(im, im, cv::COLOR_BGR2GRAY);
+        auto frame = config.with_opencv_ &&
+                     s % config.n_keyframes_per_n_frame_ == 0
+                     ? reader.GetFrame(s) : nullptr;
+        if (frame != nullptr) {
+            /** The cached frame also serves sequence files, no re-read **/
+            const Image &color = frame->color_;
+            cv::Mat color_im(color.height_, color.width_,
+                             color.num_of_channels_ == 3 ? CV_8UC3 : CV_8UC1,
+                             const_cast<uint8_t *>(color.data_.data()));
+            cv::Mat im;
+            if (color.num_of_channels_ == 3) {
+                cv::cvtColor(color_im, im, cv::COLOR_RGB2GRAY);
+            } else {
+                im = color_im.clone();
+            }
             std::vector<cv::KeyPoint> kp;
             cv::Mat desc;
             orb->detectAndCompute(im, cv::noArray(), kp, desc);
@@ -80,9 +107,7 @@ void MakePoseGraphForFragment(int fragment_id, DatasetConfig &config) {
         int t = s + 1;
         if (t >= end) break;
 
-        ReadImage(config.depth_files_[t], depth);
-        ReadImage(config.color_files_[t], color);
-        rgbd_target.Upload(depth, color);
+        UploadFrame(reader, t, rgbd_target);
 
         LogDebug("RGBD Odometry between ({} {})", s, t);
         odometry.transform_source_to_target_ = Eigen::Matrix4d::Identity();
@@ -124,15 +149,8 @@ void MakePoseGraphForFragment(int fragment_id, DatasetConfig &config) {
                     odometry.transform_source_to_target_ =
                             trans_source_to_target;
 
-                    Image depth, color;
-
-                    ReadImage(config.depth_files_[s], depth);
-                    ReadImage(config.color_files_[s], color);
-                    rgbd_source.Upload(depth, color);
-
-                    ReadImage(config.depth_files_[t], depth);
-                    ReadImage(config.color_files_[t], color);
-                    rgbd_target.Upload(depth, color);
+                    UploadFrame(reader, s, rgbd_source);
+                    UploadFrame(reader, t, rgbd_target);
 
                     odometry.Initialize(rgbd_source, rgbd_target);
                     auto result = odometry.ComputeMultiScale();
@@ -154,12 +172,13 @@ void MakePoseGraphForFragment(int fragment_id, DatasetConfig &config) {
 #endif  // USE_OPENCV
     WritePoseGraph(config.GetPoseGraphFileForFragment(fragment_id, false),
                    pose_graph);
+    return pose_graph_ptr;
 }
 
-void OptimizePoseGraphForFragment(int fragment_id, DatasetConfig &config) {
-    PoseGraph pose_graph;
-    ReadPoseGraph(config.GetPoseGraphFileForFragment(fragment_id, false),
-                  pose_graph);
+std::shared_ptr<PoseGraph> OptimizePoseGraphForFragment(
+        int fragment_id, const PoseGraph &pose_graph_odometry,
+        DatasetConfig &config) {
+    PoseGraph pose_graph = pose_graph_odometry;
 
     GlobalOptimizationConvergenceCriteria criteria;
     GlobalOptimizationOption option(config.max_depth_diff_, 0.25,
@@ -173,13 +192,15 @@ void OptimizePoseGraphForFragment(int fragment_id, DatasetConfig &config) {
 
     WritePoseGraph(config.GetPoseGraphFileForFragment(fragment_id, true),
                    *pose_graph_prunned);
+    return pose_graph_prunned;
 }
 
-void IntegrateForFragment(int fragment_id, DatasetConfig &config) {
-    PoseGraph pose_graph;
-    ReadPoseGraph(config.GetPoseGraphFileForFragment(fragment_id, true),
-                  pose_graph);
-
+/** Returns the fragment and its downsampled thumbnail **/
+std::pair<std::shared_ptr<PointCloud>, std::shared_ptr<PointCloud>>
+IntegrateForFragment(int fragment_id,
+                     const PoseGraph &pose_graph,
+                     RGBDSequenceReader &reader,
+                     DatasetConfig &config) {
     float voxel_length = config.tsdf_cubic_size_ / 512.0;
 
     cuda::PinholeCameraIntrinsicCuda intrinsic(config.intrinsic_);
@@ -192,15 +213,12 @@ void IntegrateForFragment(int fragment_id, DatasetConfig &config) {
 
     const int begin = fragment_id * config.n_frames_per_fragment_;
     const int end = std::min((fragment_id + 1) * config.n_frames_per_fragment_,
-                             (int)config.color_files_.size());
+                             config.num_frames_);
 
     for (int i = begin; i < end; ++i) {
         LogDebug("Integrating frame {} ...", i);
 
-        Image depth, color;
-        ReadImage(config.depth_files_[i], depth);
-        ReadImage(config.color_files_[i], color);
-        rgbd.Upload(depth, color);
+        UploadFrame(reader, i, rgbd);
 
         /* Use ground truth trajectory */
         Eigen::Matrix4d pose = pose_graph.nodes_[i - begin].pose_;
@@ -219,18 +237,19 @@ void IntegrateForFragment(int fragment_id, DatasetConfig &config) {
     mesher.MarchingCubes(tsdf_volume);
     auto mesh = mesher.mesh().Download();
 
-    PointCloud pcl;
-    pcl.points_ = mesh->vertices_;
-    pcl.normals_ = mesh->vertex_normals_;
-    pcl.colors_ = mesh->vertex_colors_;
+    auto pcl = std::make_shared<PointCloud>();
+    pcl->points_ = mesh->vertices_;
+    pcl->normals_ = mesh->vertex_normals_;
+    pcl->colors_ = mesh->vertex_colors_;
 
     /** Write original fragments **/
-    WritePointCloudToPLY(config.GetPlyFileForFragment(fragment_id), pcl);
+    WritePointCloudToPLY(config.GetPlyFileForFragment(fragment_id), *pcl);
 
     /** Write downsampled thumbnail fragments **/
-    auto pcl_downsampled = pcl.VoxelDownSample(config.voxel_size_);
+    auto pcl_downsampled = pcl->VoxelDownSample(config.voxel_size_);
     WritePointCloudToPLY(config.GetThumbnailPlyFileForFragment(fragment_id),
                          *pcl_downsampled);
+    return std::make_pair(pcl, pcl_downsampled);
 }
 
 static int Run(DatasetConfig &config) {
@@ -240,14 +259,21 @@ static int Run(DatasetConfig &config) {
     filesystem::MakeDirectoryHierarchy(config.path_dataset_ +
                                        "/fragments/thumbnails");
 
-    const int num_fragments = DIV_CEILING(config.color_files_.size(),
+    const int num_fragments = DIV_CEILING(config.num_frames_,
                                           config.n_frames_per_fragment_);
 
+    /** Keep a whole fragment cached for its integration pass **/
+    const int lookahead = 4;
+    auto reader_ptr = config.CreateRGBDSequenceReader(
+            2, lookahead, config.n_frames_per_fragment_ + lookahead);
+    RGBDSequenceReader &reader = *reader_ptr;
+
     for (int i = 0; i < num_fragments; ++i) {
         LogInfo("Processing fragment {} / {}", i, num_fragments - 1);
-        MakePoseGraphForFragment(i, config);
-        OptimizePoseGraphForFragment(i, config);
-        IntegrateForFragment(i, config);
+        auto pose_graph = MakePoseGraphForFragment(i, reader, config);
+        auto pose_graph_optimized =
+                OptimizePoseGraphForFragment(i, *pose_graph, config);
+        IntegrateForFragment(i, *pose_graph_optimized, reader, config);
     }
     timer.Stop();
     LogInfo("\n");
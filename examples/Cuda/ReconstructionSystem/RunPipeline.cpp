@@ -0,0 +1,318 @@
+//
+// Runs the whole reconstruction system in one process. Fragments are made
+// on the GPU and handed in memory to a registration thread, which matches
+// every finished fragment against the previous ones on the CPU while the
+// next fragments are made. Once all fragments are registered, the scene
+// pose graph is optimized and refined, and the frames are integrated into
+// the scene volume.
+//
+
+#include <memory>
+#include <thread>
+#include <tuple>
+
+#include <Open3D/Registration/FastGlobalRegistration.h>
+
+#include "BoundedQueue.h"
+#include "DatasetConfig.h"
+#include "MakeFragments.h"
+
+using namespace open3d;
+using namespace open3d::geometry;
+using namespace open3d::io;
+using namespace open3d::registration;
+using namespace open3d::utility;
+
+namespace Pipeline {
+
+/** A finished fragment, handed from fragment creation to registration **/
+struct Fragment {
+    int id;
+    std::shared_ptr<PointCloud> cloud;
+    std::shared_ptr<PointCloud> thumbnail;
+    /* frame poses in fragment coordinates */
+    std::shared_ptr<PoseGraph> pose_graph;
+};
+
+PoseGraph MakePoseGraphFromMatches(const std::vector<Match> &matches) {
+    PoseGraph pose_graph;
+
+    /* world_to_frag_0 */
+    Eigen::Matrix4d trans_odometry = Eigen::Matrix4d::Identity();
+    pose_graph.nodes_.emplace_back(PoseGraphNode(trans_odometry));
+
+    for (auto &match : matches) {
+        if (!match.success) continue;
+        if (match.t == match.s + 1) {
+            /* world_to_frag_i */
+            trans_odometry = match.trans_source_to_target * trans_odometry;
+            auto trans_odometry_inv = trans_odometry.inverse();
+
+            pose_graph.nodes_.emplace_back(PoseGraphNode(trans_odometry_inv));
+            pose_graph.edges_.emplace_back(PoseGraphEdge(
+                    match.s, match.t, match.trans_source_to_target,
+                    match.information, false));
+        } else {
+            pose_graph.edges_.emplace_back(PoseGraphEdge(
+                    match.s, match.t, match.trans_source_to_target,
+                    match.information, true));
+        }
+    }
+    return pose_graph;
+}
+
+std::shared_ptr<PoseGraph> OptimizePoseGraphForScene(PoseGraph &pose_graph,
+                                                     DatasetConfig &config) {
+    GlobalOptimizationConvergenceCriteria criteria;
+    GlobalOptimizationOption option(
+            config.voxel_size_ * 1.4, 0.25,
+            config.preference_loop_closure_registration_, 0);
+    GlobalOptimizationLevenbergMarquardt optimization_method;
+    GlobalOptimization(pose_graph, optimization_method, criteria, option);
+
+    return CreatePoseGraphWithoutInvalidEdges(pose_graph, option);
+}
+
+/** Registration stage, runs on the CPU **/
+class FragmentRegistration {
+public:
+    explicit FragmentRegistration(DatasetConfig &config) : config_(config) {}
+
+    /** Matches a new fragment against all fragments before it **/
+    void AddFragment(const std::shared_ptr<Fragment> &fragment) {
+        const double voxel_size = config_.voxel_size_;
+        const int t = (int)fragments_.size();
+        fragments_.push_back(fragment);
+        features_.push_back(ComputeFPFHFeature(
+                *fragment->thumbnail,
+                KDTreeSearchParamHybrid(voxel_size * 5.0, 100)));
+
+        const PointCloud &target = *fragment->thumbnail;
+        for (int s = 0; s < t; ++s) {
+            const PointCloud &source = *fragments_[s]->thumbnail;
+            Match match;
+            match.s = s;
+            match.t = t;
+
+            /** Colored ICP **/
+            if (s == t - 1) {
+                Eigen::Matrix4d init_source_to_target =
+                        fragments_[s]->pose_graph->nodes_.rbegin()
+                                ->pose_.inverse();
+                auto result = RegistrationColoredICP(source, target,
+                                                     voxel_size * 1.4,
+                                                     init_source_to_target);
+                match.trans_source_to_target = result.transformation_;
+                match.information = GetInformationMatrixFromPointClouds(
+                        source, target, voxel_size * 1.4,
+                        result.transformation_);
+                match.success = true;
+                LogInfo("Point cloud odometry ({} {})\n", match.s, match.t);
+            }
+
+            /** Fast global registration **/
+            else {
+                auto result = FastGlobalRegistration(
+                        source, target, *features_[s], *features_[t],
+                        FastGlobalRegistrationOption(1.4, false, true,
+                                                     voxel_size * 0.5));
+                match.trans_source_to_target = result.transformation_;
+                match.information = GetInformationMatrixFromPointClouds(
+                        source, target, voxel_size * 1.4,
+                        result.transformation_);
+                match.success =
+                        match.trans_source_to_target.trace() != 4.0 &&
+                        match.information(5, 5) /
+                                        std::min(source.points_.size(),
+                                                 target.points_.size()) >=
+                                0.3;
+                if (match.success) {
+                    LogInfo("Global registration ({} {}) computed\n", match.s,
+                            match.t);
+                } else {
+                    LogInfo("Skip ({} {}).\n", match.s, match.t);
+                }
+            }
+            matches_.push_back(match);
+        }
+    }
+
+    /** Optimizes the scene pose graph, refines its edges with multi-scale
+     *  colored ICP on the full fragments and optimizes it again **/
+    std::shared_ptr<PoseGraph> ComputeScenePoseGraph() {
+        PoseGraph pose_graph = MakePoseGraphFromMatches(matches_);
+        auto pose_graph_optimized =
+                OptimizePoseGraphForScene(pose_graph, config_);
+        WritePoseGraph(config_.GetPoseGraphFileForScene(true),
+                       *pose_graph_optimized);
+
+        /** Pyramids are built once per fragment, not once per edge **/
+        const double voxel_size = config_.voxel_size_;
+        const std::vector<double> voxel_sizes = {
+                voxel_size, voxel_size / 2.0, voxel_size / 4.0};
+        const std::vector<double> max_distances = {
+                voxel_sizes[0] * 1.4, voxel_sizes[1] * 1.4,
+                voxel_sizes[2] * 1.4};
+        const std::vector<ICPConvergenceCriteria> criteria = {
+                ICPConvergenceCriteria(1e-6, 1e-6, 50),
+                ICPConvergenceCriteria(1e-6, 1e-6, 30),
+                ICPConvergenceCriteria(1e-6, 1e-6, 14)};
+        std::vector<std::shared_ptr<PointCloudPyramid>> pyramids(
+                fragments_.size());
+        auto get_pyramid = [&](int i) {
+            if (pyramids[i] == nullptr) {
+                pyramids[i] = std::make_shared<PointCloudPyramid>(
+                        *fragments_[i]->cloud, voxel_sizes, true);
+            }
+            return pyramids[i];
+        };
+
+        std::vector<Match> refined_matches;
+        for (auto &edge : pose_graph_optimized->edges_) {
+            Match match;
+            match.s = edge.source_node_id_;
+            match.t = edge.target_node_id_;
+            match.success = true;
+
+            auto source = get_pyramid(match.s);
+            auto target = get_pyramid(match.t);
+            auto result = RegistrationMultiScaleICP(
+                    *source, *target, max_distances, criteria,
+                    edge.transformation_,
+                    TransformationEstimationType::ColoredICP);
+            match.trans_source_to_target = result.transformation_;
+            match.information = GetInformationMatrixFromPointClouds(
+                    source->GetPointCloud(voxel_sizes.size() - 1),
+                    target->GetPointCloud(voxel_sizes.size() - 1),
+                    max_distances.back(), result.transformation_);
+            LogInfo("Point cloud odometry ({} {})\n", match.s, match.t);
+            refined_matches.push_back(match);
+        }
+
+        PoseGraph refined_pose_graph =
+                MakePoseGraphFromMatches(refined_matches);
+        auto refined_pose_graph_optimized =
+                OptimizePoseGraphForScene(refined_pose_graph, config_);
+        WritePoseGraph(config_.GetPoseGraphFileForRefinedScene(true),
+                       *refined_pose_graph_optimized);
+        return refined_pose_graph_optimized;
+    }
+
+    const std::vector<std::shared_ptr<Fragment>> &fragments() const {
+        return fragments_;
+    }
+
+private:
+    DatasetConfig &config_;
+    std::vector<std::shared_ptr<Fragment>> fragments_;
+    std::vector<std::shared_ptr<Feature>> features_;
+    std::vector<Match> matches_;
+};
+
+/** Scene integration stage, runs on the GPU **/
+void IntegrateScene(const std::vector<std::shared_ptr<Fragment>> &fragments,
+                    const PoseGraph &scene_pose_graph,
+                    RGBDSequenceReader &reader,
+                    DatasetConfig &config) {
+    cuda::TransformCuda trans = cuda::TransformCuda::Identity();
+    cuda::ScalableTSDFVolumeCuda tsdf_volume(
+            8, (float)config.tsdf_cubic_size_ / 512,
+            (float)config.tsdf_truncation_, trans, config.bucket_count_tsdf_,
+            config.value_cap_tsdf_);
+    cuda::PinholeCameraIntrinsicCuda intrinsics(config.intrinsic_);
+    cuda::RGBDImageCuda rgbd((float)config.max_depth_,
+                             (float)config.depth_factor_);
+
+    for (auto &fragment : fragments) {
+        const int begin = fragment->id * config.n_frames_per_fragment_;
+        const int end = begin + (int)fragment->pose_graph->nodes_.size();
+        for (int i = begin; i < end; ++i) {
+            MakeFragment::UploadFrame(reader, i, rgbd);
+
+            Eigen::Matrix4d pose =
+                    scene_pose_graph.nodes_[fragment->id].pose_ *
+                    fragment->pose_graph->nodes_[i - begin].pose_;
+            trans.FromEigen(pose);
+            tsdf_volume.Integrate(rgbd, intrinsics, trans);
+        }
+    }
+
+    tsdf_volume.GetAllSubvolumes();
+    cuda::ScalableMeshVolumeCuda mesher(
+            cuda::VertexWithNormalAndColor, 8,
+            tsdf_volume.active_subvolume_entry_array_.size(),
+            config.max_vertices_mesh_, config.max_triangle_mesh_);
+    mesher.MarchingCubes(tsdf_volume);
+    auto mesh = mesher.mesh().Download();
+
+    WriteTriangleMeshToPLY(config.GetReconstructedSceneFile(), *mesh);
+}
+
+int Run(DatasetConfig &config) {
+    filesystem::MakeDirectoryHierarchy(config.path_dataset_ +
+                                       "/fragments/thumbnails");
+    filesystem::MakeDirectory(config.path_dataset_ + "/scene");
+
+    const int num_fragments = DIV_CEILING(config.num_frames_,
+                                          config.n_frames_per_fragment_);
+    const int lookahead = 4;
+    auto reader_ptr = config.CreateRGBDSequenceReader(
+            2, lookahead, config.n_frames_per_fragment_ + lookahead);
+    RGBDSequenceReader &reader = *reader_ptr;
+
+    /** Fragment creation blocks when two fragments wait for registration **/
+    BoundedQueue<std::shared_ptr<Fragment>> fragment_queue(2);
+    FragmentRegistration registration(config);
+    std::thread registration_thread([&]() {
+        std::shared_ptr<Fragment> fragment;
+        while (fragment_queue.Pop(fragment)) {
+            registration.AddFragment(fragment);
+        }
+    });
+
+    for (int i = 0; i < num_fragments; ++i) {
+        LogInfo("Processing fragment {} / {}", i, num_fragments - 1);
+        auto fragment = std::make_shared<Fragment>();
+        fragment->id = i;
+        auto pose_graph =
+                MakeFragment::MakePoseGraphForFragment(i, reader, config);
+        fragment->pose_graph = MakeFragment::OptimizePoseGraphForFragment(
+                i, *pose_graph, config);
+        std::tie(fragment->cloud, fragment->thumbnail) =
+                MakeFragment::IntegrateForFragment(i, *fragment->pose_graph,
+                                                   reader, config);
+        fragment_queue.Push(fragment);
+    }
+    fragment_queue.Close();
+    registration_thread.join();
+
+    if (registration.fragments().empty()) {
+        LogError("No fragments to integrate\n");
+        return -1;
+    }
+    auto scene_pose_graph = registration.ComputeScenePoseGraph();
+    IntegrateScene(registration.fragments(), *scene_pose_graph, reader, config);
+    return 0;
+}
+}  // namespace Pipeline
+
+int main(int argc, char **argv) {
+    DatasetConfig config;
+
+    std::string config_path =
+            argc > 1 ? argv[1] : kDefaultDatasetConfigDir + "/intel/config.json";
+
+    bool is_success = ReadIJsonConvertible(config_path, config);
+    if (!is_success) return 1;
+
+    Timer timer;
+    timer.Start();
+    int ret = Pipeline::Run(config);
+    timer.Stop();
+
+    LogInfo("\n");
+    LogInfo("================================");
+    LogInfo("Pipeline takes {} s", timer.GetDuration() * 1e-3);
+    LogInfo("================================");
+    return ret;
+}
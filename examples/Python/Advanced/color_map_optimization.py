@@ -23,11 +23,11 @@ if __name__ == "__main__":
     color_image_path = get_file_list(os.path.join(path, "image/"),
                                      extension=".jpg")
     assert (len(depth_image_path) == len(color_image_path))
+    depths = o3d.io.read_images(depth_image_path)
+    colors = o3d.io.read_images(color_image_path)
     for i in range(len(depth_image_path)):
-        depth = o3d.io.read_image(os.path.join(depth_image_path[i]))
-        color = o3d.io.read_image(os.path.join(color_image_path[i]))
         rgbd_image = o3d.geometry.RGBDImage.create_from_color_and_depth(
-            color, depth, convert_rgb_to_intensity=False)
+            colors[i], depths[i], convert_rgb_to_intensity=False)
         if debug_mode:
             pcd = o3d.geometry.PointCloud.create_from_rgbd_image(
                 rgbd_image,
@@ -93,11 +93,11 @@ def main(config, keys):
 
     # Load images
     rgbd_images = []
+    depths = o3d.io.read_images(depth_files)
+    colors = o3d.io.read_images(color_files)
     for i in range(len(depth_files)):
-        depth = o3d.io.read_image(os.path.join(depth_files[i]))
-        color = o3d.io.read_image(os.path.join(color_files[i]))
         rgbd_image = o3d.geometry.RGBDImage.create_from_color_and_depth(
-            color, depth, convert_rgb_to_intensity=False)
+            colors[i], depths[i], convert_rgb_to_intensity=False)
         rgbd_images.append(rgbd_image)
 
     # Before full optimization, let's just visualize texture map
@@ -42,47 +42,41 @@ def multiscale_icp(source,
                    max_iter,
                    config,
                    init_transformation=np.identity(4)):
-    current_transformation = init_transformation
-    for i, scale in enumerate(range(len(max_iter))):  # multi-scale approach
-        iter = max_iter[scale]
-        distance_threshold = config["voxel_size"] * 1.4
-        print("voxel_size %f" % voxel_size[scale])
-        source_down = source.voxel_down_sample(voxel_size[scale])
-        target_down = target.voxel_down_sample(voxel_size[scale])
+    # the pyramids down-sample and estimate normals once per level, only the
+    # target pyramid keeps its KD-trees for all iterations
+    with_color = config["icp_method"] == "color"
+    source_pyramid = o3d.registration.PointCloudPyramid.create_source(
+        source, voxel_size)
+    target_pyramid = o3d.registration.PointCloudPyramid(
+        target, voxel_size, with_color_gradients=with_color)
+    if with_color:
+        distance_thresholds = voxel_size
+        criteria = [
+            o3d.registration.ICPConvergenceCriteria(relative_fitness=1e-6,
+                                                    relative_rmse=1e-6,
+                                                    max_iteration=iter)
+            for iter in max_iter
+        ]
+        estimation_type = o3d.registration.TransformationEstimationType.ColoredICP
+    else:
+        distance_thresholds = [config["voxel_size"] * 1.4] * len(max_iter)
+        criteria = [
+            o3d.registration.ICPConvergenceCriteria(max_iteration=iter)
+            for iter in max_iter
+        ]
         if config["icp_method"] == "point_to_point":
-            result_icp = o3d.registration.registration_icp(
-                source_down, target_down, distance_threshold,
-                current_transformation,
-                o3d.registration.TransformationEstimationPointToPoint(),
-                o3d.registration.ICPConvergenceCriteria(max_iteration=iter))
+            estimation_type = o3d.registration.TransformationEstimationType.PointToPoint
         else:
-            source_down.estimate_normals(
-                o3d.geometry.KDTreeSearchParamHybrid(radius=voxel_size[scale] *
-                                                     2.0,
-                                                     max_nn=30))
-            target_down.estimate_normals(
-                o3d.geometry.KDTreeSearchParamHybrid(radius=voxel_size[scale] *
-                                                     2.0,
-                                                     max_nn=30))
-            if config["icp_method"] == "point_to_plane":
-                result_icp = o3d.registration.registration_icp(
-                    source_down, target_down, distance_threshold,
-                    current_transformation,
-                    o3d.registration.TransformationEstimationPointToPlane(),
-                    o3d.registration.ICPConvergenceCriteria(max_iteration=iter))
-            if config["icp_method"] == "color":
-                result_icp = o3d.registration.registration_colored_icp(
-                    source_down, target_down, voxel_size[scale],
-                    current_transformation,
-                    o3d.registration.ICPConvergenceCriteria(
-                        relative_fitness=1e-6,
-                        relative_rmse=1e-6,
-                        max_iteration=iter))
-        current_transformation = result_icp.transformation
-        if i == len(max_iter) - 1:
-            information_matrix = o3d.registration.get_information_matrix_from_point_clouds(
-                source_down, target_down, voxel_size[scale] * 1.4,
-                result_icp.transformation)
+            estimation_type = o3d.registration.TransformationEstimationType.PointToPlane
+    result_icp = o3d.registration.registration_multi_scale_icp(
+        source_pyramid, target_pyramid, distance_thresholds, criteria,
+        init_transformation, estimation_type)
+
+    finest = len(max_iter) - 1
+    information_matrix = o3d.registration.get_information_matrix_from_point_clouds(
+        source_pyramid.get_point_cloud(finest),
+        target_pyramid.get_point_cloud(finest), voxel_size[finest] * 1.4,
+        result_icp.transformation)
 
     if config["debug_mode"]:
         draw_registration_result_original_color(source, target,
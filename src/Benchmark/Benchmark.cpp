@@ -0,0 +1,290 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Benchmark/Benchmark.h"
+
+#include <json/json.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <regex>
+#include <thread>
+
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+
+namespace benchmark {
+
+namespace {
+
+using namespace open3d;
+
+double RealTimeInSeconds() {
+    std::chrono::duration<double> time =
+            std::chrono::steady_clock::now().time_since_epoch();
+    return time.count();
+}
+
+/// Processor time of the whole process, so it includes OpenMP workers.
+double CPUTimeInSeconds() { return double(std::clock()) / CLOCKS_PER_SEC; }
+
+const void *volatile escaped_pointer = nullptr;
+
+std::vector<std::unique_ptr<Benchmark>> &GetRegisteredBenchmarks() {
+    static std::vector<std::unique_ptr<Benchmark>> benchmarks;
+    return benchmarks;
+}
+
+struct RunResult {
+    std::string name_;
+    int64_t iterations_;
+    double real_time_ms_;
+    double cpu_time_ms_;
+    double items_per_second_;
+};
+
+/// Repeats the benchmark with more iterations until it runs for at least
+/// min_time seconds, like Google Benchmark does.
+RunResult Run(const Benchmark &benchmark,
+              const std::vector<int64_t> &args,
+              double min_time) {
+    RunResult result;
+    result.name_ = benchmark.name_;
+    for (int64_t arg : args) {
+        result.name_ += "/" + std::to_string(arg);
+    }
+    int64_t iterations = 1;
+    while (true) {
+        State state(args, iterations);
+        benchmark.function_(state);
+        double real_time = state.GetRealTimeInSeconds();
+        if (real_time >= min_time || iterations >= 1000000000) {
+            result.iterations_ = iterations;
+            result.real_time_ms_ = real_time * 1000.0 / iterations;
+            result.cpu_time_ms_ =
+                    state.GetCPUTimeInSeconds() * 1000.0 / iterations;
+            result.items_per_second_ =
+                    real_time > 0.0
+                            ? double(state.GetItemsProcessed()) / real_time
+                            : 0.0;
+            return result;
+        }
+        double multiplier = real_time > 0.0 ? min_time * 1.4 / real_time : 10.0;
+        multiplier = std::min(std::max(multiplier, 2.0), 10.0);
+        iterations = int64_t(double(iterations) * multiplier + 0.5);
+    }
+}
+
+bool WriteResultsToJSON(const std::string &filename,
+                        const std::vector<RunResult> &results) {
+    // same layout as the JSON output of Google Benchmark, so that its
+    // comparison tools can be used for regression tracking
+    Json::Value root;
+    char date[64];
+    std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S",
+                  std::localtime(&now));
+    root["context"]["date"] = date;
+    root["context"]["num_cpus"] = std::thread::hardware_concurrency();
+#ifdef NDEBUG
+    root["context"]["library_build_type"] = "release";
+#else
+    root["context"]["library_build_type"] = "debug";
+#endif
+    Json::Value &benchmarks = root["benchmarks"];
+    benchmarks = Json::Value(Json::arrayValue);
+    for (const auto &result : results) {
+        Json::Value value;
+        value["name"] = result.name_;
+        value["run_name"] = result.name_;
+        value["run_type"] = "iteration";
+        value["iterations"] = Json::Int64(result.iterations_);
+        value["real_time"] = result.real_time_ms_;
+        value["cpu_time"] = result.cpu_time_ms_;
+        value["time_unit"] = "ms";
+        if (result.items_per_second_ > 0.0) {
+            value["items_per_second"] = result.items_per_second_;
+        }
+        benchmarks.append(value);
+    }
+    std::ofstream file(filename);
+    if (!file) {
+        utility::LogWarning("Unable to open {} for writing.\n", filename);
+        return false;
+    }
+    Json::StreamWriterBuilder builder;
+    builder["indentation"] = "  ";
+    std::unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
+    writer->write(root, &file);
+    file << "\n";
+    return bool(file);
+}
+
+void PrintHelp() {
+    // clang-format off
+    utility::LogInfo("Usage:\n");
+    utility::LogInfo("    > benchmarks [options]\n");
+    utility::LogInfo("      Time the core Open3D kernels on deterministic synthetic data.\n");
+    utility::LogInfo("\n");
+    utility::LogInfo("Options:\n");
+    utility::LogInfo("    --help, -h                : Print help information.\n");
+    utility::LogInfo("    --list                    : List the benchmarks and exit.\n");
+    utility::LogInfo("    --filter regex            : Only run benchmarks whose name matches.\n");
+    utility::LogInfo("    --min_time s              : Minimum time per benchmark (default 0.5).\n");
+    utility::LogInfo("    --out file.json           : Also write the results as JSON.\n");
+    // clang-format on
+}
+
+}  // unnamed namespace
+
+State::State(const std::vector<int64_t> &args, int64_t max_iterations)
+    : args_(args),
+      max_iterations_(max_iterations),
+      iterations_(0),
+      running_(false),
+      real_start_(0.0),
+      cpu_start_(0.0),
+      real_time_(0.0),
+      cpu_time_(0.0),
+      items_processed_(0) {}
+
+bool State::KeepRunning() {
+    if (iterations_ == 0) {
+        ResumeTiming();
+    }
+    if (iterations_ < max_iterations_) {
+        iterations_++;
+        return true;
+    }
+    if (running_) {
+        PauseTiming();
+    }
+    return false;
+}
+
+void State::PauseTiming() {
+    real_time_ += RealTimeInSeconds() - real_start_;
+    cpu_time_ += CPUTimeInSeconds() - cpu_start_;
+    running_ = false;
+}
+
+void State::ResumeTiming() {
+    running_ = true;
+    cpu_start_ = CPUTimeInSeconds();
+    real_start_ = RealTimeInSeconds();
+}
+
+Benchmark::Benchmark(const std::string &name, BenchmarkFunction function)
+    : name_(name), function_(function) {}
+
+Benchmark *Benchmark::Arg(int64_t arg) {
+    args_.push_back(std::vector<int64_t>(1, arg));
+    return this;
+}
+
+Benchmark *Benchmark::Args(const std::vector<int64_t> &args) {
+    args_.push_back(args);
+    return this;
+}
+
+void EscapePointer(const void *pointer) { escaped_pointer = pointer; }
+
+std::string GetTempFilePath(const std::string &file_name) {
+    static const std::string prefix = []() {
+        std::string root = "/tmp";
+        for (const char *variable : {"TMPDIR", "TMP", "TEMP"}) {
+            const char *value = std::getenv(variable);
+            if (value != nullptr && value[0] != '\0') {
+                root = value;
+                break;
+            }
+        }
+        std::random_device random_device;
+        return open3d::utility::filesystem::GetRegularizedDirectoryName(
+                       root) +
+               "open3d_benchmark_" + std::to_string(random_device()) + "_";
+    }();
+    return prefix + file_name;
+}
+
+Benchmark *RegisterBenchmark(const std::string &name,
+                             BenchmarkFunction function) {
+    GetRegisteredBenchmarks().emplace_back(new Benchmark(name, function));
+    return GetRegisteredBenchmarks().back().get();
+}
+
+int RunBenchmarks(int argc, char **argv) {
+    if (utility::ProgramOptionExistsAny(argc, argv, {"-h", "--help"})) {
+        PrintHelp();
+        return 0;
+    }
+    std::regex filter(utility::GetProgramOptionAsString(argc, argv,
+                                                        "--filter", ".*"));
+    double min_time =
+            utility::GetProgramOptionAsDouble(argc, argv, "--min_time", 0.5);
+    std::string out = utility::GetProgramOptionAsString(argc, argv, "--out");
+    bool list_only = utility::ProgramOptionExists(argc, argv, "--list");
+
+    std::vector<RunResult> results;
+    if (!list_only) {
+        utility::LogInfo("{:<48} {:>12} {:>12} {:>12}\n", "Benchmark",
+                         "Time (ms)", "CPU (ms)", "Iterations");
+    }
+    for (const auto &benchmark : GetRegisteredBenchmarks()) {
+        std::vector<std::vector<int64_t>> arg_lists = benchmark->args_;
+        if (arg_lists.empty()) {
+            arg_lists.push_back(std::vector<int64_t>());
+        }
+        for (const auto &args : arg_lists) {
+            std::string name = benchmark->name_;
+            for (int64_t arg : args) {
+                name += "/" + std::to_string(arg);
+            }
+            if (!std::regex_search(name, filter)) {
+                continue;
+            }
+            if (list_only) {
+                utility::LogInfo("{}\n", name);
+                continue;
+            }
+            RunResult result = Run(*benchmark, args, min_time);
+            utility::LogInfo("{:<48} {:>12.3f} {:>12.3f} {:>12d}\n",
+                             result.name_, result.real_time_ms_,
+                             result.cpu_time_ms_, result.iterations_);
+            results.push_back(result);
+        }
+    }
+    if (!out.empty() && !WriteResultsToJSON(out, results)) {
+        return 1;
+    }
+    return 0;
+}
+
+}  // namespace benchmark
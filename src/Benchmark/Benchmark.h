@@ -0,0 +1,132 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+/// Controls the timed loop of one benchmark run, in the spirit of Google
+/// Benchmark:
+///
+///     void ComputeSomething(benchmark::State &state) {
+///         auto input = CreateInput(state.Arg(0));
+///         while (state.KeepRunning()) {
+///             Compute(*input);
+///         }
+///     }
+///     OPEN3D_BENCHMARK(ComputeSomething)->Arg(1000)->Arg(100000);
+///
+/// Only the loop is timed, setup before it is not.
+class State {
+public:
+    State(const std::vector<int64_t> &args, int64_t max_iterations);
+
+public:
+    /// Returns true until the requested number of iterations has run.
+    bool KeepRunning();
+
+    /// Excludes per-iteration setup from the measured time.
+    void PauseTiming();
+    void ResumeTiming();
+
+    int64_t Arg(size_t index) const { return args_[index]; }
+    int64_t Iterations() const { return max_iterations_; }
+
+    /// Reports a throughput of \param items per run of the whole loop.
+    void SetItemsProcessed(int64_t items) { items_processed_ = items; }
+
+    double GetRealTimeInSeconds() const { return real_time_; }
+    double GetCPUTimeInSeconds() const { return cpu_time_; }
+    int64_t GetItemsProcessed() const { return items_processed_; }
+
+private:
+    std::vector<int64_t> args_;
+    int64_t max_iterations_;
+    int64_t iterations_;
+    bool running_;
+    double real_start_;
+    double cpu_start_;
+    double real_time_;
+    double cpu_time_;
+    int64_t items_processed_;
+};
+
+typedef std::function<void(State &)> BenchmarkFunction;
+
+/// A registered benchmark, run once for every argument list.
+class Benchmark {
+public:
+    Benchmark(const std::string &name, BenchmarkFunction function);
+
+public:
+    /// Adds a run with the single argument \param arg.
+    Benchmark *Arg(int64_t arg);
+    /// Adds a run with the arguments \param args.
+    Benchmark *Args(const std::vector<int64_t> &args);
+
+public:
+    std::string name_;
+    BenchmarkFunction function_;
+    std::vector<std::vector<int64_t>> args_;
+};
+
+Benchmark *RegisterBenchmark(const std::string &name,
+                             BenchmarkFunction function);
+
+/// Runs the registered benchmarks selected by the command line options and
+/// returns the process exit code.
+int RunBenchmarks(int argc, char **argv);
+
+/// Returns a path for the file \p file_name in the temporary directory of
+/// the system, unique to this process. Benchmarks remove their files.
+std::string GetTempFilePath(const std::string &file_name);
+
+/// Stores \p pointer where the compiler can not see it, so the object it
+/// points to has to be computed.
+void EscapePointer(const void *pointer);
+
+/// Prevents the compiler from optimizing away the computation of \p value.
+template <typename T>
+void DoNotOptimize(const T &value) {
+    EscapePointer(&value);
+}
+
+}  // namespace benchmark
+
+#define OPEN3D_BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define OPEN3D_BENCHMARK_CONCAT(a, b) OPEN3D_BENCHMARK_CONCAT_IMPL(a, b)
+
+/// Registers the function \p function as a benchmark, returning a
+/// benchmark::Benchmark * to add arguments to.
+#define OPEN3D_BENCHMARK(function)                                     \
+    static benchmark::Benchmark *OPEN3D_BENCHMARK_CONCAT(              \
+            registered_benchmark_, __LINE__) =                         \
+            benchmark::RegisterBenchmark(#function, function)
@@ -0,0 +1,68 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Benchmark/Benchmark.h"
+
+#include <random>
+#include <vector>
+
+#include "Open3D/Geometry/FastEigen3x3.h"
+
+using namespace open3d;
+
+namespace {
+
+/// Solves 1000 blocks of random covariances with the kernel in the argument,
+/// see geometry::FastEigen3x3Kernel.
+void FastEigen3x3Block(benchmark::State &state) {
+    const auto kernel = geometry::FastEigen3x3Kernel(state.Arg(0));
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    std::vector<geometry::SymmetricMatrix3dBlock> blocks(1000);
+    for (auto &block : blocks) {
+        for (int l = 0; l < geometry::kSymmetricMatrix3dBlockSize; l++) {
+            Eigen::Matrix3d M;
+            M << uniform(rng), uniform(rng), uniform(rng), uniform(rng),
+                    uniform(rng), uniform(rng), uniform(rng), uniform(rng),
+                    uniform(rng);
+            block.Set(l, M * M.transpose());
+        }
+    }
+    Eigen::Vector3d eigenvectors[geometry::kSymmetricMatrix3dBlockSize];
+    while (state.KeepRunning()) {
+        for (const auto &block : blocks) {
+            geometry::FastEigen3x3(block, geometry::kSymmetricMatrix3dBlockSize,
+                                   eigenvectors, kernel);
+            benchmark::DoNotOptimize(eigenvectors);
+        }
+    }
+    state.SetItemsProcessed(state.Iterations() * blocks.size() *
+                            geometry::kSymmetricMatrix3dBlockSize);
+}
+
+}  // unnamed namespace
+
+OPEN3D_BENCHMARK(FastEigen3x3Block)->Arg(0)->Arg(1)->Arg(2);
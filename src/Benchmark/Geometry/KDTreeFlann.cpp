@@ -0,0 +1,88 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Benchmark/Benchmark.h"
+#include "Benchmark/SyntheticData.h"
+
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/PointCloud.h"
+
+using namespace open3d;
+
+namespace {
+
+void KDTreeFlannBuild(benchmark::State &state) {
+    auto cloud = benchmark::CreateSyntheticPointCloud(size_t(state.Arg(0)));
+    while (state.KeepRunning()) {
+        geometry::KDTreeFlann kdtree(*cloud);
+        benchmark::DoNotOptimize(kdtree);
+    }
+    state.SetItemsProcessed(state.Iterations() * state.Arg(0));
+}
+
+/// Queries the neighbours of 10000 cloud points.
+void KDTreeFlannSearchKNN(benchmark::State &state) {
+    auto cloud = benchmark::CreateSyntheticPointCloud(size_t(state.Arg(0)));
+    geometry::KDTreeFlann kdtree(*cloud);
+    const int knn = int(state.Arg(1));
+    const size_t num_queries = 10000;
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    while (state.KeepRunning()) {
+        for (size_t i = 0; i < num_queries; i++) {
+            kdtree.SearchKNN(cloud->points_[i], knn, indices, distance2);
+        }
+        benchmark::DoNotOptimize(indices);
+    }
+    state.SetItemsProcessed(state.Iterations() * num_queries);
+}
+
+void KDTreeFlannSearchRadius(benchmark::State &state) {
+    auto cloud = benchmark::CreateSyntheticPointCloud(size_t(state.Arg(0)));
+    geometry::KDTreeFlann kdtree(*cloud);
+    const double radius = double(state.Arg(1)) / 1000.0;
+    const size_t num_queries = 10000;
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    while (state.KeepRunning()) {
+        for (size_t i = 0; i < num_queries; i++) {
+            kdtree.SearchRadius(cloud->points_[i], radius, indices, distance2);
+        }
+        benchmark::DoNotOptimize(indices);
+    }
+    state.SetItemsProcessed(state.Iterations() * num_queries);
+}
+
+}  // unnamed namespace
+
+OPEN3D_BENCHMARK(KDTreeFlannBuild)->Arg(100000)->Arg(1000000);
+OPEN3D_BENCHMARK(KDTreeFlannSearchKNN)
+        ->Args({100000, 1})
+        ->Args({100000, 30});
+// second argument is the radius in millimeters
+OPEN3D_BENCHMARK(KDTreeFlannSearchRadius)
+        ->Args({100000, 10})
+        ->Args({100000, 30});
@@ -0,0 +1,60 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Benchmark/Benchmark.h"
+#include "Benchmark/SyntheticData.h"
+
+#include "Open3D/Geometry/KDTreeSearchParam.h"
+#include "Open3D/Geometry/PointCloud.h"
+
+using namespace open3d;
+
+namespace {
+
+void VoxelDownSample(benchmark::State &state) {
+    auto cloud = benchmark::CreateSyntheticPointCloud(size_t(state.Arg(0)));
+    while (state.KeepRunning()) {
+        auto down_sampled = cloud->VoxelDownSample(0.01);
+        benchmark::DoNotOptimize(down_sampled);
+    }
+    state.SetItemsProcessed(state.Iterations() * state.Arg(0));
+}
+
+void EstimateNormals(benchmark::State &state) {
+    auto cloud = benchmark::CreateSyntheticPointCloud(size_t(state.Arg(0)));
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        cloud->normals_.clear();
+        state.ResumeTiming();
+        cloud->EstimateNormals(geometry::KDTreeSearchParamKNN(30));
+    }
+    state.SetItemsProcessed(state.Iterations() * state.Arg(0));
+}
+
+}  // unnamed namespace
+
+OPEN3D_BENCHMARK(VoxelDownSample)->Arg(100000)->Arg(1000000);
+OPEN3D_BENCHMARK(EstimateNormals)->Arg(10000)->Arg(100000);
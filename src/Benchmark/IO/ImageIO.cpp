@@ -0,0 +1,124 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Benchmark/Benchmark.h"
+
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/Utility/FileSystem.h"
+
+using namespace open3d;
+
+namespace {
+
+/// The 16 bit depth frames of the test data, from several sensors.
+std::vector<geometry::Image> ReadDepthFrames() {
+    const std::vector<std::string> names = {
+            "/RGBD/depth/00000.png",        "/RGBD/depth/00001.png",
+            "/RGBD/depth/00002.png",        "/RGBD/depth/00003.png",
+            "/RGBD/depth/00004.png",        "/RGBD/depth/apt-022640.png",
+            "/RGBD/depth/lounge-00966.png", "/RGBD/other_formats/TUM_depth.png",
+            "/RGBD/other_formats/SUN_depth.png"};
+    std::vector<geometry::Image> depths(names.size());
+    for (size_t i = 0; i < names.size(); i++) {
+        io::ReadImage(std::string(TEST_DATA_DIR) + names[i], depths[i]);
+    }
+    return depths;
+}
+
+/// Arg(0) selects the format: 0 for PNG, 1 for D16.
+std::string GetFileName(const benchmark::State &state, size_t index) {
+    return benchmark::GetTempFilePath("depth_" + std::to_string(index) +
+                                      (state.Arg(0) == 0 ? ".png" : ".d16"));
+}
+
+int64_t CountPixels(const std::vector<geometry::Image> &depths) {
+    int64_t num_pixels = 0;
+    for (const auto &depth : depths) {
+        num_pixels += int64_t(depth.width_) * int64_t(depth.height_);
+    }
+    return num_pixels;
+}
+
+void WriteDepthImage(benchmark::State &state) {
+    const auto depths = ReadDepthFrames();
+    while (state.KeepRunning()) {
+        for (size_t i = 0; i < depths.size(); i++) {
+            io::WriteImage(GetFileName(state, i), depths[i]);
+        }
+    }
+    for (size_t i = 0; i < depths.size(); i++) {
+        utility::filesystem::RemoveFile(GetFileName(state, i));
+    }
+    state.SetItemsProcessed(state.Iterations() * CountPixels(depths));
+}
+
+void ReadDepthImage(benchmark::State &state) {
+    const auto depths = ReadDepthFrames();
+    for (size_t i = 0; i < depths.size(); i++) {
+        io::WriteImage(GetFileName(state, i), depths[i]);
+    }
+    geometry::Image depth;
+    while (state.KeepRunning()) {
+        for (size_t i = 0; i < depths.size(); i++) {
+            io::ReadImage(GetFileName(state, i), depth);
+        }
+    }
+    for (size_t i = 0; i < depths.size(); i++) {
+        utility::filesystem::RemoveFile(GetFileName(state, i));
+    }
+    state.SetItemsProcessed(state.Iterations() * CountPixels(depths));
+}
+
+/// Arg(0) selects the reader: 0 reads the color frames one by one with
+/// ReadImage, 1 reads them as a batch with ReadImages and 2 reads them as a
+/// batch of fast decoded previews at a quarter of the size.
+void ReadColorImages(benchmark::State &state) {
+    std::vector<std::string> filenames;
+    for (int i = 0; i < 5; i++) {
+        filenames.push_back(std::string(TEST_DATA_DIR) + "/RGBD/color/0000" +
+                            std::to_string(i) + ".jpg");
+    }
+    std::vector<geometry::Image> colors(filenames.size());
+    while (state.KeepRunning()) {
+        if (state.Arg(0) == 0) {
+            for (size_t i = 0; i < filenames.size(); i++) {
+                io::ReadImage(filenames[i], colors[i]);
+            }
+        } else if (state.Arg(0) == 1) {
+            io::ReadImages(filenames, colors);
+        } else {
+            io::ReadImages(filenames, colors, 4, true);
+        }
+    }
+    state.SetItemsProcessed(state.Iterations() * int64_t(filenames.size()));
+}
+
+}  // unnamed namespace
+
+OPEN3D_BENCHMARK(WriteDepthImage)->Arg(0)->Arg(1);
+OPEN3D_BENCHMARK(ReadDepthImage)->Arg(0)->Arg(1);
+OPEN3D_BENCHMARK(ReadColorImages)->Arg(0)->Arg(1)->Arg(2);
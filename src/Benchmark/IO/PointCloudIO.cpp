@@ -0,0 +1,82 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Benchmark/Benchmark.h"
+#include "Benchmark/SyntheticData.h"
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/Utility/FileSystem.h"
+
+using namespace open3d;
+
+namespace {
+
+/// Arg(0) selects the format: 0 for PLY, 1 for PCD. Arg(1) is 1 for ascii
+/// files.
+std::string GetFileName(const benchmark::State &state) {
+    return benchmark::GetTempFilePath(state.Arg(0) == 0 ? "point_cloud.ply"
+                                                        : "point_cloud.pcd");
+}
+
+void WritePointCloud(benchmark::State &state) {
+    auto cloud = benchmark::CreateSyntheticPointCloud(200000);
+    cloud->EstimateNormals();
+    const std::string filename = GetFileName(state);
+    while (state.KeepRunning()) {
+        io::WritePointCloud(filename, *cloud, state.Arg(1) != 0);
+    }
+    utility::filesystem::RemoveFile(filename);
+    state.SetItemsProcessed(state.Iterations() *
+                            int64_t(cloud->points_.size()));
+}
+
+void ReadPointCloud(benchmark::State &state) {
+    auto cloud = benchmark::CreateSyntheticPointCloud(200000);
+    cloud->EstimateNormals();
+    const std::string filename = GetFileName(state);
+    io::WritePointCloud(filename, *cloud, state.Arg(1) != 0);
+    geometry::PointCloud read_cloud;
+    while (state.KeepRunning()) {
+        io::ReadPointCloud(filename, read_cloud);
+    }
+    utility::filesystem::RemoveFile(filename);
+    state.SetItemsProcessed(state.Iterations() *
+                            int64_t(cloud->points_.size()));
+}
+
+}  // unnamed namespace
+
+OPEN3D_BENCHMARK(WritePointCloud)
+        ->Args({0, 0})
+        ->Args({0, 1})
+        ->Args({1, 0})
+        ->Args({1, 1});
+OPEN3D_BENCHMARK(ReadPointCloud)
+        ->Args({0, 0})
+        ->Args({0, 1})
+        ->Args({1, 0})
+        ->Args({1, 1});
@@ -0,0 +1,71 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Benchmark/Benchmark.h"
+#include "Benchmark/SyntheticData.h"
+
+#include "Open3D/IO/ClassIO/PoseGraphIO.h"
+#include "Open3D/Utility/FileSystem.h"
+
+using namespace open3d;
+
+namespace {
+
+/// Arg(0) selects the format: 0 for JSON, 1 for BIN. Arg(1) is the number
+/// of nodes, with a loop closure to every second node.
+std::string GetPoseGraphFileName(const benchmark::State &state) {
+    return benchmark::GetTempFilePath(state.Arg(0) == 0 ? "pose_graph.json"
+                                                        : "pose_graph.bin");
+}
+
+void WritePoseGraph(benchmark::State &state) {
+    auto pose_graph = benchmark::CreateSyntheticPoseGraph(int(state.Arg(1)), 2);
+    const std::string file_name = GetPoseGraphFileName(state);
+    while (state.KeepRunning()) {
+        io::WritePoseGraph(file_name, *pose_graph);
+    }
+    utility::filesystem::RemoveFile(file_name);
+    state.SetItemsProcessed(state.Iterations() *
+                            int64_t(pose_graph->edges_.size()));
+}
+
+void ReadPoseGraph(benchmark::State &state) {
+    auto pose_graph = benchmark::CreateSyntheticPoseGraph(int(state.Arg(1)), 2);
+    const std::string file_name = GetPoseGraphFileName(state);
+    io::WritePoseGraph(file_name, *pose_graph);
+    registration::PoseGraph pose_graph_read;
+    while (state.KeepRunning()) {
+        io::ReadPoseGraph(file_name, pose_graph_read);
+    }
+    utility::filesystem::RemoveFile(file_name);
+    state.SetItemsProcessed(state.Iterations() *
+                            int64_t(pose_graph->edges_.size()));
+}
+
+}  // unnamed namespace
+
+OPEN3D_BENCHMARK(WritePoseGraph)->Args({0, 10000})->Args({1, 10000});
+OPEN3D_BENCHMARK(ReadPoseGraph)->Args({0, 10000})->Args({1, 10000});
@@ -0,0 +1,129 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Benchmark/Benchmark.h"
+#include "Benchmark/SyntheticData.h"
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Integration/ScalableTSDFVolume.h"
+
+using namespace open3d;
+
+namespace {
+
+/// Synthetic VGA frames of a camera sweeping sideways over the scene.
+struct IntegrationInput {
+    explicit IntegrationInput(int num_frames)
+        : intrinsic_(camera::PinholeCameraIntrinsicParameters::
+                             PrimeSenseDefault) {
+        for (int i = 0; i < num_frames; i++) {
+            Eigen::Matrix4d camera_to_world =
+                    benchmark::CreateSyntheticMotion(0.5 * i, 0.01 * i);
+            geometry::Image color, depth;
+            benchmark::CreateSyntheticFrame(intrinsic_, camera_to_world, color,
+                                            depth);
+            images_.push_back(geometry::RGBDImage::CreateFromColorAndDepth(
+                    color, depth, 1000.0, 4.0, false));
+            extrinsics_.push_back(camera_to_world.inverse());
+        }
+    }
+
+    void Integrate(integration::ScalableTSDFVolume &volume) const {
+        for (size_t i = 0; i < images_.size(); i++) {
+            volume.Integrate(*images_[i], intrinsic_, extrinsics_[i]);
+        }
+    }
+
+    camera::PinholeCameraIntrinsic intrinsic_;
+    std::vector<std::shared_ptr<geometry::RGBDImage>> images_;
+    std::vector<Eigen::Matrix4d> extrinsics_;
+};
+
+/// Integrates 10 frames into a volume with voxel_length of Arg(0) mm.
+void ScalableTSDFVolumeIntegrate(benchmark::State &state) {
+    IntegrationInput input(10);
+    const double voxel_length = double(state.Arg(0)) / 1000.0;
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        integration::ScalableTSDFVolume volume(
+                voxel_length, voxel_length * 5.0,
+                integration::TSDFVolumeColorType::RGB8);
+        state.ResumeTiming();
+        input.Integrate(volume);
+    }
+    state.SetItemsProcessed(state.Iterations() * 10);
+}
+
+void ScalableTSDFVolumeExtractTriangleMesh(benchmark::State &state) {
+    IntegrationInput input(10);
+    const double voxel_length = double(state.Arg(0)) / 1000.0;
+    integration::ScalableTSDFVolume volume(
+            voxel_length, voxel_length * 5.0,
+            integration::TSDFVolumeColorType::RGB8);
+    input.Integrate(volume);
+    while (state.KeepRunning()) {
+        auto mesh = volume.ExtractTriangleMesh();
+        benchmark::DoNotOptimize(mesh);
+    }
+}
+
+void ScalableTSDFVolumeExtractPointCloud(benchmark::State &state) {
+    IntegrationInput input(10);
+    const double voxel_length = double(state.Arg(0)) / 1000.0;
+    integration::ScalableTSDFVolume volume(
+            voxel_length, voxel_length * 5.0,
+            integration::TSDFVolumeColorType::RGB8);
+    input.Integrate(volume);
+    while (state.KeepRunning()) {
+        auto cloud = volume.ExtractPointCloud();
+        benchmark::DoNotOptimize(cloud);
+    }
+}
+
+/// Renders the volume from the pose of the last frame.
+void ScalableTSDFVolumeRayCast(benchmark::State &state) {
+    IntegrationInput input(10);
+    const double voxel_length = double(state.Arg(0)) / 1000.0;
+    integration::ScalableTSDFVolume volume(
+            voxel_length, voxel_length * 5.0,
+            integration::TSDFVolumeColorType::RGB8);
+    input.Integrate(volume);
+    while (state.KeepRunning()) {
+        auto rendering =
+                volume.RayCast(input.intrinsic_, input.extrinsics_.back(), 4.0);
+        benchmark::DoNotOptimize(rendering);
+    }
+    state.SetItemsProcessed(state.Iterations());
+}
+
+}  // unnamed namespace
+
+OPEN3D_BENCHMARK(ScalableTSDFVolumeIntegrate)->Arg(10)->Arg(5);
+OPEN3D_BENCHMARK(ScalableTSDFVolumeExtractTriangleMesh)->Arg(10)->Arg(5);
+OPEN3D_BENCHMARK(ScalableTSDFVolumeExtractPointCloud)->Arg(10)->Arg(5);
+OPEN3D_BENCHMARK(ScalableTSDFVolumeRayCast)->Arg(10)->Arg(5);
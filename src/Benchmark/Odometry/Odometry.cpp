@@ -0,0 +1,97 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Benchmark/Benchmark.h"
+#include "Benchmark/SyntheticData.h"
+
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/Odometry/Odometry.h"
+
+using namespace open3d;
+
+namespace {
+
+/// Two synthetic VGA frames a small camera motion apart.
+struct OdometryInput {
+    OdometryInput()
+        : intrinsic_(camera::PinholeCameraIntrinsicParameters::
+                             PrimeSenseDefault) {
+        source_ = CreateRGBDImage(Eigen::Matrix4d::Identity());
+        target_ = CreateRGBDImage(benchmark::CreateSyntheticMotion(1.0, 0.02));
+    }
+
+    std::shared_ptr<geometry::RGBDImage> CreateRGBDImage(
+            const Eigen::Matrix4d &camera_to_world) const {
+        geometry::Image color, depth;
+        benchmark::CreateSyntheticFrame(intrinsic_, camera_to_world, color,
+                                        depth);
+        return geometry::RGBDImage::CreateFromColorAndDepth(color, depth,
+                                                            1000.0, 4.0);
+    }
+
+    camera::PinholeCameraIntrinsic intrinsic_;
+    std::shared_ptr<geometry::RGBDImage> source_;
+    std::shared_ptr<geometry::RGBDImage> target_;
+};
+
+void ComputeRGBDOdometryColorTerm(benchmark::State &state) {
+    OdometryInput input;
+    while (state.KeepRunning()) {
+        auto result = odometry::ComputeRGBDOdometry(
+                *input.source_, *input.target_, input.intrinsic_,
+                Eigen::Matrix4d::Identity(),
+                odometry::RGBDOdometryJacobianFromColorTerm());
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+void ComputeRGBDOdometryHybridTerm(benchmark::State &state) {
+    OdometryInput input;
+    while (state.KeepRunning()) {
+        auto result = odometry::ComputeRGBDOdometry(
+                *input.source_, *input.target_, input.intrinsic_,
+                Eigen::Matrix4d::Identity(),
+                odometry::RGBDOdometryJacobianFromHybridTerm());
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+void CreateRGBDImagePyramid(benchmark::State &state) {
+    OdometryInput input;
+    geometry::RGBDImagePyramid pyramid, pyramid_dx;
+    while (state.KeepRunning()) {
+        input.source_->CreatePyramid(4, true, false, pyramid);
+        geometry::RGBDImage::FilterPyramid(
+                pyramid, geometry::Image::FilterType::Sobel3Dx, pyramid_dx);
+        benchmark::DoNotOptimize(pyramid_dx);
+    }
+}
+
+}  // unnamed namespace
+
+OPEN3D_BENCHMARK(CreateRGBDImagePyramid);
+OPEN3D_BENCHMARK(ComputeRGBDOdometryColorTerm);
+OPEN3D_BENCHMARK(ComputeRGBDOdometryHybridTerm);
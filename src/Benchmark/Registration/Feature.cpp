@@ -0,0 +1,53 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Benchmark/Benchmark.h"
+#include "Benchmark/SyntheticData.h"
+
+#include "Open3D/Geometry/KDTreeSearchParam.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/Feature.h"
+
+using namespace open3d;
+
+namespace {
+
+void ComputeFPFHFeature(benchmark::State &state) {
+    auto cloud = benchmark::CreateSyntheticPointCloud(size_t(state.Arg(0)));
+    auto down_sampled = cloud->VoxelDownSample(0.02);
+    down_sampled->EstimateNormals(geometry::KDTreeSearchParamHybrid(0.04, 30));
+    while (state.KeepRunning()) {
+        auto feature = registration::ComputeFPFHFeature(
+                *down_sampled, geometry::KDTreeSearchParamHybrid(0.1, 100));
+        benchmark::DoNotOptimize(feature);
+    }
+    state.SetItemsProcessed(state.Iterations() *
+                            int64_t(down_sampled->points_.size()));
+}
+
+}  // unnamed namespace
+
+OPEN3D_BENCHMARK(ComputeFPFHFeature)->Arg(100000);
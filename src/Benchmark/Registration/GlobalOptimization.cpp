@@ -0,0 +1,53 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Benchmark/Benchmark.h"
+#include "Benchmark/SyntheticData.h"
+
+#include "Open3D/Registration/GlobalOptimization.h"
+
+using namespace open3d;
+
+namespace {
+
+void GlobalOptimization(benchmark::State &state) {
+    auto pose_graph = benchmark::CreateSyntheticPoseGraph(int(state.Arg(0)), 5);
+    registration::GlobalOptimizationOption option(0.05, 0.25, 0.1, 0);
+    while (state.KeepRunning()) {
+        // optimization works in place, so every run starts from a copy
+        state.PauseTiming();
+        registration::PoseGraph copy = *pose_graph;
+        state.ResumeTiming();
+        registration::GlobalOptimization(
+                copy, registration::GlobalOptimizationLevenbergMarquardt(),
+                registration::GlobalOptimizationConvergenceCriteria(), option);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+
+}  // unnamed namespace
+
+OPEN3D_BENCHMARK(GlobalOptimization)->Arg(100)->Arg(500);
@@ -0,0 +1,113 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Benchmark/Benchmark.h"
+#include "Benchmark/SyntheticData.h"
+
+#include "Open3D/Geometry/KDTreeSearchParam.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/ColoredICP.h"
+#include "Open3D/Registration/MultiScaleICP.h"
+#include "Open3D/Registration/Registration.h"
+#include "Open3D/Registration/TransformationEstimation.h"
+
+using namespace open3d;
+
+namespace {
+
+/// Source and target clouds of the same surface, sampled independently and
+/// offset by a small motion that ICP recovers in a few dozen iterations.
+struct RegistrationInput {
+    explicit RegistrationInput(size_t num_points)
+        : source_(benchmark::CreateSyntheticPointCloud(num_points, 1)),
+          target_(benchmark::CreateSyntheticPointCloud(num_points, 2)),
+          init_(benchmark::CreateSyntheticMotion(3.0, 0.03)) {
+        source_->EstimateNormals(geometry::KDTreeSearchParamHybrid(0.05, 30));
+        target_->EstimateNormals(geometry::KDTreeSearchParamHybrid(0.05, 30));
+    }
+
+    std::shared_ptr<geometry::PointCloud> source_;
+    std::shared_ptr<geometry::PointCloud> target_;
+    Eigen::Matrix4d init_;
+};
+
+void RegistrationICPPointToPoint(benchmark::State &state) {
+    RegistrationInput input(size_t(state.Arg(0)));
+    while (state.KeepRunning()) {
+        auto result = registration::RegistrationICP(
+                *input.source_, *input.target_, 0.05, input.init_,
+                registration::TransformationEstimationPointToPoint(),
+                registration::ICPConvergenceCriteria(1e-6, 1e-6, 30));
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+void RegistrationICPPointToPlane(benchmark::State &state) {
+    RegistrationInput input(size_t(state.Arg(0)));
+    while (state.KeepRunning()) {
+        auto result = registration::RegistrationICP(
+                *input.source_, *input.target_, 0.05, input.init_,
+                registration::TransformationEstimationPointToPlane(),
+                registration::ICPConvergenceCriteria(1e-6, 1e-6, 30));
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+void RegistrationColoredICP(benchmark::State &state) {
+    RegistrationInput input(size_t(state.Arg(0)));
+    while (state.KeepRunning()) {
+        auto result = registration::RegistrationColoredICP(
+                *input.source_, *input.target_, 0.05, input.init_,
+                registration::ICPConvergenceCriteria(1e-6, 1e-6, 30));
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+/// Three levels against pyramids built once, as when a fragment takes part
+/// in several registrations.
+void RegistrationMultiScaleICP(benchmark::State &state) {
+    RegistrationInput input(size_t(state.Arg(0)));
+    std::vector<double> voxel_sizes = {0.04, 0.02, 0.01};
+    auto source = registration::PointCloudPyramid::CreateSource(
+            *input.source_, voxel_sizes);
+    registration::PointCloudPyramid target(*input.target_, voxel_sizes);
+    std::vector<registration::ICPConvergenceCriteria> criteria = {
+            registration::ICPConvergenceCriteria(1e-6, 1e-6, 50),
+            registration::ICPConvergenceCriteria(1e-6, 1e-6, 30),
+            registration::ICPConvergenceCriteria(1e-6, 1e-6, 14)};
+    while (state.KeepRunning()) {
+        auto result = registration::RegistrationMultiScaleICP(
+                *source, target, {0.056, 0.028, 0.014}, criteria, input.init_);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+}  // unnamed namespace
+
+OPEN3D_BENCHMARK(RegistrationICPPointToPoint)->Arg(50000);
+OPEN3D_BENCHMARK(RegistrationICPPointToPlane)->Arg(50000);
+OPEN3D_BENCHMARK(RegistrationColoredICP)->Arg(50000);
+OPEN3D_BENCHMARK(RegistrationMultiScaleICP)->Arg(200000);
@@ -0,0 +1,191 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Benchmark/SyntheticData.h"
+
+#include <Eigen/Geometry>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+namespace benchmark {
+
+using namespace open3d;
+
+namespace {
+
+double Height(double x, double y) {
+    return 0.15 * std::sin(3.1 * x) * std::cos(2.3 * y) +
+           0.05 * std::sin(7.7 * x + 5.3 * y);
+}
+
+/// Smooth color pattern that varies along every direction.
+Eigen::Vector3d Texture(const Eigen::Vector3d &p) {
+    return Eigen::Vector3d(
+            0.5 + 0.4 * std::sin(9.0 * p(0) + 2.0 * p(2)),
+            0.5 + 0.4 * std::cos(7.0 * p(1) - 3.0 * p(0)),
+            0.5 + 0.4 * std::sin(5.0 * p(2) + 6.0 * p(1)));
+}
+
+}  // unnamed namespace
+
+std::shared_ptr<geometry::PointCloud> CreateSyntheticPointCloud(
+        size_t num_points, unsigned int seed /* = 0*/) {
+    auto cloud = std::make_shared<geometry::PointCloud>();
+    cloud->points_.resize(num_points);
+    cloud->colors_.resize(num_points);
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> uniform(0.0, 2.0);
+    std::normal_distribution<double> noise(0.0, 0.001);
+    for (size_t i = 0; i < num_points; i++) {
+        double x = uniform(rng);
+        double y = uniform(rng);
+        Eigen::Vector3d &point = cloud->points_[i];
+        point = Eigen::Vector3d(x, y, Height(x, y) + noise(rng));
+        cloud->colors_[i] = Texture(point);
+    }
+    return cloud;
+}
+
+Eigen::Matrix4d CreateSyntheticMotion(double degrees, double translation) {
+    Eigen::Vector3d axis = Eigen::Vector3d(1.0, 2.0, 3.0).normalized();
+    Eigen::Matrix4d motion = Eigen::Matrix4d::Identity();
+    motion.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(degrees * M_PI / 180.0, axis).toRotationMatrix();
+    motion.block<3, 1>(0, 3) = axis * translation;
+    return motion;
+}
+
+void CreateSyntheticFrame(const camera::PinholeCameraIntrinsic &intrinsic,
+                          const Eigen::Matrix4d &camera_to_world,
+                          geometry::Image &color,
+                          geometry::Image &depth) {
+    const Eigen::Matrix3d rotation = camera_to_world.block<3, 3>(0, 0);
+    const Eigen::Vector3d origin = camera_to_world.block<3, 1>(0, 3);
+    const Eigen::Vector3d sphere_center(0.2, 0.3, 2.2);
+    const double sphere_radius = 0.5;
+    const double fx = intrinsic.GetFocalLength().first;
+    const double fy = intrinsic.GetFocalLength().second;
+    const double cx = intrinsic.GetPrincipalPoint().first;
+    const double cy = intrinsic.GetPrincipalPoint().second;
+    color.Prepare(intrinsic.width_, intrinsic.height_, 3, 1);
+    depth.Prepare(intrinsic.width_, intrinsic.height_, 1, 2);
+    for (int v = 0; v < intrinsic.height_; v++) {
+        for (int u = 0; u < intrinsic.width_; u++) {
+            // camera rays have unit z, so the ray parameter is the depth
+            Eigen::Vector3d ray((u - cx) / fx, (v - cy) / fy, 1.0);
+            Eigen::Vector3d dir = rotation * ray;
+            double t = std::numeric_limits<double>::infinity();
+            if (dir(2) > 0.0) {
+                t = std::min(t, (3.5 - origin(2)) / dir(2));  // wall
+            }
+            if (dir(1) > 0.0) {
+                t = std::min(t, (1.0 - origin(1)) / dir(1));  // floor
+            }
+            Eigen::Vector3d oc = origin - sphere_center;
+            double b = oc.dot(dir);
+            double c = oc.squaredNorm() - sphere_radius * sphere_radius;
+            double discriminant = b * b - dir.squaredNorm() * c;
+            if (discriminant >= 0.0) {
+                double t_sphere =
+                        (-b - std::sqrt(discriminant)) / dir.squaredNorm();
+                if (t_sphere > 0.0) {
+                    t = std::min(t, t_sphere);
+                }
+            }
+            uint8_t *rgb = color.PointerAt<uint8_t>(u, v, 0);
+            uint16_t *d = depth.PointerAt<uint16_t>(u, v);
+            if (t <= 0.0 || t * 1000.0 > 65535.0) {
+                rgb[0] = rgb[1] = rgb[2] = 0;
+                *d = 0;
+                continue;
+            }
+            Eigen::Vector3d texture = Texture(origin + t * dir);
+            for (int i = 0; i < 3; i++) {
+                rgb[i] = uint8_t(texture(i) * 255.0);
+            }
+            *d = uint16_t(t * 1000.0 + 0.5);
+        }
+    }
+}
+
+std::shared_ptr<registration::PoseGraph> CreateSyntheticPoseGraph(
+        int num_nodes, int loop_stride, unsigned int seed /* = 0*/) {
+    std::mt19937 rng(seed);
+    std::normal_distribution<double> noise(0.0, 1.0);
+    auto perturbation = [&](double degrees, double translation) {
+        Eigen::Matrix4d motion = Eigen::Matrix4d::Identity();
+        Eigen::Vector3d axis(noise(rng), noise(rng), noise(rng));
+        motion.block<3, 3>(0, 0) =
+                Eigen::AngleAxisd(degrees * noise(rng) * M_PI / 180.0,
+                                  axis.normalized())
+                        .toRotationMatrix();
+        motion.block<3, 1>(0, 3) = Eigen::Vector3d(noise(rng), noise(rng),
+                                                   noise(rng)) *
+                                   translation;
+        return motion;
+    };
+
+    std::vector<Eigen::Matrix4d> poses(num_nodes);
+    for (int i = 0; i < num_nodes; i++) {
+        double angle = 2.0 * M_PI * i / num_nodes;
+        poses[i] = Eigen::Matrix4d::Identity();
+        poses[i].block<3, 3>(0, 0) =
+                Eigen::AngleAxisd(angle, Eigen::Vector3d::UnitY())
+                        .toRotationMatrix();
+        poses[i].block<3, 1>(0, 3) =
+                Eigen::Vector3d(2.0 * std::cos(angle), 0.0,
+                                2.0 * std::sin(angle));
+    }
+
+    // edges map source to target coordinates, initial poses drift along the
+    // noisy odometry
+    auto pose_graph = std::make_shared<registration::PoseGraph>();
+    Eigen::Matrix6d information = Eigen::Matrix6d::Identity() * 100.0;
+    Eigen::Matrix4d pose = poses[0];
+    pose_graph->nodes_.push_back(registration::PoseGraphNode(pose));
+    for (int i = 0; i + 1 < num_nodes; i++) {
+        Eigen::Matrix4d odometry = perturbation(0.2, 0.002) *
+                                   poses[i + 1].inverse() * poses[i];
+        pose = pose * odometry.inverse();
+        pose_graph->nodes_.push_back(registration::PoseGraphNode(pose));
+        pose_graph->edges_.push_back(registration::PoseGraphEdge(
+                i, i + 1, odometry, information, false));
+    }
+    for (int i = 0, loop = 0; i < num_nodes; i += loop_stride, loop++) {
+        int j = (i + num_nodes / 2) % num_nodes;
+        Eigen::Matrix4d transformation =
+                loop % 5 == 4 ? perturbation(30.0, 0.5)
+                              : perturbation(0.2, 0.002) * poses[j].inverse() *
+                                        poses[i];
+        pose_graph->edges_.push_back(registration::PoseGraphEdge(
+                i, j, transformation, information, true));
+    }
+    return pose_graph;
+}
+
+}  // namespace benchmark
@@ -0,0 +1,66 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/PoseGraph.h"
+
+namespace benchmark {
+
+/// Deterministic synthetic inputs, so that timings are comparable between
+/// builds and machines without shipping data sets.
+
+/// Samples \param num_points points with colors from a wavy height field
+/// over [0, 2] x [0, 2], whose shape and texture pin down rigid alignments.
+std::shared_ptr<open3d::geometry::PointCloud> CreateSyntheticPointCloud(
+        size_t num_points, unsigned int seed = 0);
+
+/// Rigid motion by \param degrees around a fixed oblique axis followed by a
+/// translation of \param translation along it.
+Eigen::Matrix4d CreateSyntheticMotion(double degrees, double translation);
+
+/// Renders a scene of a textured wall, floor and sphere seen by a camera
+/// with \param camera_to_world pose into an 8-bit RGB \param color image and
+/// a 16-bit \param depth image in millimeters.
+void CreateSyntheticFrame(
+        const open3d::camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &camera_to_world,
+        open3d::geometry::Image &color,
+        open3d::geometry::Image &depth);
+
+/// Pose graph of a camera moving on a circle, with noisy odometry edges
+/// between consecutive nodes and a loop closure every \param loop_stride
+/// nodes, one in five of them wrong.
+std::shared_ptr<open3d::registration::PoseGraph> CreateSyntheticPoseGraph(
+        int num_nodes, int loop_stride, unsigned int seed = 0);
+
+}  // namespace benchmark
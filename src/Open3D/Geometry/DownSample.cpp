@@ -24,8 +24,13 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
 #include <numeric>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
@@ -138,6 +143,471 @@ private:
     std::unordered_map<int, int> classes;
 };
 
+/// Sparse uniform grid over a point cloud. Occupied cells are sorted by
+/// (x, y, z), so every column of cells along z is a contiguous run, and the
+/// points are copied in cell order. Scanning a neighbourhood then costs one
+/// hash lookup per column and streams through memory instead of chasing
+/// indices through a tree.
+class PointGrid {
+public:
+    /// Cell coordinates are packed into 21 bits per axis.
+    static const int kMaxResolution = 1 << 21;
+
+    /// Returns the number of cells per axis needed to cover the points with
+    /// cells of size \param cell_size. Fails for non-finite bounds and for
+    /// grids too fine to be indexed.
+    static bool Resolution(const Eigen::Vector3d &min_bound,
+                           const Eigen::Vector3d &max_bound,
+                           double cell_size,
+                           Eigen::Vector3i &resolution) {
+        if (!min_bound.allFinite() || !max_bound.allFinite() ||
+            !std::isfinite(cell_size) || cell_size <= 0) {
+            return false;
+        }
+        for (int axis = 0; axis < 3; ++axis) {
+            double cells =
+                    std::floor((max_bound(axis) - min_bound(axis)) / cell_size);
+            if (cells >= double(kMaxResolution - 1)) {
+                return false;
+            }
+            resolution(axis) = int(cells) + 1;
+        }
+        return true;
+    }
+
+    /// Number of occupied cells for the given cell size.
+    static size_t CountCells(const std::vector<Eigen::Vector3d> &points,
+                             const Eigen::Vector3d &min_bound,
+                             double cell_size,
+                             const Eigen::Vector3i &resolution) {
+        std::unordered_set<int64_t> cells;
+        for (const auto &point : points) {
+            cells.insert(
+                    Key(Coordinate(point, min_bound, cell_size, resolution)));
+        }
+        return cells.size();
+    }
+
+    PointGrid(const std::vector<Eigen::Vector3d> &points,
+              const Eigen::Vector3d &min_bound,
+              double cell_size,
+              const Eigen::Vector3i &resolution)
+        : min_bound_(min_bound),
+          cell_size_(cell_size),
+          resolution_(resolution) {
+        int num_points = int(points.size());
+        std::unordered_map<int64_t, int> cell_ids;
+        std::vector<int64_t> keys;
+        std::vector<int> point_cells(num_points);
+        for (int idx = 0; idx < num_points; ++idx) {
+            int64_t key = Key(Coordinate(points[idx], min_bound_, cell_size_,
+                                         resolution_));
+            auto inserted = cell_ids.emplace(key, int(keys.size()));
+            if (inserted.second) {
+                keys.push_back(key);
+            }
+            point_cells[idx] = inserted.first->second;
+        }
+
+        // renumber the cells in key order
+        int num_cells = int(keys.size());
+        std::vector<int> order(num_cells);
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(),
+                  [&](int c0, int c1) { return keys[c0] < keys[c1]; });
+        std::vector<int> ranks(num_cells);
+        cells_.resize(num_cells);
+        for (int rank = 0; rank < num_cells; ++rank) {
+            int64_t key = keys[order[rank]];
+            ranks[order[rank]] = rank;
+            cells_[rank] = Eigen::Vector3i(int(key >> 42),
+                                           int((key >> 21) & kCoordinateMask),
+                                           int(key & kCoordinateMask));
+            int64_t column_key = key >> 21;
+            if (rank == 0 || column_key != (keys[order[rank - 1]] >> 21)) {
+                column_ids_.emplace(column_key, int(column_offsets_.size()));
+                column_offsets_.push_back(rank);
+            }
+        }
+        column_offsets_.push_back(num_cells);
+
+        cell_offsets_.assign(num_cells + 1, 0);
+        for (int &cell : point_cells) {
+            cell = ranks[cell];
+            cell_offsets_[cell + 1]++;
+        }
+        std::partial_sum(cell_offsets_.begin(), cell_offsets_.end(),
+                         cell_offsets_.begin());
+        std::vector<int> fill(cell_offsets_.begin(), cell_offsets_.end() - 1);
+        sorted_points_.resize(num_points);
+        sorted_indices_.resize(num_points);
+        for (int idx = 0; idx < num_points; ++idx) {
+            int pos = fill[point_cells[idx]]++;
+            sorted_points_[pos] = points[idx];
+            sorted_indices_[pos] = idx;
+        }
+    }
+
+    int NumberOfCells() const { return int(cells_.size()); }
+
+    /// Appends the cells at most \param range cells away from \param cell,
+    /// skipping those whose box is at least \param max_dist2 (squared) away
+    /// from the box of \param cell.
+    void NeighbourCells(int cell,
+                        int range,
+                        double max_dist2,
+                        std::vector<int> &nb_cells) const {
+        const Eigen::Vector3i &coord = cells_[cell];
+        for (int dx = -range; dx <= range; ++dx) {
+            for (int dy = -range; dy <= range; ++dy) {
+                int x = coord(0) + dx;
+                int y = coord(1) + dy;
+                if (x < 0 || y < 0 || x >= resolution_(0) ||
+                    y >= resolution_(1)) {
+                    continue;
+                }
+                double gap2_xy = Gap2(dx) + Gap2(dy);
+                if (gap2_xy >= max_dist2) {
+                    continue;
+                }
+                auto column = column_ids_.find((int64_t(x) << 21) | y);
+                if (column == column_ids_.end()) {
+                    continue;
+                }
+                auto begin = cells_.begin() + column_offsets_[column->second];
+                auto end = cells_.begin() + column_offsets_[column->second + 1];
+                auto it = std::lower_bound(
+                        begin, end, coord(2) - range,
+                        [](const Eigen::Vector3i &c, int z) {
+                            return c(2) < z;
+                        });
+                for (; it != end && (*it)(2) <= coord(2) + range; ++it) {
+                    if (gap2_xy + Gap2((*it)(2) - coord(2)) < max_dist2) {
+                        nb_cells.push_back(int(it - cells_.begin()));
+                    }
+                }
+            }
+        }
+    }
+
+    /// Squared distances from \param point to the closest and farthest
+    /// corner of \param cell. The cell is padded slightly so that rounding
+    /// in the cell assignment can not make either bound optimistic.
+    void CellDistance2(const Eigen::Vector3d &point,
+                       int cell,
+                       double &min_dist2,
+                       double &max_dist2) const {
+        const double padding = cell_size_ * 1e-6;
+        min_dist2 = 0.0;
+        max_dist2 = 0.0;
+        for (int axis = 0; axis < 3; ++axis) {
+            double lower = min_bound_(axis) + cells_[cell](axis) * cell_size_ -
+                           padding;
+            double upper = lower + cell_size_ + 2.0 * padding;
+            double gap = std::max(
+                    0.0, std::max(lower - point(axis), point(axis) - upper));
+            double span = std::max(point(axis) - lower, upper - point(axis));
+            min_dist2 += gap * gap;
+            max_dist2 += span * span;
+        }
+    }
+
+    /// Distance from \param point in \param cell to the closest point that
+    /// is more than \param range cells away from \param cell.
+    double OutsideDistance(const Eigen::Vector3d &point,
+                           int cell,
+                           int range) const {
+        const Eigen::Vector3i &coord = cells_[cell];
+        double dist = std::numeric_limits<double>::infinity();
+        for (int axis = 0; axis < 3; ++axis) {
+            if (coord(axis) - range > 0) {
+                dist = std::min(dist, point(axis) - min_bound_(axis) -
+                                              (coord(axis) - range) *
+                                                      cell_size_);
+            }
+            if (coord(axis) + range < resolution_(axis) - 1) {
+                dist = std::min(dist, min_bound_(axis) +
+                                              (coord(axis) + range + 1) *
+                                                      cell_size_ -
+                                              point(axis));
+            }
+        }
+        return std::max(0.0, dist - cell_size_ * 1e-6);
+    }
+
+private:
+    static const int64_t kCoordinateMask = (int64_t(1) << 21) - 1;
+
+    static Eigen::Vector3i Coordinate(const Eigen::Vector3d &point,
+                                      const Eigen::Vector3d &min_bound,
+                                      double cell_size,
+                                      const Eigen::Vector3i &resolution) {
+        Eigen::Vector3i coord;
+        for (int axis = 0; axis < 3; ++axis) {
+            int c = int(
+                    std::floor((point(axis) - min_bound(axis)) / cell_size));
+            coord(axis) = std::min(std::max(c, 0), resolution(axis) - 1);
+        }
+        return coord;
+    }
+
+    static int64_t Key(const Eigen::Vector3i &coord) {
+        return (int64_t(coord(0)) << 42) | (int64_t(coord(1)) << 21) |
+               int64_t(coord(2));
+    }
+
+    /// Lower bound of the squared gap between two cells \param offset cells
+    /// apart along one axis.
+    double Gap2(int offset) const {
+        double gap = std::max(0.0, (std::abs(offset) - 1 - 1e-6) * cell_size_);
+        return gap * gap;
+    }
+
+public:
+    Eigen::Vector3d min_bound_;
+    double cell_size_;
+    Eigen::Vector3i resolution_;
+    std::vector<Eigen::Vector3i> cells_;
+    std::vector<int> cell_offsets_;
+    std::unordered_map<int64_t, int> column_ids_;
+    std::vector<int> column_offsets_;
+    std::vector<Eigen::Vector3d> sorted_points_;
+    std::vector<int> sorted_indices_;
+};
+
+/// Squared distance, accumulated in the same order as FLANN's L2 metric so
+/// that both backends agree on points at the search radius.
+inline double Distance2(const Eigen::Vector3d &p0, const Eigen::Vector3d &p1) {
+    double d0 = p0(0) - p1(0);
+    double d1 = p0(1) - p1(1);
+    double d2 = p0(2) - p1(2);
+    return d0 * d0 + d1 * d1 + d2 * d2;
+}
+
+/// Chooses the grid for radius outlier removal. When the cloud is dense
+/// enough, cells are made small enough to fit into the search sphere of any
+/// of their points, so that a cell holding more than \param nb_points points
+/// is accepted as a whole. Otherwise cells as wide as the radius keep the
+/// neighbourhood at 27 cells.
+bool RadiusGridCellSize(const PointCloud &cloud,
+                        size_t nb_points,
+                        double search_radius,
+                        double &cell_size,
+                        Eigen::Vector3i &resolution) {
+    Eigen::Vector3d min_bound = cloud.GetMinBound();
+    Eigen::Vector3d max_bound = cloud.GetMaxBound();
+    cell_size = 0.999 * search_radius / std::sqrt(3.0);
+    if (PointGrid::Resolution(min_bound, max_bound, cell_size, resolution) &&
+        cloud.points_.size() >
+                nb_points * PointGrid::CountCells(cloud.points_, min_bound,
+                                                  cell_size, resolution)) {
+        return true;
+    }
+    cell_size = search_radius;
+    return PointGrid::Resolution(min_bound, max_bound, cell_size, resolution);
+}
+
+/// Marks the points with more than \param nb_points neighbours within
+/// \param search_radius, the point itself included. Cells that fit into the
+/// search sphere and hold enough points are accepted as a whole, neighbour
+/// cells entirely inside the sphere of a point are counted without looking
+/// at their points, and counting stops as soon as the point is an inlier.
+std::vector<char> RadiusInliersGrid(const PointCloud &cloud,
+                                    size_t nb_points,
+                                    double search_radius,
+                                    const PointGrid &grid) {
+    const double radius2 = double(float(search_radius * search_radius));
+    const int range = int(std::ceil(search_radius / grid.cell_size_ - 1e-6));
+    const bool cells_in_sphere = 3.0 * grid.cell_size_ * grid.cell_size_ <
+                                 0.999 * radius2;
+    const int count_limit = int(std::min(nb_points, cloud.points_.size()));
+    std::vector<char> mask(cloud.points_.size(), 0);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<int> nb_cells;
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int cell = 0; cell < grid.NumberOfCells(); cell++) {
+            int begin = grid.cell_offsets_[cell];
+            int end = grid.cell_offsets_[cell + 1];
+            if (cells_in_sphere && end - begin > count_limit) {
+                for (int pos = begin; pos < end; ++pos) {
+                    mask[grid.sorted_indices_[pos]] = 1;
+                }
+                continue;
+            }
+            nb_cells.clear();
+            grid.NeighbourCells(cell, range, radius2, nb_cells);
+            for (int pos = begin; pos < end; ++pos) {
+                const Eigen::Vector3d &point = grid.sorted_points_[pos];
+                int count = 0;
+                for (size_t i = 0; i < nb_cells.size() && count <= count_limit;
+                     ++i) {
+                    int nb_cell = nb_cells[i];
+                    double min_dist2, max_dist2;
+                    grid.CellDistance2(point, nb_cell, min_dist2, max_dist2);
+                    if (min_dist2 >= radius2) {
+                        continue;
+                    }
+                    int nb_begin = grid.cell_offsets_[nb_cell];
+                    int nb_end = grid.cell_offsets_[nb_cell + 1];
+                    if (max_dist2 < radius2) {
+                        count += nb_end - nb_begin;
+                        continue;
+                    }
+                    for (int nb = nb_begin; nb < nb_end; ++nb) {
+                        if (Distance2(point, grid.sorted_points_[nb]) <
+                            radius2) {
+                            count++;
+                        }
+                    }
+                }
+                mask[grid.sorted_indices_[pos]] = count > count_limit;
+            }
+        }
+    }
+    return mask;
+}
+
+/// Chooses the grid for the statistical outlier search. The first guess
+/// spreads the points evenly over the bounding box; since scans mostly
+/// sample surfaces, the cell size is then corrected until a cell holds
+/// about half of the requested neighbours.
+bool StatisticalGridCellSize(const PointCloud &cloud,
+                             size_t nb_neighbors,
+                             double &cell_size,
+                             Eigen::Vector3i &resolution) {
+    Eigen::Vector3d min_bound = cloud.GetMinBound();
+    Eigen::Vector3d max_bound = cloud.GetMaxBound();
+    double extent = (max_bound - min_bound).maxCoeff();
+    if (!std::isfinite(extent)) {
+        return false;
+    }
+    if (extent <= 0.0) {
+        cell_size = 1.0;
+        return PointGrid::Resolution(min_bound, max_bound, cell_size,
+                                     resolution);
+    }
+    double num_points = double(cloud.points_.size());
+    double target = std::max(1.0, 0.5 * double(nb_neighbors));
+    cell_size = extent * std::cbrt(target / num_points);
+    for (int iter = 0; iter < 2; ++iter) {
+        if (!PointGrid::Resolution(min_bound, max_bound, cell_size,
+                                   resolution)) {
+            return false;
+        }
+        double occupancy =
+                num_points / double(PointGrid::CountCells(
+                                     cloud.points_, min_bound, cell_size,
+                                     resolution));
+        if (occupancy > 0.25 * target && occupancy < 2.0 * target) {
+            break;
+        }
+        cell_size *= std::sqrt(target / occupancy);
+    }
+    return PointGrid::Resolution(min_bound, max_bound, cell_size, resolution);
+}
+
+/// Average distance of every point to its \param nb_neighbors nearest
+/// neighbours, the point itself included. The search visits the cells two
+/// rings deep around the point, ring by ring, and stops once no unseen cell
+/// can hold a closer point. Points whose neighbours lie further away, like
+/// isolated outliers, are left at -2 for the caller to resolve.
+std::vector<double> AverageDistancesGrid(const PointCloud &cloud,
+                                         size_t nb_neighbors,
+                                         const PointGrid &grid) {
+    const int max_ring = 2;
+    const size_t knn = std::min(nb_neighbors, cloud.points_.size());
+    std::vector<double> avg_distances(cloud.points_.size());
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<int> nb_cells;
+        std::vector<int> ring_offsets(max_ring + 2);
+        std::vector<int> ring_cells;
+        std::vector<double> dists2;
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int cell = 0; cell < grid.NumberOfCells(); cell++) {
+            // bucket the neighbour cells by ring
+            nb_cells.clear();
+            grid.NeighbourCells(cell, max_ring,
+                                std::numeric_limits<double>::infinity(),
+                                nb_cells);
+            std::fill(ring_offsets.begin(), ring_offsets.end(), 0);
+            for (int nb_cell : nb_cells) {
+                int ring = (grid.cells_[nb_cell] - grid.cells_[cell])
+                                   .cwiseAbs()
+                                   .maxCoeff();
+                ring_offsets[ring + 1]++;
+            }
+            std::partial_sum(ring_offsets.begin(), ring_offsets.end(),
+                             ring_offsets.begin());
+            ring_cells.resize(nb_cells.size());
+            std::vector<int> fill(ring_offsets.begin(), ring_offsets.end() - 1);
+            for (int nb_cell : nb_cells) {
+                int ring = (grid.cells_[nb_cell] - grid.cells_[cell])
+                                   .cwiseAbs()
+                                   .maxCoeff();
+                ring_cells[fill[ring]++] = nb_cell;
+            }
+
+            for (int pos = grid.cell_offsets_[cell];
+                 pos < grid.cell_offsets_[cell + 1]; ++pos) {
+                const Eigen::Vector3d &point = grid.sorted_points_[pos];
+                // squared distances of the candidates, the closest knn are
+                // moved to the front after every ring
+                dists2.clear();
+                double kth_dist2 = std::numeric_limits<double>::infinity();
+                bool resolved = false;
+                for (int ring = 0; ring <= max_ring && !resolved; ++ring) {
+                    for (int i = ring_offsets[ring]; i < ring_offsets[ring + 1];
+                         ++i) {
+                        int nb_cell = ring_cells[i];
+                        double min_dist2, max_dist2;
+                        grid.CellDistance2(point, nb_cell, min_dist2,
+                                           max_dist2);
+                        if (min_dist2 > kth_dist2) {
+                            continue;
+                        }
+                        for (int nb = grid.cell_offsets_[nb_cell];
+                             nb < grid.cell_offsets_[nb_cell + 1]; ++nb) {
+                            dists2.push_back(
+                                    Distance2(point, grid.sorted_points_[nb]));
+                        }
+                    }
+                    if (dists2.size() >= knn) {
+                        std::nth_element(dists2.begin(),
+                                         dists2.begin() + (knn - 1),
+                                         dists2.end());
+                        dists2.resize(knn);
+                        kth_dist2 = dists2.back();
+                        double bound = grid.OutsideDistance(point, cell, ring);
+                        resolved = kth_dist2 <= bound * bound;
+                    }
+                }
+                double mean = -2.0;
+                if (resolved) {
+                    // sum in ascending order, like the sorted FLANN result
+                    std::sort(dists2.begin(), dists2.end());
+                    double sum = 0.0;
+                    for (double dist2 : dists2) {
+                        sum += std::sqrt(dist2);
+                    }
+                    mean = sum / dists2.size();
+                }
+                avg_distances[grid.sorted_indices_[pos]] = mean;
+            }
+        }
+    }
+    return avg_distances;
+}
+
 }  // unnamed namespace
 
 namespace geometry {
@@ -403,18 +873,28 @@ PointCloud::RemoveRadiusOutliers(size_t nb_points, double search_radius) const {
         return std::make_tuple(std::make_shared<PointCloud>(),
                                std::vector<size_t>());
     }
-    KDTreeFlann kdtree;
-    kdtree.SetGeometry(*this);
-    std::vector<bool> mask = std::vector<bool>(points_.size());
+    std::vector<char> mask;
+    double cell_size;
+    Eigen::Vector3i resolution;
+    if (!points_.empty() && RadiusGridCellSize(*this, nb_points, search_radius,
+                                               cell_size, resolution)) {
+        PointGrid grid(points_, GetMinBound(), cell_size, resolution);
+        mask = RadiusInliersGrid(*this, nb_points, search_radius, grid);
+    } else {
+        // the grid can not index this cloud, fall back to the KD tree
+        KDTreeFlann kdtree;
+        kdtree.SetGeometry(*this);
+        mask.resize(points_.size());
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-    for (int i = 0; i < int(points_.size()); i++) {
-        std::vector<int> tmp_indices;
-        std::vector<double> dist;
-        size_t nb_neighbors = kdtree.SearchRadius(points_[i], search_radius,
-                                                  tmp_indices, dist);
-        mask[i] = (nb_neighbors > nb_points);
+        for (int i = 0; i < int(points_.size()); i++) {
+            std::vector<int> tmp_indices;
+            std::vector<double> dist;
+            size_t nb_neighbors = kdtree.SearchRadius(
+                    points_[i], search_radius, tmp_indices, dist);
+            mask[i] = (nb_neighbors > nb_points);
+        }
     }
     std::vector<size_t> indices;
     for (size_t i = 0; i < mask.size(); i++) {
@@ -440,27 +920,45 @@ PointCloud::RemoveStatisticalOutliers(size_t nb_neighbors,
         return std::make_tuple(std::make_shared<PointCloud>(),
                                std::vector<size_t>());
     }
-    KDTreeFlann kdtree;
-    kdtree.SetGeometry(*this);
-    std::vector<double> avg_distances = std::vector<double>(points_.size());
-    std::vector<size_t> indices;
-    size_t valid_distances = 0;
+    std::vector<double> avg_distances(points_.size(), -2.0);
+    double cell_size;
+    Eigen::Vector3i resolution;
+    if (StatisticalGridCellSize(*this, nb_neighbors, cell_size, resolution)) {
+        PointGrid grid(points_, GetMinBound(), cell_size, resolution);
+        avg_distances = AverageDistancesGrid(*this, nb_neighbors, grid);
+    }
+    // points the grid could not resolve go through the KD tree
+    std::vector<int> unresolved;
+    for (int i = 0; i < int(points_.size()); i++) {
+        if (avg_distances[i] == -2.0) {
+            unresolved.push_back(i);
+        }
+    }
+    if (!unresolved.empty()) {
+        KDTreeFlann kdtree;
+        kdtree.SetGeometry(*this);
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-    for (int i = 0; i < int(points_.size()); i++) {
-        std::vector<int> tmp_indices;
-        std::vector<double> dist;
-        kdtree.SearchKNN(points_[i], int(nb_neighbors), tmp_indices, dist);
-        double mean = -1.0;
-        if (dist.size() > 0u) {
-            valid_distances++;
-            std::for_each(dist.begin(), dist.end(),
-                          [](double &d) { d = std::sqrt(d); });
-            mean = std::accumulate(dist.begin(), dist.end(), 0.0) / dist.size();
-        }
-        avg_distances[i] = mean;
+        for (int k = 0; k < int(unresolved.size()); k++) {
+            int i = unresolved[k];
+            std::vector<int> tmp_indices;
+            std::vector<double> dist;
+            kdtree.SearchKNN(points_[i], int(nb_neighbors), tmp_indices, dist);
+            double mean = -1.0;
+            if (dist.size() > 0u) {
+                std::for_each(dist.begin(), dist.end(),
+                              [](double &d) { d = std::sqrt(d); });
+                mean = std::accumulate(dist.begin(), dist.end(), 0.0) /
+                       dist.size();
+            }
+            avg_distances[i] = mean;
+        }
     }
+    std::vector<size_t> indices;
+    size_t valid_distances =
+            std::count_if(avg_distances.begin(), avg_distances.end(),
+                          [](double x) { return x >= 0.0; });
     if (valid_distances == 0) {
         return std::make_tuple(std::make_shared<PointCloud>(),
                                std::vector<size_t>());
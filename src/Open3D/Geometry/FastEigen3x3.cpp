@@ -0,0 +1,484 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/FastEigen3x3.h"
+
+#include <Eigen/Geometry>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "Open3D/Geometry/FastEigen3x3SIMD.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define OPEN3D_FAST_EIGEN3X3_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define OPEN3D_FAST_EIGEN3X3_NEON
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+Eigen::Vector3d ComputeEigenvector0(const Eigen::Matrix3d &A, double eval0) {
+    Eigen::Vector3d row0(A(0, 0) - eval0, A(0, 1), A(0, 2));
+    Eigen::Vector3d row1(A(0, 1), A(1, 1) - eval0, A(1, 2));
+    Eigen::Vector3d row2(A(0, 2), A(1, 2), A(2, 2) - eval0);
+    Eigen::Vector3d r0xr1 = row0.cross(row1);
+    Eigen::Vector3d r0xr2 = row0.cross(row2);
+    Eigen::Vector3d r1xr2 = row1.cross(row2);
+    double d0 = r0xr1.dot(r0xr1);
+    double d1 = r0xr2.dot(r0xr2);
+    double d2 = r1xr2.dot(r1xr2);
+
+    double dmax = d0;
+    int imax = 0;
+    if (d1 > dmax) {
+        dmax = d1;
+        imax = 1;
+    }
+    if (d2 > dmax) {
+        imax = 2;
+    }
+
+    if (imax == 0) {
+        return r0xr1 / std::sqrt(d0);
+    } else if (imax == 1) {
+        return r0xr2 / std::sqrt(d1);
+    } else {
+        return r1xr2 / std::sqrt(d2);
+    }
+}
+
+Eigen::Vector3d ComputeEigenvector1(const Eigen::Matrix3d &A,
+                                    const Eigen::Vector3d &evec0,
+                                    double eval1) {
+    Eigen::Vector3d U, V;
+    if (std::abs(evec0(0)) > std::abs(evec0(1))) {
+        double inv_length =
+                1 / std::sqrt(evec0(0) * evec0(0) + evec0(2) * evec0(2));
+        U << -evec0(2) * inv_length, 0, evec0(0) * inv_length;
+    } else {
+        double inv_length =
+                1 / std::sqrt(evec0(1) * evec0(1) + evec0(2) * evec0(2));
+        U << 0, evec0(2) * inv_length, -evec0(1) * inv_length;
+    }
+    V = evec0.cross(U);
+
+    Eigen::Vector3d AU(A(0, 0) * U(0) + A(0, 1) * U(1) + A(0, 2) * U(2),
+                       A(0, 1) * U(0) + A(1, 1) * U(1) + A(1, 2) * U(2),
+                       A(0, 2) * U(0) + A(1, 2) * U(1) + A(2, 2) * U(2));
+
+    Eigen::Vector3d AV = {A(0, 0) * V(0) + A(0, 1) * V(1) + A(0, 2) * V(2),
+                          A(0, 1) * V(0) + A(1, 1) * V(1) + A(1, 2) * V(2),
+                          A(0, 2) * V(0) + A(1, 2) * V(1) + A(2, 2) * V(2)};
+
+    double m00 = U(0) * AU(0) + U(1) * AU(1) + U(2) * AU(2) - eval1;
+    double m01 = U(0) * AV(0) + U(1) * AV(1) + U(2) * AV(2);
+    double m11 = V(0) * AV(0) + V(1) * AV(1) + V(2) * AV(2) - eval1;
+
+    double absM00 = std::abs(m00);
+    double absM01 = std::abs(m01);
+    double absM11 = std::abs(m11);
+    double max_abs_comp;
+    if (absM00 >= absM11) {
+        max_abs_comp = std::max(absM00, absM01);
+        if (max_abs_comp > 0) {
+            if (absM00 >= absM01) {
+                m01 /= m00;
+                m00 = 1 / std::sqrt(1 + m01 * m01);
+                m01 *= m00;
+            } else {
+                m00 /= m01;
+                m01 = 1 / std::sqrt(1 + m00 * m00);
+                m00 *= m01;
+            }
+            return m01 * U - m00 * V;
+        } else {
+            return U;
+        }
+    } else {
+        max_abs_comp = std::max(absM11, absM01);
+        if (max_abs_comp > 0) {
+            if (absM11 >= absM01) {
+                m01 /= m11;
+                m11 = 1 / std::sqrt(1 + m01 * m01);
+                m01 *= m11;
+            } else {
+                m11 /= m01;
+                m01 = 1 / std::sqrt(1 + m11 * m11);
+                m11 *= m01;
+            }
+            return m11 * U - m01 * V;
+        } else {
+            return U;
+        }
+    }
+}
+
+#if defined(OPEN3D_FAST_EIGEN3X3_SSE2)
+
+/// Two lanes in an SSE2 register.
+struct Pack2 {
+    /// All bits of a lane set where a comparison holds.
+    struct Mask {
+        __m128d m_;
+    };
+    static const int kSize = 2;
+    static Pack2 Broadcast(double value) { return {_mm_set1_pd(value)}; }
+    static Pack2 Load(const double *data) { return {_mm_loadu_pd(data)}; }
+    static void Store(double *data, const Pack2 &a) {
+        _mm_storeu_pd(data, a.v_);
+    }
+    static void StoreMask(bool *data, const Mask &mask) {
+        int bits = _mm_movemask_pd(mask.m_);
+        data[0] = (bits & 1) != 0;
+        data[1] = (bits & 2) != 0;
+    }
+    __m128d v_;
+};
+
+inline Pack2 operator+(const Pack2 &a, const Pack2 &b) {
+    return {_mm_add_pd(a.v_, b.v_)};
+}
+inline Pack2 operator-(const Pack2 &a, const Pack2 &b) {
+    return {_mm_sub_pd(a.v_, b.v_)};
+}
+inline Pack2 operator*(const Pack2 &a, const Pack2 &b) {
+    return {_mm_mul_pd(a.v_, b.v_)};
+}
+inline Pack2 operator/(const Pack2 &a, const Pack2 &b) {
+    return {_mm_div_pd(a.v_, b.v_)};
+}
+inline Pack2 Sqrt(const Pack2 &a) { return {_mm_sqrt_pd(a.v_)}; }
+inline Pack2 Abs(const Pack2 &a) {
+    return {_mm_andnot_pd(_mm_set1_pd(-0.0), a.v_)};
+}
+inline Pack2 Min(const Pack2 &a, const Pack2 &b) {
+    return {_mm_min_pd(a.v_, b.v_)};
+}
+inline Pack2 Max(const Pack2 &a, const Pack2 &b) {
+    return {_mm_max_pd(a.v_, b.v_)};
+}
+inline Pack2::Mask Less(const Pack2 &a, const Pack2 &b) {
+    return {_mm_cmplt_pd(a.v_, b.v_)};
+}
+inline Pack2::Mask Greater(const Pack2 &a, const Pack2 &b) {
+    return {_mm_cmpgt_pd(a.v_, b.v_)};
+}
+inline Pack2::Mask GreaterEqual(const Pack2 &a, const Pack2 &b) {
+    return {_mm_cmpge_pd(a.v_, b.v_)};
+}
+inline Pack2::Mask NotEqual(const Pack2 &a, const Pack2 &b) {
+    return {_mm_cmpneq_pd(a.v_, b.v_)};
+}
+inline Pack2::Mask operator&(const Pack2::Mask &a, const Pack2::Mask &b) {
+    return {_mm_and_pd(a.m_, b.m_)};
+}
+inline Pack2::Mask operator|(const Pack2::Mask &a, const Pack2::Mask &b) {
+    return {_mm_or_pd(a.m_, b.m_)};
+}
+inline Pack2::Mask AndNot(const Pack2::Mask &a, const Pack2::Mask &b) {
+    return {_mm_andnot_pd(b.m_, a.m_)};
+}
+inline Pack2 Select(const Pack2::Mask &mask, const Pack2 &a, const Pack2 &b) {
+    return {_mm_or_pd(_mm_and_pd(mask.m_, a.v_),
+                      _mm_andnot_pd(mask.m_, b.v_))};
+}
+
+#elif defined(OPEN3D_FAST_EIGEN3X3_NEON)
+
+/// Two lanes in a NEON register.
+struct Pack2 {
+    /// All bits of a lane set where a comparison holds.
+    struct Mask {
+        uint64x2_t m_;
+    };
+    static const int kSize = 2;
+    static Pack2 Broadcast(double value) { return {vdupq_n_f64(value)}; }
+    static Pack2 Load(const double *data) { return {vld1q_f64(data)}; }
+    static void Store(double *data, const Pack2 &a) { vst1q_f64(data, a.v_); }
+    static void StoreMask(bool *data, const Mask &mask) {
+        data[0] = vgetq_lane_u64(mask.m_, 0) != 0;
+        data[1] = vgetq_lane_u64(mask.m_, 1) != 0;
+    }
+    float64x2_t v_;
+};
+
+inline Pack2 operator+(const Pack2 &a, const Pack2 &b) {
+    return {vaddq_f64(a.v_, b.v_)};
+}
+inline Pack2 operator-(const Pack2 &a, const Pack2 &b) {
+    return {vsubq_f64(a.v_, b.v_)};
+}
+inline Pack2 operator*(const Pack2 &a, const Pack2 &b) {
+    return {vmulq_f64(a.v_, b.v_)};
+}
+inline Pack2 operator/(const Pack2 &a, const Pack2 &b) {
+    return {vdivq_f64(a.v_, b.v_)};
+}
+inline Pack2 Sqrt(const Pack2 &a) { return {vsqrtq_f64(a.v_)}; }
+inline Pack2 Abs(const Pack2 &a) { return {vabsq_f64(a.v_)}; }
+inline Pack2 Min(const Pack2 &a, const Pack2 &b) {
+    return {vminq_f64(a.v_, b.v_)};
+}
+inline Pack2 Max(const Pack2 &a, const Pack2 &b) {
+    return {vmaxq_f64(a.v_, b.v_)};
+}
+inline Pack2::Mask Less(const Pack2 &a, const Pack2 &b) {
+    return {vcltq_f64(a.v_, b.v_)};
+}
+inline Pack2::Mask Greater(const Pack2 &a, const Pack2 &b) {
+    return {vcgtq_f64(a.v_, b.v_)};
+}
+inline Pack2::Mask GreaterEqual(const Pack2 &a, const Pack2 &b) {
+    return {vcgeq_f64(a.v_, b.v_)};
+}
+inline Pack2::Mask NotEqual(const Pack2 &a, const Pack2 &b) {
+    // not equal, or unordered
+    uint64x2_t equal = vceqq_f64(a.v_, b.v_);
+    return {veorq_u64(equal, vdupq_n_u64(~uint64_t(0)))};
+}
+inline Pack2::Mask operator&(const Pack2::Mask &a, const Pack2::Mask &b) {
+    return {vandq_u64(a.m_, b.m_)};
+}
+inline Pack2::Mask operator|(const Pack2::Mask &a, const Pack2::Mask &b) {
+    return {vorrq_u64(a.m_, b.m_)};
+}
+inline Pack2::Mask AndNot(const Pack2::Mask &a, const Pack2::Mask &b) {
+    return {vbicq_u64(a.m_, b.m_)};
+}
+inline Pack2 Select(const Pack2::Mask &mask, const Pack2 &a, const Pack2 &b) {
+    return {vbslq_f64(mask.m_, a.v_, b.v_)};
+}
+
+#endif
+
+}  // unnamed namespace
+
+#if defined(OPEN3D_FAST_EIGEN3X3_SSE2) || defined(OPEN3D_FAST_EIGEN3X3_NEON)
+
+void FastEigen3x3SIMD128(const double *const coefficients[6],
+                         int count,
+                         double *x,
+                         double *y,
+                         double *z,
+                         bool *solved) {
+    FastEigen3x3Packs<Pack2>(coefficients, count, x, y, z, solved);
+}
+
+bool HasFastEigen3x3SIMD128() { return true; }
+
+#else
+
+void FastEigen3x3SIMD128(const double *const coefficients[6],
+                         int count,
+                         double *x,
+                         double *y,
+                         double *z,
+                         bool *solved) {
+    for (int lane = 0; lane < count; lane++) {
+        solved[lane] = false;
+    }
+}
+
+bool HasFastEigen3x3SIMD128() { return false; }
+
+#endif
+
+void SymmetricMatrix3dBlock::Set(int lane, const Eigen::Matrix3d &A) {
+    xx_[lane] = A(0, 0);
+    xy_[lane] = A(0, 1);
+    xz_[lane] = A(0, 2);
+    yy_[lane] = A(1, 1);
+    yz_[lane] = A(1, 2);
+    zz_[lane] = A(2, 2);
+}
+
+Eigen::Matrix3d SymmetricMatrix3dBlock::Get(int lane) const {
+    Eigen::Matrix3d A;
+    A << xx_[lane], xy_[lane], xz_[lane], xy_[lane], yy_[lane], yz_[lane],
+            xz_[lane], yz_[lane], zz_[lane];
+    return A;
+}
+
+FastEigen3x3Kernel GetFastEigen3x3Kernel() {
+    static const FastEigen3x3Kernel kernel = []() {
+        bool cpu_has_avx2 = false;
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        // AVX2 needs the CPU feature and the OS saving the AVX registers
+        int info[4];
+        __cpuid(info, 1);
+        bool os_saves_avx = (info[2] & (1 << 27)) != 0 &&
+                            (info[2] & (1 << 28)) != 0 &&
+                            (_xgetbv(0) & 6) == 6;
+        __cpuidex(info, 7, 0);
+        cpu_has_avx2 = os_saves_avx && (info[1] & (1 << 5)) != 0;
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+        cpu_has_avx2 = __builtin_cpu_supports("avx2") != 0;
+#endif
+        if (cpu_has_avx2 && HasFastEigen3x3AVX2()) {
+            return FastEigen3x3Kernel::AVX2;
+        } else if (HasFastEigen3x3SIMD128()) {
+            return FastEigen3x3Kernel::SIMD128;
+        } else {
+            return FastEigen3x3Kernel::Scalar;
+        }
+    }();
+    return kernel;
+}
+
+Eigen::Vector3d FastEigen3x3(const Eigen::Matrix3d &covariance) {
+    Eigen::Matrix3d A = covariance;
+    // Previous version based on:
+    // https://en.wikipedia.org/wiki/Eigenvalue_algorithm#3.C3.973_matrices
+    // Current version based on
+    // https://www.geometrictools.com/Documentation/RobustEigenSymmetric3x3.pdf
+    // which handles edge cases like points on a plane
+
+    double max_coeff = A.maxCoeff();
+    if (max_coeff == 0) {
+        return Eigen::Vector3d::Zero();
+    }
+    A /= max_coeff;
+
+    double norm = A(0, 1) * A(0, 1) + A(0, 2) * A(0, 2) + A(1, 2) * A(1, 2);
+    if (norm > 0) {
+        Eigen::Vector3d eval;
+        Eigen::Vector3d evec0;
+        Eigen::Vector3d evec1;
+        Eigen::Vector3d evec2;
+
+        double q = (A(0, 0) + A(1, 1) + A(2, 2)) / 3;
+
+        double b00 = A(0, 0) - q;
+        double b11 = A(1, 1) - q;
+        double b22 = A(2, 2) - q;
+
+        double p =
+                std::sqrt((b00 * b00 + b11 * b11 + b22 * b22 + norm * 2) / 6);
+
+        double c00 = b11 * b22 - A(1, 2) * A(1, 2);
+        double c01 = A(0, 1) * b22 - A(1, 2) * A(0, 2);
+        double c02 = A(0, 1) * A(1, 2) - b11 * A(0, 2);
+        double det = (b00 * c00 - A(0, 1) * c01 + A(0, 2) * c02) / (p * p * p);
+
+        double half_det = det * 0.5;
+        half_det = std::min(std::max(half_det, -1.0), 1.0);
+
+        double angle = std::acos(half_det) / (double)3;
+        double const two_thirds_pi = 2.09439510239319549;
+        double beta2 = std::cos(angle) * 2;
+        double beta0 = std::cos(angle + two_thirds_pi) * 2;
+        double beta1 = -(beta0 + beta2);
+
+        eval(0) = q + p * beta0;
+        eval(1) = q + p * beta1;
+        eval(2) = q + p * beta2;
+
+        if (half_det >= 0) {
+            evec2 = ComputeEigenvector0(A, eval(2));
+            if (eval(2) < eval(0) && eval(2) < eval(1)) {
+                A *= max_coeff;
+                return evec2;
+            }
+            evec1 = ComputeEigenvector1(A, evec2, eval(1));
+            A *= max_coeff;
+            if (eval(1) < eval(0) && eval(1) < eval(2)) {
+                return evec1;
+            }
+            evec0 = evec1.cross(evec2);
+            return evec0;
+        } else {
+            evec0 = ComputeEigenvector0(A, eval(0));
+            if (eval(0) < eval(1) && eval(0) < eval(2)) {
+                A *= max_coeff;
+                return evec0;
+            }
+            evec1 = ComputeEigenvector1(A, evec0, eval(1));
+            A *= max_coeff;
+            if (eval(1) < eval(0) && eval(1) < eval(2)) {
+                return evec1;
+            }
+            evec2 = evec0.cross(evec1);
+            return evec2;
+        }
+    } else {
+        A *= max_coeff;
+        if (A(0, 0) < A(1, 1) && A(0, 0) < A(2, 2)) {
+            return Eigen::Vector3d(1, 0, 0);
+        } else if (A(1, 1) < A(0, 0) && A(1, 1) < A(2, 2)) {
+            return Eigen::Vector3d(0, 1, 0);
+        } else {
+            return Eigen::Vector3d(0, 0, 1);
+        }
+    }
+}
+
+void FastEigen3x3(const SymmetricMatrix3dBlock &block,
+                  int count,
+                  Eigen::Vector3d *eigenvectors,
+                  FastEigen3x3Kernel kernel /* = GetFastEigen3x3Kernel()*/) {
+    if (kernel > GetFastEigen3x3Kernel()) {
+        kernel = GetFastEigen3x3Kernel();
+    }
+    bool solved[kSymmetricMatrix3dBlockSize];
+    if (kernel == FastEigen3x3Kernel::Scalar) {
+        for (int lane = 0; lane < count; lane++) {
+            solved[lane] = false;
+        }
+    } else {
+        const double *const coefficients[6] = {block.xx_, block.xy_,
+                                               block.xz_, block.yy_,
+                                               block.yz_, block.zz_};
+        double x[kSymmetricMatrix3dBlockSize];
+        double y[kSymmetricMatrix3dBlockSize];
+        double z[kSymmetricMatrix3dBlockSize];
+        if (kernel == FastEigen3x3Kernel::AVX2) {
+            FastEigen3x3AVX2(coefficients, count, x, y, z, solved);
+        } else {
+            FastEigen3x3SIMD128(coefficients, count, x, y, z, solved);
+        }
+        for (int lane = 0; lane < count; lane++) {
+            eigenvectors[lane] = Eigen::Vector3d(x[lane], y[lane], z[lane]);
+        }
+    }
+    for (int lane = 0; lane < count; lane++) {
+        if (!solved[lane]) {
+            eigenvectors[lane] = FastEigen3x3(block.Get(lane));
+        }
+    }
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,89 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+
+namespace open3d {
+namespace geometry {
+
+/// Number of matrices in a SymmetricMatrix3dBlock.
+constexpr int kSymmetricMatrix3dBlockSize = 64;
+
+/// \class SymmetricMatrix3dBlock
+///
+/// \brief Block of symmetric 3x3 matrices, stored as one array per unique
+/// coefficient so that the vectorized solvers load several matrices at once.
+class SymmetricMatrix3dBlock {
+public:
+    void Set(int lane, const Eigen::Matrix3d &A);
+    Eigen::Matrix3d Get(int lane) const;
+
+public:
+    double xx_[kSymmetricMatrix3dBlockSize];
+    double xy_[kSymmetricMatrix3dBlockSize];
+    double xz_[kSymmetricMatrix3dBlockSize];
+    double yy_[kSymmetricMatrix3dBlockSize];
+    double yz_[kSymmetricMatrix3dBlockSize];
+    double zz_[kSymmetricMatrix3dBlockSize];
+};
+
+/// \enum FastEigen3x3Kernel
+///
+/// \brief Implementations of the batched FastEigen3x3.
+enum class FastEigen3x3Kernel {
+    /// One matrix at a time, available everywhere.
+    Scalar = 0,
+    /// Two matrices at a time with SSE2 on x86-64 or NEON on AArch64.
+    SIMD128 = 1,
+    /// Four matrices at a time, on x86-64 CPUs with AVX2.
+    AVX2 = 2,
+};
+
+/// Returns the fastest FastEigen3x3Kernel of this build that the running CPU
+/// supports.
+FastEigen3x3Kernel GetFastEigen3x3Kernel();
+
+/// Returns the eigenvector of the smallest eigenvalue of the symmetric matrix
+/// \param A, or zero if \param A is zero. The eigenvalues are solved in closed
+/// form, following
+/// https://www.geometrictools.com/Documentation/RobustEigenSymmetric3x3.pdf
+Eigen::Vector3d FastEigen3x3(const Eigen::Matrix3d &A);
+
+/// Computes FastEigen3x3 for the first \param count matrices of \param block
+/// into \param eigenvectors. The scalar kernel gives the same results as
+/// FastEigen3x3, bit for bit. The vectorized kernels find the eigenvalues by
+/// Newton iterations instead of trigonometric functions, and agree with it to
+/// rounding. \param kernel falls back to the fastest supported kernel if the
+/// CPU does not support it.
+void FastEigen3x3(const SymmetricMatrix3dBlock &block,
+                  int count,
+                  Eigen::Vector3d *eigenvectors,
+                  FastEigen3x3Kernel kernel = GetFastEigen3x3Kernel());
+
+}  // namespace geometry
+}  // namespace open3d
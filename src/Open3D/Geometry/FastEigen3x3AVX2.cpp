@@ -0,0 +1,143 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// This file is compiled with AVX2 enabled where the compiler supports it, see
+// CMakeLists.txt. Its functions are only called on CPUs with AVX2.
+
+#include "Open3D/Geometry/FastEigen3x3SIMD.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace open3d {
+namespace geometry {
+
+#if defined(__AVX2__)
+
+namespace {
+
+/// Four lanes in an AVX register.
+struct Pack4 {
+    /// All bits of a lane set where a comparison holds.
+    struct Mask {
+        __m256d m_;
+    };
+    static const int kSize = 4;
+    static Pack4 Broadcast(double value) { return {_mm256_set1_pd(value)}; }
+    static Pack4 Load(const double *data) { return {_mm256_loadu_pd(data)}; }
+    static void Store(double *data, const Pack4 &a) {
+        _mm256_storeu_pd(data, a.v_);
+    }
+    static void StoreMask(bool *data, const Mask &mask) {
+        int bits = _mm256_movemask_pd(mask.m_);
+        data[0] = (bits & 1) != 0;
+        data[1] = (bits & 2) != 0;
+        data[2] = (bits & 4) != 0;
+        data[3] = (bits & 8) != 0;
+    }
+    __m256d v_;
+};
+
+inline Pack4 operator+(const Pack4 &a, const Pack4 &b) {
+    return {_mm256_add_pd(a.v_, b.v_)};
+}
+inline Pack4 operator-(const Pack4 &a, const Pack4 &b) {
+    return {_mm256_sub_pd(a.v_, b.v_)};
+}
+inline Pack4 operator*(const Pack4 &a, const Pack4 &b) {
+    return {_mm256_mul_pd(a.v_, b.v_)};
+}
+inline Pack4 operator/(const Pack4 &a, const Pack4 &b) {
+    return {_mm256_div_pd(a.v_, b.v_)};
+}
+inline Pack4 Sqrt(const Pack4 &a) { return {_mm256_sqrt_pd(a.v_)}; }
+inline Pack4 Abs(const Pack4 &a) {
+    return {_mm256_andnot_pd(_mm256_set1_pd(-0.0), a.v_)};
+}
+inline Pack4 Min(const Pack4 &a, const Pack4 &b) {
+    return {_mm256_min_pd(a.v_, b.v_)};
+}
+inline Pack4 Max(const Pack4 &a, const Pack4 &b) {
+    return {_mm256_max_pd(a.v_, b.v_)};
+}
+inline Pack4::Mask Less(const Pack4 &a, const Pack4 &b) {
+    return {_mm256_cmp_pd(a.v_, b.v_, _CMP_LT_OQ)};
+}
+inline Pack4::Mask Greater(const Pack4 &a, const Pack4 &b) {
+    return {_mm256_cmp_pd(a.v_, b.v_, _CMP_GT_OQ)};
+}
+inline Pack4::Mask GreaterEqual(const Pack4 &a, const Pack4 &b) {
+    return {_mm256_cmp_pd(a.v_, b.v_, _CMP_GE_OQ)};
+}
+inline Pack4::Mask NotEqual(const Pack4 &a, const Pack4 &b) {
+    return {_mm256_cmp_pd(a.v_, b.v_, _CMP_NEQ_UQ)};
+}
+inline Pack4::Mask operator&(const Pack4::Mask &a, const Pack4::Mask &b) {
+    return {_mm256_and_pd(a.m_, b.m_)};
+}
+inline Pack4::Mask operator|(const Pack4::Mask &a, const Pack4::Mask &b) {
+    return {_mm256_or_pd(a.m_, b.m_)};
+}
+inline Pack4::Mask AndNot(const Pack4::Mask &a, const Pack4::Mask &b) {
+    return {_mm256_andnot_pd(b.m_, a.m_)};
+}
+inline Pack4 Select(const Pack4::Mask &mask, const Pack4 &a, const Pack4 &b) {
+    return {_mm256_blendv_pd(b.v_, a.v_, mask.m_)};
+}
+
+}  // unnamed namespace
+
+void FastEigen3x3AVX2(const double *const coefficients[6],
+                      int count,
+                      double *x,
+                      double *y,
+                      double *z,
+                      bool *solved) {
+    FastEigen3x3Packs<Pack4>(coefficients, count, x, y, z, solved);
+}
+
+bool HasFastEigen3x3AVX2() { return true; }
+
+#else
+
+void FastEigen3x3AVX2(const double *const coefficients[6],
+                      int count,
+                      double *x,
+                      double *y,
+                      double *z,
+                      bool *solved) {
+    for (int lane = 0; lane < count; lane++) {
+        solved[lane] = false;
+    }
+}
+
+bool HasFastEigen3x3AVX2() { return false; }
+
+#endif
+
+}  // namespace geometry
+}  // namespace open3d
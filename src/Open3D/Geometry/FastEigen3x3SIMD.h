@@ -0,0 +1,284 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Vectorized kernels of the batched FastEigen3x3. This header is included by
+// translation units compiled for different instruction sets, so it must not
+// pull in Eigen or the standard library: their inline functions would be
+// emitted with the instructions of whichever unit the linker picks.
+
+#pragma once
+
+namespace open3d {
+namespace geometry {
+
+/// Solves the matrices of all complete packs among the first \param count
+/// matrices given by their \param coefficients xx, xy, xz, yy, yz and zz.
+/// The eigenvectors are written to \param x, \param y and \param z. Lanes the
+/// kernel cannot solve robustly, such as zero, diagonal or nearly isotropic
+/// matrices, and the lanes after the last complete pack are marked false in
+/// \param solved and left to the scalar solver.
+void FastEigen3x3SIMD128(const double *const coefficients[6],
+                         int count,
+                         double *x,
+                         double *y,
+                         double *z,
+                         bool *solved);
+void FastEigen3x3AVX2(const double *const coefficients[6],
+                      int count,
+                      double *x,
+                      double *y,
+                      double *z,
+                      bool *solved);
+
+/// Whether the kernels were compiled for their instruction sets. The CPU
+/// support for AVX2 is checked separately.
+bool HasFastEigen3x3SIMD128();
+bool HasFastEigen3x3AVX2();
+
+namespace {
+
+/// Three components, each a pack of lanes.
+template <class Pack>
+struct PackVector3 {
+    Pack x_;
+    Pack y_;
+    Pack z_;
+};
+
+template <class Pack>
+inline PackVector3<Pack> Cross(const PackVector3<Pack> &a,
+                               const PackVector3<Pack> &b) {
+    return {a.y_ * b.z_ - a.z_ * b.y_, a.z_ * b.x_ - a.x_ * b.z_,
+            a.x_ * b.y_ - a.y_ * b.x_};
+}
+
+template <class Pack>
+inline Pack Dot(const PackVector3<Pack> &a, const PackVector3<Pack> &b) {
+    return a.x_ * b.x_ + a.y_ * b.y_ + a.z_ * b.z_;
+}
+
+template <class Pack>
+inline PackVector3<Pack> Select(const typename Pack::Mask &mask,
+                                const PackVector3<Pack> &a,
+                                const PackVector3<Pack> &b) {
+    return {Select(mask, a.x_, b.x_), Select(mask, a.y_, b.y_),
+            Select(mask, a.z_, b.z_)};
+}
+
+/// Symmetric matrix of a pack of lanes.
+template <class Pack>
+struct PackMatrix3 {
+    Pack a00_;
+    Pack a01_;
+    Pack a02_;
+    Pack a11_;
+    Pack a12_;
+    Pack a22_;
+
+    PackVector3<Pack> operator*(const PackVector3<Pack> &v) const {
+        return {a00_ * v.x_ + a01_ * v.y_ + a02_ * v.z_,
+                a01_ * v.x_ + a11_ * v.y_ + a12_ * v.z_,
+                a02_ * v.x_ + a12_ * v.y_ + a22_ * v.z_};
+    }
+};
+
+/// ComputeEigenvector0 of FastEigen3x3.cpp with the branches replaced by
+/// selects: the eigenvector of the simple eigenvalue \param eval is the
+/// longest cross product of two rows of A - eval * I.
+template <class Pack>
+inline PackVector3<Pack> PackEigenvector0(const PackMatrix3<Pack> &A,
+                                          const Pack &eval) {
+    PackVector3<Pack> row0 = {A.a00_ - eval, A.a01_, A.a02_};
+    PackVector3<Pack> row1 = {A.a01_, A.a11_ - eval, A.a12_};
+    PackVector3<Pack> row2 = {A.a02_, A.a12_, A.a22_ - eval};
+    PackVector3<Pack> r0xr1 = Cross(row0, row1);
+    PackVector3<Pack> r0xr2 = Cross(row0, row2);
+    PackVector3<Pack> r1xr2 = Cross(row1, row2);
+    Pack d0 = Dot(r0xr1, r0xr1);
+    Pack d1 = Dot(r0xr2, r0xr2);
+    Pack d2 = Dot(r1xr2, r1xr2);
+
+    typename Pack::Mask pick1 = Greater(d1, d0);
+    Pack dmax = Select(pick1, d1, d0);
+    typename Pack::Mask pick2 = Greater(d2, dmax);
+    dmax = Select(pick2, d2, dmax);
+    PackVector3<Pack> v = Select(pick2, r1xr2, Select(pick1, r0xr2, r0xr1));
+    Pack inv_length = Pack::Broadcast(1.0) / Sqrt(dmax);
+    return {v.x_ * inv_length, v.y_ * inv_length, v.z_ * inv_length};
+}
+
+/// ComputeEigenvector1 of FastEigen3x3.cpp with the branches replaced by
+/// selects: the eigenvector of \param eval1 orthogonal to \param evec0.
+template <class Pack>
+inline PackVector3<Pack> PackEigenvector1(const PackMatrix3<Pack> &A,
+                                          const PackVector3<Pack> &evec0,
+                                          const Pack &eval1) {
+    const Pack zero = Pack::Broadcast(0.0);
+    const Pack one = Pack::Broadcast(1.0);
+    typename Pack::Mask x_larger = Greater(Abs(evec0.x_), Abs(evec0.y_));
+    Pack inv_length_x =
+            one / Sqrt(evec0.x_ * evec0.x_ + evec0.z_ * evec0.z_);
+    Pack inv_length_y =
+            one / Sqrt(evec0.y_ * evec0.y_ + evec0.z_ * evec0.z_);
+    PackVector3<Pack> U = {
+            Select(x_larger, zero - evec0.z_ * inv_length_x, zero),
+            Select(x_larger, zero, evec0.z_ * inv_length_y),
+            Select(x_larger, evec0.x_ * inv_length_x,
+                   zero - evec0.y_ * inv_length_y)};
+    PackVector3<Pack> V = Cross(evec0, U);
+    PackVector3<Pack> AU = A * U;
+    PackVector3<Pack> AV = A * V;
+
+    Pack m00 = Dot(U, AU) - eval1;
+    Pack m01 = Dot(U, AV);
+    Pack m11 = Dot(V, AV) - eval1;
+    Pack abs_m00 = Abs(m00);
+    Pack abs_m01 = Abs(m01);
+    Pack abs_m11 = Abs(m11);
+
+    // normalize (m_diagonal, m01), dividing by its larger component, where
+    // m_diagonal is the larger of m00 and m11
+    typename Pack::Mask m00_larger = GreaterEqual(abs_m00, abs_m11);
+    Pack diagonal = Select(m00_larger, m00, m11);
+    Pack abs_diagonal = Select(m00_larger, abs_m00, abs_m11);
+    typename Pack::Mask diagonal_larger = GreaterEqual(abs_diagonal, abs_m01);
+    Pack ratio = Select(diagonal_larger, m01, diagonal) /
+                 Select(diagonal_larger, diagonal, m01);
+    Pack scale = one / Sqrt(one + ratio * ratio);
+    Pack diagonal_n = Select(diagonal_larger, scale, ratio * scale);
+    Pack m01_n = Select(diagonal_larger, ratio * scale, scale);
+
+    PackVector3<Pack> evec1 = Select(
+            m00_larger,
+            PackVector3<Pack>{m01_n * U.x_ - diagonal_n * V.x_,
+                              m01_n * U.y_ - diagonal_n * V.y_,
+                              m01_n * U.z_ - diagonal_n * V.z_},
+            PackVector3<Pack>{diagonal_n * U.x_ - m01_n * V.x_,
+                              diagonal_n * U.y_ - m01_n * V.y_,
+                              diagonal_n * U.z_ - m01_n * V.z_});
+    // U itself if both components are zero
+    return Select(Greater(Max(abs_diagonal, abs_m01), zero), evec1, U);
+}
+
+/// FastEigen3x3 of FastEigen3x3.cpp for packs of lanes, see
+/// FastEigen3x3SIMD128. The trigonometric solution of the characteristic
+/// polynomial is replaced by Newton iterations: with the scaled eigenvalues
+/// beta = (eval - q) / p, it reads beta^3 - 3 beta - 2 half_det = 0. Its
+/// largest root lies in [sqrt(3), 2] for half_det >= 0 and its smallest in
+/// [-2, -sqrt(3)] otherwise. These are the simple roots the scalar solver
+/// starts from, and three iterations from a quadratic guess converge to
+/// rounding over the whole range.
+template <class Pack>
+void FastEigen3x3Packs(const double *const coefficients[6],
+                       int count,
+                       double *x,
+                       double *y,
+                       double *z,
+                       bool *solved) {
+    typedef typename Pack::Mask Mask;
+    const Pack zero = Pack::Broadcast(0.0);
+    const Pack one = Pack::Broadcast(1.0);
+    const Pack three = Pack::Broadcast(3.0);
+    const Pack sqrt_three = Pack::Broadcast(1.7320508075688772);
+    const Pack guess_quadratic = Pack::Broadcast(2.0 - 1.7320508075688772 -
+                                                 1.0 / 3.0);
+    int lane = 0;
+    for (; lane + Pack::kSize <= count; lane += Pack::kSize) {
+        const Pack a00 = Pack::Load(coefficients[0] + lane);
+        const Pack a01 = Pack::Load(coefficients[1] + lane);
+        const Pack a02 = Pack::Load(coefficients[2] + lane);
+        const Pack a11 = Pack::Load(coefficients[3] + lane);
+        const Pack a12 = Pack::Load(coefficients[4] + lane);
+        const Pack a22 = Pack::Load(coefficients[5] + lane);
+        Pack max_coeff =
+                Max(Max(Max(a00, a01), Max(a02, a11)), Max(a12, a22));
+        Mask nonzero = NotEqual(max_coeff, zero);
+        Pack divisor = Select(nonzero, max_coeff, one);
+        PackMatrix3<Pack> A = {a00 / divisor, a01 / divisor, a02 / divisor,
+                               a11 / divisor, a12 / divisor, a22 / divisor};
+
+        Pack norm = A.a01_ * A.a01_ + A.a02_ * A.a02_ + A.a12_ * A.a12_;
+        Pack q = (A.a00_ + A.a11_ + A.a22_) / three;
+        Pack b00 = A.a00_ - q;
+        Pack b11 = A.a11_ - q;
+        Pack b22 = A.a22_ - q;
+        Pack p = Sqrt((b00 * b00 + b11 * b11 + b22 * b22 + norm + norm) /
+                      Pack::Broadcast(6.0));
+        Pack c00 = b11 * b22 - A.a12_ * A.a12_;
+        Pack c01 = A.a01_ * b22 - A.a12_ * A.a02_;
+        Pack c02 = A.a01_ * A.a12_ - b11 * A.a02_;
+        Pack p3 = Select(Greater(p, zero), p * p * p, one);
+        Pack half_det = (b00 * c00 - A.a01_ * c01 + A.a02_ * c02) / p3 *
+                        Pack::Broadcast(0.5);
+        half_det = Min(Max(half_det, Pack::Broadcast(-1.0)), one);
+
+        Pack h = Abs(half_det);
+        Pack beta = sqrt_three + h / three + guess_quadratic * h * h;
+        for (int i = 0; i < 3; i++) {
+            beta = beta - (beta * beta * beta - three * beta - (h + h)) /
+                                  (three * beta * beta - three);
+        }
+        // the other two roots solve beta^2 + first beta + first^2 - 3 = 0
+        Mask upper = GreaterEqual(half_det, zero);
+        Pack first = Select(upper, beta, zero - beta);
+        Pack root = Sqrt(Max(Pack::Broadcast(12.0) - three * first * first,
+                             zero));
+        Pack half = Pack::Broadcast(0.5);
+        Pack beta0 = Select(upper, (zero - first - root) * half, first);
+        Pack beta2 = Select(upper, first, (root - first) * half);
+        Pack beta1 = zero - (beta0 + beta2);
+        Pack eval0 = q + p * beta0;
+        Pack eval1 = q + p * beta1;
+        Pack eval2 = q + p * beta2;
+
+        PackVector3<Pack> evec_first =
+                PackEigenvector0(A, Select(upper, eval2, eval0));
+        PackVector3<Pack> evec1 = PackEigenvector1(A, evec_first, eval1);
+        PackVector3<Pack> normal =
+                Select(upper, Cross(evec1, evec_first), evec_first);
+
+        // the lanes taking the same branches as the scalar solver
+        Mask smallest0 = Less(eval0, eval1) & Less(eval0, eval2);
+        Mask smallest1 = Less(eval1, eval0) & Less(eval1, eval2);
+        Mask smallest2 = Less(eval2, eval0) & Less(eval2, eval1);
+        Mask lane_solved =
+                nonzero & Greater(norm, zero) &
+                (AndNot(AndNot(upper, smallest2), smallest1) |
+                 AndNot(smallest0, upper));
+        Pack::Store(x + lane, normal.x_);
+        Pack::Store(y + lane, normal.y_);
+        Pack::Store(z + lane, normal.z_);
+        Pack::StoreMask(solved + lane, lane_solved);
+    }
+    for (; lane < count; lane++) {
+        solved[lane] = false;
+    }
+}
+
+}  // unnamed namespace
+
+}  // namespace geometry
+}  // namespace open3d
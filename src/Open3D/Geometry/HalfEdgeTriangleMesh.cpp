@@ -27,6 +27,8 @@
 #include "Open3D/Geometry/HalfEdgeTriangleMesh.h"
 #include "Open3D/Geometry/BoundingVolume.h"
 
+#include <algorithm>
+#include <atomic>
 #include <numeric>
 
 #include "Open3D/Utility/Console.h"
@@ -48,117 +50,229 @@ HalfEdgeTriangleMesh &HalfEdgeTriangleMesh::Clear() {
     // TriangleMesh::Clear();
     half_edges_.clear();
     ordered_half_edge_from_vertex_.clear();
+    one_ring_offsets_.clear();
+    one_ring_half_edges_.clear();
     return *this;
 }
 
+namespace {
+
+/// Parallel counting sort that scatters the item indices
+/// 0 .. num_items - 1 into num_buckets buckets given by \p bucket_of. Bucket b
+/// is items[offsets[b]] to items[offsets[b + 1] - 1]; the order inside a
+/// bucket is not deterministic and has to be fixed by the caller.
+template <typename F>
+void BucketIndices(int num_items,
+                   size_t num_buckets,
+                   F bucket_of,
+                   std::vector<int> &offsets,
+                   std::vector<int> &items) {
+    std::vector<std::atomic<int>> cursors(num_buckets);
+    for (auto &cursor : cursors) {
+        cursor.store(0, std::memory_order_relaxed);
+    }
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < num_items; ++i) {
+        cursors[bucket_of(i)].fetch_add(1, std::memory_order_relaxed);
+    }
+    offsets.resize(num_buckets + 1);
+    offsets[0] = 0;
+    for (size_t b = 0; b < num_buckets; ++b) {
+        int count = cursors[b].load(std::memory_order_relaxed);
+        offsets[b + 1] = offsets[b] + count;
+        cursors[b].store(offsets[b], std::memory_order_relaxed);
+    }
+    items.resize(num_items);
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < num_items; ++i) {
+        items[cursors[bucket_of(i)].fetch_add(1, std::memory_order_relaxed)] =
+                i;
+    }
+}
+
+}  // unnamed namespace
+
+void HalfEdgeTriangleMesh::GroupHalfEdgesByEdge(
+        const std::vector<Eigen::Vector3i> &triangles,
+        size_t num_vertices,
+        std::vector<int> &edge_offsets,
+        std::vector<int> &edge_half_edges) {
+    const int num_half_edges = int(triangles.size() * 3);
+    auto Source = [&](int he) { return triangles[he / 3](he % 3); };
+    auto Target = [&](int he) { return triangles[he / 3]((he + 1) % 3); };
+    auto MinVertex = [&](int he) { return std::min(Source(he), Target(he)); };
+    auto MaxVertex = [&](int he) { return std::max(Source(he), Target(he)); };
+
+    std::vector<int> bucket_offsets;
+    BucketIndices(num_half_edges, num_vertices, MinVertex, bucket_offsets,
+                  edge_half_edges);
+
+    // Sort every bucket by the larger vertex and count the distinct edges.
+    const int num_buckets = int(num_vertices);
+    std::vector<int> bucket_edge_offsets(num_vertices + 1, 0);
+#pragma omp parallel for schedule(static)
+    for (int b = 0; b < num_buckets; ++b) {
+        auto begin = edge_half_edges.begin() + bucket_offsets[b];
+        auto end = edge_half_edges.begin() + bucket_offsets[b + 1];
+        std::sort(begin, end, [&](int he0, int he1) {
+            int v0 = MaxVertex(he0);
+            int v1 = MaxVertex(he1);
+            return v0 < v1 || (v0 == v1 && he0 < he1);
+        });
+        int num_edges = 0;
+        for (auto it = begin; it != end; ++it) {
+            if (it == begin || MaxVertex(*it) != MaxVertex(*(it - 1))) {
+                num_edges++;
+            }
+        }
+        bucket_edge_offsets[b + 1] = num_edges;
+    }
+    for (int b = 0; b < num_buckets; ++b) {
+        bucket_edge_offsets[b + 1] += bucket_edge_offsets[b];
+    }
+
+    edge_offsets.resize(bucket_edge_offsets[num_buckets] + 1);
+    edge_offsets.back() = num_half_edges;
+#pragma omp parallel for schedule(static)
+    for (int b = 0; b < num_buckets; ++b) {
+        int edge_index = bucket_edge_offsets[b];
+        for (int i = bucket_offsets[b]; i < bucket_offsets[b + 1]; ++i) {
+            if (i == bucket_offsets[b] ||
+                MaxVertex(edge_half_edges[i]) !=
+                        MaxVertex(edge_half_edges[i - 1])) {
+                edge_offsets[edge_index++] = i;
+            }
+        }
+    }
+}
+
 bool HalfEdgeTriangleMesh::ComputeHalfEdges() {
     // Clean up half-edge related data structures
     half_edges_.clear();
     ordered_half_edge_from_vertex_.clear();
-
-    // Collect half edges
-    // Check: for valid manifolds, there mustn't be duplicated half-edges
-    std::unordered_map<Eigen::Vector2i, size_t,
-                       utility::hash_eigen::hash<Eigen::Vector2i>>
-            vertex_indices_to_half_edge_index;
-
-    for (size_t triangle_index = 0; triangle_index < triangles_.size();
-         triangle_index++) {
-        const Eigen::Vector3i &triangle = triangles_[triangle_index];
-        size_t num_half_edges = half_edges_.size();
-
-        size_t he_0_index = num_half_edges;
-        size_t he_1_index = num_half_edges + 1;
-        size_t he_2_index = num_half_edges + 2;
-        HalfEdge he_0(Eigen::Vector2i(triangle(0), triangle(1)),
-                      int(triangle_index), int(he_1_index), -1);
-        HalfEdge he_1(Eigen::Vector2i(triangle(1), triangle(2)),
-                      int(triangle_index), int(he_2_index), -1);
-        HalfEdge he_2(Eigen::Vector2i(triangle(2), triangle(0)),
-                      int(triangle_index), int(he_0_index), -1);
-
-        if (vertex_indices_to_half_edge_index.find(he_0.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end() ||
-            vertex_indices_to_half_edge_index.find(he_1.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end() ||
-            vertex_indices_to_half_edge_index.find(he_2.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end()) {
-            utility::LogWarning(
-                    "ComputeHalfEdges failed. Duplicated half-edges.\n");
-            return false;
-        }
-
-        half_edges_.push_back(he_0);
-        half_edges_.push_back(he_1);
-        half_edges_.push_back(he_2);
-        vertex_indices_to_half_edge_index[he_0.vertex_indices_] = he_0_index;
-        vertex_indices_to_half_edge_index[he_1.vertex_indices_] = he_1_index;
-        vertex_indices_to_half_edge_index[he_2.vertex_indices_] = he_2_index;
+    one_ring_offsets_.clear();
+    one_ring_half_edges_.clear();
+
+    // Half-edge 3 * t + k starts at triangles_[t](k), the next half-edge is
+    // the following corner of the same triangle.
+    const int num_half_edges = int(triangles_.size() * 3);
+    half_edges_.resize(num_half_edges);
+#pragma omp parallel for schedule(static)
+    for (int he = 0; he < num_half_edges; ++he) {
+        const Eigen::Vector3i &triangle = triangles_[he / 3];
+        int k = he % 3;
+        half_edges_[he] = HalfEdge(
+                Eigen::Vector2i(triangle(k), triangle((k + 1) % 3)), he / 3,
+                he - k + (k + 1) % 3, -1);
     }
 
-    // Fill twin half-edge. In the previous step, it is already guaranteed that
-    // each half-edge can have at most one twin half-edge.
-    for (size_t this_he_index = 0; this_he_index < half_edges_.size();
-         this_he_index++) {
-        HalfEdge &this_he = half_edges_[this_he_index];
-        Eigen::Vector2i twin_end_points(this_he.vertex_indices_(1),
-                                        this_he.vertex_indices_(0));
-        if (this_he.twin_ == -1 &&
-            vertex_indices_to_half_edge_index.find(twin_end_points) !=
-                    vertex_indices_to_half_edge_index.end()) {
-            size_t twin_he_index =
-                    vertex_indices_to_half_edge_index[twin_end_points];
-            HalfEdge &twin_he = half_edges_[twin_he_index];
-            this_he.twin_ = int(twin_he_index);
-            twin_he.twin_ = int(this_he_index);
+    // Fill twin half-edges. For valid manifolds, there mustn't be duplicated
+    // half-edges, so an edge holds at most one half-edge in each direction.
+    std::vector<int> edge_offsets;
+    std::vector<int> edge_half_edges;
+    GroupHalfEdgesByEdge(triangles_, vertices_.size(), edge_offsets,
+                         edge_half_edges);
+    const int num_edges = int(edge_offsets.size()) - 1;
+    bool duplicated = false;
+#pragma omp parallel for schedule(static) reduction(|| : duplicated)
+    for (int e = 0; e < num_edges; ++e) {
+        int num_edge_half_edges = edge_offsets[e + 1] - edge_offsets[e];
+        if (num_edge_half_edges > 2) {
+            duplicated = true;
+        } else if (num_edge_half_edges == 2) {
+            int he0 = edge_half_edges[edge_offsets[e]];
+            int he1 = edge_half_edges[edge_offsets[e] + 1];
+            if (half_edges_[he0].vertex_indices_(0) ==
+                half_edges_[he1].vertex_indices_(0)) {
+                duplicated = true;
+            } else {
+                half_edges_[he0].twin_ = he1;
+                half_edges_[he1].twin_ = he0;
+            }
         }
     }
-
-    // Get out-going half-edges from each vertex. This can be done during
-    // half-edge construction. Done here for readability.
-    std::vector<std::vector<int>> half_edges_from_vertex(vertices_.size());
-    for (size_t half_edge_index = 0; half_edge_index < half_edges_.size();
-         half_edge_index++) {
-        int src_vertex_index = half_edges_[half_edge_index].vertex_indices_(0);
-        half_edges_from_vertex[src_vertex_index].push_back(
-                int(half_edge_index));
+    if (duplicated) {
+        half_edges_.clear();
+        utility::LogWarning(
+                "ComputeHalfEdges failed. Duplicated half-edges.\n");
+        return false;
     }
 
+    // Get out-going half-edges from each vertex, in increasing order.
+    std::vector<int> from_vertex_offsets;
+    std::vector<int> from_vertex_half_edges;
+    BucketIndices(
+            num_half_edges, vertices_.size(),
+            [&](int he) { return half_edges_[he].vertex_indices_(0); },
+            from_vertex_offsets, from_vertex_half_edges);
+
     // Find ordered half-edges from each vertex by traversal. To be a valid
     // manifold, there can be at most 1 boundary half-edge from each vertex.
-    ordered_half_edge_from_vertex_.resize(vertices_.size());
-    for (size_t vertex_index = 0; vertex_index < vertices_.size();
-         vertex_index++) {
-        size_t num_boundaries = 0;
-        int init_half_edge_index = 0;
-        for (const int &half_edge_index :
-             half_edges_from_vertex[vertex_index]) {
-            if (half_edges_[half_edge_index].IsBoundary()) {
+    // The first pass sizes the one-rings, the second pass fills them.
+    const int num_vertices = int(vertices_.size());
+    std::vector<int> init_half_edge(num_vertices, -1);
+    one_ring_offsets_.resize(num_vertices + 1, 0);
+    bool invalid_vertex = false;
+#pragma omp parallel for schedule(static) reduction(|| : invalid_vertex)
+    for (int vertex_index = 0; vertex_index < num_vertices; ++vertex_index) {
+        auto begin = from_vertex_half_edges.begin() +
+                     from_vertex_offsets[vertex_index];
+        auto end = from_vertex_half_edges.begin() +
+                   from_vertex_offsets[vertex_index + 1];
+        if (begin == end) {
+            continue;
+        }
+        std::sort(begin, end);
+        int num_boundaries = 0;
+        for (auto it = begin; it != end; ++it) {
+            if (half_edges_[*it].IsBoundary()) {
                 num_boundaries++;
-                init_half_edge_index = half_edge_index;
+                init_half_edge[vertex_index] = *it;
             }
         }
         if (num_boundaries > 1) {
-            utility::LogWarning("ComputeHalfEdges failed. Invalid vertex.\n");
-            return false;
+            invalid_vertex = true;
+            continue;
         }
         // If there is a boundary edge, start from that; otherwise start
-        // with any half-edge (default 0) started from this vertex.
+        // with the first half-edge started from this vertex.
         if (num_boundaries == 0) {
-            init_half_edge_index = half_edges_from_vertex[vertex_index][0];
+            init_half_edge[vertex_index] = *begin;
         }
+        int ring_size = 0;
+        int curr_he_index = init_half_edge[vertex_index];
+        do {
+            ring_size++;
+            curr_he_index = NextHalfEdgeFromVertex(curr_he_index);
+        } while (curr_he_index != -1 &&
+                 curr_he_index != init_half_edge[vertex_index]);
+        one_ring_offsets_[vertex_index + 1] = ring_size;
+    }
+    if (invalid_vertex) {
+        half_edges_.clear();
+        one_ring_offsets_.clear();
+        utility::LogWarning("ComputeHalfEdges failed. Invalid vertex.\n");
+        return false;
+    }
+    for (int vertex_index = 0; vertex_index < num_vertices; ++vertex_index) {
+        one_ring_offsets_[vertex_index + 1] += one_ring_offsets_[vertex_index];
+    }
 
-        // Push edges to ordered_half_edge_from_vertex_.
-        int curr_he_index = init_half_edge_index;
-        ordered_half_edge_from_vertex_[vertex_index].push_back(curr_he_index);
-        int next_next_twin_he_index = NextHalfEdgeFromVertex(curr_he_index);
-        curr_he_index = next_next_twin_he_index;
-        while (curr_he_index != -1 && curr_he_index != init_half_edge_index) {
-            ordered_half_edge_from_vertex_[vertex_index].push_back(
-                    curr_he_index);
-            next_next_twin_he_index = NextHalfEdgeFromVertex(curr_he_index);
-            curr_he_index = next_next_twin_he_index;
+    one_ring_half_edges_.resize(one_ring_offsets_[num_vertices]);
+    ordered_half_edge_from_vertex_.resize(num_vertices);
+#pragma omp parallel for schedule(static)
+    for (int vertex_index = 0; vertex_index < num_vertices; ++vertex_index) {
+        int *ring = one_ring_half_edges_.data() +
+                    one_ring_offsets_[vertex_index];
+        int ring_size = one_ring_offsets_[vertex_index + 1] -
+                        one_ring_offsets_[vertex_index];
+        int curr_he_index = init_half_edge[vertex_index];
+        for (int i = 0; i < ring_size; ++i) {
+            ring[i] = curr_he_index;
+            curr_he_index = NextHalfEdgeFromVertex(curr_he_index);
         }
+        ordered_half_edge_from_vertex_[vertex_index].assign(ring,
+                                                            ring + ring_size);
     }
     return true;
 }
@@ -180,6 +294,9 @@ int HalfEdgeTriangleMesh::NextHalfEdgeFromVertex(int half_edge_index) const {
 
 std::vector<int> HalfEdgeTriangleMesh::BoundaryHalfEdgesFromVertex(
         int vertex_index) const {
+    if (ordered_half_edge_from_vertex_[vertex_index].empty()) {
+        return {};
+    }
     int init_he_index = ordered_half_edge_from_vertex_[vertex_index][0];
     const HalfEdge &init_he = half_edges_[init_he_index];
 
@@ -223,6 +340,9 @@ std::vector<std::vector<int>> HalfEdgeTriangleMesh::GetBoundaries() const {
         // It is guaranteed that if a vertex in on boundary, the starting
         // edge must be on boundary. After purging, it's also guaranteed that
         // a vertex always have out-going half-edges after purging.
+        if (ordered_half_edge_from_vertex_[vertex_ind].empty()) {
+            continue;
+        }
         int first_half_edge_ind = ordered_half_edge_from_vertex_[vertex_ind][0];
         if (half_edges_[first_half_edge_ind].IsBoundary()) {
             std::vector<int> boundary = BoundaryVerticesFromVertex(vertex_ind);
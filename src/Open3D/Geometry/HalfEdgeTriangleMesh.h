@@ -28,6 +28,7 @@
 
 #include <Eigen/Core>
 #include <unordered_map>
+#include <vector>
 
 #include "Open3D/Geometry/Geometry3D.h"
 #include "Open3D/Geometry/TriangleMesh.h"
@@ -62,6 +63,22 @@ public:
         int triangle_index_;
     };
 
+    /// Contiguous range of half-edge indices, used to iterate over the
+    /// one-ring of a vertex without copying.
+    class HalfEdgeRange {
+    public:
+        HalfEdgeRange(const int *begin, const int *end)
+            : begin_(begin), end_(end) {}
+        const int *begin() const { return begin_; }
+        const int *end() const { return end_; }
+        size_t size() const { return size_t(end_ - begin_); }
+        bool empty() const { return begin_ == end_; }
+
+    private:
+        const int *begin_;
+        const int *end_;
+    };
+
 public:
     HalfEdgeTriangleMesh()
         : Geometry3D(Geometry::GeometryType::HalfEdgeTriangleMesh) {}
@@ -87,6 +104,9 @@ public:
 
     /// Compute and update half edges, half edge can only be computed if the
     /// mesh is a manifold. Returns true if half edges are computed.
+    /// Half-edge 3 * t + k runs from triangles_[t](k) to
+    /// triangles_[t]((k + 1) % 3), so the next half-edge is implicit and twins
+    /// are found by grouping half-edges per edge with GroupHalfEdgesByEdge.
     bool ComputeHalfEdges();
 
     bool HasVertices() const { return vertices_.size() > 0; }
@@ -94,6 +114,16 @@ public:
     /// True if half-edges have already been computed
     bool HasHalfEdges() const;
 
+    /// Counter-clockwise ordered half-edges leaving \param vertex_index,
+    /// returned in O(1) as a view into one_ring_half_edges_. If the vertex is
+    /// on the boundary, the range starts with its boundary half-edge.
+    /// Requires HasHalfEdges().
+    HalfEdgeRange OneRingHalfEdges(int vertex_index) const {
+        const int *data = one_ring_half_edges_.data();
+        return HalfEdgeRange(data + one_ring_offsets_[vertex_index],
+                             data + one_ring_offsets_[vertex_index + 1]);
+    }
+
     /// Query manifold boundary half edges from a starting vertex
     /// If query vertex is not on boundary, empty vector will be returned
     std::vector<int> BoundaryHalfEdgesFromVertex(int vertex_index) const;
@@ -117,6 +147,21 @@ public:
     static std::shared_ptr<HalfEdgeTriangleMesh> CreateFromMesh(
             const TriangleMesh &mesh);
 
+    /// Groups the half-edges of \param triangles by the undirected edge they
+    /// lie on. Half-edge 3 * t + k runs from triangles[t](k) to
+    /// triangles[t]((k + 1) % 3). The half-edges are bucketed in parallel by
+    /// their smaller vertex index and each bucket is sorted by the larger
+    /// one, so no hash map is needed. Edge e owns the half-edges
+    /// edge_half_edges[edge_offsets[e]] to
+    /// edge_half_edges[edge_offsets[e + 1] - 1], in increasing order. Edges
+    /// are ordered by (smaller vertex, larger vertex). Vertex indices must be
+    /// smaller than \param num_vertices.
+    static void GroupHalfEdgesByEdge(
+            const std::vector<Eigen::Vector3i> &triangles,
+            size_t num_vertices,
+            std::vector<int> &edge_offsets,
+            std::vector<int> &edge_half_edges);
+
 protected:
     HalfEdgeTriangleMesh(Geometry::GeometryType type) : Geometry3D(type) {}
 
@@ -139,6 +184,12 @@ public:
     /// Counter-clockwise ordered half-edges started from each vertex
     /// If the vertex is on boundary, the starting edge must be on boundary too
     std::vector<std::vector<int>> ordered_half_edge_from_vertex_;
+
+    /// Flat copy of ordered_half_edge_from_vertex_: the one-ring of vertex v
+    /// is one_ring_half_edges_[one_ring_offsets_[v]] to
+    /// one_ring_half_edges_[one_ring_offsets_[v + 1] - 1].
+    std::vector<int> one_ring_offsets_;
+    std::vector<int> one_ring_half_edges_;
 };
 
 }  // namespace geometry
@@ -26,6 +26,8 @@
 
 #include "Open3D/Geometry/Image.h"
 
+#include <algorithm>
+
 namespace {
 /// Isotropic 2D kernels are separable:
 /// two 1D kernels are applied in x and y direction.
@@ -35,6 +37,185 @@ const std::vector<double> Gaussian7 = {0.03125, 0.109375, 0.21875, 0.28125,
                                        0.21875, 0.109375, 0.03125};
 const std::vector<double> Sobel31 = {-1.0, 0.0, 1.0};
 const std::vector<double> Sobel32 = {1.0, 2.0, 1.0};
+
+using open3d::geometry::Image;
+
+/// Separable filter over the rows of single-channel float images. Rows are
+/// filtered from a copy padded with the border pixels and columns from
+/// clamped row pointers, so the kernels run without bounds checks on
+/// contiguous memory. The sums are accumulated in double in kernel order, as
+/// the per-pixel filter did.
+class SeparableFilter {
+public:
+    SeparableFilter(const std::vector<double> &dx,
+                    const std::vector<double> &dy)
+        : dx_(dx.begin(), dx.end()), dy_(dy.begin(), dy.end()) {}
+
+    /// Filters the rows [0, num_rows) of \param input horizontally into
+    /// \param output, which must have the size of \param input.
+    void FilterRows(const Image &input, int num_rows, Image &output) const {
+        const int width = input.width_;
+        const int half_kernel_size = int(dx_.size() / 2);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            std::vector<float> padded(width + 2 * half_kernel_size);
+            std::vector<double> sums(width);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+            for (int y = 0; y < num_rows; y++) {
+                const float *row = Row(input, y);
+                std::fill(padded.begin(), padded.begin() + half_kernel_size,
+                          row[0]);
+                std::copy(row, row + width, padded.begin() + half_kernel_size);
+                std::fill(padded.begin() + half_kernel_size + width,
+                          padded.end(), row[width - 1]);
+                std::fill(sums.begin(), sums.end(), 0.0);
+                for (size_t i = 0; i < dx_.size(); i++) {
+                    Accumulate(padded.data() + i, dx_[i], width, sums.data());
+                }
+                Store(sums.data(), width, Row(output, y));
+            }
+        }
+    }
+
+    /// Filters row \param y of \param input vertically into \param out, using
+    /// \param sums as scratch space of the image width.
+    void FilterColumns(const Image &input,
+                       int y,
+                       double *sums,
+                       float *out) const {
+        const int half_kernel_size = int(dy_.size() / 2);
+        std::fill(sums, sums + input.width_, 0.0);
+        for (int i = 0; i < int(dy_.size()); i++) {
+            int y_shift = std::min(std::max(y + i - half_kernel_size, 0),
+                                   input.height_ - 1);
+            Accumulate(Row(input, y_shift), dy_[i], input.width_, sums);
+        }
+        Store(sums, input.width_, out);
+    }
+
+    static float *Row(const Image &image, int y) {
+        return (float *)(image.data_.data() + y * image.BytesPerLine());
+    }
+
+private:
+    static void Accumulate(const float *p, float k, int width, double *sums) {
+        for (int x = 0; x < width; x++) {
+            sums[x] += p[x] * k;
+        }
+    }
+
+    static void Store(const double *sums, int width, float *out) {
+        for (int x = 0; x < width; x++) {
+            out[x] = (float)sums[x];
+        }
+    }
+
+    std::vector<float> dx_;
+    std::vector<float> dy_;
+};
+
+/// Scratch image for the horizontal pass, kept per thread across calls so
+/// that filtering a stream of frames does not allocate.
+Image &ScratchImage(const Image &input) {
+    static thread_local Image scratch;
+    scratch.Prepare(input.width_, input.height_, 1, 4);
+    return scratch;
+}
+
+/// Computes \param output = filter(\param input) with \param output not
+/// aliasing \param input.
+void FilterImage(const Image &input,
+                 const SeparableFilter &filter,
+                 Image &output) {
+    Image &rows = ScratchImage(input);
+    filter.FilterRows(input, input.height_, rows);
+    output.Prepare(input.width_, input.height_, 1, 4);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<double> sums(input.width_);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int y = 0; y < input.height_; y++) {
+            filter.FilterColumns(rows, y, sums.data(),
+                                 SeparableFilter::Row(output, y));
+        }
+    }
+}
+
+/// Averages the 2x2 blocks of rows \param r0 and \param r1 into \param out.
+void DownsampleRow(const float *r0, const float *r1, int width, float *out) {
+    for (int x = 0; x < width; x++) {
+        out[x] = (r0[2 * x] + r0[2 * x + 1] + r1[2 * x] + r1[2 * x + 1]) /
+                 4.0f;
+    }
+}
+
+/// Computes \param output = downsample(filter(\param input)) with
+/// \param output not aliasing \param input. Only the rows the 2x2 averaging
+/// reads are filtered, and the filtered image is never stored.
+void FilterAndDownsampleImage(const Image &input,
+                              const SeparableFilter &filter,
+                              int half_kernel_size,
+                              Image &output) {
+    output.Prepare(input.width_ / 2, input.height_ / 2, 1, 4);
+    Image &rows = ScratchImage(input);
+    filter.FilterRows(
+            input,
+            std::min(input.height_, 2 * output.height_ + half_kernel_size),
+            rows);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<double> sums(input.width_);
+        std::vector<float> r0(input.width_);
+        std::vector<float> r1(input.width_);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int y = 0; y < output.height_; y++) {
+            filter.FilterColumns(rows, 2 * y, sums.data(), r0.data());
+            filter.FilterColumns(rows, 2 * y + 1, sums.data(), r1.data());
+            DownsampleRow(r0.data(), r1.data(), output.width_,
+                          SeparableFilter::Row(output, y));
+        }
+    }
+}
+
+/// Gets the kernels of \param type, returns false for unknown types.
+bool GetFilterKernels(Image::FilterType type,
+                      const std::vector<double> *&dx,
+                      const std::vector<double> *&dy) {
+    switch (type) {
+        case Image::FilterType::Gaussian3:
+            dx = dy = &Gaussian3;
+            return true;
+        case Image::FilterType::Gaussian5:
+            dx = dy = &Gaussian5;
+            return true;
+        case Image::FilterType::Gaussian7:
+            dx = dy = &Gaussian7;
+            return true;
+        case Image::FilterType::Sobel3Dx:
+            dx = &Sobel31;
+            dy = &Sobel32;
+            return true;
+        case Image::FilterType::Sobel3Dy:
+            dx = &Sobel32;
+            dy = &Sobel31;
+            return true;
+        default:
+            return false;
+    }
+}
+
 }  // unnamed namespace
 
 namespace open3d {
@@ -149,116 +330,150 @@ Image &Image::LinearTransform(double scale, double offset /* = 0.0*/) {
 
 std::shared_ptr<Image> Image::Downsample() const {
     auto output = std::make_shared<Image>();
+    Downsample(*output);
+    return output;
+}
+
+bool Image::Downsample(Image &output) const {
     if (num_of_channels_ != 1 || bytes_per_channel_ != 4) {
         utility::LogWarning("[Downsample] Unsupported image format.\n");
-        return output;
+        output.Clear();
+        return false;
     }
-    int half_width = (int)floor((double)width_ / 2.0);
-    int half_height = (int)floor((double)height_ / 2.0);
-    output->Prepare(half_width, half_height, 1, 4);
+    if (&output == this) {
+        Image downsampled;
+        Downsample(downsampled);
+        output = downsampled;
+        return true;
+    }
+    output.Prepare(width_ / 2, height_ / 2, 1, 4);
 
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-    for (int y = 0; y < output->height_; y++) {
-        for (int x = 0; x < output->width_; x++) {
-            float *p1 = PointerAt<float>(x * 2, y * 2);
-            float *p2 = PointerAt<float>(x * 2 + 1, y * 2);
-            float *p3 = PointerAt<float>(x * 2, y * 2 + 1);
-            float *p4 = PointerAt<float>(x * 2 + 1, y * 2 + 1);
-            float *p = output->PointerAt<float>(x, y);
-            *p = (*p1 + *p2 + *p3 + *p4) / 4.0f;
-        }
+    for (int y = 0; y < output.height_; y++) {
+        DownsampleRow(SeparableFilter::Row(*this, y * 2),
+                      SeparableFilter::Row(*this, y * 2 + 1), output.width_,
+                      SeparableFilter::Row(output, y));
     }
-    return output;
+    return true;
+}
+
+bool Image::FilterAndDownsample(Image::FilterType type, Image &output) const {
+    const std::vector<double> *dx, *dy;
+    if (!GetFilterKernels(type, dx, dy)) {
+        utility::LogWarning(
+                "[FilterAndDownsample] Unsupported filter type.\n");
+        output.Clear();
+        return false;
+    }
+    if (num_of_channels_ != 1 || bytes_per_channel_ != 4) {
+        utility::LogWarning(
+                "[FilterAndDownsample] Unsupported image format.\n");
+        output.Clear();
+        return false;
+    }
+    if (&output == this) {
+        Image downsampled;
+        FilterAndDownsample(type, downsampled);
+        output = downsampled;
+        return true;
+    }
+    FilterAndDownsampleImage(*this, SeparableFilter(*dx, *dy),
+                             int(dy->size() / 2), output);
+    return true;
 }
 
 std::shared_ptr<Image> Image::FilterHorizontal(
         const std::vector<double> &kernel) const {
     auto output = std::make_shared<Image>();
+    FilterHorizontal(kernel, *output);
+    return output;
+}
+
+bool Image::FilterHorizontal(const std::vector<double> &kernel,
+                             Image &output) const {
     if (num_of_channels_ != 1 || bytes_per_channel_ != 4 ||
         kernel.size() % 2 != 1) {
         utility::LogWarning(
                 "[FilterHorizontal] Unsupported image format or kernel "
                 "size.\n");
-        return output;
+        output.Clear();
+        return false;
     }
-    output->Prepare(width_, height_, 1, 4);
-
-    const int half_kernel_size = (int)(floor((double)kernel.size() / 2.0));
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int y = 0; y < height_; y++) {
-        for (int x = 0; x < width_; x++) {
-            float *po = output->PointerAt<float>(x, y, 0);
-            double temp = 0;
-            for (int i = -half_kernel_size; i <= half_kernel_size; i++) {
-                int x_shift = x + i;
-                if (x_shift < 0) x_shift = 0;
-                if (x_shift > width_ - 1) x_shift = width_ - 1;
-                float *pi = PointerAt<float>(x_shift, y, 0);
-                temp += (*pi * (float)kernel[i + half_kernel_size]);
-            }
-            *po = (float)temp;
-        }
+    if (&output == this) {
+        Image filtered;
+        FilterHorizontal(kernel, filtered);
+        output = filtered;
+        return true;
     }
-    return output;
+    output.Prepare(width_, height_, 1, 4);
+    SeparableFilter(kernel, kernel).FilterRows(*this, height_, output);
+    return true;
 }
 
 std::shared_ptr<Image> Image::Filter(Image::FilterType type) const {
     auto output = std::make_shared<Image>();
-    if (num_of_channels_ != 1 || bytes_per_channel_ != 4) {
-        utility::LogWarning("[Filter] Unsupported image format.\n");
-        return output;
-    }
+    Filter(type, *output);
+    return output;
+}
 
-    switch (type) {
-        case Image::FilterType::Gaussian3:
-            output = Filter(Gaussian3, Gaussian3);
-            break;
-        case Image::FilterType::Gaussian5:
-            output = Filter(Gaussian5, Gaussian5);
-            break;
-        case Image::FilterType::Gaussian7:
-            output = Filter(Gaussian7, Gaussian7);
-            break;
-        case Image::FilterType::Sobel3Dx:
-            output = Filter(Sobel31, Sobel32);
-            break;
-        case Image::FilterType::Sobel3Dy:
-            output = Filter(Sobel32, Sobel31);
-            break;
-        default:
-            utility::LogWarning("[Filter] Unsupported filter type.\n");
-            break;
+bool Image::Filter(Image::FilterType type, Image &output) const {
+    const std::vector<double> *dx, *dy;
+    if (!GetFilterKernels(type, dx, dy)) {
+        utility::LogWarning("[Filter] Unsupported filter type.\n");
+        output.Clear();
+        return false;
     }
-    return output;
+    return Filter(*dx, *dy, output);
 }
 
 ImagePyramid Image::FilterPyramid(const ImagePyramid &input,
                                   Image::FilterType type) {
-    std::vector<std::shared_ptr<Image>> output;
+    ImagePyramid output;
+    FilterPyramid(input, type, output);
+    return output;
+}
+
+bool Image::FilterPyramid(const ImagePyramid &input,
+                          Image::FilterType type,
+                          ImagePyramid &output) {
+    output.resize(input.size());
+    bool success = true;
     for (size_t i = 0; i < input.size(); i++) {
-        auto layer_filtered = input[i]->Filter(type);
-        output.push_back(layer_filtered);
+        if (output[i] == nullptr) {
+            output[i] = std::make_shared<Image>();
+        }
+        success = input[i]->Filter(type, *output[i]) && success;
     }
-    return output;
+    return success;
 }
 
 std::shared_ptr<Image> Image::Filter(const std::vector<double> &dx,
                                      const std::vector<double> &dy) const {
     auto output = std::make_shared<Image>();
-    if (num_of_channels_ != 1 || bytes_per_channel_ != 4) {
-        utility::LogWarning("[Filter] Unsupported image format.\n");
-        return output;
-    }
+    Filter(dx, dy, *output);
+    return output;
+}
 
-    auto temp1 = FilterHorizontal(dx);
-    auto temp2 = temp1->Flip();
-    auto temp3 = temp2->FilterHorizontal(dy);
-    auto temp4 = temp3->Flip();
-    return temp4;
+bool Image::Filter(const std::vector<double> &dx,
+                   const std::vector<double> &dy,
+                   Image &output) const {
+    if (num_of_channels_ != 1 || bytes_per_channel_ != 4 ||
+        dx.size() % 2 != 1 || dy.size() % 2 != 1) {
+        utility::LogWarning(
+                "[Filter] Unsupported image format or kernel size.\n");
+        output.Clear();
+        return false;
+    }
+    if (&output == this) {
+        Image filtered;
+        FilterImage(*this, SeparableFilter(dx, dy), filtered);
+        output = filtered;
+        return true;
+    }
+    FilterImage(*this, SeparableFilter(dx, dy), output);
+    return true;
 }
 
 std::shared_ptr<Image> Image::Flip() const {
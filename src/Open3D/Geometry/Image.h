@@ -133,16 +133,39 @@ public:
     /// Function to filter image with pre-defined filtering type
     std::shared_ptr<Image> Filter(Image::FilterType type) const;
 
+    /// Function to filter image with pre-defined filtering type into
+    /// \param output, reusing its buffer. Returns false and clears
+    /// \param output if the image is not a single-channel float image.
+    bool Filter(Image::FilterType type, Image &output) const;
+
     /// Function to filter image with arbitrary dx, dy separable filters
     std::shared_ptr<Image> Filter(const std::vector<double> &dx,
                                   const std::vector<double> &dy) const;
 
+    /// Function to filter image with arbitrary dx, dy separable filters into
+    /// \param output, reusing its buffer. The kernels must have odd sizes.
+    bool Filter(const std::vector<double> &dx,
+                const std::vector<double> &dy,
+                Image &output) const;
+
     std::shared_ptr<Image> FilterHorizontal(
             const std::vector<double> &kernel) const;
 
+    bool FilterHorizontal(const std::vector<double> &kernel,
+                          Image &output) const;
+
     /// Function to 2x image downsample using simple 2x2 averaging
     std::shared_ptr<Image> Downsample() const;
 
+    /// Function to 2x image downsample into \param output, reusing its
+    /// buffer.
+    bool Downsample(Image &output) const;
+
+    /// Function to filter and 2x downsample an image in one pass into
+    /// \param output, with the result of Filter(type)->Downsample(). Only
+    /// the filtered pixels the downsampling reads are computed.
+    bool FilterAndDownsample(Image::FilterType type, Image &output) const;
+
     /// Function to dilate 8bit mask map
     std::shared_ptr<Image> Dilate(int half_kernel_size = 1) const;
 
@@ -165,10 +188,24 @@ public:
     static ImagePyramid FilterPyramid(const ImagePyramid &input,
                                       Image::FilterType type);
 
+    /// Function to filter image pyramid into \param output. The images of
+    /// \param output are overwritten in place and allocated when missing.
+    static bool FilterPyramid(const ImagePyramid &input,
+                              Image::FilterType type,
+                              ImagePyramid &output);
+
     /// Function to create image pyramid
     ImagePyramid CreatePyramid(size_t num_of_levels,
                                bool with_gaussian_filter = true) const;
 
+    /// Function to create image pyramid into \param pyramid, so that the
+    /// pyramids of a stream of frames reuse the same level images. The
+    /// images of \param pyramid are overwritten in place and allocated when
+    /// missing.
+    bool CreatePyramid(size_t num_of_levels,
+                       bool with_gaussian_filter,
+                       ImagePyramid &pyramid) const;
+
     /// Function to create a depthmap boundary mask from depth image
     std::shared_ptr<Image> CreateDepthBoundaryMask(
             double depth_threshold_for_discontinuity_check = 0.1,
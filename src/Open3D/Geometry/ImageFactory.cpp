@@ -145,32 +145,38 @@ template std::shared_ptr<Image> Image::CreateImageFromFloatImage<uint16_t>()
 
 ImagePyramid Image::CreatePyramid(size_t num_of_levels,
                                   bool with_gaussian_filter /*= true*/) const {
-    std::vector<std::shared_ptr<Image>> pyramid_image;
-    pyramid_image.clear();
+    ImagePyramid pyramid_image;
+    CreatePyramid(num_of_levels, with_gaussian_filter, pyramid_image);
+    return pyramid_image;
+}
+
+bool Image::CreatePyramid(size_t num_of_levels,
+                          bool with_gaussian_filter,
+                          ImagePyramid &pyramid) const {
     if ((num_of_channels_ != 1) || (bytes_per_channel_ != 4)) {
         utility::LogWarning("[CreateImagePyramid] Unsupported image format.\n");
-        return pyramid_image;
+        pyramid.clear();
+        return false;
     }
 
+    pyramid.resize(num_of_levels);
     for (size_t i = 0; i < num_of_levels; i++) {
+        if (pyramid[i] == nullptr || (i > 0 && pyramid[i].get() == this)) {
+            pyramid[i] = std::make_shared<Image>();
+        }
         if (i == 0) {
-            std::shared_ptr<Image> input_copy_ptr = std::make_shared<Image>();
-            *input_copy_ptr = *this;
-            pyramid_image.push_back(input_copy_ptr);
-        } else {
-            if (with_gaussian_filter) {
-                // https://en.wikipedia.org/wiki/Pyramid_(image_processing)
-                auto level_b = pyramid_image[i - 1]->Filter(
-                        Image::FilterType::Gaussian3);
-                auto level_bd = level_b->Downsample();
-                pyramid_image.push_back(level_bd);
-            } else {
-                auto level_d = pyramid_image[i - 1]->Downsample();
-                pyramid_image.push_back(level_d);
+            if (pyramid[i].get() != this) {
+                *pyramid[i] = *this;
             }
+        } else if (with_gaussian_filter) {
+            // https://en.wikipedia.org/wiki/Pyramid_(image_processing)
+            pyramid[i - 1]->FilterAndDownsample(Image::FilterType::Gaussian3,
+                                                *pyramid[i]);
+        } else {
+            pyramid[i - 1]->Downsample(*pyramid[i]);
         }
     }
-    return pyramid_image;
+    return true;
 }
 
 }  // namespace geometry
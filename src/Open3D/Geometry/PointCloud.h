@@ -27,6 +27,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <limits>
 #include <memory>
 #include <tuple>
 #include <vector>
@@ -132,11 +133,15 @@ public:
 
     /// Function to remove points that have less than \param nb_points in a
     /// sphere of radius \param search_radius
+    /// Neighbours are counted on a spatial hash grid; clouds the grid can not
+    /// index, e.g. with non-finite coordinates, fall back to a KD tree.
     std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
     RemoveRadiusOutliers(size_t nb_points, double search_radius) const;
 
     /// Function to remove points that are further away from their
     /// \param nb_neighbor neighbors in average.
+    /// Neighbours are searched on a spatial hash grid; points whose neighbours
+    /// lie beyond the grid search, like isolated outliers, use a KD tree.
     std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
     RemoveStatisticalOutliers(size_t nb_neighbors, double std_ratio) const;
 
@@ -218,6 +223,41 @@ public:
             const camera::PinholeCameraIntrinsic &intrinsic,
             const Eigen::Matrix4d &extrinsic = Eigen::Matrix4d::Identity());
 
+    /// Function to back-project a depth image into this point cloud, for
+    /// streaming capture loops that convert frame after frame
+    /// (PointCloudFactory.cpp). Points are computed as in
+    /// CreateFromDepthImage, in parallel over the image rows, and replace the
+    /// content of the point cloud without reallocating its memory when it is
+    /// large enough. The ray directions of \param intrinsic are cached across
+    /// calls. Only pixels (u, v) with roi(0) <= u < roi(2) and
+    /// roi(1) <= v < roi(3) are used. Return false if the image format is
+    /// not supported.
+    bool BackProjectDepthImage(
+            const Image &depth,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic = Eigen::Matrix4d::Identity(),
+            double depth_scale = 1000.0,
+            double depth_trunc = 1000.0,
+            int stride = 1,
+            const Eigen::Vector4i &roi =
+                    Eigen::Vector4i(0,
+                                    0,
+                                    std::numeric_limits<int>::max(),
+                                    std::numeric_limits<int>::max()));
+
+    /// Function to back-project an RGB-D image into this point cloud, see
+    /// BackProjectDepthImage (PointCloudFactory.cpp).
+    bool BackProjectRGBDImage(
+            const RGBDImage &image,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic = Eigen::Matrix4d::Identity(),
+            int stride = 1,
+            const Eigen::Vector4i &roi =
+                    Eigen::Vector4i(0,
+                                    0,
+                                    std::numeric_limits<int>::max(),
+                                    std::numeric_limits<int>::max()));
+
     /// Function to create a PointCloud from a VoxelGrid.
     /// It transforms the voxel centers to 3D points using the original point
     /// cloud coordinate (with respect to the center of the voxel grid).
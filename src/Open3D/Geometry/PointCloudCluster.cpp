@@ -27,10 +27,13 @@
 #include "Open3D/Geometry/PointCloud.h"
 
 #include <Eigen/Dense>
-#include <unordered_set>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <unordered_map>
 
-#include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Helper.h"
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -39,77 +42,261 @@
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+/// Lock-free union-find over point indices. The root of every set is its
+/// smallest index, because roots are always linked below smaller roots.
+class ConcurrentUnionFind {
+public:
+    explicit ConcurrentUnionFind(int size) : parents_(size) {
+        for (int idx = 0; idx < size; ++idx) {
+            parents_[idx].store(idx, std::memory_order_relaxed);
+        }
+    }
+
+    int Find(int idx) {
+        while (true) {
+            int parent = parents_[idx].load(std::memory_order_relaxed);
+            if (parent == idx) {
+                return idx;
+            }
+            int grand_parent = parents_[parent].load(std::memory_order_relaxed);
+            if (grand_parent != parent) {
+                // path halving, losing the race is harmless
+                parents_[idx].compare_exchange_weak(parent, grand_parent,
+                                                    std::memory_order_relaxed);
+            }
+            idx = grand_parent;
+        }
+    }
+
+    void Union(int idx0, int idx1) {
+        while (true) {
+            idx0 = Find(idx0);
+            idx1 = Find(idx1);
+            if (idx0 == idx1) {
+                return;
+            }
+            if (idx0 > idx1) {
+                std::swap(idx0, idx1);
+            }
+            int expected = idx1;
+            if (parents_[idx1].compare_exchange_strong(
+                        expected, idx0, std::memory_order_relaxed)) {
+                return;
+            }
+        }
+    }
+
+private:
+    std::vector<std::atomic<int>> parents_;
+};
+
+/// Uniform grid with cells of size eps over a point cloud, so that the
+/// neighbourhood of a point is covered by the 27 surrounding cells. The
+/// points are stored sorted by cell for locality and are addressed by their
+/// position in that order.
+class SortedGrid {
+public:
+    typedef Eigen::Matrix<int64_t, 3, 1> CellIndex;
+
+    SortedGrid(const std::vector<Eigen::Vector3d> &points,
+               const Eigen::Vector3d &min_bound,
+               double eps)
+        // same neighbourhood criterion as KDTreeFlann::SearchRadius
+        : radius2_(double(float(eps * eps))) {
+        const int num_points = int(points.size());
+        std::unordered_map<CellIndex, int,
+                           utility::hash_eigen::hash<CellIndex>>
+                cell_map;
+        std::vector<CellIndex> cells;
+        std::vector<int> point_cells(num_points);
+        for (int idx = 0; idx < num_points; ++idx) {
+            Eigen::Vector3d ref = (points[idx] - min_bound) / eps;
+            CellIndex cell(int64_t(std::floor(ref(0))),
+                           int64_t(std::floor(ref(1))),
+                           int64_t(std::floor(ref(2))));
+            auto it = cell_map.find(cell);
+            if (it == cell_map.end()) {
+                it = cell_map.emplace(cell, int(cells.size())).first;
+                cells.push_back(cell);
+            }
+            point_cells[idx] = it->second;
+        }
+
+        const int num_cells = int(cells.size());
+        cell_offsets_.resize(num_cells + 1, 0);
+        for (int idx = 0; idx < num_points; ++idx) {
+            cell_offsets_[point_cells[idx] + 1]++;
+        }
+        for (int cidx = 0; cidx < num_cells; ++cidx) {
+            cell_offsets_[cidx + 1] += cell_offsets_[cidx];
+        }
+        sorted_indices_.resize(num_points);
+        sorted_points_.resize(num_points);
+        sorted_cells_.resize(num_points);
+        std::vector<int> cursors(cell_offsets_.begin(),
+                                 cell_offsets_.end() - 1);
+        for (int idx = 0; idx < num_points; ++idx) {
+            int pos = cursors[point_cells[idx]]++;
+            sorted_indices_[pos] = idx;
+            sorted_points_[pos] = points[idx];
+            sorted_cells_[pos] = point_cells[idx];
+        }
+
+        cell_nb_offsets_.resize(num_cells + 1, 0);
+        for (int cidx = 0; cidx < num_cells; ++cidx) {
+            for (int64_t dx = -1; dx <= 1; ++dx) {
+                for (int64_t dy = -1; dy <= 1; ++dy) {
+                    for (int64_t dz = -1; dz <= 1; ++dz) {
+                        auto it = cell_map.find(cells[cidx] +
+                                                CellIndex(dx, dy, dz));
+                        if (it != cell_map.end()) {
+                            cell_nbs_.push_back(it->second);
+                        }
+                    }
+                }
+            }
+            cell_nb_offsets_[cidx + 1] = int(cell_nbs_.size());
+        }
+    }
+
+    /// Calls f(nb_pos) for every point within eps of the point at sorted
+    /// position pos, including the point itself, until f returns false.
+    template <typename F>
+    void ForEachNeighbour(int pos, F f) const {
+        const Eigen::Vector3d &point = sorted_points_[pos];
+        int cidx = sorted_cells_[pos];
+        for (int i = cell_nb_offsets_[cidx]; i < cell_nb_offsets_[cidx + 1];
+             ++i) {
+            int nb_cidx = cell_nbs_[i];
+            for (int nb_pos = cell_offsets_[nb_cidx];
+                 nb_pos < cell_offsets_[nb_cidx + 1]; ++nb_pos) {
+                if ((sorted_points_[nb_pos] - point).squaredNorm() <
+                            radius2_ &&
+                    !f(nb_pos)) {
+                    return;
+                }
+            }
+        }
+    }
+
+public:
+    /// Original index of the point at each sorted position.
+    std::vector<int> sorted_indices_;
+
+private:
+    double radius2_;
+    std::vector<Eigen::Vector3d> sorted_points_;
+    std::vector<int> sorted_cells_;
+    std::vector<int> cell_offsets_;
+    std::vector<int> cell_nb_offsets_;
+    std::vector<int> cell_nbs_;
+};
+
+}  // unnamed namespace
+
 std::vector<int> PointCloud::ClusterDBSCAN(double eps,
                                            size_t min_points,
                                            bool print_progress) const {
-    KDTreeFlann kdtree(*this);
+    const int num_points = int(points_.size());
+    if (num_points == 0) {
+        return std::vector<int>();
+    }
+    // the grid cells have size eps
+    if (!(eps > 0)) {
+        utility::LogWarning("[ClusterDBSCAN] eps must be positive.\n");
+        return std::vector<int>(num_points, -1);
+    }
+    const int chunk_size = 1 << 16;
+    const int num_chunks = (num_points + chunk_size - 1) / chunk_size;
+    utility::ConsoleProgressBar progress_bar(3 * num_chunks, "Clustering",
+                                             print_progress);
 
-    // precompute all neighbours
-    utility::LogDebug("Precompute Neighbours\n");
-    utility::ConsoleProgressBar progress_bar(
-            points_.size(), "Precompute Neighbours", print_progress);
-    std::vector<std::vector<int>> nbs(points_.size());
+    utility::LogDebug("Build Grid\n");
+    const SortedGrid grid(points_, GetMinBound(), eps);
+    const std::vector<int> &sorted_indices = grid.sorted_indices_;
+
+    // Core points have at least min_points neighbours, counting themselves.
+    utility::LogDebug("Detect Core Points\n");
+    std::vector<char> is_core(num_points, 0);
+    for (int chunk = 0; chunk < num_chunks; ++chunk) {
+        int end = std::min(num_points, (chunk + 1) * chunk_size);
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-    for (int idx = 0; idx < int(points_.size()); ++idx) {
-        std::vector<double> dists2;
-        kdtree.SearchRadius(points_[idx], eps, nbs[idx], dists2);
+        for (int pos = chunk * chunk_size; pos < end; ++pos) {
+            size_t count = 0;
+            grid.ForEachNeighbour(
+                    pos, [&](int) { return ++count < min_points; });
+            is_core[pos] = count >= min_points;
+        }
+        ++progress_bar;
+    }
 
+    // Clusters are the connected components of the core points.
+    utility::LogDebug("Merge Core Points\n");
+    ConcurrentUnionFind components(num_points);
+    for (int chunk = 0; chunk < num_chunks; ++chunk) {
+        int end = std::min(num_points, (chunk + 1) * chunk_size);
 #ifdef _OPENMP
-#pragma omp critical
+#pragma omp parallel for schedule(static)
 #endif
-        { ++progress_bar; }
+        for (int pos = chunk * chunk_size; pos < end; ++pos) {
+            if (!is_core[pos]) {
+                continue;
+            }
+            int idx = sorted_indices[pos];
+            grid.ForEachNeighbour(pos, [&](int nb_pos) {
+                if (nb_pos > pos && is_core[nb_pos]) {
+                    components.Union(idx, sorted_indices[nb_pos]);
+                }
+                return true;
+            });
+        }
+        ++progress_bar;
     }
-    utility::LogDebug("Done Precompute Neighbours\n");
 
-    // set all labels to undefined (-2)
-    utility::LogDebug("Compute Clusters\n");
-    progress_bar.reset(points_.size(), "Clustering", print_progress);
-    std::vector<int> labels(points_.size(), -2);
+    // Number the clusters by their smallest point index, which is the order
+    // in which a sequential scan over the points discovers them.
+    std::vector<int> labels(num_points, -1);
+    std::vector<char> is_core_point(num_points, 0);
+    for (int pos = 0; pos < num_points; ++pos) {
+        is_core_point[sorted_indices[pos]] = is_core[pos];
+    }
     int cluster_label = 0;
-    for (size_t idx = 0; idx < points_.size(); ++idx) {
-        if (labels[idx] != -2) {  // label is not undefined
-            continue;
-        }
-
-        // check density
-        if (nbs[idx].size() < min_points) {
-            labels[idx] = -1;
-            continue;
+    for (int idx = 0; idx < num_points; ++idx) {
+        if (is_core_point[idx]) {
+            int root = components.Find(idx);
+            labels[idx] = root == idx ? cluster_label++ : labels[root];
         }
+    }
 
-        std::unordered_set<int> nbs_next(nbs[idx].begin(), nbs[idx].end());
-        std::unordered_set<int> nbs_visited;
-        nbs_visited.insert(int(idx));
-
-        labels[idx] = cluster_label;
-        ++progress_bar;
-        while (!nbs_next.empty()) {
-            int nb = *nbs_next.begin();
-            nbs_next.erase(nbs_next.begin());
-            nbs_visited.insert(nb);
-
-            if (labels[nb] == -1) {  // noise label
-                labels[nb] = cluster_label;
-                ++progress_bar;
-            }
-            if (labels[nb] != -2) {  // not undefined label
+    // A border point joins the first discovered cluster among its core
+    // neighbours, points without core neighbours are noise (-1).
+    utility::LogDebug("Assign Border Points\n");
+    for (int chunk = 0; chunk < num_chunks; ++chunk) {
+        int end = std::min(num_points, (chunk + 1) * chunk_size);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int pos = chunk * chunk_size; pos < end; ++pos) {
+            if (is_core[pos]) {
                 continue;
             }
-            labels[nb] = cluster_label;
-            ++progress_bar;
-
-            if (nbs[nb].size() >= min_points) {
-                for (int qnb : nbs[nb]) {
-                    if (nbs_visited.count(qnb) == 0) {
-                        nbs_next.insert(qnb);
+            int label = -1;
+            grid.ForEachNeighbour(pos, [&](int nb_pos) {
+                if (is_core[nb_pos]) {
+                    int nb_label = labels[sorted_indices[nb_pos]];
+                    if (label == -1 || nb_label < label) {
+                        label = nb_label;
                     }
                 }
-            }
+                return true;
+            });
+            labels[sorted_indices[pos]] = label;
         }
-
-        cluster_label++;
+        ++progress_bar;
     }
 
     utility::LogDebug("Done Compute Clusters: {:d}\n", cluster_label);
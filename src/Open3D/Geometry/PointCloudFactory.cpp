@@ -25,6 +25,8 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <mutex>
 
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
 #include "Open3D/Geometry/Image.h"
@@ -38,128 +40,225 @@ namespace open3d {
 namespace {
 using namespace geometry;
 
-int CountValidDepthPixels(const Image &depth, int stride) {
-    int num_valid_pixels = 0;
-    for (int i = 0; i < depth.height_; i += stride) {
-        for (int j = 0; j < depth.width_; j += stride) {
-            const float *p = depth.PointerAt<float>(j, i);
-            if (*p > 0) num_valid_pixels += 1;
+/// Ray directions of the pixels of an image seen by a pinhole camera. The ray
+/// through pixel (u, v) is (x_[u], y_[v], 1).
+struct RayTable {
+    int width_;
+    int height_;
+    std::pair<double, double> focal_length_;
+    std::pair<double, double> principal_point_;
+    std::vector<double> x_;
+    std::vector<double> y_;
+};
+
+/// Returns the ray table of an image with the size of \param image. The table
+/// of the last intrinsic is kept, so a stream of frames from one camera
+/// builds it once.
+std::shared_ptr<const RayTable> GetRayTable(
+        const Image &image, const camera::PinholeCameraIntrinsic &intrinsic) {
+    static std::mutex mutex;
+    static std::shared_ptr<const RayTable> cached_table;
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    std::lock_guard<std::mutex> lock(mutex);
+    if (cached_table != nullptr && cached_table->width_ == image.width_ &&
+        cached_table->height_ == image.height_ &&
+        cached_table->focal_length_ == focal_length &&
+        cached_table->principal_point_ == principal_point) {
+        return cached_table;
+    }
+    auto table = std::make_shared<RayTable>();
+    table->width_ = image.width_;
+    table->height_ = image.height_;
+    table->focal_length_ = focal_length;
+    table->principal_point_ = principal_point;
+    table->x_.resize(image.width_);
+    table->y_.resize(image.height_);
+    for (int u = 0; u < image.width_; u++) {
+        table->x_[u] = (u - principal_point.first) / focal_length.first;
+    }
+    for (int v = 0; v < image.height_; v++) {
+        table->y_[v] = (v - principal_point.second) / focal_length.second;
+    }
+    cached_table = table;
+    return cached_table;
+}
+
+/// Depth in meters of a float depth pixel, invalid pixels are not positive.
+inline double DepthValue(float depth, double, double) { return depth; }
+
+/// Same conversion as Image::ConvertDepthToFloatImage.
+inline double DepthValue(uint16_t depth,
+                         double depth_scale,
+                         double depth_trunc) {
+    float z = (float)depth / (float)depth_scale;
+    return z >= depth_trunc ? 0.0 : z;
+}
+
+/// Back-projects the pixels of \param depth with a positive depth into
+/// \param pointcloud, with the colors of \param color if it is not null. The
+/// valid pixels of each row are counted first, so that every row writes its
+/// points at a known offset and the points are resized exactly once.
+template <typename TD, typename TC, int NC>
+void BackProjectImage(const Image &depth,
+                      const Image *color,
+                      const camera::PinholeCameraIntrinsic &intrinsic,
+                      const Eigen::Matrix4d &extrinsic,
+                      double depth_scale,
+                      double depth_trunc,
+                      int stride,
+                      const Eigen::Vector4i &roi,
+                      PointCloud &pointcloud) {
+    const Eigen::Matrix4d camera_pose = extrinsic.inverse();
+    const Eigen::Matrix3d rotation = camera_pose.block<3, 3>(0, 0);
+    const Eigen::Vector3d translation = camera_pose.block<3, 1>(0, 3);
+    const double scale = (sizeof(TC) == 1) ? 255.0 : 1.0;
+    const int u_min = std::max(roi(0), 0);
+    const int v_min = std::max(roi(1), 0);
+    const int u_max = std::min(roi(2), depth.width_);
+    const int v_max = std::min(roi(3), depth.height_);
+    const int num_rows =
+            v_max > v_min ? (v_max - v_min + stride - 1) / stride : 0;
+    auto table = GetRayTable(depth, intrinsic);
+
+    std::vector<int> row_offsets(num_rows + 1, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int r = 0; r < num_rows; r++) {
+        const int v = v_min + r * stride;
+        const TD *p = (const TD *)(depth.data_.data() +
+                                   v * depth.BytesPerLine());
+        int num_valid_pixels = 0;
+        for (int u = u_min; u < u_max; u += stride) {
+            if (DepthValue(p[u], depth_scale, depth_trunc) > 0) {
+                num_valid_pixels++;
+            }
+        }
+        row_offsets[r + 1] = num_valid_pixels;
+    }
+    for (int r = 0; r < num_rows; r++) {
+        row_offsets[r + 1] += row_offsets[r];
+    }
+
+    pointcloud.points_.resize(row_offsets[num_rows]);
+    pointcloud.normals_.clear();
+    if (color != nullptr) {
+        pointcloud.colors_.resize(row_offsets[num_rows]);
+    } else {
+        pointcloud.colors_.clear();
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int r = 0; r < num_rows; r++) {
+        const int v = v_min + r * stride;
+        const TD *p = (const TD *)(depth.data_.data() +
+                                   v * depth.BytesPerLine());
+        const double y_ray = table->y_[v];
+        int cnt = row_offsets[r];
+        for (int u = u_min; u < u_max; u += stride) {
+            double z = DepthValue(p[u], depth_scale, depth_trunc);
+            if (z > 0) {
+                Eigen::Vector3d point(table->x_[u] * z, y_ray * z, z);
+                pointcloud.points_[cnt] = rotation * point + translation;
+                if (color != nullptr) {
+                    const TC *pc = (const TC *)(color->data_.data() +
+                                                v * color->BytesPerLine()) +
+                                   u * NC;
+                    pointcloud.colors_[cnt] =
+                            Eigen::Vector3d(pc[0], pc[(NC - 1) / 2],
+                                            pc[NC - 1]) /
+                            scale;
+                }
+                cnt++;
+            }
         }
     }
-    return num_valid_pixels;
 }
 
-std::shared_ptr<PointCloud> CreatePointCloudFromFloatDepthImage(
+}  // unnamed namespace
+
+namespace geometry {
+std::shared_ptr<PointCloud> PointCloud::CreateFromDepthImage(
         const Image &depth,
         const camera::PinholeCameraIntrinsic &intrinsic,
-        const Eigen::Matrix4d &extrinsic,
-        int stride) {
+        const Eigen::Matrix4d &extrinsic /* = Eigen::Matrix4d::Identity()*/,
+        double depth_scale /* = 1000.0*/,
+        double depth_trunc /* = 1000.0*/,
+        int stride /* = 1*/) {
     auto pointcloud = std::make_shared<PointCloud>();
-    Eigen::Matrix4d camera_pose = extrinsic.inverse();
-    auto focal_length = intrinsic.GetFocalLength();
-    auto principal_point = intrinsic.GetPrincipalPoint();
-    int num_valid_pixels = CountValidDepthPixels(depth, stride);
-    pointcloud->points_.resize(num_valid_pixels);
-    int cnt = 0;
-    for (int i = 0; i < depth.height_; i += stride) {
-        for (int j = 0; j < depth.width_; j += stride) {
-            const float *p = depth.PointerAt<float>(j, i);
-            if (*p > 0) {
-                double z = (double)(*p);
-                double x = (j - principal_point.first) * z / focal_length.first;
-                double y =
-                        (i - principal_point.second) * z / focal_length.second;
-                Eigen::Vector4d point =
-                        camera_pose * Eigen::Vector4d(x, y, z, 1.0);
-                pointcloud->points_[cnt++] = point.block<3, 1>(0, 0);
-            }
-        }
+    if (!pointcloud->BackProjectDepthImage(depth, intrinsic, extrinsic,
+                                           depth_scale, depth_trunc, stride)) {
+        utility::LogWarning(
+                "[CreatePointCloudFromDepthImage] Unsupported image "
+                "format.\n");
     }
     return pointcloud;
 }
 
-template <typename TC, int NC>
-std::shared_ptr<PointCloud> CreatePointCloudFromRGBDImageT(
+std::shared_ptr<PointCloud> PointCloud::CreateFromRGBDImage(
         const RGBDImage &image,
         const camera::PinholeCameraIntrinsic &intrinsic,
-        const Eigen::Matrix4d &extrinsic) {
+        const Eigen::Matrix4d &extrinsic /* = Eigen::Matrix4d::Identity()*/) {
     auto pointcloud = std::make_shared<PointCloud>();
-    Eigen::Matrix4d camera_pose = extrinsic.inverse();
-    auto focal_length = intrinsic.GetFocalLength();
-    auto principal_point = intrinsic.GetPrincipalPoint();
-    double scale = (sizeof(TC) == 1) ? 255.0 : 1.0;
-    int num_valid_pixels = CountValidDepthPixels(image.depth_, 1);
-    pointcloud->points_.resize(num_valid_pixels);
-    pointcloud->colors_.resize(num_valid_pixels);
-    int cnt = 0;
-    for (int i = 0; i < image.depth_.height_; i++) {
-        float *p = (float *)(image.depth_.data_.data() +
-                             i * image.depth_.BytesPerLine());
-        TC *pc = (TC *)(image.color_.data_.data() +
-                        i * image.color_.BytesPerLine());
-        for (int j = 0; j < image.depth_.width_; j++, p++, pc += NC) {
-            if (*p > 0) {
-                double z = (double)(*p);
-                double x = (j - principal_point.first) * z / focal_length.first;
-                double y =
-                        (i - principal_point.second) * z / focal_length.second;
-                Eigen::Vector4d point =
-                        camera_pose * Eigen::Vector4d(x, y, z, 1.0);
-                pointcloud->points_[cnt] = point.block<3, 1>(0, 0);
-                pointcloud->colors_[cnt++] =
-                        Eigen::Vector3d(pc[0], pc[(NC - 1) / 2], pc[NC - 1]) /
-                        scale;
-            }
-        }
+    if (!pointcloud->BackProjectRGBDImage(image, intrinsic, extrinsic)) {
+        utility::LogWarning(
+                "[CreatePointCloudFromRGBDImage] Unsupported image format.\n");
     }
     return pointcloud;
 }
 
-}  // unnamed namespace
-
-namespace geometry {
-std::shared_ptr<PointCloud> PointCloud::CreateFromDepthImage(
+bool PointCloud::BackProjectDepthImage(
         const Image &depth,
         const camera::PinholeCameraIntrinsic &intrinsic,
         const Eigen::Matrix4d &extrinsic /* = Eigen::Matrix4d::Identity()*/,
         double depth_scale /* = 1000.0*/,
         double depth_trunc /* = 1000.0*/,
-        int stride /* = 1*/) {
-    if (depth.num_of_channels_ == 1) {
+        int stride /* = 1*/,
+        const Eigen::Vector4i &roi /* = Eigen::Vector4i(0, 0, max, max)*/) {
+    if (depth.num_of_channels_ == 1 && stride > 0) {
         if (depth.bytes_per_channel_ == 2) {
-            auto float_depth =
-                    depth.ConvertDepthToFloatImage(depth_scale, depth_trunc);
-            return CreatePointCloudFromFloatDepthImage(*float_depth, intrinsic,
-                                                       extrinsic, stride);
+            BackProjectImage<uint16_t, uint8_t, 3>(
+                    depth, nullptr, intrinsic, extrinsic, depth_scale,
+                    depth_trunc, stride, roi, *this);
+            return true;
         } else if (depth.bytes_per_channel_ == 4) {
-            return CreatePointCloudFromFloatDepthImage(depth, intrinsic,
-                                                       extrinsic, stride);
+            BackProjectImage<float, uint8_t, 3>(depth, nullptr, intrinsic,
+                                                extrinsic, depth_scale,
+                                                depth_trunc, stride, roi,
+                                                *this);
+            return true;
         }
     }
-    utility::LogWarning(
-            "[CreatePointCloudFromDepthImage] Unsupported image format.\n");
-    return std::make_shared<PointCloud>();
+    Clear();
+    return false;
 }
 
-std::shared_ptr<PointCloud> PointCloud::CreateFromRGBDImage(
+bool PointCloud::BackProjectRGBDImage(
         const RGBDImage &image,
         const camera::PinholeCameraIntrinsic &intrinsic,
-        const Eigen::Matrix4d &extrinsic /* = Eigen::Matrix4d::Identity()*/) {
+        const Eigen::Matrix4d &extrinsic /* = Eigen::Matrix4d::Identity()*/,
+        int stride /* = 1*/,
+        const Eigen::Vector4i &roi /* = Eigen::Vector4i(0, 0, max, max)*/) {
     if (image.depth_.num_of_channels_ == 1 &&
-        image.depth_.bytes_per_channel_ == 4) {
+        image.depth_.bytes_per_channel_ == 4 && stride > 0) {
         if (image.color_.bytes_per_channel_ == 1 &&
             image.color_.num_of_channels_ == 3) {
-            return CreatePointCloudFromRGBDImageT<uint8_t, 3>(image, intrinsic,
-                                                              extrinsic);
+            BackProjectImage<float, uint8_t, 3>(image.depth_, &image.color_,
+                                                intrinsic, extrinsic, 1.0, 0.0,
+                                                stride, roi, *this);
+            return true;
         } else if (image.color_.bytes_per_channel_ == 4 &&
                    image.color_.num_of_channels_ == 1) {
-            return CreatePointCloudFromRGBDImageT<float, 1>(image, intrinsic,
-                                                            extrinsic);
+            BackProjectImage<float, float, 1>(image.depth_, &image.color_,
+                                              intrinsic, extrinsic, 1.0, 0.0,
+                                              stride, roi, *this);
+            return true;
         }
     }
-    utility::LogWarning(
-            "[CreatePointCloudFromRGBDImage] Unsupported image format.\n");
-    return std::make_shared<PointCloud>();
+    Clear();
+    return false;
 }
 
 std::shared_ptr<PointCloud> PointCloud::CreateFromVoxelGrid(
@@ -25,6 +25,7 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/Utility/Console.h"
 
 namespace open3d {
 namespace geometry {
@@ -50,36 +51,79 @@ Eigen::Vector2d RGBDImage::GetMaxBound() const {
 RGBDImagePyramid RGBDImage::FilterPyramid(
         const RGBDImagePyramid &rgbd_image_pyramid, Image::FilterType type) {
     RGBDImagePyramid rgbd_image_pyramid_filtered;
-    rgbd_image_pyramid_filtered.clear();
-    int num_of_levels = (int)rgbd_image_pyramid.size();
-    for (int level = 0; level < num_of_levels; level++) {
-        auto color_level = rgbd_image_pyramid[level]->color_;
-        auto depth_level = rgbd_image_pyramid[level]->depth_;
-        auto color_level_filtered = color_level.Filter(type);
-        auto depth_level_filtered = depth_level.Filter(type);
-        auto rgbd_image_level_filtered = std::make_shared<RGBDImage>(
-                RGBDImage(*color_level_filtered, *depth_level_filtered));
-        rgbd_image_pyramid_filtered.push_back(rgbd_image_level_filtered);
-    }
+    FilterPyramid(rgbd_image_pyramid, type, rgbd_image_pyramid_filtered);
     return rgbd_image_pyramid_filtered;
 }
 
+bool RGBDImage::FilterPyramid(const RGBDImagePyramid &rgbd_image_pyramid,
+                              Image::FilterType type,
+                              RGBDImagePyramid &output) {
+    output.resize(rgbd_image_pyramid.size());
+    bool success = true;
+    for (size_t level = 0; level < rgbd_image_pyramid.size(); level++) {
+        if (output[level] == nullptr) {
+            output[level] = std::make_shared<RGBDImage>();
+        }
+        const RGBDImage &input_level = *rgbd_image_pyramid[level];
+        success = input_level.color_.Filter(type, output[level]->color_) &&
+                  success;
+        success = input_level.depth_.Filter(type, output[level]->depth_) &&
+                  success;
+    }
+    return success;
+}
+
 RGBDImagePyramid RGBDImage::CreatePyramid(
         size_t num_of_levels,
         bool with_gaussian_filter_for_color /* = true */,
         bool with_gaussian_filter_for_depth /* = false */) const {
-    ImagePyramid color_pyramid =
-            color_.CreatePyramid(num_of_levels, with_gaussian_filter_for_color);
-    ImagePyramid depth_pyramid =
-            depth_.CreatePyramid(num_of_levels, with_gaussian_filter_for_depth);
     RGBDImagePyramid rgbd_image_pyramid;
-    rgbd_image_pyramid.clear();
+    CreatePyramid(num_of_levels, with_gaussian_filter_for_color,
+                  with_gaussian_filter_for_depth, rgbd_image_pyramid);
+    return rgbd_image_pyramid;
+}
+
+bool RGBDImage::CreatePyramid(size_t num_of_levels,
+                              bool with_gaussian_filter_for_color,
+                              bool with_gaussian_filter_for_depth,
+                              RGBDImagePyramid &pyramid) const {
+    if (color_.num_of_channels_ != 1 || color_.bytes_per_channel_ != 4 ||
+        depth_.num_of_channels_ != 1 || depth_.bytes_per_channel_ != 4) {
+        utility::LogWarning(
+                "[CreateRGBDImagePyramid] Unsupported image format.\n");
+        pyramid.clear();
+        return false;
+    }
+
+    pyramid.resize(num_of_levels);
     for (size_t level = 0; level < num_of_levels; level++) {
-        auto rgbd_image_level = std::make_shared<RGBDImage>(
-                RGBDImage(*color_pyramid[level], *depth_pyramid[level]));
-        rgbd_image_pyramid.push_back(rgbd_image_level);
+        if (pyramid[level] == nullptr ||
+            (level > 0 && pyramid[level].get() == this)) {
+            pyramid[level] = std::make_shared<RGBDImage>();
+        }
+        RGBDImage &rgbd_image_level = *pyramid[level];
+        if (level == 0) {
+            if (&rgbd_image_level != this) {
+                rgbd_image_level.color_ = color_;
+                rgbd_image_level.depth_ = depth_;
+            }
+            continue;
+        }
+        const RGBDImage &previous = *pyramid[level - 1];
+        if (with_gaussian_filter_for_color) {
+            previous.color_.FilterAndDownsample(Image::FilterType::Gaussian3,
+                                                rgbd_image_level.color_);
+        } else {
+            previous.color_.Downsample(rgbd_image_level.color_);
+        }
+        if (with_gaussian_filter_for_depth) {
+            previous.depth_.FilterAndDownsample(Image::FilterType::Gaussian3,
+                                                rgbd_image_level.depth_);
+        } else {
+            previous.depth_.Downsample(rgbd_image_level.depth_);
+        }
     }
-    return rgbd_image_pyramid;
+    return true;
 }
 
 }  // namespace geometry
@@ -93,11 +93,26 @@ public:
     static RGBDImagePyramid FilterPyramid(
             const RGBDImagePyramid &rgbd_image_pyramid, Image::FilterType type);
 
+    /// Function to filter RGBD image pyramid into \param output. The images
+    /// of \param output are overwritten in place and allocated when missing.
+    static bool FilterPyramid(const RGBDImagePyramid &rgbd_image_pyramid,
+                              Image::FilterType type,
+                              RGBDImagePyramid &output);
+
     RGBDImagePyramid CreatePyramid(
             size_t num_of_levels,
             bool with_gaussian_filter_for_color = true,
             bool with_gaussian_filter_for_depth = false) const;
 
+    /// Function to create RGBD image pyramid into \param pyramid, so that
+    /// the pyramids of a stream of frames reuse the same level images. The
+    /// images of \param pyramid are overwritten in place and allocated when
+    /// missing.
+    bool CreatePyramid(size_t num_of_levels,
+                       bool with_gaussian_filter_for_color,
+                       bool with_gaussian_filter_for_depth,
+                       RGBDImagePyramid &pyramid) const;
+
 public:
     Image color_;
     Image depth_;
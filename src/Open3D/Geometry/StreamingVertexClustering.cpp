@@ -0,0 +1,138 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/StreamingVertexClustering.h"
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+StreamingVertexClustering::StreamingVertexClustering(
+        double voxel_size,
+        TriangleMesh::SimplificationContraction
+                contraction /* = SimplificationContraction::Quadric */)
+    : voxel_size_(voxel_size), contraction_(contraction) {
+    if (voxel_size_ <= 0.0) {
+        utility::LogWarning("[StreamingVertexClustering] voxel_size <= 0.\n");
+    }
+}
+
+Eigen::Vector3i StreamingVertexClustering::GetCellIndex(
+        const Eigen::Vector3d &point) const {
+    Eigen::Vector3d ref_coord = point / voxel_size_;
+    return Eigen::Vector3i(int(floor(ref_coord(0))), int(floor(ref_coord(1))),
+                           int(floor(ref_coord(2))));
+}
+
+void StreamingVertexClustering::AddTriangles(
+        const std::vector<Eigen::Vector3d> &corners) {
+    if (voxel_size_ <= 0.0) {
+        return;
+    }
+    int n_triangles = int(corners.size() / 3);
+
+    // The cells and quadrics of the chunk are computed in parallel, only the
+    // merge into the cell map is serial.
+    std::vector<Eigen::Vector3i> cell_indices(n_triangles * 3);
+    std::vector<Quadric> quadrics(n_triangles);
+#pragma omp parallel for schedule(static)
+    for (int tidx = 0; tidx < n_triangles; ++tidx) {
+        const Eigen::Vector3d &p0 = corners[tidx * 3 + 0];
+        const Eigen::Vector3d &p1 = corners[tidx * 3 + 1];
+        const Eigen::Vector3d &p2 = corners[tidx * 3 + 2];
+        for (int k = 0; k < 3; ++k) {
+            cell_indices[tidx * 3 + k] = GetCellIndex(corners[tidx * 3 + k]);
+        }
+        if (contraction_ == TriangleMesh::SimplificationContraction::Quadric) {
+            quadrics[tidx] =
+                    Quadric(TriangleMesh::ComputeTrianglePlane(p0, p1, p2),
+                            TriangleMesh::ComputeTriangleArea(p0, p1, p2));
+        }
+    }
+
+    for (int tidx = 0; tidx < n_triangles; ++tidx) {
+        int vidx[3];
+        for (int k = 0; k < 3; ++k) {
+            Cell &cell = cells_[cell_indices[tidx * 3 + k]];
+            if (cell.index_ < 0) {
+                cell.index_ = int(cells_.size()) - 1;
+            }
+            cell.quadric_ += quadrics[tidx];
+            cell.sum_ += corners[tidx * 3 + k];
+            cell.count_++;
+            vidx[k] = cell.index_;
+        }
+
+        // only connect if in different cells
+        if (vidx[0] == vidx[1] || vidx[0] == vidx[2] || vidx[1] == vidx[2]) {
+            continue;
+        }
+        // rotate the smallest index to the front, keeping the orientation
+        if (vidx[1] < vidx[0] && vidx[1] < vidx[2]) {
+            triangles_.emplace(vidx[1], vidx[2], vidx[0]);
+        } else if (vidx[2] < vidx[0] && vidx[2] < vidx[1]) {
+            triangles_.emplace(vidx[2], vidx[0], vidx[1]);
+        } else {
+            triangles_.emplace(vidx[0], vidx[1], vidx[2]);
+        }
+    }
+}
+
+std::shared_ptr<TriangleMesh> StreamingVertexClustering::ExtractTriangleMesh()
+        const {
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_.resize(cells_.size());
+    for (const auto &kv : cells_) {
+        const Cell &cell = kv.second;
+        Eigen::Vector3d average = cell.sum_ / double(cell.count_);
+        Eigen::Vector3d &vertex = mesh->vertices_[cell.index_];
+        vertex = average;
+        if (contraction_ == TriangleMesh::SimplificationContraction::Quadric &&
+            cell.quadric_.IsInvertible()) {
+            // The minimum of the quadric is only used if it does not leave
+            // the cell (with a margin of half a cell), as the quadric is
+            // unstable in nearly flat regions.
+            Eigen::Vector3d minimum = cell.quadric_.Minimum();
+            Eigen::Vector3d cell_min = kv.first.cast<double>() * voxel_size_;
+            Eigen::Vector3d margin = Eigen::Vector3d::Constant(
+                    0.5 * voxel_size_);
+            if ((minimum.array() >= (cell_min - margin).array()).all() &&
+                (minimum.array() <=
+                 (cell_min + Eigen::Vector3d::Constant(voxel_size_) + margin)
+                         .array())
+                        .all()) {
+                vertex = minimum;
+            }
+        }
+    }
+
+    mesh->triangles_.assign(triangles_.begin(), triangles_.end());
+    return mesh;
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,100 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Open3D/Geometry/Quadric.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Utility/Helper.h"
+
+namespace open3d {
+namespace geometry {
+
+/// Out-of-core mesh simplification by vertex clustering. Triangles are fed in
+/// chunks, e.g., while streaming a mesh file, and only the per cell error
+/// quadrics and the output triangles are kept in memory. Hence, the memory
+/// consumption is bounded by the size of the simplified mesh and not by the
+/// size of the input. Cf. Lindstrom, "Out-of-Core Simplification of Large
+/// Polygonal Models", 2000.
+class StreamingVertexClustering {
+public:
+    /// \param voxel_size defines the edge length of the clustering cells.
+    /// \param contraction defines how the position of the cell vertex is
+    /// computed, see TriangleMesh::SimplifyVertexClustering.
+    StreamingVertexClustering(
+            double voxel_size,
+            TriangleMesh::SimplificationContraction contraction =
+                    TriangleMesh::SimplificationContraction::Quadric);
+    ~StreamingVertexClustering() {}
+
+public:
+    /// Function to add a chunk of triangles. Every triangle is given by three
+    /// consecutive entries in \param corners.
+    void AddTriangles(const std::vector<Eigen::Vector3d> &corners);
+
+    /// Function to extract the simplified indexed triangle mesh.
+    std::shared_ptr<TriangleMesh> ExtractTriangleMesh() const;
+
+    /// Number of occupied cells, i.e., vertices of the simplified mesh.
+    size_t NumberOfCells() const { return cells_.size(); }
+
+    /// Number of triangles of the simplified mesh.
+    size_t NumberOfTriangles() const { return triangles_.size(); }
+
+private:
+    class Cell {
+    public:
+        Cell() : index_(-1), sum_(0, 0, 0), count_(0) {}
+
+    public:
+        int index_;
+        Quadric quadric_;
+        Eigen::Vector3d sum_;
+        int count_;
+    };
+
+    Eigen::Vector3i GetCellIndex(const Eigen::Vector3d &point) const;
+
+private:
+    double voxel_size_;
+    TriangleMesh::SimplificationContraction contraction_;
+    std::unordered_map<Eigen::Vector3i,
+                       Cell,
+                       utility::hash_eigen::hash<Eigen::Vector3i>>
+            cells_;
+    std::unordered_set<Eigen::Vector3i,
+                       utility::hash_eigen::hash<Eigen::Vector3i>>
+            triangles_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -49,6 +49,7 @@ TriangleMesh &TriangleMesh::Clear() {
     triangles_.clear();
     triangle_normals_.clear();
     adjacency_list_.clear();
+    InvalidateTopologyCache();
     return *this;
 }
 
@@ -141,6 +142,7 @@ TriangleMesh &TriangleMesh::operator+=(const TriangleMesh &mesh) {
     for (size_t i = 0; i < add_tri_num; i++) {
         triangles_[old_tri_num + i] = mesh.triangles_[i] + index_shift;
     }
+    InvalidateTopologyCache();
     if (HasAdjacencyList()) {
         ComputeAdjacencyList();
     }
@@ -184,241 +186,233 @@ TriangleMesh &TriangleMesh::ComputeVertexNormals(bool normalized /* = true*/) {
 }
 
 TriangleMesh &TriangleMesh::ComputeAdjacencyList() {
+    auto topology = GetTopology();
     adjacency_list_.clear();
     adjacency_list_.resize(vertices_.size());
-    for (const auto &triangle : triangles_) {
-        adjacency_list_[triangle(0)].insert(triangle(1));
-        adjacency_list_[triangle(0)].insert(triangle(2));
-        adjacency_list_[triangle(1)].insert(triangle(0));
-        adjacency_list_[triangle(1)].insert(triangle(2));
-        adjacency_list_[triangle(2)].insert(triangle(0));
-        adjacency_list_[triangle(2)].insert(triangle(1));
+    for (size_t vidx = 0; vidx < vertices_.size(); ++vidx) {
+        adjacency_list_[vidx].insert(
+                topology->vertex_vertices_.begin() +
+                        topology->vertex_vertex_offsets_[vidx],
+                topology->vertex_vertices_.begin() +
+                        topology->vertex_vertex_offsets_[vidx + 1]);
     }
     return *this;
 }
 
-std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
-        int number_of_iterations, double strength, FilterScope scope) const {
-    bool filter_vertex =
-            scope == FilterScope::All || scope == FilterScope::Vertex;
-    bool filter_normal =
-            (scope == FilterScope::All || scope == FilterScope::Normal) &&
-            HasVertexNormals();
-    bool filter_color =
-            (scope == FilterScope::All || scope == FilterScope::Color) &&
-            HasVertexColors();
-
-    std::vector<Eigen::Vector3d> prev_vertices = vertices_;
-    std::vector<Eigen::Vector3d> prev_vertex_normals = vertex_normals_;
-    std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
-
-    std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
-    mesh->triangles_ = triangles_;
-    mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
+TriangleMesh &TriangleMesh::EnableTopologyCache(bool enable /* = true */) {
+    topology_cache_enabled_ = enable;
+    if (!enable) {
+        InvalidateTopologyCache();
     }
+    return *this;
+}
 
-    for (int iter = 0; iter < number_of_iterations; ++iter) {
-        for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
-            Eigen::Vector3d vertex_sum(0, 0, 0);
-            Eigen::Vector3d normal_sum(0, 0, 0);
-            Eigen::Vector3d color_sum(0, 0, 0);
-            for (int nbidx : mesh->adjacency_list_[vidx]) {
-                if (filter_vertex) {
-                    vertex_sum += prev_vertices[nbidx];
-                }
-                if (filter_normal) {
-                    normal_sum += prev_vertex_normals[nbidx];
-                }
-                if (filter_color) {
-                    color_sum += prev_vertex_colors[nbidx];
-                }
-            }
-
-            size_t nb_size = mesh->adjacency_list_[vidx].size();
-            if (filter_vertex) {
-                mesh->vertices_[vidx] =
-                        prev_vertices[vidx] +
-                        strength * (prev_vertices[vidx] * nb_size - vertex_sum);
-            }
-            if (filter_normal) {
-                mesh->vertex_normals_[vidx] =
-                        prev_vertex_normals[vidx] +
-                        strength * (prev_vertex_normals[vidx] * nb_size -
-                                    normal_sum);
-            }
-            if (filter_color) {
-                mesh->vertex_colors_[vidx] =
-                        prev_vertex_colors[vidx] +
-                        strength * (prev_vertex_colors[vidx] * nb_size -
-                                    color_sum);
-            }
-        }
-        if (iter < number_of_iterations - 1) {
-            std::swap(mesh->vertices_, prev_vertices);
-            std::swap(mesh->vertex_normals_, prev_vertex_normals);
-            std::swap(mesh->vertex_colors_, prev_vertex_colors);
-        }
+std::shared_ptr<const TriangleMeshTopology> TriangleMesh::GetTopology()
+        const {
+    if (topology_cache_enabled_) {
+        return topology_cache_.Get(triangles_, vertices_.size());
     }
-
-    return mesh;
+    return TriangleMeshTopology::Create(triangles_, vertices_.size());
 }
 
-std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
-        int number_of_iterations, FilterScope scope) const {
-    bool filter_vertex =
-            scope == FilterScope::All || scope == FilterScope::Vertex;
-    bool filter_normal =
-            (scope == FilterScope::All || scope == FilterScope::Normal) &&
-            HasVertexNormals();
-    bool filter_color =
-            (scope == FilterScope::All || scope == FilterScope::Color) &&
-            HasVertexColors();
-
-    std::vector<Eigen::Vector3d> prev_vertices = vertices_;
-    std::vector<Eigen::Vector3d> prev_vertex_normals = vertex_normals_;
-    std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
-
-    std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
-    mesh->triangles_ = triangles_;
-    mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
+void TriangleMesh::ShareTopologyCache(TriangleMesh &mesh) const {
+    mesh.topology_cache_enabled_ = topology_cache_enabled_;
+    if (topology_cache_enabled_) {
+        GetTopology();
+        mesh.topology_cache_ = topology_cache_;
     }
+}
 
-    for (int iter = 0; iter < number_of_iterations; ++iter) {
-        for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
-            Eigen::Vector3d vertex_sum(0, 0, 0);
-            Eigen::Vector3d normal_sum(0, 0, 0);
-            Eigen::Vector3d color_sum(0, 0, 0);
-            for (int nbidx : mesh->adjacency_list_[vidx]) {
-                if (filter_vertex) {
-                    vertex_sum += prev_vertices[nbidx];
-                }
-                if (filter_normal) {
-                    normal_sum += prev_vertex_normals[nbidx];
-                }
-                if (filter_color) {
-                    color_sum += prev_vertex_colors[nbidx];
-                }
-            }
-
-            size_t nb_size = mesh->adjacency_list_[vidx].size();
-            if (filter_vertex) {
-                mesh->vertices_[vidx] =
-                        (prev_vertices[vidx] + vertex_sum) / (1 + nb_size);
-            }
-            if (filter_normal) {
-                mesh->vertex_normals_[vidx] =
-                        (prev_vertex_normals[vidx] + normal_sum) /
-                        (1 + nb_size);
+namespace {
+
+/// Neighbour lists of the vertices of a mesh in CSR form. They are taken from
+/// adjacency_list_ if the mesh has one, otherwise from the mesh topology.
+class VertexNeighbours {
+public:
+    explicit VertexNeighbours(const TriangleMesh &mesh) {
+        if (mesh.HasAdjacencyList()) {
+            offsets_storage_.resize(mesh.vertices_.size() + 1, 0);
+            for (size_t vidx = 0; vidx < mesh.vertices_.size(); ++vidx) {
+                offsets_storage_[vidx + 1] =
+                        offsets_storage_[vidx] +
+                        int(mesh.adjacency_list_[vidx].size());
             }
-            if (filter_color) {
-                mesh->vertex_colors_[vidx] =
-                        (prev_vertex_colors[vidx] + color_sum) / (1 + nb_size);
+            indices_storage_.reserve(offsets_storage_.back());
+            for (const auto &adjacent : mesh.adjacency_list_) {
+                indices_storage_.insert(indices_storage_.end(),
+                                        adjacent.begin(), adjacent.end());
             }
-        }
-        if (iter < number_of_iterations - 1) {
-            std::swap(mesh->vertices_, prev_vertices);
-            std::swap(mesh->vertex_normals_, prev_vertex_normals);
-            std::swap(mesh->vertex_colors_, prev_vertex_colors);
+            offsets_ = offsets_storage_.data();
+            indices_ = indices_storage_.data();
+        } else {
+            topology_ = mesh.GetTopology();
+            offsets_ = topology_->vertex_vertex_offsets_.data();
+            indices_ = topology_->vertex_vertices_.data();
         }
     }
-    return mesh;
+
+    int Begin(int vidx) const { return offsets_[vidx]; }
+    int End(int vidx) const { return offsets_[vidx + 1]; }
+    int operator[](int i) const { return indices_[i]; }
+
+private:
+    std::shared_ptr<const TriangleMeshTopology> topology_;
+    std::vector<int> offsets_storage_;
+    std::vector<int> indices_storage_;
+    const int *offsets_ = nullptr;
+    const int *indices_ = nullptr;
+};
+
+/// Returns the vertex attributes of \p mesh selected by \p scope.
+std::vector<std::vector<Eigen::Vector3d> *> FilteredAttributes(
+        TriangleMesh &mesh, TriangleMesh::FilterScope scope) {
+    typedef TriangleMesh::FilterScope FilterScope;
+    std::vector<std::vector<Eigen::Vector3d> *> attributes;
+    if (scope == FilterScope::All || scope == FilterScope::Vertex) {
+        attributes.push_back(&mesh.vertices_);
+    }
+    if ((scope == FilterScope::All || scope == FilterScope::Normal) &&
+        mesh.HasVertexNormals()) {
+        attributes.push_back(&mesh.vertex_normals_);
+    }
+    if ((scope == FilterScope::All || scope == FilterScope::Color) &&
+        mesh.HasVertexColors()) {
+        attributes.push_back(&mesh.vertex_colors_);
+    }
+    return attributes;
 }
 
-void TriangleMesh::FilterSmoothLaplacianHelper(
-        std::shared_ptr<TriangleMesh> &mesh,
-        const std::vector<Eigen::Vector3d> &prev_vertices,
-        const std::vector<Eigen::Vector3d> &prev_vertex_normals,
-        const std::vector<Eigen::Vector3d> &prev_vertex_colors,
-        const std::vector<std::unordered_set<int>> &adjacency_list,
-        double lambda,
-        bool filter_vertex,
-        bool filter_normal,
-        bool filter_color) const {
-    for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
-        Eigen::Vector3d vertex_sum(0, 0, 0);
-        Eigen::Vector3d normal_sum(0, 0, 0);
-        Eigen::Vector3d color_sum(0, 0, 0);
+/// One pass of the linear filter
+/// $v_i = \alpha v_i + \beta \sum_{n \in N} w_n v_n$ over all \p attributes,
+/// where $w_n$ is one, or the inverse distance between the vertex
+/// \p positions if \p inverse_distance_weights is set. \p coefficients maps
+/// the number of neighbours and the total weight to $\alpha$ and $\beta$.
+/// The vertices are updated in parallel into \p buffers, which are then
+/// swapped with the attributes, so no memory is allocated per pass.
+template <typename F>
+void FilterPass(const VertexNeighbours &neighbours,
+                const std::vector<Eigen::Vector3d> &positions,
+                bool inverse_distance_weights,
+                F coefficients,
+                std::vector<std::vector<Eigen::Vector3d> *> &attributes,
+                std::vector<std::vector<Eigen::Vector3d>> &buffers) {
+    const int num_vertices = int(positions.size());
+    const int num_attributes = int(attributes.size());
+    buffers.resize(num_attributes);
+    for (int a = 0; a < num_attributes; ++a) {
+        buffers[a].resize(num_vertices);
+    }
+#pragma omp parallel for schedule(static)
+    for (int vidx = 0; vidx < num_vertices; ++vidx) {
+        Eigen::Vector3d sums[3] = {Eigen::Vector3d::Zero(),
+                                   Eigen::Vector3d::Zero(),
+                                   Eigen::Vector3d::Zero()};
         double total_weight = 0;
-        for (int nbidx : mesh->adjacency_list_[vidx]) {
-            auto diff = prev_vertices[vidx] - prev_vertices[nbidx];
-            double dist = diff.norm();
-            double weight = 1. / (dist + 1e-12);
-            total_weight += weight;
-
-            if (filter_vertex) {
-                vertex_sum += weight * prev_vertices[nbidx];
-            }
-            if (filter_normal) {
-                normal_sum += weight * prev_vertex_normals[nbidx];
+        for (int i = neighbours.Begin(vidx); i < neighbours.End(vidx); ++i) {
+            int nbidx = neighbours[i];
+            double weight = 1;
+            if (inverse_distance_weights) {
+                double dist = (positions[vidx] - positions[nbidx]).norm();
+                weight = 1. / (dist + 1e-12);
             }
-            if (filter_color) {
-                color_sum += weight * prev_vertex_colors[nbidx];
+            total_weight += weight;
+            for (int a = 0; a < num_attributes; ++a) {
+                sums[a] += weight * (*attributes[a])[nbidx];
             }
         }
-
-        if (filter_vertex) {
-            mesh->vertices_[vidx] =
-                    prev_vertices[vidx] +
-                    lambda * (vertex_sum / total_weight - prev_vertices[vidx]);
-        }
-        if (filter_normal) {
-            mesh->vertex_normals_[vidx] = prev_vertex_normals[vidx] +
-                                          lambda * (normal_sum / total_weight -
-                                                    prev_vertex_normals[vidx]);
-        }
-        if (filter_color) {
-            mesh->vertex_colors_[vidx] = prev_vertex_colors[vidx] +
-                                         lambda * (color_sum / total_weight -
-                                                   prev_vertex_colors[vidx]);
+        double alpha, beta;
+        coefficients(neighbours.End(vidx) - neighbours.Begin(vidx),
+                     total_weight, alpha, beta);
+        for (int a = 0; a < num_attributes; ++a) {
+            buffers[a][vidx] = alpha * (*attributes[a])[vidx] + beta * sums[a];
         }
     }
+    for (int a = 0; a < num_attributes; ++a) {
+        std::swap(*attributes[a], buffers[a]);
+    }
 }
 
-std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothLaplacian(
-        int number_of_iterations, double lambda, FilterScope scope) const {
-    bool filter_vertex =
-            scope == FilterScope::All || scope == FilterScope::Vertex;
-    bool filter_normal =
-            (scope == FilterScope::All || scope == FilterScope::Normal) &&
-            HasVertexNormals();
-    bool filter_color =
-            (scope == FilterScope::All || scope == FilterScope::Color) &&
-            HasVertexColors();
-
-    std::vector<Eigen::Vector3d> prev_vertices = vertices_;
-    std::vector<Eigen::Vector3d> prev_vertex_normals = vertex_normals_;
-    std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
-
-    std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
+/// Coefficients of the Laplacian step
+/// $v_i + \lambda (\sum_{n \in N} w_n v_n / \sum_{n \in N} w_n - v_i)$.
+/// Vertices without neighbours keep their value.
+class LaplacianCoefficients {
+public:
+    explicit LaplacianCoefficients(double lambda) : lambda_(lambda) {}
+    void operator()(int num_neighbours,
+                    double total_weight,
+                    double &alpha,
+                    double &beta) const {
+        if (num_neighbours == 0) {
+            alpha = 1;
+            beta = 0;
+        } else {
+            alpha = 1 - lambda_;
+            beta = lambda_ / total_weight;
+        }
+    }
+
+private:
+    double lambda_;
+};
+
+}  // unnamed namespace
+
+std::shared_ptr<TriangleMesh> TriangleMesh::CreateFilterOutput() const {
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = vertices_;
+    mesh->vertex_normals_ = vertex_normals_;
+    mesh->vertex_colors_ = vertex_colors_;
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
+    ShareTopologyCache(*mesh);
+    return mesh;
+}
+
+std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
+        int number_of_iterations, double strength, FilterScope scope) const {
+    auto mesh = CreateFilterOutput();
+    auto attributes = FilteredAttributes(*mesh, scope);
+    VertexNeighbours neighbours(*mesh);
+    std::vector<std::vector<Eigen::Vector3d>> buffers;
+    auto Coefficients = [&](int num_neighbours, double, double &alpha,
+                            double &beta) {
+        alpha = 1 + strength * num_neighbours;
+        beta = -strength;
+    };
+    for (int iter = 0; iter < number_of_iterations; ++iter) {
+        FilterPass(neighbours, mesh->vertices_, false, Coefficients,
+                   attributes, buffers);
     }
+    return mesh;
+}
 
+std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
+        int number_of_iterations, FilterScope scope) const {
+    auto mesh = CreateFilterOutput();
+    auto attributes = FilteredAttributes(*mesh, scope);
+    VertexNeighbours neighbours(*mesh);
+    std::vector<std::vector<Eigen::Vector3d>> buffers;
+    auto Coefficients = [](int num_neighbours, double, double &alpha,
+                           double &beta) {
+        alpha = 1. / (num_neighbours + 1);
+        beta = alpha;
+    };
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    lambda, filter_vertex, filter_normal,
-                                    filter_color);
-        if (iter < number_of_iterations - 1) {
-            std::swap(mesh->vertices_, prev_vertices);
-            std::swap(mesh->vertex_normals_, prev_vertex_normals);
-            std::swap(mesh->vertex_colors_, prev_vertex_colors);
-        }
+        FilterPass(neighbours, mesh->vertices_, false, Coefficients,
+                   attributes, buffers);
+    }
+    return mesh;
+}
+
+std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothLaplacian(
+        int number_of_iterations, double lambda, FilterScope scope) const {
+    auto mesh = CreateFilterOutput();
+    auto attributes = FilteredAttributes(*mesh, scope);
+    VertexNeighbours neighbours(*mesh);
+    std::vector<std::vector<Eigen::Vector3d>> buffers;
+    for (int iter = 0; iter < number_of_iterations; ++iter) {
+        FilterPass(neighbours, mesh->vertices_, true,
+                   LaplacianCoefficients(lambda), attributes, buffers);
     }
     return mesh;
 }
@@ -428,45 +422,15 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothTaubin(
         double lambda,
         double mu,
         FilterScope scope) const {
-    bool filter_vertex =
-            scope == FilterScope::All || scope == FilterScope::Vertex;
-    bool filter_normal =
-            (scope == FilterScope::All || scope == FilterScope::Normal) &&
-            HasVertexNormals();
-    bool filter_color =
-            (scope == FilterScope::All || scope == FilterScope::Color) &&
-            HasVertexColors();
-
-    std::vector<Eigen::Vector3d> prev_vertices = vertices_;
-    std::vector<Eigen::Vector3d> prev_vertex_normals = vertex_normals_;
-    std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
-
-    std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
-    mesh->triangles_ = triangles_;
-    mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
+    auto mesh = CreateFilterOutput();
+    auto attributes = FilteredAttributes(*mesh, scope);
+    VertexNeighbours neighbours(*mesh);
+    std::vector<std::vector<Eigen::Vector3d>> buffers;
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    lambda, filter_vertex, filter_normal,
-                                    filter_color);
-        std::swap(mesh->vertices_, prev_vertices);
-        std::swap(mesh->vertex_normals_, prev_vertex_normals);
-        std::swap(mesh->vertex_colors_, prev_vertex_colors);
-        FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    mu, filter_vertex, filter_normal,
-                                    filter_color);
-        if (iter < number_of_iterations - 1) {
-            std::swap(mesh->vertices_, prev_vertices);
-            std::swap(mesh->vertex_normals_, prev_vertex_normals);
-            std::swap(mesh->vertex_colors_, prev_vertex_colors);
-        }
+        FilterPass(neighbours, mesh->vertices_, true,
+                   LaplacianCoefficients(lambda), attributes, buffers);
+        FilterPass(neighbours, mesh->vertices_, true,
+                   LaplacianCoefficients(mu), attributes, buffers);
     }
     return mesh;
 }
@@ -730,6 +694,7 @@ TriangleMesh &TriangleMesh::RemoveDuplicatedVertices() {
             triangle(1) = index_old_to_new[triangle(1)];
             triangle(2) = index_old_to_new[triangle(2)];
         }
+        InvalidateTopologyCache();
         if (HasAdjacencyList()) {
             ComputeAdjacencyList();
         }
@@ -778,8 +743,11 @@ TriangleMesh &TriangleMesh::RemoveDuplicatedTriangles() {
     }
     triangles_.resize(k);
     if (has_tri_normal) triangle_normals_.resize(k);
-    if (k < old_triangle_num && HasAdjacencyList()) {
-        ComputeAdjacencyList();
+    if (k < old_triangle_num) {
+        InvalidateTopologyCache();
+        if (HasAdjacencyList()) {
+            ComputeAdjacencyList();
+        }
     }
     utility::LogDebug(
             "[RemoveDuplicatedTriangles] {:d} triangles have been removed.\n",
@@ -820,6 +788,7 @@ TriangleMesh &TriangleMesh::RemoveUnreferencedVertices() {
             triangle(1) = index_old_to_new[triangle(1)];
             triangle(2) = index_old_to_new[triangle(2)];
         }
+        InvalidateTopologyCache();
         if (HasAdjacencyList()) {
             ComputeAdjacencyList();
         }
@@ -846,8 +815,11 @@ TriangleMesh &TriangleMesh::RemoveDegenerateTriangles() {
     }
     triangles_.resize(k);
     if (has_tri_normal) triangle_normals_.resize(k);
-    if (k < old_triangle_num && HasAdjacencyList()) {
-        ComputeAdjacencyList();
+    if (k < old_triangle_num) {
+        InvalidateTopologyCache();
+        if (HasAdjacencyList()) {
+            ComputeAdjacencyList();
+        }
     }
     utility::LogDebug(
             "[RemoveDegenerateTriangles] {:d} triangles have been "
@@ -924,6 +896,7 @@ TriangleMesh &TriangleMesh::RemoveNonManifoldEdges() {
         }
         triangles_.resize(to_tidx);
         triangle_areas.resize(to_tidx);
+        InvalidateTopologyCache();
         if (has_tri_normal) {
             triangle_normals_.resize(to_tidx);
         }
@@ -933,112 +906,95 @@ TriangleMesh &TriangleMesh::RemoveNonManifoldEdges() {
 
 template <typename F>
 bool OrientTriangleHelper(const std::vector<Eigen::Vector3i> &triangles,
+                          const TriangleMeshTopology &topology,
                           F &swap) {
-    std::unordered_map<Eigen::Vector2i, Eigen::Vector2i,
-                       utility::hash_eigen::hash<Eigen::Vector2i>>
-            edge_to_orientation;
-    std::unordered_set<int> unvisited_triangles;
-    std::unordered_map<Eigen::Vector2i, std::unordered_set<int>,
-                       utility::hash_eigen::hash<Eigen::Vector2i>>
-            adjacent_triangles;
+    const int num_edges = int(topology.NumberOfEdges());
+
+    // Source vertex of the first oriented half-edge seen on each edge.
+    std::vector<int> edge_to_orientation(num_edges, -1);
+    std::vector<bool> visited(triangles.size(), false);
     std::queue<int> triangle_queue;
 
-    auto CreateOrderedEdge = [](int vidx0, int vidx1) {
-        return Eigen::Vector2i(std::min(vidx0, vidx1), std::max(vidx0, vidx1));
-    };
-    auto VerifyAndAdd = [&](int vidx0, int vidx1) {
-        Eigen::Vector2i key = CreateOrderedEdge(vidx0, vidx1);
-        if (edge_to_orientation.count(key) > 0) {
-            if (edge_to_orientation.at(key)(0) == vidx0) {
-                return false;
-            }
-        } else {
-            edge_to_orientation[key] = Eigen::Vector2i(vidx0, vidx1);
+    auto VerifyAndAdd = [&](int edge, int vidx0) {
+        if (edge_to_orientation[edge] == -1) {
+            edge_to_orientation[edge] = vidx0;
+            return true;
         }
-        return true;
+        return edge_to_orientation[edge] != vidx0;
     };
-    auto AddTriangleNbsToQueue = [&](const Eigen::Vector2i &edge) {
-        for (int nb_tidx : adjacent_triangles[edge]) {
-            triangle_queue.push(nb_tidx);
+    auto AddTriangleNbsToQueue = [&](int edge) {
+        for (int i = topology.edge_triangle_offsets_[edge];
+             i < topology.edge_triangle_offsets_[edge + 1]; ++i) {
+            triangle_queue.push(topology.edge_triangles_[i]);
         }
     };
 
-    for (size_t tidx = 0; tidx < triangles.size(); ++tidx) {
-        unvisited_triangles.insert(int(tidx));
-        const auto &triangle = triangles[tidx];
-        int vidx0 = triangle(0);
-        int vidx1 = triangle(1);
-        int vidx2 = triangle(2);
-        adjacent_triangles[CreateOrderedEdge(vidx0, vidx1)].insert(int(tidx));
-        adjacent_triangles[CreateOrderedEdge(vidx1, vidx2)].insert(int(tidx));
-        adjacent_triangles[CreateOrderedEdge(vidx2, vidx0)].insert(int(tidx));
-    }
-
-    while (!unvisited_triangles.empty()) {
+    size_t next_unvisited = 0;
+    while (true) {
         int tidx;
         if (triangle_queue.empty()) {
-            tidx = *unvisited_triangles.begin();
+            while (next_unvisited < triangles.size() &&
+                   visited[next_unvisited]) {
+                next_unvisited++;
+            }
+            if (next_unvisited == triangles.size()) {
+                break;
+            }
+            tidx = int(next_unvisited);
         } else {
             tidx = triangle_queue.front();
             triangle_queue.pop();
         }
-        if (unvisited_triangles.count(tidx) > 0) {
-            unvisited_triangles.erase(tidx);
-        } else {
+        if (visited[tidx]) {
             continue;
         }
-
-        const auto &triangle = triangles[tidx];
-        int vidx0 = triangle(0);
-        int vidx1 = triangle(1);
-        int vidx2 = triangle(2);
-        Eigen::Vector2i key01 = CreateOrderedEdge(vidx0, vidx1);
-        Eigen::Vector2i key12 = CreateOrderedEdge(vidx1, vidx2);
-        Eigen::Vector2i key20 = CreateOrderedEdge(vidx2, vidx0);
-        bool exist01 = edge_to_orientation.count(key01) > 0;
-        bool exist12 = edge_to_orientation.count(key12) > 0;
-        bool exist20 = edge_to_orientation.count(key20) > 0;
-
-        if (!(exist01 || exist12 || exist20)) {
-            edge_to_orientation[key01] = Eigen::Vector2i(vidx0, vidx1);
-            edge_to_orientation[key12] = Eigen::Vector2i(vidx1, vidx2);
-            edge_to_orientation[key20] = Eigen::Vector2i(vidx2, vidx0);
+        visited[tidx] = true;
+
+        // vidx[k] and vidx[(k + 1) % 3] span edges[k]
+        int vidx[3] = {triangles[tidx](0), triangles[tidx](1),
+                       triangles[tidx](2)};
+        int edges[3] = {topology.triangle_edges_[tidx](0),
+                        topology.triangle_edges_[tidx](1),
+                        topology.triangle_edges_[tidx](2)};
+        bool exist[3] = {edge_to_orientation[edges[0]] != -1,
+                         edge_to_orientation[edges[1]] != -1,
+                         edge_to_orientation[edges[2]] != -1};
+
+        if (!(exist[0] || exist[1] || exist[2])) {
+            for (int k = 0; k < 3; ++k) {
+                edge_to_orientation[edges[k]] = vidx[k];
+            }
         } else {
-            // one flip is allowed
-            if (exist01 && edge_to_orientation.at(key01)(0) == vidx0) {
-                std::swap(vidx0, vidx1);
-                swap(tidx, 0, 1);
-            } else if (exist12 && edge_to_orientation.at(key12)(0) == vidx1) {
-                std::swap(vidx1, vidx2);
-                swap(tidx, 1, 2);
-            } else if (exist20 && edge_to_orientation.at(key20)(0) == vidx2) {
-                std::swap(vidx2, vidx0);
-                swap(tidx, 2, 0);
+            // one flip is allowed, swapping the endpoints of edge k exchanges
+            // the two other edges
+            for (int k = 0; k < 3; ++k) {
+                if (exist[k] && edge_to_orientation[edges[k]] == vidx[k]) {
+                    std::swap(vidx[k], vidx[(k + 1) % 3]);
+                    std::swap(edges[(k + 1) % 3], edges[(k + 2) % 3]);
+                    swap(tidx, k, (k + 1) % 3);
+                    break;
+                }
             }
 
             // check if each edge looks in different direction compared to
             // existing ones if not existend, add the edge to map
-            if (!VerifyAndAdd(vidx0, vidx1)) {
-                return false;
-            }
-            if (!VerifyAndAdd(vidx1, vidx2)) {
-                return false;
-            }
-            if (!VerifyAndAdd(vidx2, vidx0)) {
-                return false;
+            for (int k = 0; k < 3; ++k) {
+                if (!VerifyAndAdd(edges[k], vidx[k])) {
+                    return false;
+                }
             }
         }
 
-        AddTriangleNbsToQueue(key01);
-        AddTriangleNbsToQueue(key12);
-        AddTriangleNbsToQueue(key20);
+        for (int k = 0; k < 3; ++k) {
+            AddTriangleNbsToQueue(edges[k]);
+        }
     }
     return true;
 }
 
 bool TriangleMesh::IsOrientable() const {
     auto NoOp = [](int, int, int) {};
-    return OrientTriangleHelper(triangles_, NoOp);
+    return OrientTriangleHelper(triangles_, *GetTopology(), NoOp);
 }
 
 bool TriangleMesh::IsWatertight() const {
@@ -1049,27 +1005,27 @@ bool TriangleMesh::OrientTriangles() {
     auto SwapTriangleOrder = [&](int tidx, int idx0, int idx1) {
         std::swap(triangles_[tidx](idx0), triangles_[tidx](idx1));
     };
-    return OrientTriangleHelper(triangles_, SwapTriangleOrder);
+    bool success =
+            OrientTriangleHelper(triangles_, *GetTopology(), SwapTriangleOrder);
+    // the corner order of the triangles may have changed
+    InvalidateTopologyCache();
+    return success;
 }
 
 std::unordered_map<Eigen::Vector2i,
                    std::vector<int>,
                    utility::hash_eigen::hash<Eigen::Vector2i>>
 TriangleMesh::GetEdgeToTrianglesMap() const {
+    auto topology = GetTopology();
     std::unordered_map<Eigen::Vector2i, std::vector<int>,
                        utility::hash_eigen::hash<Eigen::Vector2i>>
-            trias_per_edge;
-    auto AddEdge = [&](int vidx0, int vidx1, int tidx) {
-        int min0 = std::min(vidx0, vidx1);
-        int max0 = std::max(vidx0, vidx1);
-        Eigen::Vector2i edge(min0, max0);
-        trias_per_edge[edge].push_back(tidx);
-    };
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        const auto &triangle = triangles_[tidx];
-        AddEdge(triangle(0), triangle(1), int(tidx));
-        AddEdge(triangle(1), triangle(2), int(tidx));
-        AddEdge(triangle(2), triangle(0), int(tidx));
+            trias_per_edge(topology->NumberOfEdges());
+    for (size_t e = 0; e < topology->NumberOfEdges(); ++e) {
+        trias_per_edge[topology->edges_[e]].assign(
+                topology->edge_triangles_.begin() +
+                        topology->edge_triangle_offsets_[e],
+                topology->edge_triangles_.begin() +
+                        topology->edge_triangle_offsets_[e + 1]);
     }
     return trias_per_edge;
 }
@@ -1136,24 +1092,7 @@ Eigen::Vector4d TriangleMesh::GetTrianglePlane(size_t triangle_idx) const {
 }
 
 int TriangleMesh::EulerPoincareCharacteristic() const {
-    std::unordered_set<Eigen::Vector2i,
-                       utility::hash_eigen::hash<Eigen::Vector2i>>
-            edges;
-    for (auto triangle : triangles_) {
-        int min0 = std::min(triangle(0), triangle(1));
-        int max0 = std::max(triangle(0), triangle(1));
-        edges.emplace(Eigen::Vector2i(min0, max0));
-
-        int min1 = std::min(triangle(0), triangle(2));
-        int max1 = std::max(triangle(0), triangle(2));
-        edges.emplace(Eigen::Vector2i(min1, max1));
-
-        int min2 = std::min(triangle(1), triangle(2));
-        int max2 = std::max(triangle(1), triangle(2));
-        edges.emplace(Eigen::Vector2i(min2, max2));
-    }
-
-    int E = int(edges.size());
+    int E = int(GetTopology()->NumberOfEdges());
     int V = int(vertices_.size());
     int F = int(triangles_.size());
     return V + F - E;
@@ -1161,13 +1100,12 @@ int TriangleMesh::EulerPoincareCharacteristic() const {
 
 std::vector<Eigen::Vector2i> TriangleMesh::GetNonManifoldEdges(
         bool allow_boundary_edges /* = true */) const {
-    auto edges = GetEdgeToTrianglesMap();
+    auto topology = GetTopology();
     std::vector<Eigen::Vector2i> non_manifold_edges;
-    for (auto &kv : edges) {
-        if ((allow_boundary_edges &&
-             (kv.second.size() < 1 || kv.second.size() > 2)) ||
-            (!allow_boundary_edges && kv.second.size() != 2)) {
-            non_manifold_edges.push_back(kv.first);
+    for (int e = 0; e < int(topology->NumberOfEdges()); ++e) {
+        int num_triangles = topology->EdgeValence(e);
+        if (num_triangles > 2 || (!allow_boundary_edges && num_triangles < 2)) {
+            non_manifold_edges.push_back(topology->edges_[e]);
         }
     }
     return non_manifold_edges;
@@ -1175,11 +1113,10 @@ std::vector<Eigen::Vector2i> TriangleMesh::GetNonManifoldEdges(
 
 bool TriangleMesh::IsEdgeManifold(
         bool allow_boundary_edges /* = true */) const {
-    auto edges = GetEdgeToTrianglesMap();
-    for (auto &kv : edges) {
-        if ((allow_boundary_edges &&
-             (kv.second.size() < 1 || kv.second.size() > 2)) ||
-            (!allow_boundary_edges && kv.second.size() != 2)) {
+    auto topology = GetTopology();
+    for (int e = 0; e < int(topology->NumberOfEdges()); ++e) {
+        int num_triangles = topology->EdgeValence(e);
+        if (num_triangles > 2 || (!allow_boundary_edges && num_triangles < 2)) {
             return false;
         }
     }
@@ -1187,24 +1124,20 @@ bool TriangleMesh::IsEdgeManifold(
 }
 
 std::vector<int> TriangleMesh::GetNonManifoldVertices() const {
-    std::vector<std::unordered_set<int>> vert_to_triangles(vertices_.size());
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        const auto &tria = triangles_[tidx];
-        vert_to_triangles[tria(0)].emplace(int(tidx));
-        vert_to_triangles[tria(1)].emplace(int(tidx));
-        vert_to_triangles[tria(2)].emplace(int(tidx));
-    }
+    auto topology = GetTopology();
 
     std::vector<int> non_manifold_verts;
     for (int vidx = 0; vidx < int(vertices_.size()); ++vidx) {
-        const auto &triangles = vert_to_triangles[vidx];
-        if (triangles.size() == 0) {
+        int begin = topology->vertex_triangle_offsets_[vidx];
+        int end = topology->vertex_triangle_offsets_[vidx + 1];
+        if (begin == end) {
             continue;
         }
 
         // collect edges and vertices
         std::unordered_map<int, std::unordered_set<int>> edges;
-        for (int tidx : triangles) {
+        for (int i = begin; i < end; ++i) {
+            int tidx = topology->vertex_triangles_[i];
             const auto &triangle = triangles_[tidx];
             if (triangle(0) != vidx && triangle(1) != vidx) {
                 edges[triangle(0)].emplace(triangle(1));
@@ -33,6 +33,7 @@
 #include <vector>
 
 #include "Open3D/Geometry/Geometry3D.h"
+#include "Open3D/Geometry/TriangleMeshTopology.h"
 #include "Open3D/Utility/Helper.h"
 
 namespace open3d {
@@ -91,6 +92,30 @@ public:
     /// Function to compute adjacency list, call before adjacency list is needed
     TriangleMesh &ComputeAdjacencyList();
 
+    /// Function to enable or disable caching of the mesh topology. When
+    /// enabled, GetTopology builds the TriangleMeshTopology once and the
+    /// topology queries, ComputeAdjacencyList and the smoothing filters
+    /// reuse it until the triangles or the number of vertices change. The
+    /// cache compares the triangles with those it was built from, so direct
+    /// edits of triangles_ are detected. The cache is shared by copies of the
+    /// mesh and by the output of the smoothing filters.
+    TriangleMesh &EnableTopologyCache(bool enable = true);
+
+    /// Returns true if the topology cache is enabled.
+    bool IsTopologyCacheEnabled() const { return topology_cache_enabled_; }
+
+    /// Function to drop the cached topology and free its memory, it is
+    /// rebuilt on demand.
+    TriangleMesh &InvalidateTopologyCache() {
+        topology_cache_.Reset();
+        return *this;
+    }
+
+    /// Returns the topology of the mesh. It is taken from the cache if the
+    /// cache is enabled and valid, otherwise it is built and, if the cache
+    /// is enabled, stored. Safe to call concurrently on the same mesh.
+    std::shared_ptr<const TriangleMeshTopology> GetTopology() const;
+
     /// Function that removes duplicated verties, i.e., vertices that have
     /// identical coordinates.
     TriangleMesh &RemoveDuplicatedVertices();
@@ -349,6 +374,16 @@ public:
     std::shared_ptr<TriangleMesh> SimplifyQuadricDecimation(
             int target_number_of_triangles) const;
 
+    /// Function to simplify mesh using Quadric Error Metric Decimation by
+    /// Garland and Heckbert, collapsing edges in parallel rounds. In each
+    /// round the cheapest edges whose one-ring neighbourhoods do not overlap
+    /// form an independent set that is collapsed concurrently. Collapsing
+    /// stops as soon as the mesh has at most
+    /// \param target_number_of_triangles triangles, or if no further edge
+    /// can be collapsed without flipping a triangle.
+    std::shared_ptr<TriangleMesh> SimplifyQuadricDecimationParallel(
+            int target_number_of_triangles) const;
+
     /// Function to select points from \param input TriangleMesh into
     /// \return output TriangleMesh
     /// Vertices with indices in \param indices are selected.
@@ -481,16 +516,13 @@ protected:
     // Forward child class type to avoid indirect nonvirtual base
     TriangleMesh(Geometry::GeometryType type) : Geometry3D(type) {}
 
-    void FilterSmoothLaplacianHelper(
-            std::shared_ptr<TriangleMesh> &mesh,
-            const std::vector<Eigen::Vector3d> &prev_vertices,
-            const std::vector<Eigen::Vector3d> &prev_vertex_normals,
-            const std::vector<Eigen::Vector3d> &prev_vertex_colors,
-            const std::vector<std::unordered_set<int>> &adjacency_list,
-            double lambda,
-            bool filter_vertex,
-            bool filter_normal,
-            bool filter_color) const;
+    /// Returns a copy of the vertices, vertex attributes and triangles, used
+    /// as the output of the vertex filters.
+    std::shared_ptr<TriangleMesh> CreateFilterOutput() const;
+
+    /// Passes the topology cache setting, and the cached topology if the
+    /// cache is enabled, to \param mesh that has the same triangles.
+    void ShareTopologyCache(TriangleMesh &mesh) const;
 
 public:
     std::vector<Eigen::Vector3d> vertices_;
@@ -499,6 +531,10 @@ public:
     std::vector<Eigen::Vector3i> triangles_;
     std::vector<Eigen::Vector3d> triangle_normals_;
     std::vector<std::unordered_set<int>> adjacency_list_;
+
+protected:
+    bool topology_cache_enabled_ = false;
+    mutable TriangleMeshTopologyCache topology_cache_;
 };
 
 }  // namespace geometry
@@ -25,8 +25,12 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Geometry/Quadric.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <atomic>
+#include <limits>
 #include <queue>
 #include <tuple>
 
@@ -35,60 +39,6 @@
 namespace open3d {
 namespace geometry {
 
-/// Error quadric that is used to minimize the squared distance of a point to
-/// its neigbhouring triangle planes.
-/// Cf. "Simplifying Surfaces with Color and Texture using Quadric Error
-/// Metrics" by Garland and Heckbert.
-class Quadric {
-public:
-    Quadric() {
-        A_.fill(0);
-        b_.fill(0);
-        c_ = 0;
-    }
-
-    Quadric(const Eigen::Vector4d& plane, double weight = 1) {
-        Eigen::Vector3d n = plane.head<3>();
-        A_ = weight * n * n.transpose();
-        b_ = weight * plane(3) * n;
-        c_ = weight * plane(3) * plane(3);
-    }
-
-    Quadric& operator+=(const Quadric& other) {
-        A_ += other.A_;
-        b_ += other.b_;
-        c_ += other.c_;
-        return *this;
-    }
-
-    Quadric operator+(const Quadric& other) const {
-        Quadric res;
-        res.A_ = A_ + other.A_;
-        res.b_ = b_ + other.b_;
-        res.c_ = c_ + other.c_;
-        return res;
-    }
-
-    double Eval(const Eigen::Vector3d& v) const {
-        Eigen::Vector3d Av = A_ * v;
-        double q = v.dot(Av) + 2 * b_.dot(v) + c_;
-        return q;
-    }
-
-    bool IsInvertible() const { return std::fabs(A_.determinant()) > 1e-4; }
-
-    Eigen::Vector3d Minimum() const { return -A_.ldlt().solve(b_); }
-
-public:
-    /// A_ = n . n^T, where n is the plane normal
-    Eigen::Matrix3d A_;
-    /// b_ = d . n, where n is the plane normal and d the non-normal component
-    /// of the plane parameters
-    Eigen::Vector3d b_;
-    /// c_ = d . d, where d the non-normal component pf the plane parameters
-    double c_;
-};
-
 std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyVertexClustering(
         double voxel_size,
         TriangleMesh::SimplificationContraction
@@ -542,5 +492,427 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
     return mesh;
 }
 
+std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimationParallel(
+        int target_number_of_triangles) const {
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = vertices_;
+    mesh->vertex_normals_ = vertex_normals_;
+    mesh->vertex_colors_ = vertex_colors_;
+    mesh->triangles_ = triangles_;
+
+    int n_vertices = int(vertices_.size());
+    int n_triangles = int(triangles_.size());
+
+    // std::vector<bool> packs bits and cannot be written concurrently
+    std::vector<uint8_t> vertices_deleted(n_vertices, 0);
+    std::vector<uint8_t> triangles_deleted(n_triangles, 0);
+
+    std::vector<Eigen::Vector4d> triangle_planes(n_triangles);
+    std::vector<double> triangle_areas(n_triangles);
+#pragma omp parallel for schedule(static)
+    for (int tidx = 0; tidx < n_triangles; ++tidx) {
+        triangle_planes[tidx] = GetTrianglePlane(tidx);
+        triangle_areas[tidx] = GetTriangleArea(tidx);
+    }
+
+    std::vector<std::vector<int>> vert_to_triangles(n_vertices);
+    for (int tidx = 0; tidx < n_triangles; ++tidx) {
+        const auto& tria = triangles_[tidx];
+        vert_to_triangles[tria(0)].push_back(tidx);
+        if (tria(1) != tria(0)) {
+            vert_to_triangles[tria(1)].push_back(tidx);
+        }
+        if (tria(2) != tria(0) && tria(2) != tria(1)) {
+            vert_to_triangles[tria(2)].push_back(tidx);
+        }
+    }
+
+    auto HasVertex = [](const Eigen::Vector3i& tria, int vidx) {
+        return tria(0) == vidx || tria(1) == vidx || tria(2) == vidx;
+    };
+
+    // Compute the error metric per vertex. Every vertex only writes its own
+    // quadric, therefore boundary edges are detected from both end points.
+    std::vector<Quadric> Qs(n_vertices);
+#pragma omp parallel for schedule(static)
+    for (int vidx = 0; vidx < n_vertices; ++vidx) {
+        const auto& triangles = vert_to_triangles[vidx];
+        for (int tidx : triangles) {
+            Qs[vidx] += Quadric(triangle_planes[tidx], triangle_areas[tidx]);
+        }
+        for (int tidx : triangles) {
+            const Eigen::Vector3i& tria = triangles_[tidx];
+            for (int k = 0; k < 3; ++k) {
+                int vidx0 = tria(k);
+                int vidx1 = tria((k + 1) % 3);
+                if (vidx0 == vidx1 || (vidx0 != vidx && vidx1 != vidx)) {
+                    continue;
+                }
+                int other = vidx0 == vidx ? vidx1 : vidx0;
+                int count = 0;
+                for (int tidx2 : triangles) {
+                    count += HasVertex(triangles_[tidx2], other) ? 1 : 0;
+                }
+                if (count != 1) {
+                    continue;
+                }
+                // add plane perpendicular to the triangle through the
+                // boundary edge
+                const Eigen::Vector3d& vert0 = vertices_[vidx0];
+                const Eigen::Vector3d& vert1 = vertices_[vidx1];
+                Eigen::Vector3d n = (vert1 - vert0).cross(
+                        triangle_planes[tidx].head<3>());
+                double norm = n.norm();
+                if (norm == 0) {
+                    continue;
+                }
+                n /= norm;
+                Eigen::Vector4d plane(n(0), n(1), n(2), -n.dot(vert0));
+                Qs[vidx] += Quadric(plane, triangle_areas[tidx]);
+            }
+        }
+    }
+
+    auto ComputeCost = [&](int vidx0, int vidx1, Eigen::Vector3d& vbar) {
+        Quadric Qbar = Qs[vidx0] + Qs[vidx1];
+        if (Qbar.IsInvertible()) {
+            vbar = Qbar.Minimum();
+            return Qbar.Eval(vbar);
+        }
+        const Eigen::Vector3d& v0 = mesh->vertices_[vidx0];
+        const Eigen::Vector3d& v1 = mesh->vertices_[vidx1];
+        Eigen::Vector3d vmid = (v0 + v1) / 2;
+        double cost0 = Qbar.Eval(v0);
+        double cost1 = Qbar.Eval(v1);
+        double costmid = Qbar.Eval(vmid);
+        double cost = std::min(cost0, std::min(cost1, costmid));
+        if (cost == costmid) {
+            vbar = vmid;
+        } else if (cost == cost0) {
+            vbar = v0;
+        } else {
+            vbar = v1;
+        }
+        return cost;
+    };
+
+    // Collects the neighbours with a larger index than vidx that share a
+    // non-deleted triangle with vidx, sorted and unique.
+    auto CollectUpperNeighbours = [&](int vidx, std::vector<int>& nbs) {
+        nbs.clear();
+        for (int tidx : vert_to_triangles[vidx]) {
+            const Eigen::Vector3i& tria = mesh->triangles_[tidx];
+            for (int k = 0; k < 3; ++k) {
+                if (tria(k) > vidx) {
+                    nbs.push_back(tria(k));
+                }
+            }
+        }
+        std::sort(nbs.begin(), nbs.end());
+        nbs.erase(std::unique(nbs.begin(), nbs.end()), nbs.end());
+    };
+
+    // Tests if moving vidx0 and vidx1 to vbar flips any adjacent triangle
+    auto IsFlipping = [&](int vidx0, int vidx1, const Eigen::Vector3d& vbar) {
+        for (int vidx : {vidx0, vidx1}) {
+            for (int tidx : vert_to_triangles[vidx]) {
+                const Eigen::Vector3i& tria = mesh->triangles_[tidx];
+                if (HasVertex(tria, vidx0) && HasVertex(tria, vidx1)) {
+                    continue;
+                }
+                Eigen::Vector3d vert0 = mesh->vertices_[tria(0)];
+                Eigen::Vector3d vert1 = mesh->vertices_[tria(1)];
+                Eigen::Vector3d vert2 = mesh->vertices_[tria(2)];
+                Eigen::Vector3d norm_before =
+                        (vert1 - vert0).cross(vert2 - vert0);
+                norm_before /= norm_before.norm();
+
+                if (vidx == tria(0)) {
+                    vert0 = vbar;
+                } else if (vidx == tria(1)) {
+                    vert1 = vbar;
+                } else {
+                    vert2 = vbar;
+                }
+
+                Eigen::Vector3d norm_after =
+                        (vert1 - vert0).cross(vert2 - vert0);
+                norm_after /= norm_after.norm();
+                if (norm_before.dot(norm_after) < 0) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+
+    // Priorities of the candidate edges for the independent set selection.
+    // Ordering the candidates by cost (or by index) would let a single
+    // minimum suppress its whole neighbourhood along smooth cost fields,
+    // hence the edge index is scrambled by a bijective hash instead.
+    const uint64_t invalid_key = std::numeric_limits<uint64_t>::max();
+    auto EdgeKey = [](size_t eidx) {
+        uint64_t key = uint64_t(eidx);
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdULL;
+        key ^= key >> 33;
+        key *= 0xc4ceb9fe1a85ec53ULL;
+        key ^= key >> 33;
+        return key == invalid_key ? key - 1 : key;
+    };
+
+    std::vector<std::atomic<uint64_t>> vertex_marks(n_vertices);
+    std::vector<size_t> edge_offsets(n_vertices + 1);
+    std::vector<Eigen::Vector2i> edges;
+    std::vector<double> edge_costs;
+    std::vector<Eigen::Vector3d> edge_vbars;
+    std::vector<uint64_t> edge_keys;
+    std::vector<int> edge_removed;
+
+    bool has_vert_normal = HasVertexNormals();
+    bool has_vert_color = HasVertexColors();
+    bool all_edges_are_candidates = false;
+    while (n_triangles > target_number_of_triangles) {
+        // Drop deleted triangles from the vertex to triangle map
+#pragma omp parallel for schedule(static)
+        for (int vidx = 0; vidx < n_vertices; ++vidx) {
+            auto& triangles = vert_to_triangles[vidx];
+            triangles.erase(std::remove_if(triangles.begin(), triangles.end(),
+                                           [&](int tidx) {
+                                               return triangles_deleted[tidx] !=
+                                                      0;
+                                           }),
+                            triangles.end());
+        }
+
+        // Gather the unique edges (vidx0 < vidx1) in vertex order, such that
+        // the edge indices do not depend on the number of threads.
+        edge_offsets[0] = 0;
+#pragma omp parallel
+        {
+            std::vector<int> nbs;
+#pragma omp for schedule(static)
+            for (int vidx = 0; vidx < n_vertices; ++vidx) {
+                CollectUpperNeighbours(vidx, nbs);
+                edge_offsets[vidx + 1] = nbs.size();
+            }
+        }
+        for (int vidx = 0; vidx < n_vertices; ++vidx) {
+            edge_offsets[vidx + 1] += edge_offsets[vidx];
+        }
+        size_t n_edges = edge_offsets[n_vertices];
+        if (n_edges == 0) {
+            break;
+        }
+        edges.resize(n_edges);
+        edge_costs.resize(n_edges);
+        edge_vbars.resize(n_edges);
+        edge_keys.resize(n_edges);
+        edge_removed.resize(n_edges);
+#pragma omp parallel
+        {
+            std::vector<int> nbs;
+#pragma omp for schedule(static)
+            for (int vidx = 0; vidx < n_vertices; ++vidx) {
+                CollectUpperNeighbours(vidx, nbs);
+                size_t eidx = edge_offsets[vidx];
+                for (int nb : nbs) {
+                    edges[eidx] = Eigen::Vector2i(vidx, nb);
+                    edge_costs[eidx] =
+                            ComputeCost(vidx, nb, edge_vbars[eidx]);
+                    eidx++;
+                }
+                vertex_marks[vidx].store(invalid_key,
+                                         std::memory_order_relaxed);
+            }
+        }
+
+        // Only the cheapest edges are candidates. Every collapse removes up
+        // to two triangles.
+        double threshold = std::numeric_limits<double>::infinity();
+        size_t n_candidates = std::max(
+                size_t(1),
+                size_t(n_triangles - target_number_of_triangles + 1) / 2);
+        if (!all_edges_are_candidates && n_candidates < n_edges) {
+            std::vector<double> costs = edge_costs;
+            std::nth_element(costs.begin(), costs.begin() + n_candidates - 1,
+                             costs.end());
+            threshold = costs[n_candidates - 1];
+        }
+
+        // Every valid candidate marks its neighbourhood, i.e., all vertices
+        // of triangles adjacent to the edge, with the minimum key
+#pragma omp parallel for schedule(static)
+        for (int64_t eidx = 0; eidx < int64_t(n_edges); ++eidx) {
+            edge_keys[eidx] = invalid_key;
+            double cost = edge_costs[eidx];
+            if (!(cost <= threshold)) {
+                continue;
+            }
+            int vidx0 = edges[eidx](0);
+            int vidx1 = edges[eidx](1);
+            if (IsFlipping(vidx0, vidx1, edge_vbars[eidx])) {
+                continue;
+            }
+            uint64_t key = EdgeKey(size_t(eidx));
+            edge_keys[eidx] = key;
+            for (int vidx : {vidx0, vidx1}) {
+                for (int tidx : vert_to_triangles[vidx]) {
+                    const Eigen::Vector3i& tria = mesh->triangles_[tidx];
+                    for (int k = 0; k < 3; ++k) {
+                        std::atomic<uint64_t>& mark = vertex_marks[tria(k)];
+                        uint64_t prev = mark.load(std::memory_order_relaxed);
+                        while (key < prev &&
+                               !mark.compare_exchange_weak(
+                                       prev, key, std::memory_order_relaxed)) {
+                        }
+                    }
+                }
+            }
+        }
+
+        // An edge is selected if it owns its whole neighbourhood. The
+        // neighbourhoods of selected edges are hence disjoint.
+#pragma omp parallel for schedule(static)
+        for (int64_t eidx = 0; eidx < int64_t(n_edges); ++eidx) {
+            uint64_t key = edge_keys[eidx];
+            if (key == invalid_key) {
+                continue;
+            }
+            int vidx0 = edges[eidx](0);
+            int vidx1 = edges[eidx](1);
+            int removed = 0;
+            bool owned = true;
+            for (int vidx : {vidx0, vidx1}) {
+                for (int tidx : vert_to_triangles[vidx]) {
+                    const Eigen::Vector3i& tria = mesh->triangles_[tidx];
+                    for (int k = 0; k < 3; ++k) {
+                        owned = owned && vertex_marks[tria(k)].load(
+                                                 std::memory_order_relaxed) ==
+                                                 key;
+                    }
+                    if (vidx == vidx0 && HasVertex(tria, vidx1)) {
+                        removed++;
+                    }
+                }
+            }
+            if (!owned) {
+                edge_keys[eidx] = invalid_key;
+            }
+            edge_removed[eidx] = removed;
+        }
+
+        // Order the independent set by cost and cut it off at the target
+        std::vector<size_t> selected;
+        for (size_t eidx = 0; eidx < n_edges; ++eidx) {
+            if (edge_keys[eidx] != invalid_key) {
+                selected.push_back(eidx);
+            }
+        }
+        std::sort(selected.begin(), selected.end(), [&](size_t a, size_t b) {
+            return edge_costs[a] < edge_costs[b] ||
+                   (edge_costs[a] == edge_costs[b] && a < b);
+        });
+        size_t n_selected = 0;
+        int n_remaining = n_triangles;
+        while (n_selected < selected.size() &&
+               n_remaining > target_number_of_triangles) {
+            n_remaining -= edge_removed[selected[n_selected]];
+            n_selected++;
+        }
+
+        if (n_selected == 0) {
+            if (all_edges_are_candidates) {
+                break;
+            }
+            all_edges_are_candidates = true;
+            continue;
+        }
+        all_edges_are_candidates = false;
+
+        // Collapse vidx1 into vidx0. The neighbourhoods are disjoint, so the
+        // collapses do not interfere with each other.
+#pragma omp parallel for schedule(static)
+        for (int sidx = 0; sidx < int(n_selected); ++sidx) {
+            size_t eidx = selected[sidx];
+            int vidx0 = edges[eidx](0);
+            int vidx1 = edges[eidx](1);
+            for (int tidx : vert_to_triangles[vidx1]) {
+                Eigen::Vector3i& tria = mesh->triangles_[tidx];
+                if (HasVertex(tria, vidx0)) {
+                    triangles_deleted[tidx] = 1;
+                    continue;
+                }
+                if (vidx1 == tria(0)) {
+                    tria(0) = vidx0;
+                } else if (vidx1 == tria(1)) {
+                    tria(1) = vidx0;
+                } else if (vidx1 == tria(2)) {
+                    tria(2) = vidx0;
+                }
+                vert_to_triangles[vidx0].push_back(tidx);
+            }
+            vert_to_triangles[vidx1].clear();
+
+            mesh->vertices_[vidx0] = edge_vbars[eidx];
+            Qs[vidx0] += Qs[vidx1];
+            if (has_vert_normal) {
+                mesh->vertex_normals_[vidx0] =
+                        0.5 * (mesh->vertex_normals_[vidx0] +
+                               mesh->vertex_normals_[vidx1]);
+            }
+            if (has_vert_color) {
+                mesh->vertex_colors_[vidx0] =
+                        0.5 * (mesh->vertex_colors_[vidx0] +
+                               mesh->vertex_colors_[vidx1]);
+            }
+            vertices_deleted[vidx1] = 1;
+        }
+        n_triangles = n_remaining;
+    }
+
+    // Apply changes to the triangle mesh
+    int next_free = 0;
+    std::vector<int> vert_remapping(vertices_.size(), -1);
+    for (size_t idx = 0; idx < mesh->vertices_.size(); ++idx) {
+        if (!vertices_deleted[idx]) {
+            vert_remapping[idx] = next_free;
+            mesh->vertices_[next_free] = mesh->vertices_[idx];
+            if (has_vert_normal) {
+                mesh->vertex_normals_[next_free] = mesh->vertex_normals_[idx];
+            }
+            if (has_vert_color) {
+                mesh->vertex_colors_[next_free] = mesh->vertex_colors_[idx];
+            }
+            next_free++;
+        }
+    }
+    mesh->vertices_.resize(next_free);
+    if (has_vert_normal) {
+        mesh->vertex_normals_.resize(next_free);
+    }
+    if (has_vert_color) {
+        mesh->vertex_colors_.resize(next_free);
+    }
+
+    next_free = 0;
+    for (size_t idx = 0; idx < mesh->triangles_.size(); ++idx) {
+        if (!triangles_deleted[idx]) {
+            Eigen::Vector3i tria = mesh->triangles_[idx];
+            mesh->triangles_[next_free](0) = vert_remapping[tria(0)];
+            mesh->triangles_[next_free](1) = vert_remapping[tria(1)];
+            mesh->triangles_[next_free](2) = vert_remapping[tria(2)];
+            next_free++;
+        }
+    }
+    mesh->triangles_.resize(next_free);
+
+    if (HasTriangleNormals()) {
+        mesh->ComputeTriangleNormals();
+    }
+
+    return mesh;
+}
+
 }  // namespace geometry
 }  // namespace open3d
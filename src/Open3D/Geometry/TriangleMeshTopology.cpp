@@ -0,0 +1,170 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/TriangleMeshTopology.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Open3D/Geometry/HalfEdgeTriangleMesh.h"
+
+namespace open3d {
+namespace geometry {
+
+std::shared_ptr<TriangleMeshTopology> TriangleMeshTopology::Create(
+        const std::vector<Eigen::Vector3i> &triangles, size_t num_vertices) {
+    auto topology = std::make_shared<TriangleMeshTopology>();
+    topology->num_vertices_ = num_vertices;
+    const int num_triangles = int(triangles.size());
+
+    // Edge table, half-edge 3 * t + k is the side k of triangle t.
+    std::vector<int> edge_half_edges;
+    HalfEdgeTriangleMesh::GroupHalfEdgesByEdge(
+            triangles, num_vertices, topology->edge_triangle_offsets_,
+            edge_half_edges);
+    const int num_edges = int(topology->edge_triangle_offsets_.size()) - 1;
+    topology->edges_.resize(num_edges);
+    topology->edge_triangles_.resize(edge_half_edges.size());
+    topology->triangle_edges_.resize(num_triangles);
+#pragma omp parallel for schedule(static)
+    for (int e = 0; e < num_edges; ++e) {
+        int begin = topology->edge_triangle_offsets_[e];
+        int end = topology->edge_triangle_offsets_[e + 1];
+        int he = edge_half_edges[begin];
+        int vidx0 = triangles[he / 3](he % 3);
+        int vidx1 = triangles[he / 3]((he + 1) % 3);
+        topology->edges_[e] = Eigen::Vector2i(std::min(vidx0, vidx1),
+                                              std::max(vidx0, vidx1));
+        for (int i = begin; i < end; ++i) {
+            he = edge_half_edges[i];
+            topology->edge_triangles_[i] = he / 3;
+            topology->triangle_edges_[he / 3](he % 3) = e;
+        }
+    }
+
+    // Vertex to triangles. A degenerate triangle is listed once per vertex
+    // and scattering in triangle order keeps every list sorted.
+    auto IsFirstCorner = [&](int tidx, int k) {
+        const Eigen::Vector3i &triangle = triangles[tidx];
+        return (k < 1 || triangle(0) != triangle(k)) &&
+               (k < 2 || triangle(1) != triangle(k));
+    };
+    auto &vt_offsets = topology->vertex_triangle_offsets_;
+    vt_offsets.assign(num_vertices + 1, 0);
+    for (int tidx = 0; tidx < num_triangles; ++tidx) {
+        for (int k = 0; k < 3; ++k) {
+            if (IsFirstCorner(tidx, k)) {
+                vt_offsets[triangles[tidx](k) + 1]++;
+            }
+        }
+    }
+    for (size_t vidx = 0; vidx < num_vertices; ++vidx) {
+        vt_offsets[vidx + 1] += vt_offsets[vidx];
+    }
+    topology->vertex_triangles_.resize(vt_offsets[num_vertices]);
+    std::vector<int> cursors(vt_offsets.begin(), vt_offsets.end() - 1);
+    for (int tidx = 0; tidx < num_triangles; ++tidx) {
+        for (int k = 0; k < 3; ++k) {
+            if (IsFirstCorner(tidx, k)) {
+                topology->vertex_triangles_[cursors[triangles[tidx](k)]++] =
+                        tidx;
+            }
+        }
+    }
+
+    // Vertex to vertices. Edges are sorted by (smaller, larger) vertex, so
+    // scattering them in order yields sorted neighbour lists.
+    auto &vv_offsets = topology->vertex_vertex_offsets_;
+    vv_offsets.assign(num_vertices + 1, 0);
+    for (const auto &edge : topology->edges_) {
+        vv_offsets[edge(0) + 1]++;
+        if (edge(1) != edge(0)) {
+            vv_offsets[edge(1) + 1]++;
+        }
+    }
+    for (size_t vidx = 0; vidx < num_vertices; ++vidx) {
+        vv_offsets[vidx + 1] += vv_offsets[vidx];
+    }
+    topology->vertex_vertices_.resize(vv_offsets[num_vertices]);
+    cursors.assign(vv_offsets.begin(), vv_offsets.end() - 1);
+    for (const auto &edge : topology->edges_) {
+        topology->vertex_vertices_[cursors[edge(1)]++] = edge(0);
+        if (edge(1) != edge(0)) {
+            topology->vertex_vertices_[cursors[edge(0)]++] = edge(1);
+        }
+    }
+    return topology;
+}
+
+TriangleMeshTopologyCache::TriangleMeshTopologyCache(
+        const TriangleMeshTopologyCache &other) {
+    *this = other;
+}
+
+TriangleMeshTopologyCache &TriangleMeshTopologyCache::operator=(
+        const TriangleMeshTopologyCache &other) {
+    if (this == &other) {
+        return *this;
+    }
+    std::shared_ptr<const TriangleMeshTopology> topology;
+    std::shared_ptr<const std::vector<Eigen::Vector3i>> triangles;
+    {
+        std::lock_guard<std::mutex> lock(other.mutex_);
+        topology = other.topology_;
+        triangles = other.triangles_;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    topology_ = topology;
+    triangles_ = triangles;
+    return *this;
+}
+
+std::shared_ptr<const TriangleMeshTopology> TriangleMeshTopologyCache::Get(
+        const std::vector<Eigen::Vector3i> &triangles, size_t num_vertices) {
+    // Concurrent callers wait for a single build.
+    std::lock_guard<std::mutex> lock(mutex_);
+    // Eigen::Vector3i has no padding, so comparing bytes compares indices.
+    if (topology_ && topology_->NumberOfVertices() == num_vertices &&
+        triangles_->size() == triangles.size() &&
+        (triangles.empty() ||
+         std::memcmp(triangles_->data(), triangles.data(),
+                     triangles.size() * sizeof(Eigen::Vector3i)) == 0)) {
+        return topology_;
+    }
+    topology_ = TriangleMeshTopology::Create(triangles, num_vertices);
+    triangles_ = std::make_shared<const std::vector<Eigen::Vector3i>>(
+            triangles);
+    return topology_;
+}
+
+void TriangleMeshTopologyCache::Reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    topology_.reset();
+    triangles_.reset();
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,124 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+/// \class TriangleMeshTopology
+///
+/// Connectivity of a triangle mesh in compressed sparse row (CSR) form. The
+/// neighbours of element i are stored at [offsets[i], offsets[i + 1]) of the
+/// corresponding index array. It only depends on the triangles and the number
+/// of vertices, so it stays valid while vertex positions, normals or colors
+/// change. TriangleMesh can keep one as a cache, see
+/// TriangleMesh::EnableTopologyCache.
+class TriangleMeshTopology {
+public:
+    TriangleMeshTopology() {}
+    ~TriangleMeshTopology() {}
+
+public:
+    /// Builds the topology of \param triangles. All vertex indices must be
+    /// smaller than \param num_vertices.
+    static std::shared_ptr<TriangleMeshTopology> Create(
+            const std::vector<Eigen::Vector3i> &triangles,
+            size_t num_vertices);
+
+    size_t NumberOfVertices() const { return num_vertices_; }
+    size_t NumberOfTriangles() const { return triangle_edges_.size(); }
+    size_t NumberOfEdges() const { return edges_.size(); }
+
+    /// Number of triangles adjacent to edge \param edge_index.
+    int EdgeValence(int edge_index) const {
+        return edge_triangle_offsets_[edge_index + 1] -
+               edge_triangle_offsets_[edge_index];
+    }
+
+public:
+    size_t num_vertices_ = 0;
+
+    /// Triangles incident to each vertex, in increasing order.
+    std::vector<int> vertex_triangle_offsets_;
+    std::vector<int> vertex_triangles_;
+
+    /// Vertices sharing an edge with each vertex, in increasing order.
+    /// Degenerate triangles can make a vertex its own neighbour, as in
+    /// TriangleMesh::adjacency_list_.
+    std::vector<int> vertex_vertex_offsets_;
+    std::vector<int> vertex_vertices_;
+
+    /// Undirected edges (smaller vertex, larger vertex), in lexicographic
+    /// order, with the triangles adjacent to each edge. A triangle is listed
+    /// once per side lying on the edge.
+    std::vector<Eigen::Vector2i> edges_;
+    std::vector<int> edge_triangle_offsets_;
+    std::vector<int> edge_triangles_;
+
+    /// triangle_edges_[t](k) is the edge between corner k and corner
+    /// (k + 1) % 3 of triangle t.
+    std::vector<Eigen::Vector3i> triangle_edges_;
+};
+
+/// \class TriangleMeshTopologyCache
+///
+/// Cached TriangleMeshTopology of a mesh, together with a copy of the
+/// triangles it was built from. The topology is reused only while the
+/// triangles and the number of vertices are unchanged, so edits through any
+/// path, including direct writes to TriangleMesh::triangles_, are detected.
+/// Get may be called concurrently. Copies share the cached topology.
+class TriangleMeshTopologyCache {
+public:
+    TriangleMeshTopologyCache() {}
+    TriangleMeshTopologyCache(const TriangleMeshTopologyCache &other);
+    TriangleMeshTopologyCache &operator=(
+            const TriangleMeshTopologyCache &other);
+    ~TriangleMeshTopologyCache() {}
+
+public:
+    /// Returns the cached topology if it was built from \param triangles and
+    /// \param num_vertices, otherwise builds it and stores it.
+    std::shared_ptr<const TriangleMeshTopology> Get(
+            const std::vector<Eigen::Vector3i> &triangles,
+            size_t num_vertices);
+
+    /// Drops the cached topology.
+    void Reset();
+
+private:
+    mutable std::mutex mutex_;
+    std::shared_ptr<const TriangleMeshTopology> topology_;
+    std::shared_ptr<const std::vector<Eigen::Vector3i>> triangles_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -28,11 +28,13 @@
 
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Profiler.h"
 
 namespace open3d {
 namespace io {
 
 bool ReadFeature(const std::string &filename, registration::Feature &feature) {
+    OPEN3D_PROFILE_SCOPE("ReadFeature");
     return ReadFeatureFromBIN(filename, feature);
 }
 
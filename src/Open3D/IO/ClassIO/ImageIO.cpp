@@ -26,10 +26,16 @@
 
 #include "Open3D/IO/ClassIO/ImageIO.h"
 
+#include <algorithm>
 #include <unordered_map>
 
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Profiler.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 namespace open3d {
 
@@ -43,6 +49,7 @@ static const std::unordered_map<
                 {"png", ReadImageFromPNG},
                 {"jpg", ReadImageFromJPG},
                 {"jpeg", ReadImageFromJPG},
+                {"d16", ReadImageFromD16},
         };
 
 static const std::unordered_map<
@@ -52,6 +59,7 @@ static const std::unordered_map<
                 {"png", WriteImageToPNG},
                 {"jpg", WriteImageToJPG},
                 {"jpeg", WriteImageToJPG},
+                {"d16", WriteImageToD16},
         };
 
 }  // unnamed namespace
@@ -66,6 +74,7 @@ std::shared_ptr<geometry::Image> CreateImageFromFile(
 }
 
 bool ReadImage(const std::string &filename, geometry::Image &image) {
+    OPEN3D_PROFILE_SCOPE("ReadImage");
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
@@ -101,5 +110,69 @@ bool WriteImage(const std::string &filename,
     return map_itr->second(filename, image, quality);
 }
 
+bool ReadImages(const std::vector<std::string> &filenames,
+                std::vector<geometry::Image> &images,
+                int jpeg_scale_denominator /* = 1*/,
+                bool jpeg_fast /* = false*/) {
+    OPEN3D_PROFILE_SCOPE("ReadImages");
+    const int num_images = int(filenames.size());
+    images.resize(num_images);
+    std::vector<char> success(num_images, 0);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        JPGDecoder jpg_decoder;
+        // Files differ in size, so they are handed out one by one.
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (int i = 0; i < num_images; i++) {
+            std::string filename_ext =
+                    utility::filesystem::GetFileExtensionInLowerCase(
+                            filenames[i]);
+            if (filename_ext == "jpg" || filename_ext == "jpeg") {
+                success[i] = jpg_decoder.Read(filenames[i], images[i],
+                                              jpeg_scale_denominator,
+                                              jpeg_fast);
+            } else {
+                success[i] = ReadImage(filenames[i], images[i]);
+            }
+            if (!success[i]) {
+                images[i].Clear();
+            }
+        }
+    }
+    int num_failed = int(std::count(success.begin(), success.end(), 0));
+    if (num_failed > 0) {
+        utility::LogWarning("Read geometry::Image failed for {:d} of {:d} "
+                            "files.\n",
+                            num_failed, num_images);
+        return false;
+    }
+    return true;
+}
+
+bool WriteImages(const std::vector<std::string> &filenames,
+                 const std::vector<geometry::Image> &images,
+                 int quality /* = 90*/) {
+    if (filenames.size() != images.size()) {
+        utility::LogWarning(
+                "Write geometry::Image failed: {:d} file names for {:d} "
+                "images.\n",
+                filenames.size(), images.size());
+        return false;
+    }
+    const int num_images = int(images.size());
+    std::vector<char> success(num_images, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int i = 0; i < num_images; i++) {
+        success[i] = WriteImage(filenames[i], images[i], quality);
+    }
+    return std::count(success.begin(), success.end(), 0) == 0;
+}
+
 }  // namespace io
 }  // namespace open3d
@@ -26,7 +26,9 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "Open3D/Geometry/Image.h"
 
@@ -52,6 +54,25 @@ bool WriteImage(const std::string &filename,
                 const geometry::Image &image,
                 int quality = 90);
 
+/// Reads the images \param filenames in parallel into \param images, which
+/// is resized to match. The buffers of the images are reused when they are
+/// large enough, so that a batch of frames can be reloaded without
+/// allocations. JPEG images are decoded by one JPGDecoder per thread with
+/// \param jpeg_scale_denominator and \param jpeg_fast. Images that can not be
+/// read are left empty.
+/// \return return true if all images are read, false otherwise.
+bool ReadImages(const std::vector<std::string> &filenames,
+                std::vector<geometry::Image> &images,
+                int jpeg_scale_denominator = 1,
+                bool jpeg_fast = false);
+
+/// Writes the images \param images to \param filenames in parallel, one image
+/// per thread, see WriteImage.
+/// \return return true if all images are written, false otherwise.
+bool WriteImages(const std::vector<std::string> &filenames,
+                 const std::vector<geometry::Image> &images,
+                 int quality = 90);
+
 bool ReadImageFromPNG(const std::string &filename, geometry::Image &image);
 
 bool WriteImageToPNG(const std::string &filename,
@@ -64,5 +85,60 @@ bool WriteImageToJPG(const std::string &filename,
                      const geometry::Image &image,
                      int quality = 90);
 
+/// JPEG decoder that keeps its libjpeg state across images, which saves the
+/// setup of a decoder per image when one thread reads many files
+/// (FileJPG.cpp). It is not thread safe, use one decoder per thread.
+class JPGDecoder {
+public:
+    JPGDecoder();
+    ~JPGDecoder();
+    JPGDecoder(const JPGDecoder &) = delete;
+    JPGDecoder &operator=(const JPGDecoder &) = delete;
+
+public:
+    /// Reads \param filename into \param image, downscaled during decoding
+    /// by \param scale_denominator, which is 1, 2, 4 or 8. The downscaled
+    /// size is rounded up. If \param fast is true, the image is decoded
+    /// with the fast integer DCT and without smooth chroma upsampling, which
+    /// is less accurate but suits previews.
+    bool Read(const std::string &filename,
+              geometry::Image &image,
+              int scale_denominator = 1,
+              bool fast = false);
+
+private:
+    struct DecoderState;
+    std::unique_ptr<DecoderState> state_;
+};
+
+/// Decodes a JPEG image held in \param buffer of \param length bytes.
+bool ReadImageFromJPGInMemory(const uint8_t *buffer,
+                              size_t length,
+                              geometry::Image &image);
+
+/// Encodes \param image as JPEG into \param buffer, replacing its content.
+bool WriteImageToJPGInMemory(const geometry::Image &image,
+                             std::vector<uint8_t> &buffer,
+                             int quality = 90);
+
+/// Reads a 16 bit depth image in the lossless D16 format (FileD16.cpp),
+/// which encodes and decodes several times faster than PNG in less space.
+bool ReadImageFromD16(const std::string &filename, geometry::Image &image);
+
+/// Writes a 16 bit single channel image in the D16 format. \param quality is
+/// ignored, the codec is lossless.
+bool WriteImageToD16(const std::string &filename,
+                     const geometry::Image &image,
+                     int quality = 90);
+
+/// Decodes a D16 image held in \param buffer of \param length bytes.
+bool ReadImageFromD16InMemory(const uint8_t *buffer,
+                              size_t length,
+                              geometry::Image &image);
+
+/// Encodes \param image as D16 into \param buffer, replacing its content.
+bool WriteImageToD16InMemory(const geometry::Image &image,
+                             std::vector<uint8_t> &buffer);
+
 }  // namespace io
 }  // namespace open3d
@@ -31,6 +31,7 @@
 #include "Open3D/IO/ClassIO/IJsonConvertibleIO.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Profiler.h"
 
 namespace open3d {
 
@@ -57,6 +58,7 @@ static const std::unordered_map<
                 {"log", ReadPinholeCameraTrajectoryFromLOG},
                 {"json", ReadPinholeCameraTrajectoryFromJSON},
                 {"txt", ReadPinholeCameraTrajectoryFromTUM},
+                {"bin", ReadPinholeCameraTrajectoryFromBIN},
         };
 
 static const std::unordered_map<
@@ -67,6 +69,7 @@ static const std::unordered_map<
                 {"log", WritePinholeCameraTrajectoryToLOG},
                 {"json", WritePinholeCameraTrajectoryToJSON},
                 {"txt", WritePinholeCameraTrajectoryToTUM},
+                {"bin", WritePinholeCameraTrajectoryToBIN},
         };
 
 }  // unnamed namespace
@@ -82,6 +85,7 @@ CreatePinholeCameraTrajectoryFromFile(const std::string &filename) {
 
 bool ReadPinholeCameraTrajectory(const std::string &filename,
                                  camera::PinholeCameraTrajectory &trajectory) {
+    OPEN3D_PROFILE_SCOPE("ReadPinholeCameraTrajectory");
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
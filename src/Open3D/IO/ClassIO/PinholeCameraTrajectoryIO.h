@@ -68,5 +68,15 @@ bool WritePinholeCameraTrajectoryToTUM(
         const std::string &filename,
         const camera::PinholeCameraTrajectory &trajectory);
 
+/// Reads the versioned little-endian binary format (.bin), which stores one
+/// fixed-size record of intrinsic and extrinsic per camera.
+bool ReadPinholeCameraTrajectoryFromBIN(
+        const std::string &filename,
+        camera::PinholeCameraTrajectory &trajectory);
+
+bool WritePinholeCameraTrajectoryToBIN(
+        const std::string &filename,
+        const camera::PinholeCameraTrajectory &trajectory);
+
 }  // namespace io
 }  // namespace open3d
@@ -31,6 +31,7 @@
 #include "Open3D/IO/ClassIO/IJsonConvertibleIO.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Profiler.h"
 
 namespace open3d {
 
@@ -52,6 +53,7 @@ static const std::unordered_map<
         std::function<bool(const std::string &, registration::PoseGraph &)>>
         file_extension_to_pose_graph_read_function{
                 {"json", ReadPoseGraphFromJSON},
+                {"bin", ReadPoseGraphFromBIN},
         };
 
 static const std::unordered_map<
@@ -60,6 +62,7 @@ static const std::unordered_map<
                            const registration::PoseGraph &)>>
         file_extension_to_pose_graph_write_function{
                 {"json", WritePoseGraphToJSON},
+                {"bin", WritePoseGraphToBIN},
         };
 
 }  // unnamed namespace
@@ -74,6 +77,7 @@ std::shared_ptr<registration::PoseGraph> CreatePoseGraphFromFile(
 
 bool ReadPoseGraph(const std::string &filename,
                    registration::PoseGraph &pose_graph) {
+    OPEN3D_PROFILE_SCOPE("ReadPoseGraph");
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
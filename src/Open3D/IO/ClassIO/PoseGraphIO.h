@@ -51,5 +51,13 @@ bool ReadPoseGraph(const std::string &filename,
 bool WritePoseGraph(const std::string &filename,
                     const registration::PoseGraph &pose_graph);
 
+/// Reads the versioned little-endian binary format (.bin), which stores the
+/// nodes and edges as fixed-size records that can be memory mapped.
+bool ReadPoseGraphFromBIN(const std::string &filename,
+                          registration::PoseGraph &pose_graph);
+
+bool WritePoseGraphToBIN(const std::string &filename,
+                         const registration::PoseGraph &pose_graph);
+
 }  // namespace io
 }  // namespace open3d
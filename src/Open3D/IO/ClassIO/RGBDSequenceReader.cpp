@@ -0,0 +1,218 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/ClassIO/RGBDSequenceReader.h"
+
+#include <algorithm>
+
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace io {
+
+RGBDSequenceReader::RGBDSequenceReader(
+        const std::vector<std::string> &color_files,
+        const std::vector<std::string> &depth_files,
+        int num_threads /* = 2*/,
+        size_t lookahead /* = 4*/,
+        size_t cache_capacity /* = 16*/)
+    : color_files_(color_files),
+      depth_files_(depth_files),
+      lookahead_(lookahead),
+      cache_capacity_(std::max(cache_capacity, lookahead + 1)) {
+    if (color_files_.size() != depth_files_.size()) {
+        utility::LogWarning(
+                "[RGBDSequenceReader] {:d} color files and {:d} depth files, "
+                "extra files are ignored.\n",
+                color_files_.size(), depth_files_.size());
+        size_t num_frames = std::min(color_files_.size(), depth_files_.size());
+        color_files_.resize(num_frames);
+        depth_files_.resize(num_frames);
+    }
+    num_frames_ = color_files_.size();
+    StartWorkers(num_threads);
+}
+
+RGBDSequenceReader::RGBDSequenceReader(const std::string &sequence_file,
+                                       int num_threads /* = 2*/,
+                                       size_t lookahead /* = 4*/,
+                                       size_t cache_capacity /* = 16*/)
+    : sequence_file_(new RGBDSequenceFileReader()),
+      lookahead_(lookahead),
+      cache_capacity_(std::max(cache_capacity, lookahead + 1)) {
+    sequence_file_->Open(sequence_file);
+    num_frames_ = sequence_file_->NumFrames();
+    StartWorkers(num_threads);
+}
+
+RGBDSequenceReader::~RGBDSequenceReader() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    queue_condition_.notify_all();
+    for (std::thread &worker : workers_) {
+        worker.join();
+    }
+}
+
+std::shared_ptr<const geometry::RGBDImage> RGBDSequenceReader::GetFrame(
+        size_t index) {
+    if (index >= NumFrames()) {
+        utility::LogWarning("[RGBDSequenceReader] Frame {:d} out of range.\n",
+                            index);
+        return nullptr;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    ScheduleLookahead(index);
+    while (true) {
+        auto it = entries_.find(index);
+        if (it != entries_.end() && it->second.state_ == FrameState::Ready) {
+            lru_.splice(lru_.begin(), lru_, it->second.lru_position_);
+            return it->second.frame_;
+        }
+        if (it != entries_.end() && it->second.state_ == FrameState::Decoding) {
+            frame_condition_.wait(lock);
+            continue;
+        }
+        // decode on this thread rather than wait for a worker
+        if (it == entries_.end()) {
+            it = entries_.emplace(index, CacheEntry()).first;
+        } else {
+            queue_.erase(std::find(queue_.begin(), queue_.end(), index));
+        }
+        it->second.state_ = FrameState::Decoding;
+        lock.unlock();
+        std::shared_ptr<const geometry::RGBDImage> frame = DecodeFrame(index);
+        lock.lock();
+        InsertFrame(index, frame);
+        frame_condition_.notify_all();
+        return frame;
+    }
+}
+
+void RGBDSequenceReader::ClearCache() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t index : lru_) {
+        entries_.erase(index);
+    }
+    lru_.clear();
+}
+
+size_t RGBDSequenceReader::NumDecodedFrames() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_decoded_frames_;
+}
+
+void RGBDSequenceReader::StartWorkers(int num_threads) {
+    if (lookahead_ > 0) {
+        for (int i = 0; i < num_threads; i++) {
+            workers_.emplace_back(&RGBDSequenceReader::WorkerLoop, this);
+        }
+    }
+}
+
+std::shared_ptr<const geometry::RGBDImage> RGBDSequenceReader::DecodeFrame(
+        size_t index) {
+    auto frame = std::make_shared<geometry::RGBDImage>();
+    if (sequence_file_) {
+        if (!sequence_file_->ReadFrame(index, *frame)) {
+            return nullptr;
+        }
+    } else if (!ReadImage(color_files_[index], frame->color_) ||
+               !ReadImage(depth_files_[index], frame->depth_)) {
+        utility::LogWarning("[RGBDSequenceReader] Unable to read frame {:d}.\n",
+                            index);
+        return nullptr;
+    }
+    return frame;
+}
+
+void RGBDSequenceReader::InsertFrame(
+        size_t index, std::shared_ptr<const geometry::RGBDImage> frame) {
+    CacheEntry &entry = entries_[index];
+    entry.state_ = FrameState::Ready;
+    entry.frame_ = frame;
+    lru_.push_front(index);
+    entry.lru_position_ = lru_.begin();
+    num_decoded_frames_++;
+    while (lru_.size() > cache_capacity_) {
+        entries_.erase(lru_.back());
+        lru_.pop_back();
+    }
+}
+
+void RGBDSequenceReader::ScheduleLookahead(size_t index) {
+    if (workers_.empty()) {
+        return;
+    }
+    size_t end = std::min(index + 1 + lookahead_, NumFrames());
+    // frames queued for an earlier position that are not needed anymore
+    for (auto it = queue_.begin(); it != queue_.end();) {
+        if (*it <= index || *it >= end) {
+            entries_.erase(*it);
+            it = queue_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    bool is_queued = false;
+    for (size_t i = index + 1; i < end; i++) {
+        if (entries_.count(i) == 0) {
+            CacheEntry entry;
+            entry.state_ = FrameState::Queued;
+            entries_.emplace(i, entry);
+            queue_.push_back(i);
+            is_queued = true;
+        }
+    }
+    if (is_queued) {
+        queue_condition_.notify_all();
+    }
+}
+
+void RGBDSequenceReader::WorkerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        queue_condition_.wait(lock,
+                              [this] { return stop_ || !queue_.empty(); });
+        if (stop_) {
+            return;
+        }
+        size_t index = queue_.front();
+        queue_.pop_front();
+        entries_[index].state_ = FrameState::Decoding;
+        lock.unlock();
+        std::shared_ptr<const geometry::RGBDImage> frame = DecodeFrame(index);
+        lock.lock();
+        InsertFrame(index, frame);
+        frame_condition_.notify_all();
+    }
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,142 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/IO/Sensor/RGBDSequenceFileReader.h"
+
+namespace open3d {
+namespace io {
+
+/// Reader for RGB-D sequences stored as one color and one depth image file
+/// per frame, or as an RGB-D sequence file. Frames are decoded with ReadImage
+/// or RGBDSequenceFileReader and returned as RGBDImage holding the color and
+/// depth images as stored in the files.
+///
+/// A pool of background threads decodes the frames following the last
+/// requested one, at most \param lookahead of them, so that decoding
+/// overlaps the processing of the caller. The most recently used decoded
+/// frames are kept in a cache, so passes that visit frames again do not
+/// decode them again. All methods are thread safe.
+class RGBDSequenceReader {
+public:
+    /// \param num_threads background decoding threads, 0 decodes every frame
+    /// on the calling thread when it is requested.
+    /// \param cache_capacity number of decoded frames kept in memory, at
+    /// least lookahead + 1.
+    RGBDSequenceReader(const std::vector<std::string> &color_files,
+                       const std::vector<std::string> &depth_files,
+                       int num_threads = 2,
+                       size_t lookahead = 4,
+                       size_t cache_capacity = 16);
+    /// Reads the frames of the RGB-D sequence file \param sequence_file, see
+    /// RGBDSequenceFileWriter. The sequence is empty if the file can not be
+    /// opened.
+    RGBDSequenceReader(const std::string &sequence_file,
+                       int num_threads = 2,
+                       size_t lookahead = 4,
+                       size_t cache_capacity = 16);
+    ~RGBDSequenceReader();
+    RGBDSequenceReader(const RGBDSequenceReader &) = delete;
+    RGBDSequenceReader &operator=(const RGBDSequenceReader &) = delete;
+
+public:
+    size_t NumFrames() const { return num_frames_; }
+
+    /// The sequence file the frames are read from, nullptr if the frames are
+    /// read from image files.
+    const RGBDSequenceFileReader *GetSequenceFile() const {
+        return sequence_file_.get();
+    }
+
+    /// Returns frame \param index, waiting for it to be decoded if needed,
+    /// and schedules the decoding of the frames after it.
+    /// \return nullptr if the index is out of range or the files of the frame
+    /// can not be read.
+    std::shared_ptr<const geometry::RGBDImage> GetFrame(size_t index);
+
+    /// Drops all decoded frames from the cache.
+    void ClearCache();
+
+    /// Number of frames decoded so far, including decodes that failed.
+    size_t NumDecodedFrames() const;
+
+private:
+    enum class FrameState { Queued, Decoding, Ready };
+
+    struct CacheEntry {
+        FrameState state_;
+        std::shared_ptr<const geometry::RGBDImage> frame_;
+        /// Position in lru_, valid once the frame is ready.
+        std::list<size_t>::iterator lru_position_;
+    };
+
+    void StartWorkers(int num_threads);
+    std::shared_ptr<const geometry::RGBDImage> DecodeFrame(size_t index);
+    /// Stores a decoded frame and evicts least recently used frames. Must be
+    /// called with mutex_ held.
+    void InsertFrame(size_t index,
+                     std::shared_ptr<const geometry::RGBDImage> frame);
+    /// Queues the frames after \param index and drops queued frames outside
+    /// of the new lookahead window. Must be called with mutex_ held.
+    void ScheduleLookahead(size_t index);
+    void WorkerLoop();
+
+private:
+    std::vector<std::string> color_files_;
+    std::vector<std::string> depth_files_;
+    std::unique_ptr<RGBDSequenceFileReader> sequence_file_;
+    size_t num_frames_;
+    size_t lookahead_;
+    size_t cache_capacity_;
+
+    mutable std::mutex mutex_;
+    /// Signals workers that frames were queued or that they should stop.
+    std::condition_variable queue_condition_;
+    /// Signals readers that a frame finished decoding.
+    std::condition_variable frame_condition_;
+    std::unordered_map<size_t, CacheEntry> entries_;
+    /// Ready frames, most recently used first.
+    std::list<size_t> lru_;
+    std::deque<size_t> queue_;
+    size_t num_decoded_frames_ = 0;
+    bool stop_ = false;
+    std::vector<std::thread> workers_;
+};
+
+}  // namespace io
+}  // namespace open3d
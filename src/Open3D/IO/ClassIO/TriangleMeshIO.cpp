@@ -28,8 +28,10 @@
 
 #include <unordered_map>
 
+#include "Open3D/Geometry/StreamingVertexClustering.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Profiler.h"
 
 namespace open3d {
 
@@ -67,6 +69,17 @@ static const std::unordered_map<
                 {"glb", WriteTriangleMeshToGLTF},
         };
 
+static const std::unordered_map<
+        std::string,
+        std::function<bool(const std::string &,
+                           const TriangleChunkCallback &,
+                           size_t,
+                           bool)>>
+        file_extension_to_trianglemesh_read_in_chunks_function{
+                {"ply", ReadTriangleMeshInChunksFromPLY},
+                {"stl", ReadTriangleMeshInChunksFromSTL},
+        };
+
 }  // unnamed namespace
 
 namespace io {
@@ -81,6 +94,7 @@ std::shared_ptr<geometry::TriangleMesh> CreateMeshFromFile(
 bool ReadTriangleMesh(const std::string &filename,
                       geometry::TriangleMesh &mesh,
                       bool print_progress) {
+    OPEN3D_PROFILE_SCOPE("ReadTriangleMesh");
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
@@ -142,6 +156,59 @@ bool WriteTriangleMesh(const std::string &filename,
     return success;
 }
 
+bool ReadTriangleMeshInChunks(const std::string &filename,
+                              const TriangleChunkCallback &callback,
+                              size_t chunk_size /* = 65536*/,
+                              bool print_progress /* = false*/) {
+    std::string filename_ext =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
+    if (filename_ext.empty()) {
+        utility::LogWarning(
+                "Read geometry::TriangleMesh in chunks failed: unknown file "
+                "extension.\n");
+        return false;
+    }
+    auto map_itr = file_extension_to_trianglemesh_read_in_chunks_function.find(
+            filename_ext);
+    if (map_itr ==
+        file_extension_to_trianglemesh_read_in_chunks_function.end()) {
+        utility::LogWarning(
+                "Read geometry::TriangleMesh in chunks failed: unknown file "
+                "extension.\n");
+        return false;
+    }
+    if (chunk_size == 0) {
+        utility::LogWarning(
+                "Read geometry::TriangleMesh in chunks failed: chunk_size is "
+                "0.\n");
+        return false;
+    }
+    return map_itr->second(filename, callback, chunk_size, print_progress);
+}
+
+std::shared_ptr<geometry::TriangleMesh> SimplifyTriangleMeshFromFile(
+        const std::string &filename,
+        double voxel_size,
+        geometry::TriangleMesh::SimplificationContraction
+                contraction /* = SimplificationContraction::Quadric */,
+        size_t chunk_size /* = 65536*/,
+        bool print_progress /* = false*/) {
+    geometry::StreamingVertexClustering clustering(voxel_size, contraction);
+    auto AddTriangles = [&](const std::vector<Eigen::Vector3d> &corners) {
+        clustering.AddTriangles(corners);
+    };
+    if (!ReadTriangleMeshInChunks(filename, AddTriangles, chunk_size,
+                                  print_progress)) {
+        return std::make_shared<geometry::TriangleMesh>();
+    }
+    auto mesh = clustering.ExtractTriangleMesh();
+    utility::LogDebug(
+            "Simplify geometry::TriangleMesh from file: {:d} triangles and "
+            "{:d} vertices.\n",
+            (int)mesh->triangles_.size(), (int)mesh->vertices_.size());
+    return mesh;
+}
+
 // Reference: https://stackoverflow.com/a/43896965
 bool IsPointInsidePolygon(const Eigen::MatrixX2d &polygon, double x, double y) {
     bool inside = false;
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
 
 #include "Open3D/Geometry/TriangleMesh.h"
@@ -58,6 +59,34 @@ bool WriteTriangleMesh(const std::string &filename,
                        bool write_vertex_colors = true,
                        bool print_progress = false);
 
+/// Callback that receives a chunk of triangles, every triangle is given by
+/// three consecutive corner positions.
+typedef std::function<void(const std::vector<Eigen::Vector3d> &corners)>
+        TriangleChunkCallback;
+
+/// The general entrance for reading the triangles of a mesh file in chunks of
+/// at most \param chunk_size triangles, without creating a TriangleMesh.
+/// The function calls read functions based on the extension name of filename.
+/// Supported are PLY and binary STL files.
+/// \return return true if the read function is successful, false otherwise.
+bool ReadTriangleMeshInChunks(const std::string &filename,
+                              const TriangleChunkCallback &callback,
+                              size_t chunk_size = 65536,
+                              bool print_progress = false);
+
+/// Function to simplify a mesh file with out-of-core vertex clustering (see
+/// geometry::StreamingVertexClustering). The triangles are streamed from the
+/// file in chunks of \param chunk_size triangles, such that the input mesh
+/// never has to fit into memory.
+/// \return return the simplified mesh, which is empty if reading failed.
+std::shared_ptr<geometry::TriangleMesh> SimplifyTriangleMeshFromFile(
+        const std::string &filename,
+        double voxel_size,
+        geometry::TriangleMesh::SimplificationContraction contraction =
+                geometry::TriangleMesh::SimplificationContraction::Quadric,
+        size_t chunk_size = 65536,
+        bool print_progress = false);
+
 bool ReadTriangleMeshFromPLY(const std::string &filename,
                              geometry::TriangleMesh &mesh,
                              bool print_progress = false);
@@ -70,10 +99,22 @@ bool WriteTriangleMeshToPLY(const std::string &filename,
                             bool write_vertex_colors = true,
                             bool print_progress = false);
 
+/// Only the vertex positions are kept in memory (in single precision), the
+/// faces are streamed. Polygons are split into triangle fans.
+bool ReadTriangleMeshInChunksFromPLY(const std::string &filename,
+                                     const TriangleChunkCallback &callback,
+                                     size_t chunk_size = 65536,
+                                     bool print_progress = false);
+
 bool ReadTriangleMeshFromSTL(const std::string &filename,
                              geometry::TriangleMesh &mesh,
                              bool print_progress = false);
 
+bool ReadTriangleMeshInChunksFromSTL(const std::string &filename,
+                                     const TriangleChunkCallback &callback,
+                                     size_t chunk_size = 65536,
+                                     bool print_progress = false);
+
 bool WriteTriangleMeshToSTL(const std::string &filename,
                             const geometry::TriangleMesh &mesh,
                             bool write_ascii = false,
@@ -24,10 +24,15 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <memory>
+#include <vector>
 
 #include "Open3D/IO/ClassIO/FeatureIO.h"
+#include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
+#include "Open3D/IO/ClassIO/PoseGraphIO.h"
 #include "Open3D/Utility/Console.h"
 
 namespace open3d {
@@ -71,6 +76,160 @@ bool WriteMatrixXdToBINFile(FILE *file, const Eigen::MatrixXd &mat) {
     return true;
 }
 
+/// Header of the binary pose graph and trajectory files, followed by
+/// num_records_[0] records of the first kind and num_records_[1] records of
+/// the second kind. Everything is little-endian and every record is 8-byte
+/// aligned, so a file can be memory mapped and its records used in place.
+/// Matrices are stored column-major.
+struct BINHeader {
+    char magic_[8];
+    uint32_t version_;
+    uint32_t reserved_;
+    uint64_t num_records_[2];
+};
+
+struct PoseGraphNodeRecord {
+    double pose_[16];
+};
+
+struct PoseGraphEdgeRecord {
+    int32_t source_node_id_;
+    int32_t target_node_id_;
+    int32_t uncertain_;
+    int32_t reserved_;
+    double confidence_;
+    double transformation_[16];
+    double information_[36];
+};
+
+struct PinholeCameraParametersRecord {
+    int32_t width_;
+    int32_t height_;
+    double intrinsic_matrix_[9];
+    double extrinsic_[16];
+};
+
+static_assert(sizeof(BINHeader) == 32, "unexpected BINHeader padding");
+static_assert(sizeof(PoseGraphNodeRecord) == 128,
+              "unexpected PoseGraphNodeRecord padding");
+static_assert(sizeof(PoseGraphEdgeRecord) == 440,
+              "unexpected PoseGraphEdgeRecord padding");
+static_assert(sizeof(PinholeCameraParametersRecord) == 208,
+              "unexpected PinholeCameraParametersRecord padding");
+
+const uint32_t kBINVersion = 1;
+const char kPoseGraphBINMagic[8] = {'O', '3', 'D', 'P', 'G', 'R', 'P', 'H'};
+const char kTrajectoryBINMagic[8] = {'O', '3', 'D', 'T', 'R', 'A', 'J', 'C'};
+
+bool IsLittleEndianHost() {
+    const uint16_t one = 1;
+    return *reinterpret_cast<const uint8_t *>(&one) == 1;
+}
+
+/// Opens a binary pose graph or trajectory file and checks its header
+/// against \param magic and its size against the record sizes.
+FILE *OpenBINFileForReading(const std::string &filename,
+                            const char *magic,
+                            size_t record_size0,
+                            size_t record_size1,
+                            BINHeader &header) {
+    if (!IsLittleEndianHost()) {
+        utility::LogWarning("Read BIN failed: big-endian hosts unsupported.\n");
+        return NULL;
+    }
+    FILE *file = fopen(filename.c_str(), "rb");
+    if (file == NULL) {
+        utility::LogWarning("Read BIN failed: unable to open file: {}\n",
+                            filename);
+        return NULL;
+    }
+    if (fread(&header, sizeof(BINHeader), 1, file) < 1) {
+        utility::LogWarning("Read BIN failed: unexpected EOF.\n");
+        fclose(file);
+        return NULL;
+    }
+    if (memcmp(header.magic_, magic, sizeof(header.magic_)) != 0) {
+        utility::LogWarning("Read BIN failed: unknown file type: {}\n",
+                            filename);
+        fclose(file);
+        return NULL;
+    }
+    if (header.version_ != kBINVersion) {
+        utility::LogWarning("Read BIN failed: unsupported version {:d}.\n",
+                            header.version_);
+        fclose(file);
+        return NULL;
+    }
+    // checking the size up front also rejects corrupted record counts
+    // before anything is allocated
+    fseek(file, 0, SEEK_END);
+    uint64_t file_size = uint64_t(ftell(file));
+    fseek(file, sizeof(BINHeader), SEEK_SET);
+    uint64_t max_records = (file_size - sizeof(BINHeader)) / record_size0;
+    if (header.num_records_[0] > max_records ||
+        header.num_records_[1] > max_records * record_size0 / record_size1 ||
+        sizeof(BINHeader) + header.num_records_[0] * record_size0 +
+                        header.num_records_[1] * record_size1 !=
+                file_size) {
+        utility::LogWarning("Read BIN failed: unexpected file size.\n");
+        fclose(file);
+        return NULL;
+    }
+    return file;
+}
+
+FILE *OpenBINFileForWriting(const std::string &filename,
+                            const char *magic,
+                            uint64_t num_records0,
+                            uint64_t num_records1) {
+    if (!IsLittleEndianHost()) {
+        utility::LogWarning(
+                "Write BIN failed: big-endian hosts unsupported.\n");
+        return NULL;
+    }
+    FILE *file = fopen(filename.c_str(), "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write BIN failed: unable to open file: {}\n",
+                            filename);
+        return NULL;
+    }
+    BINHeader header;
+    memset(&header, 0, sizeof(BINHeader));
+    memcpy(header.magic_, magic, sizeof(header.magic_));
+    header.version_ = kBINVersion;
+    header.num_records_[0] = num_records0;
+    header.num_records_[1] = num_records1;
+    if (fwrite(&header, sizeof(BINHeader), 1, file) < 1) {
+        utility::LogWarning("Write BIN failed: unexpected error.\n");
+        fclose(file);
+        return NULL;
+    }
+    return file;
+}
+
+template <typename Record>
+bool ReadRecordsFromBINFile(FILE *file,
+                            uint64_t num_records,
+                            std::vector<Record> &records) {
+    records.resize(size_t(num_records));
+    if (fread(records.data(), sizeof(Record), records.size(), file) <
+        records.size()) {
+        utility::LogWarning("Read BIN failed: unexpected EOF.\n");
+        return false;
+    }
+    return true;
+}
+
+template <typename Record>
+bool WriteRecordsToBINFile(FILE *file, const std::vector<Record> &records) {
+    if (fwrite(records.data(), sizeof(Record), records.size(), file) <
+        records.size()) {
+        utility::LogWarning("Write BIN failed: unexpected error.\n");
+        return false;
+    }
+    return true;
+}
+
 }  // unnamed namespace
 
 namespace io {
@@ -101,5 +260,152 @@ bool WriteFeatureToBIN(const std::string &filename,
     return success;
 }
 
+bool ReadPoseGraphFromBIN(const std::string &filename,
+                          registration::PoseGraph &pose_graph) {
+    BINHeader header;
+    FILE *fid = OpenBINFileForReading(filename, kPoseGraphBINMagic,
+                                      sizeof(PoseGraphNodeRecord),
+                                      sizeof(PoseGraphEdgeRecord), header);
+    if (fid == NULL) {
+        return false;
+    }
+    std::vector<PoseGraphNodeRecord> node_records;
+    std::vector<PoseGraphEdgeRecord> edge_records;
+    bool success = ReadRecordsFromBINFile(fid, header.num_records_[0],
+                                          node_records) &&
+                   ReadRecordsFromBINFile(fid, header.num_records_[1],
+                                          edge_records);
+    fclose(fid);
+    if (!success) {
+        return false;
+    }
+
+    pose_graph.nodes_.resize(node_records.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < (int)node_records.size(); i++) {
+        memcpy(pose_graph.nodes_[i].pose_.data(), node_records[i].pose_,
+               sizeof(node_records[i].pose_));
+    }
+    pose_graph.edges_.resize(edge_records.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < (int)edge_records.size(); i++) {
+        const PoseGraphEdgeRecord &record = edge_records[i];
+        registration::PoseGraphEdge &edge = pose_graph.edges_[i];
+        edge.source_node_id_ = record.source_node_id_;
+        edge.target_node_id_ = record.target_node_id_;
+        edge.uncertain_ = record.uncertain_ != 0;
+        edge.confidence_ = record.confidence_;
+        memcpy(edge.transformation_.data(), record.transformation_,
+               sizeof(record.transformation_));
+        memcpy(edge.information_.data(), record.information_,
+               sizeof(record.information_));
+    }
+    return true;
+}
+
+bool WritePoseGraphToBIN(const std::string &filename,
+                         const registration::PoseGraph &pose_graph) {
+    std::vector<PoseGraphNodeRecord> node_records(pose_graph.nodes_.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < (int)node_records.size(); i++) {
+        memcpy(node_records[i].pose_, pose_graph.nodes_[i].pose_.data(),
+               sizeof(node_records[i].pose_));
+    }
+    std::vector<PoseGraphEdgeRecord> edge_records(pose_graph.edges_.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < (int)edge_records.size(); i++) {
+        const registration::PoseGraphEdge &edge = pose_graph.edges_[i];
+        PoseGraphEdgeRecord &record = edge_records[i];
+        record.source_node_id_ = edge.source_node_id_;
+        record.target_node_id_ = edge.target_node_id_;
+        record.uncertain_ = edge.uncertain_ ? 1 : 0;
+        record.reserved_ = 0;
+        record.confidence_ = edge.confidence_;
+        memcpy(record.transformation_, edge.transformation_.data(),
+               sizeof(record.transformation_));
+        memcpy(record.information_, edge.information_.data(),
+               sizeof(record.information_));
+    }
+
+    FILE *fid = OpenBINFileForWriting(filename, kPoseGraphBINMagic,
+                                      node_records.size(),
+                                      edge_records.size());
+    if (fid == NULL) {
+        return false;
+    }
+    bool success = WriteRecordsToBINFile(fid, node_records) &&
+                   WriteRecordsToBINFile(fid, edge_records);
+    fclose(fid);
+    return success;
+}
+
+bool ReadPinholeCameraTrajectoryFromBIN(
+        const std::string &filename,
+        camera::PinholeCameraTrajectory &trajectory) {
+    BINHeader header;
+    FILE *fid = OpenBINFileForReading(
+            filename, kTrajectoryBINMagic,
+            sizeof(PinholeCameraParametersRecord), 1, header);
+    if (fid == NULL) {
+        return false;
+    }
+    std::vector<PinholeCameraParametersRecord> records;
+    bool success = ReadRecordsFromBINFile(fid, header.num_records_[0], records);
+    fclose(fid);
+    if (!success) {
+        return false;
+    }
+
+    trajectory.parameters_.resize(records.size());
+    for (size_t i = 0; i < records.size(); i++) {
+        const PinholeCameraParametersRecord &record = records[i];
+        camera::PinholeCameraParameters &parameters =
+                trajectory.parameters_[i];
+        parameters.intrinsic_.width_ = record.width_;
+        parameters.intrinsic_.height_ = record.height_;
+        memcpy(parameters.intrinsic_.intrinsic_matrix_.data(),
+               record.intrinsic_matrix_, sizeof(record.intrinsic_matrix_));
+        memcpy(parameters.extrinsic_.data(), record.extrinsic_,
+               sizeof(record.extrinsic_));
+    }
+    return true;
+}
+
+bool WritePinholeCameraTrajectoryToBIN(
+        const std::string &filename,
+        const camera::PinholeCameraTrajectory &trajectory) {
+    std::vector<PinholeCameraParametersRecord> records(
+            trajectory.parameters_.size());
+    for (size_t i = 0; i < records.size(); i++) {
+        const camera::PinholeCameraParameters &parameters =
+                trajectory.parameters_[i];
+        PinholeCameraParametersRecord &record = records[i];
+        record.width_ = parameters.intrinsic_.width_;
+        record.height_ = parameters.intrinsic_.height_;
+        memcpy(record.intrinsic_matrix_,
+               parameters.intrinsic_.intrinsic_matrix_.data(),
+               sizeof(record.intrinsic_matrix_));
+        memcpy(record.extrinsic_, parameters.extrinsic_.data(),
+               sizeof(record.extrinsic_));
+    }
+
+    FILE *fid = OpenBINFileForWriting(filename, kTrajectoryBINMagic,
+                                      records.size(), 0);
+    if (fid == NULL) {
+        return false;
+    }
+    bool success = WriteRecordsToBINFile(fid, records);
+    fclose(fid);
+    return success;
+}
+
 }  // namespace io
 }  // namespace open3d
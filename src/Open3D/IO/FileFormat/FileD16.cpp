@@ -0,0 +1,506 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Lossless codec for 16 bit depth images, several times faster than PNG.
+//
+// Depth sensors produce few distinct values, as they measure disparities or
+// phases quantized to some levels, so the pixels are first replaced by their
+// rank among the distinct values of the image. Neighbouring ranks differ by
+// a level or two where depths differ by many units, and are mostly equal.
+// Each row predicts its valid pixels from their left or from their upper
+// neighbours, whichever codes shorter, and codes the prediction residuals as
+// runs of zeros, each followed by the non-zero residual that ends it. A run
+// and its residual share a byte, so that decoding needs no bit operations
+// and fills the runs of correctly predicted pixels at once. Invalid (zero)
+// pixels are coded as runs as well.
+//
+// File layout, little endian:
+//     char magic[4] = "OD16"; uint32 width; uint32 height;
+//     uint32 number of distinct values; byte stream.
+// The byte stream codes the distinct values in increasing order as varints
+// of their differences minus one, then each row: the lengths of its runs of
+// invalid and valid pixels alternately, starting with invalid ones, as
+// varints, and if the row has valid pixels, its prediction mode byte and the
+// pairs of a run of zero residuals and the zigzag code of the residual that
+// ends it, 0 if none. A pair is one byte holding the run in its high and the
+// code in its low nibble, saturated to 15, followed by the varints of the
+// remainders of the saturated ones.
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+
+namespace {
+
+const char kMagic[4] = {'O', 'D', '1', '6'};
+const size_t kHeaderSize = 16;
+const uint32_t kMaxNibble = 15;
+
+/// Number of ranks that fills write at once, rounding the fills up. Fills may
+/// overwrite ranks beyond their end, which are decoded or zeroed later, so
+/// rank rows are allocated with that much slack.
+const int kFillChunk = 8;
+
+enum class RowPrediction { Left = 0, Up = 1 };
+
+class ByteWriter {
+public:
+    explicit ByteWriter(std::vector<uint8_t> &buffer) : buffer_(buffer) {}
+
+    void Write(uint8_t byte) { buffer_.push_back(byte); }
+
+    /// Writes \param value by groups of 7 bits, low bits first.
+    void WriteVarint(uint32_t value) {
+        while (value >= 0x80) {
+            buffer_.push_back(uint8_t(value | 0x80));
+            value >>= 7;
+        }
+        buffer_.push_back(uint8_t(value));
+    }
+
+    void WritePair(uint32_t num_zeros, uint32_t code) {
+        buffer_.push_back(uint8_t(std::min(num_zeros, kMaxNibble) << 4 |
+                                  std::min(code, kMaxNibble)));
+        if (num_zeros >= kMaxNibble) {
+            WriteVarint(num_zeros - kMaxNibble);
+        }
+        if (code >= kMaxNibble) {
+            WriteVarint(code - kMaxNibble);
+        }
+    }
+
+private:
+    std::vector<uint8_t> &buffer_;
+};
+
+/// Counts the bytes that ByteWriter would write, to compare codings.
+class ByteCounter {
+public:
+    void WritePair(uint32_t num_zeros, uint32_t code) {
+        size_++;
+        if (num_zeros >= kMaxNibble) {
+            size_ += VarintSize(num_zeros - kMaxNibble);
+        }
+        if (code >= kMaxNibble) {
+            size_ += VarintSize(code - kMaxNibble);
+        }
+    }
+
+    size_t size_ = 0;
+
+private:
+    static size_t VarintSize(uint32_t value) {
+        size_t size = 1;
+        for (; value >= 0x80; value >>= 7) {
+            size++;
+        }
+        return size;
+    }
+};
+
+class ByteReader {
+public:
+    ByteReader(const uint8_t *data, size_t size)
+        : position_(data), end_(data + size) {}
+
+    /// Reads past the end of the stream return zeros and set the overrun flag.
+    uint8_t Read() {
+        if (position_ == end_) {
+            overrun_ = true;
+            return 0;
+        }
+        return *position_++;
+    }
+
+    uint32_t ReadVarint() {
+        uint32_t value = 0;
+        for (int shift = 0; shift < 35; shift += 7) {
+            uint8_t byte = Read();
+            value |= uint32_t(byte & 0x7f) << shift;
+            if (byte < 0x80) {
+                return value;
+            }
+        }
+        overrun_ = true;
+        return 0;
+    }
+
+    void ReadPair(uint32_t &num_zeros, uint32_t &code) {
+        uint8_t byte = Read();
+        num_zeros = byte >> 4;
+        code = byte & kMaxNibble;
+        if (num_zeros == kMaxNibble) {
+            num_zeros += ReadVarint();
+        }
+        if (code == kMaxNibble) {
+            code += ReadVarint();
+        }
+    }
+
+    bool IsOverrun() const { return overrun_; }
+
+private:
+    const uint8_t *position_;
+    const uint8_t *end_;
+    bool overrun_ = false;
+};
+
+/// Prediction of the valid pixel \param u of the rank row \param rank, in the
+/// run of valid pixels starting at \param begin. \param up is the previous
+/// rank row and \param last the last valid rank in scan order.
+inline int PredictRank(RowPrediction prediction,
+                       const uint16_t *rank,
+                       const uint16_t *up,
+                       int u,
+                       int begin,
+                       int last) {
+    int left = u > begin ? rank[u - 1] : last;
+    if (prediction == RowPrediction::Left) {
+        return u > begin || up[u] == 0 ? left : up[u];
+    }
+    return up[u] != 0 ? up[u] : left;
+}
+
+/// Codes the valid pixels of the rank row \param rank, whose runs of valid
+/// pixels are [runs[2i], runs[2i + 1]).
+template <typename Writer>
+void EncodeRow(RowPrediction prediction,
+               const uint16_t *rank,
+               const uint16_t *up,
+               const std::vector<int> &runs,
+               int last,
+               Writer &writer) {
+    uint32_t num_zeros = 0;
+    for (size_t i = 0; i < runs.size(); i += 2) {
+        for (int u = runs[i]; u < runs[i + 1]; u++) {
+            int residual = int(rank[u]) - PredictRank(prediction, rank, up, u,
+                                                      runs[i], last);
+            if (residual == 0) {
+                num_zeros++;
+            } else {
+                writer.WritePair(num_zeros, (uint32_t(residual) << 1) ^
+                                                    uint32_t(residual >> 31));
+                num_zeros = 0;
+            }
+            last = rank[u];
+        }
+    }
+    if (num_zeros > 0) {
+        writer.WritePair(num_zeros, 0);
+    }
+}
+
+/// Decodes the ranks of the run of valid pixels [\param begin, \param end) of
+/// \param rank. \param num_zeros and \param code are what is left of the
+/// last pair read. Return false if the data is corrupted.
+template <RowPrediction prediction>
+bool DecodeValidRun(ByteReader &reader,
+                    uint16_t *rank,
+                    const uint16_t *up,
+                    int begin,
+                    int end,
+                    int last,
+                    int num_values,
+                    uint32_t &num_zeros,
+                    uint32_t &code) {
+    for (int u = begin; u < end;) {
+        if (num_zeros == 0 && code == 0) {
+            reader.ReadPair(num_zeros, code);
+            if (reader.IsOverrun()) {
+                return false;
+            }
+        }
+        int r = PredictRank(prediction, rank, up, u, begin, last);
+        if (num_zeros > 0) {
+            if (r == 0) {
+                return false;
+            }
+            int num_filled = int(std::min(num_zeros, uint32_t(end - u)));
+            if (prediction == RowPrediction::Left) {
+                for (int i = 0; i < num_filled; i += kFillChunk) {
+                    std::fill(rank + u + i, rank + u + i + kFillChunk,
+                              uint16_t(r));
+                }
+            } else {
+                int left = r;
+                for (int i = 0; i < num_filled; i++) {
+                    left = up[u + i] != 0 ? up[u + i] : left;
+                    rank[u + i] = uint16_t(left);
+                }
+            }
+            u += num_filled;
+            num_zeros -= uint32_t(num_filled);
+            if (u == end) {
+                break;
+            }
+            if (prediction == RowPrediction::Up) {
+                r = PredictRank(prediction, rank, up, u, begin, last);
+            }
+        }
+        if (code != 0) {
+            if (code > 2 * uint32_t(num_values)) {
+                return false;
+            }
+            r += int(code >> 1) ^ -int(code & 1);
+            if (r < 1 || r > num_values) {
+                return false;
+            }
+            rank[u++] = uint16_t(r);
+            code = 0;
+        }
+    }
+    return true;
+}
+
+}  // unnamed namespace
+
+namespace io {
+
+bool WriteImageToD16InMemory(const geometry::Image &image,
+                             std::vector<uint8_t> &buffer) {
+    if (image.num_of_channels_ != 1 || image.bytes_per_channel_ != 2) {
+        utility::LogWarning(
+                "Write D16 failed: only 16 bit single channel images are "
+                "supported.\n");
+        return false;
+    }
+    const int width = image.width_;
+    const int height = image.height_;
+    const uint16_t *depth = reinterpret_cast<const uint16_t *>(
+            image.data_.data());
+    const uint16_t *depth_end = depth + size_t(width) * size_t(height);
+
+    buffer.resize(kHeaderSize);
+    buffer.reserve(image.data_.size() / 2);
+    ByteWriter writer(buffer);
+
+    // ranks of the distinct values, starting at 1 for valid pixels
+    std::vector<uint16_t> ranks(65536, 0);
+    for (const uint16_t *p = depth; p != depth_end; ++p) {
+        ranks[*p] = 1;
+    }
+    ranks[0] = 0;
+    uint32_t num_values = 0;
+    int previous = 0;
+    for (int value = 1; value < 65536; value++) {
+        if (ranks[value] != 0) {
+            ranks[value] = uint16_t(++num_values);
+            writer.WriteVarint(uint32_t(value - previous - 1));
+            previous = value;
+        }
+    }
+
+    std::vector<uint16_t> rank(width), up(width, 0);
+    std::vector<int> runs;
+    int last = 0;
+    for (int v = 0; v < height; v++) {
+        const uint16_t *row = depth + size_t(v) * size_t(width);
+        runs.clear();
+        int begin = 0;
+        for (int u = 0; u < width; u++) {
+            rank[u] = ranks[row[u]];
+            if ((rank[u] != 0) != (runs.size() % 2 == 1)) {
+                writer.WriteVarint(uint32_t(u - begin));
+                runs.push_back(u);
+                begin = u;
+            }
+        }
+        writer.WriteVarint(uint32_t(width - begin));
+        if (runs.size() % 2 == 1) {
+            runs.push_back(width);
+        }
+        if (!runs.empty()) {
+            ByteCounter left_size, up_size;
+            EncodeRow(RowPrediction::Left, rank.data(), up.data(), runs, last,
+                      left_size);
+            EncodeRow(RowPrediction::Up, rank.data(), up.data(), runs, last,
+                      up_size);
+            auto prediction = left_size.size_ <= up_size.size_
+                                      ? RowPrediction::Left
+                                      : RowPrediction::Up;
+            writer.Write(uint8_t(prediction));
+            EncodeRow(prediction, rank.data(), up.data(), runs, last, writer);
+            last = rank[runs.back() - 1];
+        }
+        std::swap(rank, up);
+    }
+
+    uint32_t header[3] = {uint32_t(width), uint32_t(height), num_values};
+    memcpy(buffer.data(), kMagic, 4);
+    memcpy(buffer.data() + 4, header, sizeof(header));
+    return true;
+}
+
+bool ReadImageFromD16InMemory(const uint8_t *buffer,
+                              size_t length,
+                              geometry::Image &image) {
+    uint32_t header[3];
+    if (length < kHeaderSize || memcmp(buffer, kMagic, 4) != 0) {
+        utility::LogWarning("Read D16 failed: invalid header.\n");
+        return false;
+    }
+    memcpy(header, buffer + 4, sizeof(header));
+    const int width = int(header[0]);
+    const int height = int(header[1]);
+    const uint32_t num_values = header[2];
+    // every row codes at least one byte, and the image as well as the rows
+    // padded for the fills stay within the int range
+    if (width < 0 || height < 0 || size_t(height) > length ||
+        uint64_t(width) * uint64_t(height) * 2 > uint64_t(INT_MAX) ||
+        width > INT_MAX - kFillChunk || num_values > 65535) {
+        utility::LogWarning("Read D16 failed: invalid header.\n");
+        return false;
+    }
+    image.Prepare(width, height, 1, 2);
+    ByteReader reader(buffer + kHeaderSize, length - kHeaderSize);
+
+    std::vector<uint16_t> values(num_values + 1, 0);
+    uint32_t previous = 0;
+    for (uint32_t rank = 1; rank <= num_values; rank++) {
+        previous += reader.ReadVarint() + 1;
+        if (previous > 65535) {
+            utility::LogWarning("Read D16 failed: corrupted data.\n");
+            return false;
+        }
+        values[rank] = uint16_t(previous);
+    }
+
+    std::vector<uint16_t> rank(width + kFillChunk, 0);
+    std::vector<uint16_t> up(width + kFillChunk, 0);
+    std::vector<int> runs;
+    int last = 0;
+    bool corrupted = reader.IsOverrun();
+    for (int v = 0; v < height && !corrupted; v++) {
+        // ends of the runs of invalid and valid pixels
+        runs.clear();
+        int u = 0;
+        do {
+            uint32_t run = reader.ReadVarint();
+            if (run > uint32_t(width - u) ||
+                (run == 0 && (u > 0 || runs.size() % 2 == 1)) ||
+                reader.IsOverrun()) {
+                corrupted = true;
+                break;
+            }
+            u += int(run);
+            runs.push_back(u);
+        } while (u < width);
+        if (corrupted) {
+            break;
+        }
+
+        if (runs.size() > 1) {
+            uint8_t prediction = reader.Read();
+            uint32_t num_zeros = 0;
+            uint32_t code = 0;
+            for (size_t i = 1; i < runs.size() && !corrupted; i += 2) {
+                int begin = runs[i - 1];
+                int end = runs[i];
+                if (prediction == uint8_t(RowPrediction::Left)) {
+                    corrupted = !DecodeValidRun<RowPrediction::Left>(
+                            reader, rank.data(), up.data(), begin, end, last,
+                            int(num_values), num_zeros, code);
+                } else if (prediction == uint8_t(RowPrediction::Up)) {
+                    corrupted = !DecodeValidRun<RowPrediction::Up>(
+                            reader, rank.data(), up.data(), begin, end, last,
+                            int(num_values), num_zeros, code);
+                } else {
+                    corrupted = true;
+                }
+                last = rank[end - 1];
+            }
+            corrupted = corrupted || num_zeros != 0 || code != 0;
+        }
+        // zero the invalid runs after the fills that overwrite them
+        for (size_t i = 0; i < runs.size(); i += 2) {
+            std::fill(rank.begin() + (i > 0 ? runs[i - 1] : 0),
+                      rank.begin() + runs[i], 0);
+        }
+
+        uint16_t *row = reinterpret_cast<uint16_t *>(image.data_.data()) +
+                        size_t(v) * size_t(width);
+        for (u = 0; u < width; u++) {
+            row[u] = values[rank[u]];
+        }
+        std::swap(rank, up);
+    }
+    if (corrupted || reader.IsOverrun()) {
+        utility::LogWarning("Read D16 failed: corrupted data.\n");
+        return false;
+    }
+    return true;
+}
+
+bool ReadImageFromD16(const std::string &filename, geometry::Image &image) {
+    FILE *file = fopen(filename.c_str(), "rb");
+    if (file == NULL) {
+        utility::LogWarning("Read D16 failed: unable to open file: {}\n",
+                            filename);
+        return false;
+    }
+    std::vector<uint8_t> buffer;
+    uint8_t chunk[65536];
+    size_t num_read;
+    while ((num_read = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        buffer.insert(buffer.end(), chunk, chunk + num_read);
+    }
+    fclose(file);
+    return ReadImageFromD16InMemory(buffer.data(), buffer.size(), image);
+}
+
+bool WriteImageToD16(const std::string &filename,
+                     const geometry::Image &image,
+                     int quality) {
+    std::vector<uint8_t> buffer;
+    if (!WriteImageToD16InMemory(image, buffer)) {
+        return false;
+    }
+    FILE *file = fopen(filename.c_str(), "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write D16 failed: unable to open file: {}\n",
+                            filename);
+        return false;
+    }
+    bool success = fwrite(buffer.data(), 1, buffer.size(), file) ==
+                   buffer.size();
+    success = fclose(file) == 0 && success;
+    if (!success) {
+        utility::LogWarning("Write D16 failed: unable to write file: {}\n",
+                            filename);
+    }
+    return success;
+}
+
+}  // namespace io
+}  // namespace open3d
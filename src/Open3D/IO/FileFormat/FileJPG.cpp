@@ -26,6 +26,8 @@
 
 #include <cstddef>
 #include <cstdio>
+#include <csetjmp>
+#include <cstdlib>
 
 #include <jpeglib.h>  // Include after cstddef to define size_t
 
@@ -33,24 +35,51 @@
 #include "Open3D/Utility/Console.h"
 
 namespace open3d {
-namespace io {
 
-bool ReadImageFromJPG(const std::string &filename, geometry::Image &image) {
-    struct jpeg_decompress_struct cinfo;
+namespace {
+
+/// Error manager that jumps back to the reader on errors instead of exiting
+/// the process. The jerr member comes first so that the error manager of a
+/// cinfo points to the whole struct.
+struct JPGErrorManager {
     struct jpeg_error_mgr jerr;
-    FILE *file_in;
-    JSAMPARRAY buffer;
+    std::jmp_buf jump_buffer;
 
-    if ((file_in = fopen(filename.c_str(), "rb")) == NULL) {
-        utility::LogWarning("Read JPG failed: unable to open file: {}\n",
-                            filename);
-        return false;
+    /// Sets up the error manager of \param cinfo, before it is created.
+    void Install(jpeg_decompress_struct &cinfo) {
+        cinfo.err = jpeg_std_error(&jerr);
+        jerr.error_exit = ErrorExit;
+        jerr.output_message = OutputMessage;
     }
 
-    cinfo.err = jpeg_std_error(&jerr);
-    jpeg_create_decompress(&cinfo);
-    jpeg_stdio_src(&cinfo, file_in);
+    static void ErrorExit(j_common_ptr cinfo) {
+        char message[JMSG_LENGTH_MAX];
+        (*cinfo->err->format_message)(cinfo, message);
+        utility::LogWarning("Read JPG failed: {}\n", message);
+        std::longjmp(
+                reinterpret_cast<JPGErrorManager *>(cinfo->err)->jump_buffer,
+                1);
+    }
+
+    static void OutputMessage(j_common_ptr cinfo) {
+        char message[JMSG_LENGTH_MAX];
+        (*cinfo->err->format_message)(cinfo, message);
+        utility::LogDebug("Read JPG: {}\n", message);
+    }
+};
+
+/// Decodes the image of \param cinfo once its source is set, downscaled by
+/// \param scale_denominator. On failure \param cinfo is reset for reuse.
+bool DecompressJPG(jpeg_decompress_struct &cinfo,
+                   geometry::Image &image,
+                   int scale_denominator = 1,
+                   bool fast = false) {
+    JSAMPARRAY buffer;
     jpeg_read_header(&cinfo, TRUE);
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = scale_denominator;
+    cinfo.dct_method = fast ? JDCT_IFAST : JDCT_ISLOW;
+    cinfo.do_fancy_upsampling = fast ? FALSE : TRUE;
 
     // We only support two channel types: gray, and RGB.
     int num_of_channels = 3;
@@ -72,8 +101,7 @@ bool ReadImageFromJPG(const std::string &filename, geometry::Image &image) {
         default:
             utility::LogWarning(
                     "Read JPG failed: color space not supported.\n");
-            jpeg_destroy_decompress(&cinfo);
-            fclose(file_in);
+            jpeg_abort_decompress(&cinfo);
             return false;
     }
     jpeg_start_decompress(&cinfo);
@@ -89,14 +117,10 @@ bool ReadImageFromJPG(const std::string &filename, geometry::Image &image) {
         pdata += row_stride;
     }
     jpeg_finish_decompress(&cinfo);
-    jpeg_destroy_decompress(&cinfo);
-    fclose(file_in);
     return true;
 }
 
-bool WriteImageToJPG(const std::string &filename,
-                     const geometry::Image &image,
-                     int quality /* = 90*/) {
+bool IsJPGWritable(const geometry::Image &image) {
     if (image.HasData() == false) {
         utility::LogWarning("Write JPG failed: image has no data.\n");
         return false;
@@ -106,20 +130,14 @@ bool WriteImageToJPG(const std::string &filename,
         utility::LogWarning("Write JPG failed: unsupported image data.\n");
         return false;
     }
-    struct jpeg_compress_struct cinfo;
-    struct jpeg_error_mgr jerr;
-    FILE *file_out;
-    JSAMPROW row_pointer[1];
-
-    if ((file_out = fopen(filename.c_str(), "wb")) == NULL) {
-        utility::LogWarning("Write JPG failed: unable to open file: {}\n",
-                            filename);
-        return false;
-    }
+    return true;
+}
 
-    cinfo.err = jpeg_std_error(&jerr);
-    jpeg_create_compress(&cinfo);
-    jpeg_stdio_dest(&cinfo, file_out);
+/// Encodes \param image once the destination of \param cinfo is set.
+void CompressJPG(jpeg_compress_struct &cinfo,
+                 const geometry::Image &image,
+                 int quality) {
+    JSAMPROW row_pointer[1];
     cinfo.image_width = image.width_;
     cinfo.image_height = image.height_;
     cinfo.input_components = image.num_of_channels_;
@@ -138,10 +156,144 @@ bool WriteImageToJPG(const std::string &filename,
         pdata += row_stride;
     }
     jpeg_finish_compress(&cinfo);
+}
+
+}  // unnamed namespace
+
+namespace io {
+
+/// The decoder jumps back to Read on errors instead of exiting, so that a
+/// corrupt file in a batch is skipped.
+struct JPGDecoder::DecoderState {
+    JPGErrorManager error;
+    struct jpeg_decompress_struct cinfo;
+};
+
+JPGDecoder::JPGDecoder() : state_(new DecoderState) {
+    state_->error.Install(state_->cinfo);
+    jpeg_create_decompress(&state_->cinfo);
+}
+
+JPGDecoder::~JPGDecoder() { jpeg_destroy_decompress(&state_->cinfo); }
+
+bool JPGDecoder::Read(const std::string &filename,
+                      geometry::Image &image,
+                      int scale_denominator /* = 1*/,
+                      bool fast /* = false*/) {
+    if (scale_denominator != 1 && scale_denominator != 2 &&
+        scale_denominator != 4 && scale_denominator != 8) {
+        utility::LogWarning(
+                "Read JPG failed: unsupported scale denominator {:d}.\n",
+                scale_denominator);
+        return false;
+    }
+    FILE *file_in;
+    if ((file_in = fopen(filename.c_str(), "rb")) == NULL) {
+        utility::LogWarning("Read JPG failed: unable to open file: {}\n",
+                            filename);
+        return false;
+    }
+    if (setjmp(state_->error.jump_buffer)) {
+        jpeg_abort_decompress(&state_->cinfo);
+        fclose(file_in);
+        return false;
+    }
+    // the source manager is allocated once and rebound to every file
+    jpeg_stdio_src(&state_->cinfo, file_in);
+    bool success =
+            DecompressJPG(state_->cinfo, image, scale_denominator, fast);
+    fclose(file_in);
+    return success;
+}
+
+bool ReadImageFromJPG(const std::string &filename, geometry::Image &image) {
+    struct jpeg_decompress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    FILE *file_in;
+
+    if ((file_in = fopen(filename.c_str(), "rb")) == NULL) {
+        utility::LogWarning("Read JPG failed: unable to open file: {}\n",
+                            filename);
+        return false;
+    }
+
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_decompress(&cinfo);
+    jpeg_stdio_src(&cinfo, file_in);
+    bool success = DecompressJPG(cinfo, image);
+    jpeg_destroy_decompress(&cinfo);
+    fclose(file_in);
+    return success;
+}
+
+bool WriteImageToJPG(const std::string &filename,
+                     const geometry::Image &image,
+                     int quality /* = 90*/) {
+    if (!IsJPGWritable(image)) {
+        return false;
+    }
+    struct jpeg_compress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    FILE *file_out;
+
+    if ((file_out = fopen(filename.c_str(), "wb")) == NULL) {
+        utility::LogWarning("Write JPG failed: unable to open file: {}\n",
+                            filename);
+        return false;
+    }
+
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_compress(&cinfo);
+    jpeg_stdio_dest(&cinfo, file_out);
+    CompressJPG(cinfo, image, quality);
     fclose(file_out);
     jpeg_destroy_compress(&cinfo);
     return true;
 }
 
+bool ReadImageFromJPGInMemory(const uint8_t *buffer,
+                              size_t length,
+                              geometry::Image &image) {
+    struct jpeg_decompress_struct cinfo;
+    JPGErrorManager error;
+    error.Install(cinfo);
+    jpeg_create_decompress(&cinfo);
+    if (setjmp(error.jump_buffer)) {
+        jpeg_destroy_decompress(&cinfo);
+        return false;
+    }
+    // older libjpeg versions take a non-const buffer
+    jpeg_mem_src(&cinfo, const_cast<unsigned char *>(buffer),
+                 (unsigned long)length);
+    bool success = DecompressJPG(cinfo, image);
+    // libjpeg fills in truncated or damaged data with a warning
+    if (success && error.jerr.num_warnings > 0) {
+        utility::LogWarning("Read JPG failed: corrupt data.\n");
+        success = false;
+    }
+    jpeg_destroy_decompress(&cinfo);
+    return success;
+}
+
+bool WriteImageToJPGInMemory(const geometry::Image &image,
+                             std::vector<uint8_t> &buffer,
+                             int quality /* = 90*/) {
+    if (!IsJPGWritable(image)) {
+        return false;
+    }
+    struct jpeg_compress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    unsigned char *out_buffer = NULL;
+    unsigned long out_length = 0;
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_compress(&cinfo);
+    jpeg_mem_dest(&cinfo, &out_buffer, &out_length);
+    CompressJPG(cinfo, image, quality);
+    jpeg_destroy_compress(&cinfo);
+    buffer.assign(out_buffer, out_buffer + out_length);
+    free(out_buffer);
+    return true;
+}
+
 }  // namespace io
 }  // namespace open3d
@@ -206,6 +206,85 @@ int ReadFaceCallBack(p_ply_argument argument) {
 
 }  // namespace ply_trianglemesh_reader
 
+namespace ply_trianglemesh_chunk_reader {
+
+struct PLYReaderState {
+    utility::ConsoleProgressBar *progress_bar;
+    const TriangleChunkCallback *callback;
+    size_t chunk_size;
+    std::vector<Eigen::Vector3f> vertices;
+    std::vector<Eigen::Vector3d> corners;
+    long vertex_index;
+    long vertex_num;
+    std::vector<unsigned int> face;
+    long face_index;
+    long face_num;
+};
+
+int ReadVertexCallback(p_ply_argument argument) {
+    PLYReaderState *state_ptr;
+    long index;
+    ply_get_argument_user_data(argument, reinterpret_cast<void **>(&state_ptr),
+                               &index);
+    if (state_ptr->vertex_index >= state_ptr->vertex_num) {
+        return 0;
+    }
+
+    double value = ply_get_argument_value(argument);
+    state_ptr->vertices[state_ptr->vertex_index](index) = float(value);
+    if (index == 2) {  // reading 'z'
+        state_ptr->vertex_index++;
+        ++(*state_ptr->progress_bar);
+    }
+    return 1;
+}
+
+int ReadFaceCallBack(p_ply_argument argument) {
+    PLYReaderState *state_ptr;
+    long dummy, length, index;
+    ply_get_argument_user_data(argument, reinterpret_cast<void **>(&state_ptr),
+                               &dummy);
+    double value = ply_get_argument_value(argument);
+    if (state_ptr->face_index >= state_ptr->face_num) {
+        return 0;
+    }
+
+    ply_get_argument_property(argument, NULL, &length, &index);
+    if (index == -1) {
+        state_ptr->face.clear();
+    } else {
+        unsigned int vidx = (unsigned int)(value);
+        if (vidx >= (unsigned int)(state_ptr->vertex_index)) {
+            utility::LogWarning(
+                    "Read PLY failed: face references a vertex that has not "
+                    "been read.\n");
+            return 0;
+        }
+        state_ptr->face.push_back(vidx);
+    }
+    if (long(state_ptr->face.size()) == length) {
+        // polygons are split into a triangle fan
+        const auto &face = state_ptr->face;
+        for (size_t i = 2; i < face.size(); ++i) {
+            state_ptr->corners.push_back(
+                    state_ptr->vertices[face[0]].cast<double>());
+            state_ptr->corners.push_back(
+                    state_ptr->vertices[face[i - 1]].cast<double>());
+            state_ptr->corners.push_back(
+                    state_ptr->vertices[face[i]].cast<double>());
+            if (state_ptr->corners.size() >= state_ptr->chunk_size * 3) {
+                (*state_ptr->callback)(state_ptr->corners);
+                state_ptr->corners.clear();
+            }
+        }
+        state_ptr->face_index++;
+        ++(*state_ptr->progress_bar);
+    }
+    return 1;
+}
+
+}  // namespace ply_trianglemesh_chunk_reader
+
 namespace ply_lineset_reader {
 
 struct PLYReaderState {
@@ -561,6 +640,68 @@ bool ReadTriangleMeshFromPLY(const std::string &filename,
     return true;
 }
 
+bool ReadTriangleMeshInChunksFromPLY(const std::string &filename,
+                                     const TriangleChunkCallback &callback,
+                                     size_t chunk_size,
+                                     bool print_progress) {
+    using namespace ply_trianglemesh_chunk_reader;
+
+    p_ply ply_file = ply_open(filename.c_str(), NULL, 0, NULL);
+    if (!ply_file) {
+        utility::LogWarning("Read PLY failed: unable to open file: {}\n",
+                            filename);
+        return false;
+    }
+    if (!ply_read_header(ply_file)) {
+        utility::LogWarning("Read PLY failed: unable to parse header.\n");
+        ply_close(ply_file);
+        return false;
+    }
+
+    PLYReaderState state;
+    state.callback = &callback;
+    state.chunk_size = chunk_size;
+    state.vertex_num = ply_set_read_cb(ply_file, "vertex", "x",
+                                       ReadVertexCallback, &state, 0);
+    ply_set_read_cb(ply_file, "vertex", "y", ReadVertexCallback, &state, 1);
+    ply_set_read_cb(ply_file, "vertex", "z", ReadVertexCallback, &state, 2);
+
+    if (state.vertex_num <= 0) {
+        utility::LogWarning("Read PLY failed: number of vertex <= 0.\n");
+        ply_close(ply_file);
+        return false;
+    }
+
+    state.face_num = ply_set_read_cb(ply_file, "face", "vertex_indices",
+                                     ReadFaceCallBack, &state, 0);
+    if (state.face_num == 0) {
+        state.face_num = ply_set_read_cb(ply_file, "face", "vertex_index",
+                                         ReadFaceCallBack, &state, 0);
+    }
+
+    state.vertex_index = 0;
+    state.face_index = 0;
+    state.vertices.resize(state.vertex_num);
+    state.corners.reserve(chunk_size * 3);
+
+    utility::ConsoleProgressBar progress_bar(state.vertex_num + state.face_num,
+                                             "Reading PLY: ", print_progress);
+    state.progress_bar = &progress_bar;
+
+    if (!ply_read(ply_file)) {
+        utility::LogWarning("Read PLY failed: unable to read file: {}\n",
+                            filename);
+        ply_close(ply_file);
+        return false;
+    }
+    if (!state.corners.empty()) {
+        callback(state.corners);
+    }
+
+    ply_close(ply_file);
+    return true;
+}
+
 bool WriteTriangleMeshToPLY(const std::string &filename,
                             const geometry::TriangleMesh &mesh,
                             bool write_ascii /* = false*/,
@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <vector>
 
@@ -100,6 +102,63 @@ bool ReadTriangleMeshFromSTL(const std::string &filename,
     return true;
 }
 
+bool ReadTriangleMeshInChunksFromSTL(const std::string &filename,
+                                     const TriangleChunkCallback &callback,
+                                     size_t chunk_size,
+                                     bool print_progress) {
+    FILE *myFile = fopen(filename.c_str(), "rb");
+    if (!myFile) {
+        utility::LogWarning("Read STL failed: unable to open file.\n");
+        return false;
+    }
+
+    char header[80] = "";
+    unsigned int num_of_triangles = 0;
+    if (fread(header, sizeof(char), 80, myFile) != 80 ||
+        fread(&num_of_triangles, sizeof(unsigned int), 1, myFile) != 1) {
+        utility::LogWarning("Read STL failed: unable to read header.\n");
+        fclose(myFile);
+        return false;
+    }
+    if (num_of_triangles == 0) {
+        utility::LogWarning("Read STL failed: empty file.\n");
+        fclose(myFile);
+        return false;
+    }
+
+    utility::ConsoleProgressBar progress_bar(num_of_triangles,
+                                             "Reading STL: ", print_progress);
+    std::vector<char> buffer(chunk_size * 50);
+    std::vector<Eigen::Vector3d> corners;
+    corners.reserve(chunk_size * 3);
+    size_t num_read = 0;
+    while (num_read < num_of_triangles) {
+        size_t num_chunk = std::min(chunk_size, num_of_triangles - num_read);
+        if (fread(buffer.data(), 50, num_chunk, myFile) != num_chunk) {
+            utility::LogWarning("Read STL failed: not enough triangles.\n");
+            fclose(myFile);
+            return false;
+        }
+        corners.clear();
+        for (size_t i = 0; i < num_chunk; i++) {
+            // skip the normal and ignore the two attribute bytes
+            for (int j = 0; j < 3; j++) {
+                float float_buffer[3];
+                memcpy(float_buffer, buffer.data() + i * 50 + 12 * (j + 1),
+                       sizeof(float_buffer));
+                corners.push_back(Eigen::Map<Eigen::Vector3f>(float_buffer)
+                                          .cast<double>());
+            }
+            ++progress_bar;
+        }
+        callback(corners);
+        num_read += num_chunk;
+    }
+
+    fclose(myFile);
+    return true;
+}
+
 bool WriteTriangleMeshToSTL(const std::string &filename,
                             const geometry::TriangleMesh &mesh,
                             bool write_ascii /* = false*/,
@@ -0,0 +1,122 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace open3d {
+namespace io {
+
+/// Magic bytes at the start of an RGB-D sequence file.
+constexpr char kRGBDSequenceFileMagic[8] = {'O', '3', 'D', 'R',
+                                            'G', 'B', 'D', 'S'};
+
+/// Version written into and expected from RGBDSequenceFileHeader::version_.
+constexpr uint32_t kRGBDSequenceFileVersion = 1;
+
+/// Codecs of the color frames of an RGB-D sequence file.
+enum class RGBDSequenceColorCodec : uint32_t {
+    /// Pixels as stored in geometry::Image.
+    Raw = 0,
+    /// Lossy JPEG, for 8 bit gray or RGB images.
+    JPEG = 1,
+};
+
+/// Codecs of the depth frames of an RGB-D sequence file, all lossless.
+enum class RGBDSequenceDepthCodec : uint32_t {
+    /// Pixels as stored in geometry::Image.
+    Raw = 0,
+    /// Differences between horizontally adjacent pixels, compressed with
+    /// LZF. Frames that do not compress are stored raw.
+    DeltaLZF = 1,
+    /// The D16 image format (see ReadImageFromD16InMemory), several times
+    /// smaller than DeltaLZF and faster than PNG. Frames that do not compress
+    /// are stored raw.
+    D16 = 2,
+};
+
+/// An RGB-D sequence file stores a stream of RGB-D frames in a single file:
+///
+///     header | frame payloads | frame index
+///
+/// The header is at offset 0. Each frame stores its color payload followed by
+/// its depth payload, every payload starts at an offset aligned to 8 bytes.
+/// The index lists one RGBDSequenceFrameEntry per frame and is written when
+/// the file is closed. All values are little endian and all structures are
+/// naturally aligned, so a mapped file can be read in place. Reader and
+/// writer refuse to run on big endian hosts, see
+/// IsRGBDSequenceFileByteOrderNative().
+struct RGBDSequenceFileHeader {
+    /// "O3DRGBDS"
+    char magic_[8];
+    uint32_t version_;
+    uint32_t color_codec_;
+    uint32_t depth_codec_;
+    int32_t color_width_;
+    int32_t color_height_;
+    int32_t color_channels_;
+    /// Depth images are single channel 16 bit images.
+    int32_t depth_width_;
+    int32_t depth_height_;
+    /// Pinhole camera intrinsic of the frames.
+    int32_t intrinsic_width_;
+    int32_t intrinsic_height_;
+    double focal_length_[2];
+    double principal_point_[2];
+    /// Depth values are in units of 1 / depth_scale_ meters.
+    double depth_scale_;
+    uint64_t num_frames_;
+    uint64_t index_offset_;
+};
+
+/// Index entry of a frame of an RGB-D sequence file.
+struct RGBDSequenceFrameEntry {
+    /// Capture time in microseconds, non-decreasing along the sequence.
+    uint64_t timestamp_;
+    uint64_t color_offset_;
+    uint64_t color_size_;
+    uint64_t depth_offset_;
+    uint64_t depth_size_;
+};
+
+/// Returns true if the host is little endian, i.e. the structures above can
+/// be read and written in place.
+inline bool IsRGBDSequenceFileByteOrderNative() {
+    const uint32_t one = 1;
+    uint8_t first_byte;
+    std::memcpy(&first_byte, &one, 1);
+    return first_byte == 1;
+}
+
+static_assert(sizeof(RGBDSequenceFileHeader) == 104,
+              "RGBDSequenceFileHeader must not be padded");
+static_assert(sizeof(RGBDSequenceFrameEntry) == 40,
+              "RGBDSequenceFrameEntry must not be padded");
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,313 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/Sensor/RGBDSequenceFileReader.h"
+
+#include <liblzf/lzf.h>
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace io {
+
+namespace {
+
+bool IsPayloadInFile(uint64_t offset, uint64_t size, size_t file_size) {
+    return offset <= file_size && size <= file_size - offset;
+}
+
+/// LZF encodes at most 264 bytes with a 3 byte back reference.
+constexpr uint64_t kMaxLZFCompressionRatio = 88;
+
+/// Returns the size in bytes of an image, or 0 if the size is not positive
+/// or does not fit into the int arithmetic of geometry::Image.
+uint64_t ImageSize(int32_t width,
+                   int32_t height,
+                   int32_t channels,
+                   int32_t bytes_per_channel) {
+    if (width <= 0 || height <= 0) {
+        return 0;
+    }
+    uint64_t size = uint64_t(width) * uint64_t(height) * uint64_t(channels) *
+                    uint64_t(bytes_per_channel);
+    return size <= uint64_t(INT_MAX) ? size : 0;
+}
+
+/// Checks the image sizes of \param header. A raw image must fit into the
+/// frame payloads of the file, which lie between the header and the index.
+bool IsImageFormatValid(const RGBDSequenceFileHeader &header) {
+    if (header.num_frames_ == 0) {
+        // the sizes are taken from the first frame
+        return true;
+    }
+    if (header.color_channels_ != 1 && header.color_channels_ != 3) {
+        return false;
+    }
+    uint64_t color_size = ImageSize(header.color_width_, header.color_height_,
+                                    header.color_channels_, 1);
+    uint64_t depth_size =
+            ImageSize(header.depth_width_, header.depth_height_, 1, 2);
+    if (color_size == 0 || depth_size == 0) {
+        return false;
+    }
+    uint64_t raw_frame_size = 0;
+    if (header.color_codec_ == uint32_t(RGBDSequenceColorCodec::Raw)) {
+        raw_frame_size += color_size;
+    }
+    if (header.depth_codec_ == uint32_t(RGBDSequenceDepthCodec::Raw)) {
+        raw_frame_size += depth_size;
+    }
+    uint64_t payload_size =
+            header.index_offset_ - sizeof(RGBDSequenceFileHeader);
+    return raw_frame_size <= payload_size / header.num_frames_;
+}
+
+}  // unnamed namespace
+
+bool RGBDSequenceFileReader::Open(const std::string &filename) {
+    Close();
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    LARGE_INTEGER file_size;
+    HANDLE mapping = NULL;
+    if (file != INVALID_HANDLE_VALUE && GetFileSizeEx(file, &file_size) &&
+        file_size.QuadPart > 0) {
+        mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    }
+    void *data = NULL;
+    if (mapping != NULL) {
+        data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    }
+    if (data != NULL) {
+        data_ = static_cast<const uint8_t *>(data);
+        size_ = size_t(file_size.QuadPart);
+        file_handle_ = file;
+        mapping_handle_ = mapping;
+    } else {
+        if (mapping != NULL) {
+            CloseHandle(mapping);
+        }
+        if (file != INVALID_HANDLE_VALUE) {
+            CloseHandle(file);
+        }
+    }
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    struct stat file_stat;
+    void *data = MAP_FAILED;
+    if (fd >= 0 && fstat(fd, &file_stat) == 0 && file_stat.st_size > 0) {
+        data = mmap(NULL, size_t(file_stat.st_size), PROT_READ, MAP_SHARED,
+                    fd, 0);
+    }
+    // the mapping stays valid after the descriptor is closed
+    if (fd >= 0) {
+        close(fd);
+    }
+    if (data != MAP_FAILED) {
+        data_ = static_cast<const uint8_t *>(data);
+        size_ = size_t(file_stat.st_size);
+    }
+#endif
+    if (data_ == nullptr) {
+        utility::LogWarning("[RGBDSequenceFileReader] Unable to open {}.\n",
+                            filename);
+        return false;
+    }
+    if (!IsRGBDSequenceFileByteOrderNative()) {
+        utility::LogWarning(
+                "[RGBDSequenceFileReader] Big endian hosts are not "
+                "supported.\n");
+        Close();
+        return false;
+    }
+
+    header_ = reinterpret_cast<const RGBDSequenceFileHeader *>(data_);
+    // the index offset is 0 in files that were not closed
+    if (size_ < sizeof(RGBDSequenceFileHeader) ||
+        memcmp(header_->magic_, kRGBDSequenceFileMagic,
+               sizeof(header_->magic_)) != 0 ||
+        header_->version_ != kRGBDSequenceFileVersion ||
+        header_->color_codec_ > uint32_t(RGBDSequenceColorCodec::JPEG) ||
+        header_->depth_codec_ > uint32_t(RGBDSequenceDepthCodec::D16) ||
+        header_->index_offset_ < sizeof(RGBDSequenceFileHeader) ||
+        header_->index_offset_ % 8 != 0 ||
+        header_->num_frames_ > size_ / sizeof(RGBDSequenceFrameEntry) ||
+        !IsPayloadInFile(header_->index_offset_,
+                         header_->num_frames_ * sizeof(RGBDSequenceFrameEntry),
+                         size_) ||
+        !IsImageFormatValid(*header_)) {
+        utility::LogWarning(
+                "[RGBDSequenceFileReader] {} is not a complete RGB-D sequence "
+                "file.\n",
+                filename);
+        Close();
+        return false;
+    }
+    index_ = reinterpret_cast<const RGBDSequenceFrameEntry *>(
+            data_ + header_->index_offset_);
+    intrinsic_.SetIntrinsics(
+            header_->intrinsic_width_, header_->intrinsic_height_,
+            header_->focal_length_[0], header_->focal_length_[1],
+            header_->principal_point_[0], header_->principal_point_[1]);
+    return true;
+}
+
+void RGBDSequenceFileReader::Close() {
+    if (data_ == nullptr) {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(data_);
+    CloseHandle(mapping_handle_);
+    CloseHandle(file_handle_);
+#else
+    munmap(const_cast<uint8_t *>(data_), size_);
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    header_ = nullptr;
+    index_ = nullptr;
+}
+
+size_t RGBDSequenceFileReader::FindFrame(uint64_t timestamp) const {
+    return std::lower_bound(index_, index_ + NumFrames(), timestamp,
+                            [](const RGBDSequenceFrameEntry &entry,
+                               uint64_t t) { return entry.timestamp_ < t; }) -
+           index_;
+}
+
+bool RGBDSequenceFileReader::ReadFrame(size_t index,
+                                       geometry::RGBDImage &frame) const {
+    if (index >= NumFrames()) {
+        utility::LogWarning(
+                "[RGBDSequenceFileReader] Frame {:d} out of range.\n", index);
+        return false;
+    }
+    const RGBDSequenceFrameEntry &entry = index_[index];
+    if (!IsPayloadInFile(entry.color_offset_, entry.color_size_, size_) ||
+        !IsPayloadInFile(entry.depth_offset_, entry.depth_size_, size_)) {
+        utility::LogWarning(
+                "[RGBDSequenceFileReader] Frame {:d} is corrupted.\n", index);
+        return false;
+    }
+
+    // Open() checked the image sizes, the payload sizes are checked before
+    // the images are allocated
+    const uint8_t *color_data = data_ + entry.color_offset_;
+    if (header_->color_codec_ == uint32_t(RGBDSequenceColorCodec::JPEG)) {
+        if (!ReadImageFromJPGInMemory(color_data, entry.color_size_,
+                                      frame.color_)) {
+            return false;
+        }
+        if (frame.color_.width_ != header_->color_width_ ||
+            frame.color_.height_ != header_->color_height_ ||
+            frame.color_.num_of_channels_ != header_->color_channels_) {
+            utility::LogWarning(
+                    "[RGBDSequenceFileReader] Frame {:d} is corrupted.\n",
+                    index);
+            return false;
+        }
+    } else {
+        if (entry.color_size_ != ImageSize(header_->color_width_,
+                                           header_->color_height_,
+                                           header_->color_channels_, 1)) {
+            utility::LogWarning(
+                    "[RGBDSequenceFileReader] Frame {:d} is corrupted.\n",
+                    index);
+            return false;
+        }
+        frame.color_.Prepare(header_->color_width_, header_->color_height_,
+                             header_->color_channels_, 1);
+        memcpy(frame.color_.data_.data(), color_data, entry.color_size_);
+    }
+
+    const uint8_t *depth_data = data_ + entry.depth_offset_;
+    const uint64_t depth_size =
+            ImageSize(header_->depth_width_, header_->depth_height_, 1, 2);
+    if (entry.depth_size_ > depth_size ||
+        (entry.depth_size_ < depth_size &&
+         header_->depth_codec_ ==
+                 uint32_t(RGBDSequenceDepthCodec::DeltaLZF) &&
+         entry.depth_size_ * kMaxLZFCompressionRatio < depth_size)) {
+        utility::LogWarning(
+                "[RGBDSequenceFileReader] Frame {:d} is corrupted.\n", index);
+        return false;
+    }
+    geometry::Image &depth = frame.depth_;
+    if (entry.depth_size_ == depth_size) {
+        depth.Prepare(header_->depth_width_, header_->depth_height_, 1, 2);
+        memcpy(depth.data_.data(), depth_data, depth_size);
+        return true;
+    }
+    if (header_->depth_codec_ == uint32_t(RGBDSequenceDepthCodec::D16)) {
+        if (!ReadImageFromD16InMemory(depth_data, entry.depth_size_, depth) ||
+            depth.width_ != header_->depth_width_ ||
+            depth.height_ != header_->depth_height_) {
+            utility::LogWarning(
+                    "[RGBDSequenceFileReader] Frame {:d} is corrupted.\n",
+                    index);
+            return false;
+        }
+        return true;
+    }
+    if (header_->depth_codec_ != uint32_t(RGBDSequenceDepthCodec::DeltaLZF)) {
+        utility::LogWarning(
+                "[RGBDSequenceFileReader] Frame {:d} is corrupted.\n", index);
+        return false;
+    }
+    depth.Prepare(header_->depth_width_, header_->depth_height_, 1, 2);
+    if (lzf_decompress(depth_data, (unsigned int)entry.depth_size_,
+                       depth.data_.data(),
+                       (unsigned int)depth_size) != depth_size) {
+        utility::LogWarning(
+                "[RGBDSequenceFileReader] Frame {:d} is corrupted.\n", index);
+        return false;
+    }
+    for (int v = 0; v < depth.height_; v++) {
+        uint16_t *row = depth.PointerAt<uint16_t>(0, v);
+        for (int u = 1; u < depth.width_; u++) {
+            row[u] = uint16_t(row[u] + row[u - 1]);
+        }
+    }
+    return true;
+}
+
+}  // namespace io
+}  // namespace open3d
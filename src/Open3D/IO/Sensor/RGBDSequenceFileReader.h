@@ -0,0 +1,86 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/IO/Sensor/RGBDSequenceFileFormat.h"
+
+namespace open3d {
+namespace io {
+
+/// Reader of RGB-D sequence files written by RGBDSequenceFileWriter. The file
+/// is memory mapped, so frames are read in any order without seeking, and
+/// ReadFrame can be called from several threads at once.
+class RGBDSequenceFileReader {
+public:
+    RGBDSequenceFileReader() {}
+    ~RGBDSequenceFileReader() { Close(); }
+    RGBDSequenceFileReader(const RGBDSequenceFileReader &) = delete;
+    RGBDSequenceFileReader &operator=(const RGBDSequenceFileReader &) = delete;
+
+public:
+    bool Open(const std::string &filename);
+    void Close();
+    bool IsOpened() const { return data_ != nullptr; }
+
+    size_t NumFrames() const { return IsOpened() ? header_->num_frames_ : 0; }
+    const camera::PinholeCameraIntrinsic &GetIntrinsic() const {
+        return intrinsic_;
+    }
+    /// Depth values are in units of 1 / depth scale meters.
+    double GetDepthScale() const { return header_->depth_scale_; }
+
+    /// Capture time of frame \param index in microseconds.
+    uint64_t GetTimestamp(size_t index) const {
+        return index_[index].timestamp_;
+    }
+
+    /// \return the index of the first frame captured at or after
+    /// \param timestamp (usec), NumFrames() if there is none.
+    size_t FindFrame(uint64_t timestamp) const;
+
+    /// Decodes frame \param index into \param frame. The color image has 8
+    /// bit channels and the depth image is a 16 bit image, as written.
+    bool ReadFrame(size_t index, geometry::RGBDImage &frame) const;
+
+private:
+    const uint8_t *data_ = nullptr;
+    size_t size_ = 0;
+    const RGBDSequenceFileHeader *header_ = nullptr;
+    const RGBDSequenceFrameEntry *index_ = nullptr;
+    camera::PinholeCameraIntrinsic intrinsic_;
+#ifdef _WIN32
+    void *file_handle_ = nullptr;
+    void *mapping_handle_ = nullptr;
+#endif
+};
+
+}  // namespace io
+}  // namespace open3d
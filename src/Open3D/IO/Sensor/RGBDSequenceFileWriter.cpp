@@ -0,0 +1,214 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/Sensor/RGBDSequenceFileWriter.h"
+
+#include <liblzf/lzf.h>
+#include <cstring>
+
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace io {
+
+bool RGBDSequenceFileWriter::Open(
+        const std::string &filename,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        double depth_scale /* = 1000.0*/,
+        RGBDSequenceColorCodec color_codec /* = RGBDSequenceColorCodec::JPEG*/,
+        RGBDSequenceDepthCodec depth_codec
+        /* = RGBDSequenceDepthCodec::D16*/,
+        int color_quality /* = 90*/) {
+    Close();
+    if (!IsRGBDSequenceFileByteOrderNative()) {
+        utility::LogWarning(
+                "[RGBDSequenceFileWriter] Big endian hosts are not "
+                "supported.\n");
+        return false;
+    }
+    file_ = fopen(filename.c_str(), "wb");
+    if (file_ == NULL) {
+        utility::LogWarning("[RGBDSequenceFileWriter] Unable to open {}.\n",
+                            filename);
+        return false;
+    }
+    filename_ = filename;
+    memset(&header_, 0, sizeof(header_));
+    memcpy(header_.magic_, kRGBDSequenceFileMagic, sizeof(header_.magic_));
+    header_.version_ = kRGBDSequenceFileVersion;
+    header_.color_codec_ = uint32_t(color_codec);
+    header_.depth_codec_ = uint32_t(depth_codec);
+    header_.intrinsic_width_ = intrinsic.width_;
+    header_.intrinsic_height_ = intrinsic.height_;
+    header_.focal_length_[0] = intrinsic.GetFocalLength().first;
+    header_.focal_length_[1] = intrinsic.GetFocalLength().second;
+    header_.principal_point_[0] = intrinsic.GetPrincipalPoint().first;
+    header_.principal_point_[1] = intrinsic.GetPrincipalPoint().second;
+    header_.depth_scale_ = depth_scale;
+    index_.clear();
+    color_quality_ = color_quality;
+    // the header is written again with the frame count on Close()
+    file_size_ = 0;
+    uint64_t offset;
+    return WritePayload(reinterpret_cast<const uint8_t *>(&header_),
+                        sizeof(header_), offset);
+}
+
+bool RGBDSequenceFileWriter::WriteFrame(const geometry::Image &color,
+                                        const geometry::Image &depth,
+                                        uint64_t timestamp) {
+    if (!IsOpened()) {
+        utility::LogWarning("[RGBDSequenceFileWriter] File is not opened.\n");
+        return false;
+    }
+    if (color.bytes_per_channel_ != 1 ||
+        (color.num_of_channels_ != 1 && color.num_of_channels_ != 3) ||
+        depth.bytes_per_channel_ != 2 || depth.num_of_channels_ != 1) {
+        utility::LogWarning(
+                "[RGBDSequenceFileWriter] Unsupported image format.\n");
+        return false;
+    }
+    if (index_.empty()) {
+        header_.color_width_ = color.width_;
+        header_.color_height_ = color.height_;
+        header_.color_channels_ = color.num_of_channels_;
+        header_.depth_width_ = depth.width_;
+        header_.depth_height_ = depth.height_;
+    } else if (color.width_ != header_.color_width_ ||
+               color.height_ != header_.color_height_ ||
+               color.num_of_channels_ != header_.color_channels_ ||
+               depth.width_ != header_.depth_width_ ||
+               depth.height_ != header_.depth_height_) {
+        utility::LogWarning(
+                "[RGBDSequenceFileWriter] Frame size differs from the first "
+                "frame.\n");
+        return false;
+    } else if (timestamp < index_.back().timestamp_) {
+        utility::LogWarning(
+                "[RGBDSequenceFileWriter] Timestamp {:d} is before the "
+                "previous frame.\n",
+                timestamp);
+        return false;
+    }
+
+    const uint8_t *color_data = color.data_.data();
+    size_t color_size = color.data_.size();
+    if (header_.color_codec_ == uint32_t(RGBDSequenceColorCodec::JPEG)) {
+        if (!WriteImageToJPGInMemory(color, color_buffer_, color_quality_)) {
+            return false;
+        }
+        color_data = color_buffer_.data();
+        color_size = color_buffer_.size();
+    }
+
+    const uint8_t *depth_data = depth.data_.data();
+    size_t depth_size = depth.data_.size();
+    if (header_.depth_codec_ == uint32_t(RGBDSequenceDepthCodec::DeltaLZF)) {
+        // depth changes little between neighbours, deltas repeat much more
+        // often than the depth values themselves
+        depth_buffer_.resize(depth_size * 2);
+        uint16_t *deltas = reinterpret_cast<uint16_t *>(depth_buffer_.data());
+        for (int v = 0; v < depth.height_; v++) {
+            const uint16_t *row = depth.PointerAt<uint16_t>(0, v);
+            uint16_t *delta_row = deltas + v * depth.width_;
+            uint16_t previous = 0;
+            for (int u = 0; u < depth.width_; u++) {
+                delta_row[u] = uint16_t(row[u] - previous);
+                previous = row[u];
+            }
+        }
+        uint8_t *compressed = depth_buffer_.data() + depth_size;
+        // the output is smaller than the input, raw frames are recognized by
+        // their size
+        unsigned int compressed_size =
+                lzf_compress(deltas, (unsigned int)depth_size, compressed,
+                             (unsigned int)depth_size - 1);
+        if (compressed_size > 0) {
+            depth_data = compressed;
+            depth_size = compressed_size;
+        }
+    } else if (header_.depth_codec_ == uint32_t(RGBDSequenceDepthCodec::D16)) {
+        if (!WriteImageToD16InMemory(depth, depth_buffer_)) {
+            return false;
+        }
+        if (depth_buffer_.size() < depth_size) {
+            depth_data = depth_buffer_.data();
+            depth_size = depth_buffer_.size();
+        }
+    }
+
+    RGBDSequenceFrameEntry entry;
+    entry.timestamp_ = timestamp;
+    entry.color_size_ = color_size;
+    entry.depth_size_ = depth_size;
+    if (!WritePayload(color_data, color_size, entry.color_offset_) ||
+        !WritePayload(depth_data, depth_size, entry.depth_offset_)) {
+        return false;
+    }
+    index_.push_back(entry);
+    return true;
+}
+
+bool RGBDSequenceFileWriter::Close() {
+    if (!IsOpened()) {
+        return true;
+    }
+    uint64_t index_offset;
+    bool success = WritePayload(
+            reinterpret_cast<const uint8_t *>(index_.data()),
+            index_.size() * sizeof(RGBDSequenceFrameEntry), index_offset);
+    header_.num_frames_ = index_.size();
+    header_.index_offset_ = index_offset;
+    success = success && fseek(file_, 0, SEEK_SET) == 0 &&
+              fwrite(&header_, sizeof(header_), 1, file_) == 1;
+    success = fclose(file_) == 0 && success;
+    file_ = NULL;
+    if (!success) {
+        utility::LogWarning("[RGBDSequenceFileWriter] Unable to write {}.\n",
+                            filename_);
+    }
+    return success;
+}
+
+bool RGBDSequenceFileWriter::WritePayload(const uint8_t *data,
+                                          size_t size,
+                                          uint64_t &offset) {
+    static const uint8_t padding[8] = {0};
+    size_t padding_size = (8 - file_size_ % 8) % 8;
+    offset = file_size_ + padding_size;
+    if (fwrite(padding, 1, padding_size, file_) != padding_size ||
+        fwrite(data, 1, size, file_) != size) {
+        utility::LogWarning("[RGBDSequenceFileWriter] Unable to write {}.\n",
+                            filename_);
+        return false;
+    }
+    file_size_ = offset + size;
+    return true;
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,94 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/IO/Sensor/RGBDSequenceFileFormat.h"
+
+namespace open3d {
+namespace io {
+
+/// Writer of RGB-D sequence files, which hold a captured RGB-D stream with its
+/// timestamps and camera intrinsic in a single file instead of one image file
+/// per frame. See RGBDSequenceFileHeader for the layout.
+class RGBDSequenceFileWriter {
+public:
+    RGBDSequenceFileWriter() {}
+    ~RGBDSequenceFileWriter() { Close(); }
+    RGBDSequenceFileWriter(const RGBDSequenceFileWriter &) = delete;
+    RGBDSequenceFileWriter &operator=(const RGBDSequenceFileWriter &) = delete;
+
+public:
+    /// Creates the file \param filename, replacing any existing file.
+    /// \param depth_scale depth values are in units of 1 / depth_scale meters.
+    /// \param color_quality JPEG quality of the color frames.
+    bool Open(const std::string &filename,
+              const camera::PinholeCameraIntrinsic &intrinsic,
+              double depth_scale = 1000.0,
+              RGBDSequenceColorCodec color_codec = RGBDSequenceColorCodec::JPEG,
+              RGBDSequenceDepthCodec depth_codec = RGBDSequenceDepthCodec::D16,
+              int color_quality = 90);
+
+    bool IsOpened() const { return file_ != NULL; }
+
+    /// Appends a frame captured at \param timestamp (usec). The first frame
+    /// fixes the size of the color and depth images of the sequence. Color
+    /// images have 1 or 3 channels of 8 bit, depth images are 16 bit.
+    bool WriteFrame(const geometry::Image &color,
+                    const geometry::Image &depth,
+                    uint64_t timestamp);
+
+    /// Writes the frame index and closes the file. A file that is not closed
+    /// can not be read.
+    bool Close();
+
+    size_t NumFrames() const { return index_.size(); }
+
+private:
+    /// Appends \param size bytes at the next aligned offset.
+    bool WritePayload(const uint8_t *data, size_t size, uint64_t &offset);
+
+private:
+    FILE *file_ = NULL;
+    std::string filename_;
+    RGBDSequenceFileHeader header_;
+    std::vector<RGBDSequenceFrameEntry> index_;
+    int color_quality_ = 90;
+    /// End of the data written so far.
+    uint64_t file_size_ = 0;
+    /// Reused across frames to encode the payloads.
+    std::vector<uint8_t> color_buffer_;
+    std::vector<uint8_t> depth_buffer_;
+};
+
+}  // namespace io
+}  // namespace open3d
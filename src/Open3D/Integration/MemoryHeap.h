@@ -0,0 +1,134 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace integration {
+
+/// Pool of fixed-size blocks of \p T, the CPU counterpart of
+/// cuda::MemoryHeapCuda. Blocks are addressed by int and live in chunks that
+/// are never moved, so pointers to a block stay valid until Reset(). Memory
+/// is only released when the heap is destroyed: after Reset() the chunks are
+/// handed out again without touching the system allocator.
+template <typename T>
+class MemoryHeap {
+public:
+    /// \param block_size Number of elements per block.
+    /// \param blocks_per_chunk Number of blocks allocated at once, rounded up
+    /// to a power of two.
+    explicit MemoryHeap(int block_size, int blocks_per_chunk = 64)
+        : block_size_(block_size), chunk_shift_(0), num_blocks_(0) {
+        while ((1 << chunk_shift_) < blocks_per_chunk) {
+            chunk_shift_++;
+        }
+    }
+
+    MemoryHeap(const MemoryHeap<T> &other)
+        : block_size_(other.block_size_),
+          chunk_shift_(other.chunk_shift_),
+          num_blocks_(0) {
+        *this = other;
+    }
+
+    MemoryHeap<T> &operator=(const MemoryHeap<T> &other) {
+        if (this == &other) {
+            return *this;
+        }
+        block_size_ = other.block_size_;
+        chunk_shift_ = other.chunk_shift_;
+        chunks_.clear();
+        int num_blocks = other.NumberOfBlocks();
+        Reserve(num_blocks);
+        for (size_t i = 0; i < chunks_.size(); i++) {
+            std::copy(other.chunks_[i].get(),
+                      other.chunks_[i].get() + ChunkSize(),
+                      chunks_[i].get());
+        }
+        num_blocks_.store(num_blocks);
+        return *this;
+    }
+
+public:
+    /// Makes room for \param num_blocks blocks in total, so that Malloc()
+    /// can be called concurrently until that many blocks are in use. Not
+    /// thread safe.
+    void Reserve(int num_blocks) {
+        while (Capacity() < num_blocks) {
+            chunks_.emplace_back(new T[ChunkSize()]);
+        }
+    }
+
+    /// Returns the address of a block reset to T(), or -1 if the reserved
+    /// capacity is exhausted. Thread safe.
+    int Malloc() {
+        int addr = num_blocks_.fetch_add(1);
+        if (addr >= Capacity()) {
+            num_blocks_.fetch_sub(1);
+            utility::LogError("[MemoryHeap] Out of reserved blocks.\n");
+            return -1;
+        }
+        T *block = Get(addr);
+        std::fill(block, block + block_size_, T());
+        return addr;
+    }
+
+    /// Marks all blocks as free, keeping the memory for reuse.
+    void Reset() { num_blocks_.store(0); }
+
+    T *Get(int addr) {
+        return chunks_[addr >> chunk_shift_].get() +
+               size_t(addr & ((1 << chunk_shift_) - 1)) * block_size_;
+    }
+
+    const T *Get(int addr) const {
+        return chunks_[addr >> chunk_shift_].get() +
+               size_t(addr & ((1 << chunk_shift_) - 1)) * block_size_;
+    }
+
+    int BlockSize() const { return block_size_; }
+    int NumberOfBlocks() const { return num_blocks_.load(); }
+    int Capacity() const { return int(chunks_.size()) << chunk_shift_; }
+
+private:
+    size_t ChunkSize() const { return size_t(block_size_) << chunk_shift_; }
+
+private:
+    int block_size_;
+    int chunk_shift_;
+    std::atomic<int> num_blocks_;
+    std::vector<std::unique_ptr<T[]>> chunks_;
+};
+
+}  // namespace integration
+}  // namespace open3d
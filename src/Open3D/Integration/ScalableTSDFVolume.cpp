@@ -26,16 +26,139 @@
 
 #include "Open3D/Integration/ScalableTSDFVolume.h"
 
-#include <unordered_set>
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
 
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Integration/MarchingCubesConst.h"
-#include "Open3D/Integration/UniformTSDFVolume.h"
+#include "Open3D/Integration/TSDFRayCast.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/Profiler.h"
 
 namespace open3d {
 namespace integration {
 
+namespace {
+
+/// Voxel access of RayCastTSDF for a ScalableTSDFVolume. Consecutive samples
+/// of a ray mostly fall into the same volume unit, so the last unit looked
+/// up in the hash table is cached.
+class ScalableTSDFSampler {
+public:
+    explicit ScalableTSDFSampler(const ScalableTSDFVolume &volume)
+        : volume_(volume),
+          resolution_(volume.volume_unit_resolution_),
+          cached_unit_(Eigen::Vector3i::Constant(
+                  std::numeric_limits<int>::min())),
+          cached_voxels_(nullptr) {
+        for (int i = 0; i < 8; i++) {
+            offsets_[i] = IndexOf(CornerShift(i));
+        }
+    }
+
+    const geometry::TSDFVoxel *GetVoxel(const Eigen::Vector3i &idx) {
+        Eigen::Vector3i unit = FloorDivide(idx);
+        const geometry::TSDFVoxel *voxels = GetVolumeUnit(unit);
+        return voxels == nullptr ? nullptr
+                                 : voxels + IndexOf(idx - unit * resolution_);
+    }
+
+    bool GetVoxels(const Eigen::Vector3i &idx,
+                   const geometry::TSDFVoxel **voxels) {
+        Eigen::Vector3i unit = FloorDivide(idx);
+        Eigen::Vector3i local = idx - unit * resolution_;
+        if (local.maxCoeff() < resolution_ - 1) {
+            // all eight voxels lie in one volume unit
+            const geometry::TSDFVoxel *base = GetVolumeUnit(unit);
+            if (base == nullptr) {
+                return false;
+            }
+            base += IndexOf(local);
+            for (int i = 0; i < 8; i++) {
+                voxels[i] = base + offsets_[i];
+            }
+            return true;
+        }
+        for (int i = 0; i < 8; i++) {
+            voxels[i] = GetVoxel(idx + CornerShift(i));
+            if (voxels[i] == nullptr) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Jumps over the volume units that have not been allocated. A ray point
+    /// in such a unit can not be sampled, because the voxel that contains it
+    /// is read either way.
+    double SkipEmptySpace(const Eigen::Vector3d &origin,
+                          const Eigen::Vector3d &direction,
+                          double t,
+                          double t_max) {
+        const double unit_length = volume_.volume_unit_length_;
+        while (t < t_max) {
+            Eigen::Vector3d p = (origin + t * direction) / unit_length;
+            Eigen::Vector3d floor_p(std::floor(p(0)), std::floor(p(1)),
+                                    std::floor(p(2)));
+            if (!(floor_p.array().abs() <
+                  double(std::numeric_limits<int>::max() / 2))
+                         .all()) {
+                return std::numeric_limits<double>::infinity();
+            }
+            if (GetVolumeUnit(floor_p.cast<int>()) != nullptr) {
+                return t;
+            }
+            double t_exit = t_max;
+            for (int i = 0; i < 3; i++) {
+                if (direction(i) != 0.0) {
+                    double bound = (floor_p(i) + (direction(i) > 0.0 ? 1 : 0)) *
+                                   unit_length;
+                    t_exit = std::min(t_exit,
+                                      (bound - origin(i)) / direction(i));
+                }
+            }
+            // step just past the boundary, also when rounding keeps the ray
+            // on it
+            t = std::max(t_exit, t) + 1e-4 * volume_.voxel_length_;
+        }
+        return t;
+    }
+
+private:
+    Eigen::Vector3i FloorDivide(const Eigen::Vector3i &idx) const {
+        Eigen::Vector3i unit;
+        for (int i = 0; i < 3; i++) {
+            unit(i) = idx(i) >= 0 ? idx(i) / resolution_
+                                  : (idx(i) + 1) / resolution_ - 1;
+        }
+        return unit;
+    }
+
+    int IndexOf(const Eigen::Vector3i &local) const {
+        return (local(0) * resolution_ + local(1)) * resolution_ + local(2);
+    }
+
+    const geometry::TSDFVoxel *GetVolumeUnit(const Eigen::Vector3i &unit) {
+        if (unit != cached_unit_) {
+            cached_unit_ = unit;
+            int addr = volume_.volume_units_.Find(unit);
+            cached_voxels_ = addr < 0 ? nullptr : volume_.voxel_heap_.Get(addr);
+        }
+        return cached_voxels_;
+    }
+
+private:
+    const ScalableTSDFVolume &volume_;
+    int resolution_;
+    Eigen::Vector3i cached_unit_;
+    const geometry::TSDFVoxel *cached_voxels_;
+    int offsets_[8];
+};
+
+}  // unnamed namespace
+
 ScalableTSDFVolume::ScalableTSDFVolume(double voxel_length,
                                        double sdf_trunc,
                                        TSDFVolumeColorType color_type,
@@ -44,16 +167,22 @@ ScalableTSDFVolume::ScalableTSDFVolume(double voxel_length,
     : TSDFVolume(voxel_length, sdf_trunc, color_type),
       volume_unit_resolution_(volume_unit_resolution),
       volume_unit_length_(voxel_length * volume_unit_resolution),
-      depth_sampling_stride_(depth_sampling_stride) {}
+      depth_sampling_stride_(depth_sampling_stride),
+      voxel_heap_(volume_unit_resolution * volume_unit_resolution *
+                  volume_unit_resolution) {}
 
 ScalableTSDFVolume::~ScalableTSDFVolume() {}
 
-void ScalableTSDFVolume::Reset() { volume_units_.clear(); }
+void ScalableTSDFVolume::Reset() {
+    volume_units_.Clear();
+    voxel_heap_.Reset();
+}
 
 void ScalableTSDFVolume::Integrate(
         const geometry::RGBDImage &image,
         const camera::PinholeCameraIntrinsic &intrinsic,
         const Eigen::Matrix4d &extrinsic) {
+    OPEN3D_PROFILE_SCOPE("ScalableTSDFVolume::Integrate");
     if ((image.depth_.num_of_channels_ != 1) ||
         (image.depth_.bytes_per_channel_ != 4) ||
         (image.depth_.width_ != intrinsic.width_) ||
@@ -80,9 +209,9 @@ void ScalableTSDFVolume::Integrate(
     auto pointcloud = geometry::PointCloud::CreateFromDepthImage(
             image.depth_, intrinsic, extrinsic, 1000.0, 1000.0,
             depth_sampling_stride_);
-    std::unordered_set<Eigen::Vector3i,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            touched_volume_units_;
+
+    // volume units within the truncation distance of a depth sample
+    std::vector<Eigen::Vector3i> touched_units;
     for (const auto &point : pointcloud->points_) {
         auto min_bound = LocateVolumeUnit(
                 point - Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
@@ -91,113 +220,131 @@ void ScalableTSDFVolume::Integrate(
         for (auto x = min_bound(0); x <= max_bound(0); x++) {
             for (auto y = min_bound(1); y <= max_bound(1); y++) {
                 for (auto z = min_bound(2); z <= max_bound(2); z++) {
-                    auto loc = Eigen::Vector3i(x, y, z);
-                    if (touched_volume_units_.find(loc) ==
-                        touched_volume_units_.end()) {
-                        touched_volume_units_.insert(loc);
-                        auto volume = OpenVolumeUnit(Eigen::Vector3i(x, y, z));
-                        volume->IntegrateWithDepthToCameraDistanceMultiplier(
-                                image, intrinsic, extrinsic,
-                                *depth2cameradistance);
-                    }
+                    touched_units.push_back(Eigen::Vector3i(x, y, z));
                 }
             }
         }
     }
+    auto less = [](const Eigen::Vector3i &a, const Eigen::Vector3i &b) {
+        return std::lexicographical_compare(a.data(), a.data() + 3, b.data(),
+                                            b.data() + 3);
+    };
+    std::sort(touched_units.begin(), touched_units.end(), less);
+    touched_units.erase(std::unique(touched_units.begin(), touched_units.end()),
+                        touched_units.end());
+    int num_units = int(touched_units.size());
+
+    // allocate the units seen for the first time, reserving exactly what they
+    // need so that the inserts below can run concurrently
+    std::vector<int> addrs(num_units);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_units; i++) {
+        addrs[i] = volume_units_.Find(touched_units[i]);
+    }
+    int num_new_units = int(std::count(addrs.begin(), addrs.end(), -1));
+    OPEN3D_PROFILE_COUNTER("ScalableTSDFVolume touched units", num_units);
+    OPEN3D_PROFILE_COUNTER("ScalableTSDFVolume new units", num_new_units);
+    volume_units_.Reserve(volume_units_.Size() + num_new_units);
+    voxel_heap_.Reserve(voxel_heap_.NumberOfBlocks() + num_new_units);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_units; i++) {
+        if (addrs[i] < 0) {
+            addrs[i] = volume_units_.Insert(touched_units[i], [this]() {
+                return voxel_heap_.Malloc();
+            });
+        }
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_units; i++) {
+        if (addrs[i] < 0) {
+            continue;
+        }
+        UniformTSDFVolume::IntegrateVoxelBlock(
+                voxel_heap_.Get(addrs[i]), volume_unit_resolution_,
+                touched_units[i].cast<double>() * volume_unit_length_,
+                voxel_length_, sdf_trunc_, color_type_, image, intrinsic,
+                extrinsic, *depth2cameradistance);
+    }
 }
 
 std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
+    OPEN3D_PROFILE_SCOPE("ScalableTSDFVolume::ExtractPointCloud");
     auto pointcloud = std::make_shared<geometry::PointCloud>();
     double half_voxel_length = voxel_length_ * 0.5;
     float w0, w1, f0, f1;
     Eigen::Vector3f c0, c1;
-    for (const auto &unit : volume_units_) {
-        if (unit.second.volume_) {
-            const auto &volume0 = *unit.second.volume_;
-            const auto &index0 = unit.second.index_;
-            for (int x = 0; x < volume0.resolution_; x++) {
-                for (int y = 0; y < volume0.resolution_; y++) {
-                    for (int z = 0; z < volume0.resolution_; z++) {
-                        Eigen::Vector3i idx0(x, y, z);
-                        w0 = volume0.voxels_[volume0.IndexOf(idx0)].weight_;
-                        f0 = volume0.voxels_[volume0.IndexOf(idx0)].tsdf_;
-                        if (color_type_ != TSDFVolumeColorType::None)
-                            c0 = volume0.voxels_[volume0.IndexOf(idx0)]
-                                         .color_.cast<float>();
-                        if (w0 != 0.0f && f0 < 0.98f && f0 >= -0.98f) {
-                            Eigen::Vector3d p0 =
-                                    Eigen::Vector3d(half_voxel_length +
-                                                            voxel_length_ * x,
-                                                    half_voxel_length +
-                                                            voxel_length_ * y,
-                                                    half_voxel_length +
-                                                            voxel_length_ * z) +
-                                    index0.cast<double>() * volume_unit_length_;
-                            for (int i = 0; i < 3; i++) {
-                                Eigen::Vector3d p1 = p0;
-                                Eigen::Vector3i idx1 = idx0;
-                                Eigen::Vector3i index1 = index0;
-                                p1(i) += voxel_length_;
-                                idx1(i) += 1;
-                                if (idx1(i) < volume0.resolution_) {
-                                    w1 = volume0.voxels_[volume0.IndexOf(idx1)]
-                                                 .weight_;
-                                    f1 = volume0.voxels_[volume0.IndexOf(idx1)]
-                                                 .tsdf_;
-                                    if (color_type_ !=
-                                        TSDFVolumeColorType::None)
-                                        c1 = volume0.voxels_[volume0.IndexOf(
-                                                                     idx1)]
-                                                     .color_.cast<float>();
-                                } else {
-                                    idx1(i) -= volume0.resolution_;
-                                    index1(i) += 1;
-                                    auto unit_itr = volume_units_.find(index1);
-                                    if (unit_itr == volume_units_.end()) {
-                                        w1 = 0.0f;
-                                        f1 = 0.0f;
-                                    } else {
-                                        const auto &volume1 =
-                                                *unit_itr->second.volume_;
-                                        w1 = volume1.voxels_[volume1.IndexOf(
-                                                                     idx1)]
-                                                     .weight_;
-                                        f1 = volume1.voxels_[volume1.IndexOf(
-                                                                     idx1)]
-                                                     .tsdf_;
-                                        if (color_type_ !=
-                                            TSDFVolumeColorType::None)
-                                            c1 = volume1.voxels_
-                                                         [volume1.IndexOf(idx1)]
-                                                                 .color_
-                                                                 .cast<float>();
-                                    }
-                                }
-                                if (w1 != 0.0f && f1 < 0.98f && f1 >= -0.98f &&
-                                    f0 * f1 < 0) {
-                                    float r0 = std::fabs(f0);
-                                    float r1 = std::fabs(f1);
-                                    Eigen::Vector3d p = p0;
-                                    p(i) = (p0(i) * r1 + p1(i) * r0) /
-                                           (r0 + r1);
-                                    pointcloud->points_.push_back(p);
-                                    if (color_type_ ==
-                                        TSDFVolumeColorType::RGB8) {
-                                        pointcloud->colors_.push_back(
-                                                ((c0 * r1 + c1 * r0) /
-                                                 (r0 + r1) / 255.0f)
-                                                        .cast<double>());
-                                    } else if (color_type_ ==
-                                               TSDFVolumeColorType::Gray32) {
-                                        pointcloud->colors_.push_back(
-                                                ((c0 * r1 + c1 * r0) /
-                                                 (r0 + r1))
-                                                        .cast<double>());
-                                    }
-                                    // has_normal
-                                    pointcloud->normals_.push_back(
-                                            GetNormalAt(p));
+    std::vector<Eigen::Vector3i> unit_indices;
+    std::vector<int> unit_addrs;
+    volume_units_.GetEntries(unit_indices, unit_addrs);
+    for (size_t unit = 0; unit < unit_indices.size(); unit++) {
+        const geometry::TSDFVoxel *voxels0 = voxel_heap_.Get(unit_addrs[unit]);
+        const Eigen::Vector3i &index0 = unit_indices[unit];
+        for (int x = 0; x < volume_unit_resolution_; x++) {
+            for (int y = 0; y < volume_unit_resolution_; y++) {
+                for (int z = 0; z < volume_unit_resolution_; z++) {
+                    Eigen::Vector3i idx0(x, y, z);
+                    const geometry::TSDFVoxel &voxel0 = voxels0[IndexOf(idx0)];
+                    w0 = voxel0.weight_;
+                    f0 = voxel0.tsdf_;
+                    if (color_type_ != TSDFVolumeColorType::None)
+                        c0 = voxel0.color_.cast<float>();
+                    if (w0 != 0.0f && f0 < 0.98f && f0 >= -0.98f) {
+                        Eigen::Vector3d p0 =
+                                Eigen::Vector3d(
+                                        half_voxel_length + voxel_length_ * x,
+                                        half_voxel_length + voxel_length_ * y,
+                                        half_voxel_length + voxel_length_ * z) +
+                                index0.cast<double>() * volume_unit_length_;
+                        for (int i = 0; i < 3; i++) {
+                            Eigen::Vector3d p1 = p0;
+                            Eigen::Vector3i idx1 = idx0;
+                            Eigen::Vector3i index1 = index0;
+                            p1(i) += voxel_length_;
+                            idx1(i) += 1;
+                            const geometry::TSDFVoxel *voxels1 = voxels0;
+                            if (idx1(i) >= volume_unit_resolution_) {
+                                idx1(i) -= volume_unit_resolution_;
+                                index1(i) += 1;
+                                voxels1 = GetVolumeUnit(index1);
+                            }
+                            if (voxels1 == nullptr) {
+                                w1 = 0.0f;
+                                f1 = 0.0f;
+                            } else {
+                                const geometry::TSDFVoxel &voxel1 =
+                                        voxels1[IndexOf(idx1)];
+                                w1 = voxel1.weight_;
+                                f1 = voxel1.tsdf_;
+                                if (color_type_ != TSDFVolumeColorType::None)
+                                    c1 = voxel1.color_.cast<float>();
+                            }
+                            if (w1 != 0.0f && f1 < 0.98f && f1 >= -0.98f &&
+                                f0 * f1 < 0) {
+                                float r0 = std::fabs(f0);
+                                float r1 = std::fabs(f1);
+                                Eigen::Vector3d p = p0;
+                                p(i) = (p0(i) * r1 + p1(i) * r0) / (r0 + r1);
+                                pointcloud->points_.push_back(p);
+                                if (color_type_ == TSDFVolumeColorType::RGB8) {
+                                    pointcloud->colors_.push_back(
+                                            ((c0 * r1 + c1 * r0) / (r0 + r1) /
+                                             255.0f)
+                                                    .cast<double>());
+                                } else if (color_type_ ==
+                                           TSDFVolumeColorType::Gray32) {
+                                    pointcloud->colors_.push_back(
+                                            ((c0 * r1 + c1 * r0) / (r0 + r1))
+                                                    .cast<double>());
                                 }
+                                // has_normal
+                                pointcloud->normals_.push_back(GetNormalAt(p));
                             }
                         }
                     }
@@ -210,6 +357,7 @@ std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
 
 std::shared_ptr<geometry::TriangleMesh>
 ScalableTSDFVolume::ExtractTriangleMesh() {
+    OPEN3D_PROFILE_SCOPE("ScalableTSDFVolume::ExtractTriangleMesh");
     // implementation of marching cubes, based on
     // http://paulbourke.net/geometry/polygonise/
     auto mesh = std::make_shared<geometry::TriangleMesh>();
@@ -220,137 +368,106 @@ ScalableTSDFVolume::ExtractTriangleMesh() {
             Eigen::aligned_allocator<std::pair<const Eigen::Vector4i, int>>>
             edgeindex_to_vertexindex;
     int edge_to_index[12];
-    for (const auto &unit : volume_units_) {
-        if (unit.second.volume_) {
-            const auto &volume0 = *unit.second.volume_;
-            const auto &index0 = unit.second.index_;
-            for (int x = 0; x < volume0.resolution_; x++) {
-                for (int y = 0; y < volume0.resolution_; y++) {
-                    for (int z = 0; z < volume0.resolution_; z++) {
-                        Eigen::Vector3i idx0(x, y, z);
-                        int cube_index = 0;
-                        float w[8];
-                        float f[8];
-                        Eigen::Vector3d c[8];
-                        for (int i = 0; i < 8; i++) {
-                            Eigen::Vector3i index1 = index0;
-                            Eigen::Vector3i idx1 = idx0 + shift[i];
-                            if (idx1(0) < volume_unit_resolution_ &&
-                                idx1(1) < volume_unit_resolution_ &&
-                                idx1(2) < volume_unit_resolution_) {
-                                w[i] = volume0.voxels_[volume0.IndexOf(idx1)]
-                                               .weight_;
-                                f[i] = volume0.voxels_[volume0.IndexOf(idx1)]
-                                               .tsdf_;
-                                if (color_type_ == TSDFVolumeColorType::RGB8)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
-                                                                   idx1)]
-                                                   .color_.cast<double>() /
-                                           255.0;
-                                else if (color_type_ ==
-                                         TSDFVolumeColorType::Gray32)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
-                                                                   idx1)]
-                                                   .color_.cast<double>();
-                            } else {
-                                for (int j = 0; j < 3; j++) {
-                                    if (idx1(j) >= volume_unit_resolution_) {
-                                        idx1(j) -= volume_unit_resolution_;
-                                        index1(j) += 1;
-                                    }
-                                }
-                                auto unit_itr1 = volume_units_.find(index1);
-                                if (unit_itr1 == volume_units_.end()) {
-                                    w[i] = 0.0f;
-                                    f[i] = 0.0f;
-                                } else {
-                                    const auto &volume1 =
-                                            *unit_itr1->second.volume_;
-                                    w[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .weight_;
-                                    f[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .tsdf_;
-                                    if (color_type_ ==
-                                        TSDFVolumeColorType::RGB8)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>() /
-                                               255.0;
-                                    else if (color_type_ ==
-                                             TSDFVolumeColorType::Gray32)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>();
-                                }
-                            }
-                            if (w[i] == 0.0f) {
-                                cube_index = 0;
-                                break;
-                            } else {
-                                if (f[i] < 0.0f) {
-                                    cube_index |= (1 << i);
+    std::vector<Eigen::Vector3i> unit_indices;
+    std::vector<int> unit_addrs;
+    volume_units_.GetEntries(unit_indices, unit_addrs);
+    for (size_t unit = 0; unit < unit_indices.size(); unit++) {
+        const geometry::TSDFVoxel *voxels0 = voxel_heap_.Get(unit_addrs[unit]);
+        const Eigen::Vector3i &index0 = unit_indices[unit];
+        for (int x = 0; x < volume_unit_resolution_; x++) {
+            for (int y = 0; y < volume_unit_resolution_; y++) {
+                for (int z = 0; z < volume_unit_resolution_; z++) {
+                    Eigen::Vector3i idx0(x, y, z);
+                    int cube_index = 0;
+                    float w[8];
+                    float f[8];
+                    Eigen::Vector3d c[8];
+                    for (int i = 0; i < 8; i++) {
+                        Eigen::Vector3i index1 = index0;
+                        Eigen::Vector3i idx1 = idx0 + shift[i];
+                        const geometry::TSDFVoxel *voxels1 = voxels0;
+                        if (idx1(0) >= volume_unit_resolution_ ||
+                            idx1(1) >= volume_unit_resolution_ ||
+                            idx1(2) >= volume_unit_resolution_) {
+                            for (int j = 0; j < 3; j++) {
+                                if (idx1(j) >= volume_unit_resolution_) {
+                                    idx1(j) -= volume_unit_resolution_;
+                                    index1(j) += 1;
                                 }
                             }
+                            voxels1 = GetVolumeUnit(index1);
                         }
-                        if (cube_index == 0 || cube_index == 255) {
-                            continue;
+                        if (voxels1 == nullptr) {
+                            w[i] = 0.0f;
+                            f[i] = 0.0f;
+                        } else {
+                            const geometry::TSDFVoxel &voxel1 =
+                                    voxels1[IndexOf(idx1)];
+                            w[i] = voxel1.weight_;
+                            f[i] = voxel1.tsdf_;
+                            if (color_type_ == TSDFVolumeColorType::RGB8)
+                                c[i] = voxel1.color_ / 255.0;
+                            else if (color_type_ ==
+                                     TSDFVolumeColorType::Gray32)
+                                c[i] = voxel1.color_;
                         }
-                        for (int i = 0; i < 12; i++) {
-                            if (edge_table[cube_index] & (1 << i)) {
-                                Eigen::Vector4i edge_index =
-                                        Eigen::Vector4i(index0(0), index0(1),
-                                                        index0(2), 0) *
-                                                volume_unit_resolution_ +
-                                        Eigen::Vector4i(x, y, z, 0) +
-                                        edge_shift[i];
-                                if (edgeindex_to_vertexindex.find(edge_index) ==
-                                    edgeindex_to_vertexindex.end()) {
-                                    edge_to_index[i] =
-                                            (int)mesh->vertices_.size();
-                                    edgeindex_to_vertexindex[edge_index] =
-                                            (int)mesh->vertices_.size();
-                                    Eigen::Vector3d pt(
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(0),
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(1),
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(2));
-                                    double f0 = std::abs(
-                                            (double)f[edge_to_vert[i][0]]);
-                                    double f1 = std::abs(
-                                            (double)f[edge_to_vert[i][1]]);
-                                    pt(edge_index(3)) +=
-                                            f0 * voxel_length_ / (f0 + f1);
-                                    mesh->vertices_.push_back(pt);
-                                    if (color_type_ !=
-                                        TSDFVolumeColorType::None) {
-                                        const auto &c0 = c[edge_to_vert[i][0]];
-                                        const auto &c1 = c[edge_to_vert[i][1]];
-                                        mesh->vertex_colors_.push_back(
-                                                (f1 * c0 + f0 * c1) /
-                                                (f0 + f1));
-                                    }
-                                } else {
-                                    edge_to_index[i] = edgeindex_to_vertexindex
-                                            [edge_index];
-                                }
+                        if (w[i] == 0.0f) {
+                            cube_index = 0;
+                            break;
+                        } else {
+                            if (f[i] < 0.0f) {
+                                cube_index |= (1 << i);
                             }
                         }
-                        for (int i = 0; tri_table[cube_index][i] != -1;
-                             i += 3) {
-                            mesh->triangles_.push_back(Eigen::Vector3i(
-                                    edge_to_index[tri_table[cube_index][i]],
-                                    edge_to_index[tri_table[cube_index][i + 2]],
-                                    edge_to_index[tri_table[cube_index]
-                                                           [i + 1]]));
+                    }
+                    if (cube_index == 0 || cube_index == 255) {
+                        continue;
+                    }
+                    for (int i = 0; i < 12; i++) {
+                        if (edge_table[cube_index] & (1 << i)) {
+                            Eigen::Vector4i edge_index =
+                                    Eigen::Vector4i(index0(0), index0(1),
+                                                    index0(2), 0) *
+                                            volume_unit_resolution_ +
+                                    Eigen::Vector4i(x, y, z, 0) +
+                                    edge_shift[i];
+                            if (edgeindex_to_vertexindex.find(edge_index) ==
+                                edgeindex_to_vertexindex.end()) {
+                                edge_to_index[i] = (int)mesh->vertices_.size();
+                                edgeindex_to_vertexindex[edge_index] =
+                                        (int)mesh->vertices_.size();
+                                Eigen::Vector3d pt(
+                                        half_voxel_length +
+                                                voxel_length_ * edge_index(0),
+                                        half_voxel_length +
+                                                voxel_length_ * edge_index(1),
+                                        half_voxel_length +
+                                                voxel_length_ * edge_index(2));
+                                double f0 = std::abs(
+                                        (double)f[edge_to_vert[i][0]]);
+                                double f1 = std::abs(
+                                        (double)f[edge_to_vert[i][1]]);
+                                pt(edge_index(3)) +=
+                                        f0 * voxel_length_ / (f0 + f1);
+                                mesh->vertices_.push_back(pt);
+                                if (color_type_ != TSDFVolumeColorType::None) {
+                                    const auto &c0 = c[edge_to_vert[i][0]];
+                                    const auto &c1 = c[edge_to_vert[i][1]];
+                                    mesh->vertex_colors_.push_back(
+                                            (f1 * c0 + f0 * c1) / (f0 + f1));
+                                }
+                            } else {
+                                edge_to_index[i] =
+                                        edgeindex_to_vertexindex[edge_index];
+                            }
                         }
                     }
+                    for (int i = 0; tri_table[cube_index][i] != -1; i += 3) {
+                        mesh->triangles_.push_back(Eigen::Vector3i(
+                                edge_to_index[tri_table[cube_index][i]],
+                                edge_to_index[tri_table[cube_index][i + 2]],
+                                edge_to_index[tri_table[cube_index][i + 1]]));
+                    }
                 }
             }
         }
@@ -358,28 +475,75 @@ ScalableTSDFVolume::ExtractTriangleMesh() {
     return mesh;
 }
 
+std::tuple<std::shared_ptr<geometry::RGBDImage>,
+           std::shared_ptr<geometry::Image>>
+ScalableTSDFVolume::RayCast(const camera::PinholeCameraIntrinsic &intrinsic,
+                            const Eigen::Matrix4d &extrinsic,
+                            double depth_max /* = 3.0*/,
+                            bool convert_rgb_to_intensity /* = true*/) {
+    OPEN3D_PROFILE_SCOPE("ScalableTSDFVolume::RayCast");
+    return RayCastTSDF(ScalableTSDFSampler(*this), Eigen::Vector3d::Zero(),
+                       voxel_length_, sdf_trunc_, color_type_, intrinsic,
+                       extrinsic, depth_max, convert_rgb_to_intensity);
+}
+
 std::shared_ptr<geometry::PointCloud>
 ScalableTSDFVolume::ExtractVoxelPointCloud() {
     auto voxel = std::make_shared<geometry::PointCloud>();
-    for (auto &unit : volume_units_) {
-        if (unit.second.volume_) {
-            auto v = unit.second.volume_->ExtractVoxelPointCloud();
-            *voxel += *v;
+    double half_voxel_length = voxel_length_ * 0.5;
+    std::vector<Eigen::Vector3i> unit_indices;
+    std::vector<int> unit_addrs;
+    volume_units_.GetEntries(unit_indices, unit_addrs);
+    for (size_t unit = 0; unit < unit_indices.size(); unit++) {
+        const geometry::TSDFVoxel *voxels = voxel_heap_.Get(unit_addrs[unit]);
+        Eigen::Vector3d origin =
+                unit_indices[unit].cast<double>() * volume_unit_length_;
+        for (int x = 0; x < volume_unit_resolution_; x++) {
+            for (int y = 0; y < volume_unit_resolution_; y++) {
+                for (int z = 0; z < volume_unit_resolution_; z++) {
+                    const geometry::TSDFVoxel &v =
+                            voxels[IndexOf(Eigen::Vector3i(x, y, z))];
+                    if (v.weight_ != 0.0f && v.tsdf_ < 0.98f &&
+                        v.tsdf_ >= -0.98f) {
+                        Eigen::Vector3d pt(
+                                half_voxel_length + voxel_length_ * x,
+                                half_voxel_length + voxel_length_ * y,
+                                half_voxel_length + voxel_length_ * z);
+                        voxel->points_.push_back(pt + origin);
+                        double c = (v.tsdf_ + 1.0) * 0.5;
+                        voxel->colors_.push_back(Eigen::Vector3d(c, c, c));
+                    }
+                }
+            }
         }
     }
     return voxel;
 }
 
-std::shared_ptr<UniformTSDFVolume> ScalableTSDFVolume::OpenVolumeUnit(
-        const Eigen::Vector3i &index) {
-    auto &unit = volume_units_[index];
-    if (!unit.volume_) {
-        unit.volume_.reset(new UniformTSDFVolume(
+std::unordered_map<Eigen::Vector3i,
+                   ScalableTSDFVolume::VolumeUnit,
+                   utility::hash_eigen::hash<Eigen::Vector3i>>
+ScalableTSDFVolume::GetVolumeUnits() const {
+    std::unordered_map<Eigen::Vector3i, VolumeUnit,
+                       utility::hash_eigen::hash<Eigen::Vector3i>>
+            volume_units;
+    std::vector<Eigen::Vector3i> unit_indices;
+    std::vector<int> unit_addrs;
+    volume_units_.GetEntries(unit_indices, unit_addrs);
+    const int voxel_num = voxel_heap_.BlockSize();
+    for (size_t unit = 0; unit < unit_indices.size(); unit++) {
+        VolumeUnit &volume_unit = volume_units[unit_indices[unit]];
+        volume_unit.index_ = unit_indices[unit];
+        volume_unit.volume_ = std::make_shared<UniformTSDFVolume>(
                 volume_unit_length_, volume_unit_resolution_, sdf_trunc_,
-                color_type_, index.cast<double>() * volume_unit_length_));
-        unit.index_ = index;
+                color_type_,
+                unit_indices[unit].cast<double>() * volume_unit_length_);
+        // both lay out the voxels by UniformTSDFVolume::IndexOf
+        const geometry::TSDFVoxel *voxels = voxel_heap_.Get(unit_addrs[unit]);
+        std::copy(voxels, voxels + voxel_num,
+                  volume_unit.volume_->voxels_.begin());
     }
-    return unit.volume_;
+    return volume_units;
 }
 
 Eigen::Vector3d ScalableTSDFVolume::GetNormalAt(const Eigen::Vector3d &p) {
@@ -395,15 +559,15 @@ Eigen::Vector3d ScalableTSDFVolume::GetNormalAt(const Eigen::Vector3d &p) {
     return n.normalized();
 }
 
+
 double ScalableTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
     Eigen::Vector3d p_locate =
             p - Eigen::Vector3d(0.5, 0.5, 0.5) * voxel_length_;
     Eigen::Vector3i index0 = LocateVolumeUnit(p_locate);
-    auto unit_itr = volume_units_.find(index0);
-    if (unit_itr == volume_units_.end()) {
+    const geometry::TSDFVoxel *voxels0 = GetVolumeUnit(index0);
+    if (voxels0 == nullptr) {
         return 0.0;
     }
-    const auto &volume0 = *unit_itr->second.volume_;
     Eigen::Vector3i idx0;
     Eigen::Vector3d p_grid =
             (p_locate - index0.cast<double>() * volume_unit_length_) /
@@ -422,7 +586,7 @@ double ScalableTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
         if (idx1(0) < volume_unit_resolution_ &&
             idx1(1) < volume_unit_resolution_ &&
             idx1(2) < volume_unit_resolution_) {
-            f[i] = volume0.voxels_[volume0.IndexOf(idx1)].tsdf_;
+            f[i] = voxels0[IndexOf(idx1)].tsdf_;
         } else {
             for (int j = 0; j < 3; j++) {
                 if (idx1(j) >= volume_unit_resolution_) {
@@ -430,13 +594,8 @@ double ScalableTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
                     index1(j) += 1;
                 }
             }
-            auto unit_itr1 = volume_units_.find(index1);
-            if (unit_itr1 == volume_units_.end()) {
-                f[i] = 0.0f;
-            } else {
-                const auto &volume1 = *unit_itr1->second.volume_;
-                f[i] = volume1.voxels_[volume1.IndexOf(idx1)].tsdf_;
-            }
+            const geometry::TSDFVoxel *voxels1 = GetVolumeUnit(index1);
+            f[i] = voxels1 == nullptr ? 0.0f : voxels1[IndexOf(idx1)].tsdf_;
         }
     }
     return (1 - r(0)) * ((1 - r(1)) * ((1 - r(2)) * f[0] + r(2) * f[4]) +
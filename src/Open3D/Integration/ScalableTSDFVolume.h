@@ -29,14 +29,15 @@
 #include <memory>
 #include <unordered_map>
 
+#include "Open3D/Integration/MemoryHeap.h"
+#include "Open3D/Integration/SpatialHashTable.h"
 #include "Open3D/Integration/TSDFVolume.h"
+#include "Open3D/Integration/UniformTSDFVolume.h"
 #include "Open3D/Utility/Helper.h"
 
 namespace open3d {
 namespace integration {
 
-class UniformTSDFVolume;
-
 /// Class that implements a more memory efficient data structure for volumetric
 /// integration
 /// This implementation is based on the following repository:
@@ -54,9 +55,14 @@ class UniformTSDFVolume;
 /// normal and producing a smooth surface output. The carving is great in
 /// removing outlier structures like floating noise pixels and bumps along
 /// structure edges.
+///
+/// The volume units are stored like in ScalableTSDFVolumeCuda: a spatial hash
+/// table maps every unit to a block of voxels in a pooled memory heap, so
+/// integrating a frame neither allocates per unit nor serializes on a map.
 
 class ScalableTSDFVolume : public TSDFVolume {
 public:
+    /// A volume unit as a standalone UniformTSDFVolume, see GetVolumeUnits.
     struct VolumeUnit {
     public:
         VolumeUnit() : volume_(NULL) {}
@@ -81,8 +87,23 @@ public:
                    const Eigen::Matrix4d &extrinsic) override;
     std::shared_ptr<geometry::PointCloud> ExtractPointCloud() override;
     std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMesh() override;
+    std::tuple<std::shared_ptr<geometry::RGBDImage>,
+               std::shared_ptr<geometry::Image>>
+    RayCast(const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            double depth_max = 3.0,
+            bool convert_rgb_to_intensity = true) override;
     std::shared_ptr<geometry::PointCloud> ExtractVoxelPointCloud();
 
+    /// Function that returns copies of the observed volume units keyed by
+    /// their index, as volume_units_ stored them before it became a
+    /// SpatialHashTable. Kept for code that walks the units; it copies every
+    /// voxel, so new code should read volume_units_ and voxel_heap_ instead.
+    std::unordered_map<Eigen::Vector3i,
+                       VolumeUnit,
+                       utility::hash_eigen::hash<Eigen::Vector3i>>
+    GetVolumeUnits() const;
+
 public:
     int volume_unit_resolution_;
     double volume_unit_length_;
@@ -91,10 +112,13 @@ public:
     /// Assume the index of the volume unit is (x, y, z), then the unit spans
     /// from (x, y, z) * volume_unit_length_
     /// to (x + 1, y + 1, z + 1) * volume_unit_length_
-    std::unordered_map<Eigen::Vector3i,
-                       VolumeUnit,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            volume_units_;
+    /// The table maps the index to the address of the unit's voxels in
+    /// voxel_heap_.
+    SpatialHashTable volume_units_;
+
+    /// Blocks of volume_unit_resolution_ ^ 3 voxels, laid out like
+    /// UniformTSDFVolume::IndexOf().
+    MemoryHeap<geometry::TSDFVoxel> voxel_heap_;
 
 private:
     Eigen::Vector3i LocateVolumeUnit(const Eigen::Vector3d &point) {
@@ -103,8 +127,19 @@ private:
                                (int)std::floor(point(2) / volume_unit_length_));
     }
 
-    std::shared_ptr<UniformTSDFVolume> OpenVolumeUnit(
-            const Eigen::Vector3i &index);
+    /// Returns the voxels of the volume unit at \param index, or nullptr if
+    /// the unit has not been observed.
+    const geometry::TSDFVoxel *GetVolumeUnit(
+            const Eigen::Vector3i &index) const {
+        int addr = volume_units_.Find(index);
+        return addr < 0 ? nullptr : voxel_heap_.Get(addr);
+    }
+
+    inline int IndexOf(const Eigen::Vector3i &xyz) const {
+        return (xyz(0) * volume_unit_resolution_ + xyz(1)) *
+                       volume_unit_resolution_ +
+               xyz(2);
+    }
 
     Eigen::Vector3d GetNormalAt(const Eigen::Vector3d &p);
 
@@ -0,0 +1,171 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Integration/SpatialHashTable.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace open3d {
+namespace integration {
+
+namespace {
+
+const int kCoordinateBits = 21;
+const int64_t kCoordinateBias = int64_t(1) << (kCoordinateBits - 1);
+const int64_t kCoordinateMask = (int64_t(1) << kCoordinateBits) - 1;
+
+}  // unnamed namespace
+
+SpatialHashTable::SpatialHashTable() : capacity_(0), size_(0) {}
+
+SpatialHashTable::SpatialHashTable(const SpatialHashTable &other)
+    : capacity_(0), size_(0) {
+    *this = other;
+}
+
+SpatialHashTable &SpatialHashTable::operator=(const SpatialHashTable &other) {
+    if (this == &other) {
+        return *this;
+    }
+    Allocate(other.capacity_);
+    for (size_t slot = 0; slot < capacity_; slot++) {
+        keys_[slot].store(other.keys_[slot].load());
+        addrs_[slot].store(other.addrs_[slot].load());
+    }
+    size_.store(other.size_.load());
+    return *this;
+}
+
+SpatialHashTable::~SpatialHashTable() {}
+
+void SpatialHashTable::Reserve(size_t num_entries) {
+    size_t capacity = std::max(capacity_, size_t(16));
+    while (capacity < 2 * num_entries) {
+        capacity *= 2;
+    }
+    if (capacity == capacity_) {
+        return;
+    }
+    std::vector<Eigen::Vector3i> keys;
+    std::vector<int> addrs;
+    GetEntries(keys, addrs);
+    Allocate(capacity);
+    for (size_t i = 0; i < keys.size(); i++) {
+        int addr = addrs[i];
+        Insert(keys[i], [addr]() { return addr; });
+    }
+}
+
+int SpatialHashTable::Find(const Eigen::Vector3i &key) const {
+    int64_t packed = Pack(key);
+    if (packed < 0 || capacity_ == 0) {
+        return -1;
+    }
+    size_t mask = capacity_ - 1;
+    size_t slot = Hash(packed) & mask;
+    for (size_t probe = 0; probe < capacity_;
+         probe++, slot = (slot + 1) & mask) {
+        int64_t slot_key = keys_[slot].load(std::memory_order_relaxed);
+        if (slot_key == packed) {
+            return addrs_[slot].load(std::memory_order_relaxed);
+        }
+        if (slot_key == kEmptyKey) {
+            return -1;
+        }
+    }
+    return -1;
+}
+
+void SpatialHashTable::Clear() {
+    for (size_t slot = 0; slot < capacity_; slot++) {
+        keys_[slot].store(kEmptyKey, std::memory_order_relaxed);
+        addrs_[slot].store(kPendingAddr, std::memory_order_relaxed);
+    }
+    size_.store(0);
+}
+
+void SpatialHashTable::GetEntries(std::vector<Eigen::Vector3i> &keys,
+                                  std::vector<int> &addrs) const {
+    std::vector<int64_t> packed_keys;
+    std::vector<int> slot_addrs;
+    for (size_t slot = 0; slot < capacity_; slot++) {
+        int64_t packed = keys_[slot].load(std::memory_order_relaxed);
+        int addr = addrs_[slot].load(std::memory_order_relaxed);
+        if (packed != kEmptyKey && addr >= 0) {
+            packed_keys.push_back(packed);
+            slot_addrs.push_back(addr);
+        }
+    }
+    std::vector<size_t> order(packed_keys.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t i0, size_t i1) {
+        return packed_keys[i0] < packed_keys[i1];
+    });
+    keys.resize(order.size());
+    addrs.resize(order.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        keys[i] = Unpack(packed_keys[order[i]]);
+        addrs[i] = slot_addrs[order[i]];
+    }
+}
+
+int64_t SpatialHashTable::Pack(const Eigen::Vector3i &key) {
+    int64_t packed = 0;
+    for (int i = 0; i < 3; i++) {
+        int64_t biased = int64_t(key(i)) + kCoordinateBias;
+        if (biased < 0 || biased > kCoordinateMask) {
+            return -1;
+        }
+        packed = (packed << kCoordinateBits) | biased;
+    }
+    return packed;
+}
+
+Eigen::Vector3i SpatialHashTable::Unpack(int64_t packed) {
+    Eigen::Vector3i key;
+    for (int i = 2; i >= 0; i--) {
+        key(i) = int((packed & kCoordinateMask) - kCoordinateBias);
+        packed >>= kCoordinateBits;
+    }
+    return key;
+}
+
+size_t SpatialHashTable::Hash(int64_t packed) {
+    // Fibonacci hashing spreads neighbouring cells over the whole table
+    uint64_t hash = uint64_t(packed) * 0x9E3779B97F4A7C15ull;
+    return size_t(hash >> 32);
+}
+
+void SpatialHashTable::Allocate(size_t capacity) {
+    capacity_ = capacity;
+    keys_.reset(capacity > 0 ? new std::atomic<int64_t>[capacity] : nullptr);
+    addrs_.reset(capacity > 0 ? new std::atomic<int>[capacity] : nullptr);
+    Clear();
+}
+
+}  // namespace integration
+}  // namespace open3d
@@ -0,0 +1,128 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace open3d {
+namespace integration {
+
+/// Hash table from integer grid coordinates to int addresses, typically into
+/// a MemoryHeap. It is the CPU counterpart of cuda::HashTableCuda, using open
+/// addressing with linear probing in a flat power-of-two array instead of
+/// buckets and linked lists.
+///
+/// Insert() may be called concurrently from many threads; all other
+/// functions require exclusive access. Entries are never removed one by one,
+/// which keeps probing lock-free. Coordinates must lie in [-2^20, 2^20).
+class SpatialHashTable {
+public:
+    SpatialHashTable();
+    SpatialHashTable(const SpatialHashTable &other);
+    SpatialHashTable &operator=(const SpatialHashTable &other);
+    ~SpatialHashTable();
+
+public:
+    /// Grows the table so that \param num_entries entries in total fit
+    /// below half load, so concurrent inserts never need to rehash.
+    void Reserve(size_t num_entries);
+
+    /// Returns the address stored for \param key, creating the entry with
+    /// the address returned by \param allocate if it is missing. Concurrent
+    /// callers inserting the same key agree on one address and only one of
+    /// them calls \param allocate. Returns -1 if \param key is out of range,
+    /// if the allocation fails, or if the table is full.
+    template <typename Allocator>
+    int Insert(const Eigen::Vector3i &key, Allocator allocate) {
+        int64_t packed = Pack(key);
+        if (packed < 0 || capacity_ == 0) {
+            return -1;
+        }
+        size_t mask = capacity_ - 1;
+        size_t slot = Hash(packed) & mask;
+        for (size_t probe = 0; probe < capacity_;
+             probe++, slot = (slot + 1) & mask) {
+            int64_t slot_key = keys_[slot].load(std::memory_order_acquire);
+            if (slot_key == kEmptyKey) {
+                if (keys_[slot].compare_exchange_strong(
+                            slot_key, packed, std::memory_order_acq_rel)) {
+                    int addr = allocate();
+                    addrs_[slot].store(addr, std::memory_order_release);
+                    if (addr >= 0) {
+                        size_.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    return addr;
+                }
+                // another thread claimed the slot, slot_key now holds its key
+            }
+            if (slot_key == packed) {
+                int addr;
+                while ((addr = addrs_[slot].load(std::memory_order_acquire)) ==
+                       kPendingAddr) {
+                }
+                return addr;
+            }
+        }
+        return -1;
+    }
+
+    /// Returns the address stored for \param key, or -1.
+    int Find(const Eigen::Vector3i &key) const;
+
+    /// Removes all entries, keeping the memory.
+    void Clear();
+
+    size_t Size() const { return size_.load(); }
+
+    /// Returns all entries ordered by key, so iterating over them does not
+    /// depend on the insertion order.
+    void GetEntries(std::vector<Eigen::Vector3i> &keys,
+                    std::vector<int> &addrs) const;
+
+private:
+    static const int64_t kEmptyKey = -1;
+    static const int kPendingAddr = -2;
+
+    static int64_t Pack(const Eigen::Vector3i &key);
+    static Eigen::Vector3i Unpack(int64_t packed);
+    static size_t Hash(int64_t packed);
+
+    void Allocate(size_t capacity);
+
+private:
+    size_t capacity_;
+    std::atomic<size_t> size_;
+    std::unique_ptr<std::atomic<int64_t>[]> keys_;
+    std::unique_ptr<std::atomic<int>[]> addrs_;
+};
+
+}  // namespace integration
+}  // namespace open3d
@@ -0,0 +1,324 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <tuple>
+
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/Integration/TSDFVolume.h"
+#include "Open3D/Integration/UniformTSDFVolume.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace open3d {
+namespace integration {
+
+/// Splits \param p_grid, a point in voxel coordinates, into its integer part
+/// \param idx and the remainder \param r. Returns false if the point is too
+/// far away to be indexed.
+inline bool LocateVoxel(const Eigen::Vector3d &p_grid,
+                        Eigen::Vector3i &idx,
+                        Eigen::Vector3d &r) {
+    Eigen::Vector3d floor_grid(std::floor(p_grid(0)), std::floor(p_grid(1)),
+                               std::floor(p_grid(2)));
+    if (!(floor_grid.array().abs() <
+          double(std::numeric_limits<int>::max() / 2))
+                 .all()) {
+        return false;
+    }
+    idx = floor_grid.cast<int>();
+    r = p_grid - floor_grid;
+    return true;
+}
+
+/// Index shift of the i-th of eight voxels that surround a point.
+inline Eigen::Vector3i CornerShift(int i) {
+    return Eigen::Vector3i((i >> 2) & 1, (i >> 1) & 1, i & 1);
+}
+
+/// Trilinear interpolation of the TSDF between the eight \param voxels
+/// around a point at offset \param r from the first voxel, ordered by
+/// CornerShift. If they are not null, \param color receives the
+/// interpolated color and \param gradient the gradient of the interpolated
+/// TSDF in voxel units. Returns false if one of the voxels has not been
+/// observed.
+inline bool InterpolateTSDF(const geometry::TSDFVoxel *const *voxels,
+                            const Eigen::Vector3d &r,
+                            float &tsdf,
+                            Eigen::Vector3d *color,
+                            Eigen::Vector3d *gradient) {
+    const double wx[2] = {1.0 - r(0), r(0)};
+    const double wy[2] = {1.0 - r(1), r(1)};
+    const double wz[2] = {1.0 - r(2), r(2)};
+    double tsdf_sum = 0.0;
+    Eigen::Vector3d color_sum = Eigen::Vector3d::Zero();
+    Eigen::Vector3d gradient_sum = Eigen::Vector3d::Zero();
+    for (int i = 0; i < 8; i++) {
+        if (voxels[i]->weight_ == 0.0f) {
+            return false;
+        }
+        const int x = (i >> 2) & 1, y = (i >> 1) & 1, z = i & 1;
+        const double f = voxels[i]->tsdf_;
+        const double weight = wx[x] * wy[y] * wz[z];
+        tsdf_sum += weight * f;
+        if (color != nullptr) {
+            color_sum += weight * voxels[i]->color_;
+        }
+        if (gradient != nullptr) {
+            gradient_sum(0) += (x ? f : -f) * wy[y] * wz[z];
+            gradient_sum(1) += (y ? f : -f) * wx[x] * wz[z];
+            gradient_sum(2) += (z ? f : -f) * wx[x] * wy[y];
+        }
+    }
+    tsdf = float(tsdf_sum);
+    if (color != nullptr) {
+        *color = color_sum;
+    }
+    if (gradient != nullptr) {
+        *gradient = gradient_sum;
+    }
+    return true;
+}
+
+/// Ray casting shared by the TSDF volumes, as in
+/// R. A. Newcombe et al., KinectFusion: Real-time dense surface mapping and
+/// tracking, ISMAR 2011.
+///
+/// Every pixel marches a ray from the camera and stops at the first zero
+/// crossing of the TSDF from positive to negative. Steps are as long as the
+/// TSDF allows, but at least one voxel. Far from surfaces the steps only
+/// read the voxel that contains the ray point, closer to them they
+/// interpolate the eight voxels around it. The crossing is refined by one
+/// more interpolation, whose gradient gives the normal.
+///
+/// The voxel with index idx spans from volume_origin + idx * voxel_length
+/// to volume_origin + (idx + 1) * voxel_length. The voxels are accessed
+/// through \param sampler, which is copied for every image row and provides
+///
+///     const geometry::TSDFVoxel *GetVoxel(const Eigen::Vector3i &idx);
+///         The voxel idx, or nullptr if it does not exist.
+///
+///     bool GetVoxels(const Eigen::Vector3i &idx,
+///                    const geometry::TSDFVoxel **voxels);
+///         The eight voxels idx + CornerShift(i). Returns false if one of
+///         them does not exist.
+///
+///     double SkipEmptySpace(const Eigen::Vector3d &origin,
+///                           const Eigen::Vector3d &direction,
+///                           double t, double t_max);
+///         The first ray parameter from t on where the ray may reach
+///         existing voxels, or a value beyond t_max if there is none.
+template <class Sampler>
+std::tuple<std::shared_ptr<geometry::RGBDImage>,
+           std::shared_ptr<geometry::Image>>
+RayCastTSDF(const Sampler &sampler,
+            const Eigen::Vector3d &volume_origin,
+            double voxel_length,
+            double sdf_trunc,
+            TSDFVolumeColorType color_type,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            double depth_max,
+            bool convert_rgb_to_intensity) {
+    const int width = intrinsic.width_;
+    const int height = intrinsic.height_;
+    const bool rgb_output = color_type == TSDFVolumeColorType::RGB8 &&
+                            !convert_rgb_to_intensity;
+    auto rgbd = std::make_shared<geometry::RGBDImage>();
+    auto normal_map = std::make_shared<geometry::Image>();
+    rgbd->depth_.Prepare(width, height, 1, 4);
+    if (rgb_output) {
+        rgbd->color_.Prepare(width, height, 3, 1);
+    } else {
+        rgbd->color_.Prepare(width, height, 1, 4);
+    }
+    normal_map->Prepare(width, height, 3, 4);
+    std::fill(rgbd->depth_.data_.begin(), rgbd->depth_.data_.end(), 0);
+    std::fill(rgbd->color_.data_.begin(), rgbd->color_.data_.end(), 0);
+    std::fill(normal_map->data_.begin(), normal_map->data_.end(), 0);
+
+    const double fx = intrinsic.GetFocalLength().first;
+    const double fy = intrinsic.GetFocalLength().second;
+    const double cx = intrinsic.GetPrincipalPoint().first;
+    const double cy = intrinsic.GetPrincipalPoint().second;
+    const Eigen::Matrix3d world_to_camera = extrinsic.block<3, 3>(0, 0);
+    const Eigen::Matrix3d camera_to_world = world_to_camera.transpose();
+    const Eigen::Vector3d origin =
+            -camera_to_world * extrinsic.block<3, 1>(0, 3);
+    const float min_step = float(voxel_length);
+    const float sdf_trunc_f = float(sdf_trunc);
+    // The TSDF is the distance to the surface along the rays of the
+    // integrated frames and may overestimate the distance along a ray cast
+    // from another view. Steps are shortened as in KinectFusion, so that a
+    // ray does not step over a thin structure.
+    const float step_factor = 0.8f * sdf_trunc_f;
+    // nearest voxel reads are off by less than a voxel from interpolation
+    const float far_tsdf = 2.0f * min_step / sdf_trunc_f;
+
+    // Rows differ in cost with the amount of space their rays cross.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int v = 0; v < height; v++) {
+        Sampler row_sampler = sampler;
+        auto interpolate = [&](const Eigen::Vector3d &point, float &tsdf,
+                               Eigen::Vector3d *color,
+                               Eigen::Vector3d *gradient) {
+            Eigen::Vector3i idx;
+            Eigen::Vector3d r;
+            const geometry::TSDFVoxel *voxels[8];
+            return LocateVoxel((point - volume_origin) / voxel_length -
+                                       Eigen::Vector3d::Constant(0.5),
+                               idx, r) &&
+                   row_sampler.GetVoxels(idx, voxels) &&
+                   InterpolateTSDF(voxels, r, tsdf, color, gradient);
+        };
+        for (int u = 0; u < width; u++) {
+            // the ray parameter t is the depth of the ray point
+            Eigen::Vector3d direction =
+                    camera_to_world *
+                    Eigen::Vector3d((u - cx) / fx, (v - cy) / fy, 1.0);
+            const double depth_per_length = 1.0 / direction.norm();
+            double t = 0.0;
+            double t_prev = 0.0;
+            float tsdf_prev = 0.0f;
+            float tsdf = 0.0f;
+            bool has_prev = false;
+            bool hit = false;
+            while (t < depth_max) {
+                double t_skip = row_sampler.SkipEmptySpace(origin, direction,
+                                                           t, depth_max);
+                if (t_skip > t) {
+                    t = t_skip;
+                    has_prev = false;
+                    if (t >= depth_max) {
+                        break;
+                    }
+                }
+                Eigen::Vector3d point = origin + t * direction;
+                Eigen::Vector3i idx;
+                Eigen::Vector3d r;
+                const geometry::TSDFVoxel *voxel =
+                        LocateVoxel((point - volume_origin) / voxel_length,
+                                    idx, r)
+                                ? row_sampler.GetVoxel(idx)
+                                : nullptr;
+                bool valid;
+                if (voxel != nullptr && voxel->weight_ != 0.0f &&
+                    voxel->tsdf_ > far_tsdf) {
+                    tsdf = voxel->tsdf_;
+                    valid = true;
+                } else {
+                    valid = interpolate(point, tsdf, nullptr, nullptr);
+                }
+                if (!valid) {
+                    has_prev = false;
+                    t += min_step * depth_per_length;
+                    continue;
+                }
+                if (tsdf <= 0.0f) {
+                    // a ray that starts behind a surface sees nothing
+                    hit = has_prev;
+                    break;
+                }
+                has_prev = true;
+                t_prev = t;
+                tsdf_prev = tsdf;
+                t += std::max(min_step, tsdf * step_factor) * depth_per_length;
+            }
+            if (!hit) {
+                continue;
+            }
+
+            // The crossing lies between t_prev and t. A linear estimate is
+            // refined once within the side of the bracket that holds it.
+            double t_hit =
+                    t_prev + (t - t_prev) * tsdf_prev / (tsdf_prev - tsdf);
+            float tsdf_hit;
+            if (interpolate(origin + t_hit * direction, tsdf_hit, nullptr,
+                            nullptr) &&
+                tsdf_hit != 0.0f) {
+                if (tsdf_hit > 0.0f) {
+                    t_hit = t_hit + (t - t_hit) * tsdf_hit / (tsdf_hit - tsdf);
+                } else {
+                    t_hit = t_prev + (t_hit - t_prev) * tsdf_prev /
+                                             (tsdf_prev - tsdf_hit);
+                }
+            }
+            *rgbd->depth_.PointerAt<float>(u, v) = float(t_hit);
+
+            // The TSDF gradient points to the free space, towards the camera.
+            // Next to unobserved voxels the samples before and after the
+            // crossing stand in for the surface point.
+            Eigen::Vector3d color, gradient;
+            if (!interpolate(origin + t_hit * direction, tsdf_hit, &color,
+                             &gradient) &&
+                !interpolate(origin + t * direction, tsdf_hit, &color,
+                             &gradient) &&
+                !interpolate(origin + t_prev * direction, tsdf_hit, &color,
+                             &gradient)) {
+                // the previous sample read only the nearest voxel
+                continue;
+            }
+            if (rgb_output) {
+                uint8_t *rgb = rgbd->color_.PointerAt<uint8_t>(u, v, 0);
+                for (int i = 0; i < 3; i++) {
+                    rgb[i] = uint8_t(
+                            std::min(255.0, std::max(0.0, color(i) + 0.5)));
+                }
+            } else if (color_type == TSDFVolumeColorType::RGB8) {
+                *rgbd->color_.PointerAt<float>(u, v) =
+                        float((0.2990 * color(0) + 0.5870 * color(1) +
+                               0.1140 * color(2)) /
+                              255.0);
+            } else if (color_type == TSDFVolumeColorType::Gray32) {
+                *rgbd->color_.PointerAt<float>(u, v) = float(color(0));
+            }
+            if (gradient.squaredNorm() > 0.0) {
+                Eigen::Vector3d normal =
+                        world_to_camera * gradient.normalized();
+                float *n = normal_map->PointerAt<float>(u, v, 0);
+                n[0] = float(normal(0));
+                n[1] = float(normal(1));
+                n[2] = float(normal(2));
+            }
+        }
+    }
+    return std::make_tuple(rgbd, normal_map);
+}
+
+}  // namespace integration
+}  // namespace open3d
@@ -0,0 +1,46 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Integration/TSDFVolume.h"
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace integration {
+
+std::tuple<std::shared_ptr<geometry::RGBDImage>,
+           std::shared_ptr<geometry::Image>>
+TSDFVolume::RayCast(const camera::PinholeCameraIntrinsic &intrinsic,
+                    const Eigen::Matrix4d &extrinsic,
+                    double depth_max /* = 3.0*/,
+                    bool convert_rgb_to_intensity /* = true*/) {
+    utility::LogWarning("[TSDFVolume] RayCast is not supported.\n");
+    return std::make_tuple(std::make_shared<geometry::RGBDImage>(),
+                           std::make_shared<geometry::Image>());
+}
+
+}  // namespace integration
+}  // namespace open3d
@@ -26,6 +26,9 @@
 
 #pragma once
 
+#include <memory>
+#include <tuple>
+
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/RGBDImage.h"
@@ -73,6 +76,25 @@ public:
     /// (https://en.wikipedia.org/wiki/Marching_cubes)
     virtual std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMesh() = 0;
 
+    /// Function to render the surface seen by a camera with \param intrinsic
+    /// and \param extrinsic by ray casting, e.g. as the target frame of
+    /// frame-to-model tracking. Rays are cast in parallel up to
+    /// \param depth_max and skip the space that holds no observed voxels.
+    /// \return an RGBDImage with float depth in meters and the color of the
+    /// volume, and a 3 channel float image of the surface normals in camera
+    /// coordinates. Pixels without a surface have depth 0 and a zero normal.
+    /// If \param convert_rgb_to_intensity is true, RGB8 colors are converted
+    /// to float intensity, so that the image can be passed to
+    /// odometry::ComputeRGBDOdometry. Volumes without color give an intensity
+    /// of 0. The default implementation, for volumes that do not support ray
+    /// casting, warns and returns empty images.
+    virtual std::tuple<std::shared_ptr<geometry::RGBDImage>,
+                       std::shared_ptr<geometry::Image>>
+    RayCast(const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            double depth_max = 3.0,
+            bool convert_rgb_to_intensity = true);
+
 public:
     double voxel_length_;
     double sdf_trunc_;
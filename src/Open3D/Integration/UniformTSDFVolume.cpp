@@ -32,11 +32,86 @@
 
 #include "Open3D/Geometry/VoxelGrid.h"
 #include "Open3D/Integration/MarchingCubesConst.h"
+#include "Open3D/Integration/TSDFRayCast.h"
 #include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/Profiler.h"
 
 namespace open3d {
 namespace integration {
 
+namespace {
+
+/// Voxel access of RayCastTSDF for a UniformTSDFVolume.
+class UniformTSDFSampler {
+public:
+    explicit UniformTSDFSampler(const UniformTSDFVolume &volume)
+        : volume_(volume),
+          // interpolation needs voxels on both sides
+          min_bound_(volume.origin_ +
+                     Eigen::Vector3d::Constant(0.5 * volume.voxel_length_)),
+          max_bound_(volume.origin_ +
+                     Eigen::Vector3d::Constant(volume.length_ -
+                                               0.5 * volume.voxel_length_)) {
+        for (int i = 0; i < 8; i++) {
+            offsets_[i] = volume.IndexOf(CornerShift(i));
+        }
+    }
+
+    const geometry::TSDFVoxel *GetVoxel(const Eigen::Vector3i &idx) const {
+        if (idx.minCoeff() < 0 || idx.maxCoeff() >= volume_.resolution_) {
+            return nullptr;
+        }
+        return &volume_.voxels_[volume_.IndexOf(idx)];
+    }
+
+    bool GetVoxels(const Eigen::Vector3i &idx,
+                   const geometry::TSDFVoxel **voxels) const {
+        if (idx.minCoeff() < 0 || idx.maxCoeff() >= volume_.resolution_ - 1) {
+            return false;
+        }
+        const geometry::TSDFVoxel *base =
+                &volume_.voxels_[volume_.IndexOf(idx)];
+        for (int i = 0; i < 8; i++) {
+            voxels[i] = base + offsets_[i];
+        }
+        return true;
+    }
+
+    /// Clips the ray to the bounding box of the volume.
+    double SkipEmptySpace(const Eigen::Vector3d &origin,
+                          const Eigen::Vector3d &direction,
+                          double t,
+                          double t_max) const {
+        const double no_hit = std::numeric_limits<double>::infinity();
+        if (int(volume_.voxels_.size()) != volume_.voxel_num_) {
+            return no_hit;
+        }
+        double t_near = t;
+        double t_far = t_max;
+        for (int i = 0; i < 3; i++) {
+            if (direction(i) == 0.0) {
+                if (origin(i) < min_bound_(i) || origin(i) > max_bound_(i)) {
+                    return no_hit;
+                }
+                continue;
+            }
+            double t0 = (min_bound_(i) - origin(i)) / direction(i);
+            double t1 = (max_bound_(i) - origin(i)) / direction(i);
+            t_near = std::max(t_near, std::min(t0, t1));
+            t_far = std::min(t_far, std::max(t0, t1));
+        }
+        return t_near <= t_far ? t_near : no_hit;
+    }
+
+private:
+    const UniformTSDFVolume &volume_;
+    Eigen::Vector3d min_bound_;
+    Eigen::Vector3d max_bound_;
+    int offsets_[8];
+};
+
+}  // unnamed namespace
+
 UniformTSDFVolume::UniformTSDFVolume(
         double length,
         int resolution,
@@ -59,6 +134,7 @@ void UniformTSDFVolume::Integrate(
         const geometry::RGBDImage &image,
         const camera::PinholeCameraIntrinsic &intrinsic,
         const Eigen::Matrix4d &extrinsic) {
+    OPEN3D_PROFILE_SCOPE("UniformTSDFVolume::Integrate");
     // This function goes through the voxels, and scan convert the relative
     // depth/color value into the voxel.
     // The following implementation is a highly optimized version.
@@ -90,6 +166,7 @@ void UniformTSDFVolume::Integrate(
 }
 
 std::shared_ptr<geometry::PointCloud> UniformTSDFVolume::ExtractPointCloud() {
+    OPEN3D_PROFILE_SCOPE("UniformTSDFVolume::ExtractPointCloud");
     auto pointcloud = std::make_shared<geometry::PointCloud>();
     double half_voxel_length = voxel_length_ * 0.5;
     for (int x = 1; x < resolution_ - 1; x++) {
@@ -147,6 +224,7 @@ std::shared_ptr<geometry::PointCloud> UniformTSDFVolume::ExtractPointCloud() {
 
 std::shared_ptr<geometry::TriangleMesh>
 UniformTSDFVolume::ExtractTriangleMesh() {
+    OPEN3D_PROFILE_SCOPE("UniformTSDFVolume::ExtractTriangleMesh");
     // implementation of marching cubes, based on
     // http://paulbourke.net/geometry/polygonise/
     auto mesh = std::make_shared<geometry::TriangleMesh>();
@@ -231,6 +309,18 @@ UniformTSDFVolume::ExtractTriangleMesh() {
     return mesh;
 }
 
+std::tuple<std::shared_ptr<geometry::RGBDImage>,
+           std::shared_ptr<geometry::Image>>
+UniformTSDFVolume::RayCast(const camera::PinholeCameraIntrinsic &intrinsic,
+                           const Eigen::Matrix4d &extrinsic,
+                           double depth_max /* = 3.0*/,
+                           bool convert_rgb_to_intensity /* = true*/) {
+    OPEN3D_PROFILE_SCOPE("UniformTSDFVolume::RayCast");
+    return RayCastTSDF(UniformTSDFSampler(*this), origin_, voxel_length_,
+                       sdf_trunc_, color_type_, intrinsic, extrinsic, depth_max,
+                       convert_rgb_to_intensity);
+}
+
 std::shared_ptr<geometry::PointCloud>
 UniformTSDFVolume::ExtractVoxelPointCloud() const {
     auto voxel = std::make_shared<geometry::PointCloud>();
@@ -287,14 +377,30 @@ void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
         const camera::PinholeCameraIntrinsic &intrinsic,
         const Eigen::Matrix4d &extrinsic,
         const geometry::Image &depth_to_camera_distance_multiplier) {
+    IntegrateVoxelBlock(voxels_.data(), resolution_, origin_, voxel_length_,
+                        sdf_trunc_, color_type_, image, intrinsic, extrinsic,
+                        depth_to_camera_distance_multiplier);
+}
+
+void UniformTSDFVolume::IntegrateVoxelBlock(
+        geometry::TSDFVoxel *voxels,
+        int resolution,
+        const Eigen::Vector3d &origin,
+        double voxel_length,
+        double sdf_trunc,
+        TSDFVolumeColorType color_type,
+        const geometry::RGBDImage &image,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        const geometry::Image &depth_to_camera_distance_multiplier) {
     const float fx = static_cast<float>(intrinsic.GetFocalLength().first);
     const float fy = static_cast<float>(intrinsic.GetFocalLength().second);
     const float cx = static_cast<float>(intrinsic.GetPrincipalPoint().first);
     const float cy = static_cast<float>(intrinsic.GetPrincipalPoint().second);
     const Eigen::Matrix4f extrinsic_f = extrinsic.cast<float>();
-    const float voxel_length_f = static_cast<float>(voxel_length_);
+    const float voxel_length_f = static_cast<float>(voxel_length);
     const float half_voxel_length_f = voxel_length_f * 0.5f;
-    const float sdf_trunc_f = static_cast<float>(sdf_trunc_);
+    const float sdf_trunc_f = static_cast<float>(sdf_trunc);
     const float sdf_trunc_inv_f = 1.0f / sdf_trunc_f;
     const Eigen::Matrix4f extrinsic_scaled_f = extrinsic_f * voxel_length_f;
     const float safe_width_f = intrinsic.width_ - 0.0001f;
@@ -303,16 +409,16 @@ void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-    for (int x = 0; x < resolution_; x++) {
-        for (int y = 0; y < resolution_; y++) {
+    for (int x = 0; x < resolution; x++) {
+        for (int y = 0; y < resolution; y++) {
             Eigen::Vector4f pt_3d_homo(float(half_voxel_length_f +
-                                             voxel_length_f * x + origin_(0)),
+                                             voxel_length_f * x + origin(0)),
                                        float(half_voxel_length_f +
-                                             voxel_length_f * y + origin_(1)),
-                                       float(half_voxel_length_f + origin_(2)),
+                                             voxel_length_f * y + origin(1)),
+                                       float(half_voxel_length_f + origin(2)),
                                        1.f);
             Eigen::Vector4f pt_camera = extrinsic_f * pt_3d_homo;
-            for (int z = 0; z < resolution_; z++,
+            for (int z = 0; z < resolution; z++,
                      pt_camera(0) += extrinsic_scaled_f(0, 2),
                      pt_camera(1) += extrinsic_scaled_f(1, 2),
                      pt_camera(2) += extrinsic_scaled_f(2, 2)) {
@@ -335,7 +441,7 @@ void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
                     continue;
                 }
 
-                int v_ind = IndexOf(x, y, z);
+                int v_ind = (x * resolution + y) * resolution + z;
                 float sdf =
                         (d - pt_camera(2)) *
                         (*depth_to_camera_distance_multiplier.PointerAt<float>(
@@ -343,29 +449,29 @@ void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
                 if (sdf > -sdf_trunc_f) {
                     // integrate
                     float tsdf = std::min(1.0f, sdf * sdf_trunc_inv_f);
-                    voxels_[v_ind].tsdf_ =
-                            (voxels_[v_ind].tsdf_ * voxels_[v_ind].weight_ +
+                    voxels[v_ind].tsdf_ =
+                            (voxels[v_ind].tsdf_ * voxels[v_ind].weight_ +
                              tsdf) /
-                            (voxels_[v_ind].weight_ + 1.0f);
-                    if (color_type_ == TSDFVolumeColorType::RGB8) {
+                            (voxels[v_ind].weight_ + 1.0f);
+                    if (color_type == TSDFVolumeColorType::RGB8) {
                         const uint8_t *rgb =
                                 image.color_.PointerAt<uint8_t>(u, v, 0);
                         Eigen::Vector3d rgb_f(rgb[0], rgb[1], rgb[2]);
-                        voxels_[v_ind].color_ =
-                                (voxels_[v_ind].color_ *
-                                         voxels_[v_ind].weight_ +
+                        voxels[v_ind].color_ =
+                                (voxels[v_ind].color_ *
+                                         voxels[v_ind].weight_ +
                                  rgb_f) /
-                                (voxels_[v_ind].weight_ + 1.0f);
-                    } else if (color_type_ == TSDFVolumeColorType::Gray32) {
+                                (voxels[v_ind].weight_ + 1.0f);
+                    } else if (color_type == TSDFVolumeColorType::Gray32) {
                         const float *intensity =
                                 image.color_.PointerAt<float>(u, v, 0);
-                        voxels_[v_ind].color_ =
-                                (voxels_[v_ind].color_.array() *
-                                         voxels_[v_ind].weight_ +
+                        voxels[v_ind].color_ =
+                                (voxels[v_ind].color_.array() *
+                                         voxels[v_ind].weight_ +
                                  (*intensity)) /
-                                (voxels_[v_ind].weight_ + 1.0f);
+                                (voxels[v_ind].weight_ + 1.0f);
                     }
-                    voxels_[v_ind].weight_ += 1.0f;
+                    voxels[v_ind].weight_ += 1.0f;
                 }
             }
         }
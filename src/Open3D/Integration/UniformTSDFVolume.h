@@ -66,6 +66,12 @@ public:
                    const Eigen::Matrix4d &extrinsic) override;
     std::shared_ptr<geometry::PointCloud> ExtractPointCloud() override;
     std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMesh() override;
+    std::tuple<std::shared_ptr<geometry::RGBDImage>,
+               std::shared_ptr<geometry::Image>>
+    RayCast(const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            double depth_max = 3.0,
+            bool convert_rgb_to_intensity = true) override;
 
     /// Debug function to extract the voxel data into a VoxelGrid
     std::shared_ptr<geometry::PointCloud> ExtractVoxelPointCloud() const;
@@ -79,6 +85,22 @@ public:
             const Eigen::Matrix4d &extrinsic,
             const geometry::Image &depth_to_camera_distance_multiplier);
 
+    /// Integrates an RGB-D image into \param voxels, a block of
+    /// \param resolution ^ 3 voxels laid out like IndexOf() whose first voxel
+    /// starts at \param origin. Shared with the pooled volume units of
+    /// ScalableTSDFVolume.
+    static void IntegrateVoxelBlock(
+            geometry::TSDFVoxel *voxels,
+            int resolution,
+            const Eigen::Vector3d &origin,
+            double voxel_length,
+            double sdf_trunc,
+            TSDFVolumeColorType color_type,
+            const geometry::RGBDImage &image,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            const geometry::Image &depth_to_camera_distance_multiplier);
+
     inline int IndexOf(int x, int y, int z) const {
         return x * resolution_ * resolution_ + y * resolution_ + z;
     }
@@ -32,6 +32,7 @@
 #include "Open3D/Geometry/RGBDImage.h"
 #include "Open3D/Odometry/RGBDOdometryJacobian.h"
 #include "Open3D/Utility/Eigen.h"
+#include "Open3D/Utility/Profiler.h"
 #include "Open3D/Utility/Timer.h"
 
 namespace open3d {
@@ -410,9 +411,11 @@ std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
         const Eigen::Matrix4d &extrinsic_initial,
         const RGBDOdometryJacobian &jacobian_method,
         const OdometryOption &option) {
+    OPEN3D_PROFILE_SCOPE("DoSingleIteration");
     auto correspondence = ComputeCorrespondence(
             intrinsic, extrinsic_initial, source.depth_, target.depth_, option);
     int corresps_count = (int)correspondence->size();
+    OPEN3D_PROFILE_COUNTER("Odometry correspondences", corresps_count);
 
     auto f_lambda =
             [&](int i,
@@ -443,6 +446,20 @@ std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
     }
 }
 
+/// Image pyramids of ComputeMultiscale, kept per thread across calls so that
+/// the odometry of a stream of frames reuses their level images.
+struct MultiscalePyramids {
+    geometry::RGBDImagePyramid source_;
+    geometry::RGBDImagePyramid target_;
+    geometry::RGBDImagePyramid target_dx_;
+    geometry::RGBDImagePyramid target_dy_;
+};
+
+MultiscalePyramids &ThreadMultiscalePyramids() {
+    static thread_local MultiscalePyramids pyramids;
+    return pyramids;
+}
+
 std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
         const geometry::RGBDImage &source,
         const geometry::RGBDImage &target,
@@ -453,12 +470,19 @@ std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
     std::vector<int> iter_counts = option.iteration_number_per_pyramid_level_;
     int num_levels = (int)iter_counts.size();
 
-    auto source_pyramid = source.CreatePyramid(num_levels);
-    auto target_pyramid = target.CreatePyramid(num_levels);
-    auto target_pyramid_dx = geometry::RGBDImage::FilterPyramid(
-            target_pyramid, geometry::Image::FilterType::Sobel3Dx);
-    auto target_pyramid_dy = geometry::RGBDImage::FilterPyramid(
-            target_pyramid, geometry::Image::FilterType::Sobel3Dy);
+    MultiscalePyramids &pyramids = ThreadMultiscalePyramids();
+    source.CreatePyramid(num_levels, true, false, pyramids.source_);
+    target.CreatePyramid(num_levels, true, false, pyramids.target_);
+    geometry::RGBDImage::FilterPyramid(pyramids.target_,
+                                       geometry::Image::FilterType::Sobel3Dx,
+                                       pyramids.target_dx_);
+    geometry::RGBDImage::FilterPyramid(pyramids.target_,
+                                       geometry::Image::FilterType::Sobel3Dy,
+                                       pyramids.target_dy_);
+    const geometry::RGBDImagePyramid &source_pyramid = pyramids.source_;
+    const geometry::RGBDImagePyramid &target_pyramid = pyramids.target_;
+    const geometry::RGBDImagePyramid &target_pyramid_dx = pyramids.target_dx_;
+    const geometry::RGBDImagePyramid &target_pyramid_dy = pyramids.target_dy_;
 
     Eigen::Matrix4d result_odo = extrinsic_initial.isZero()
                                          ? Eigen::Matrix4d::Identity()
@@ -514,6 +538,7 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
         const RGBDOdometryJacobian &jacobian_method
         /*=RGBDOdometryJacobianFromHybridTerm*/,
         const OdometryOption &option /*= OdometryOption()*/) {
+    OPEN3D_PROFILE_SCOPE("ComputeRGBDOdometry");
     if (!CheckRGBDImagePair(source, target)) {
         utility::LogWarning(
                 "[RGBDOdometry] Two RGBD pairs should be same in size.\n");
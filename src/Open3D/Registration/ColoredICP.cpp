@@ -27,76 +27,44 @@
 #include "Open3D/Registration/ColoredICP.h"
 
 #include <Eigen/Dense>
-#include <iostream>
 
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/KDTreeSearchParam.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Eigen.h"
+#include "Open3D/Utility/Profiler.h"
 
 namespace open3d {
 
 namespace {
 using namespace registration;
 
-class PointCloudForColoredICP : public geometry::PointCloud {
-public:
-    std::vector<Eigen::Vector3d> color_gradient_;
-};
-
-class TransformationEstimationForColoredICP : public TransformationEstimation {
-public:
-    TransformationEstimationType GetTransformationEstimationType()
-            const override {
-        return type_;
-    };
-    TransformationEstimationForColoredICP(double lambda_geometric = 0.968)
-        : lambda_geometric_(lambda_geometric) {
-        if (lambda_geometric_ < 0 || lambda_geometric_ > 1.0)
-            lambda_geometric_ = 0.968;
-    }
-    ~TransformationEstimationForColoredICP() override {}
-
-public:
-    double ComputeRMSE(const geometry::PointCloud &source,
-                       const geometry::PointCloud &target,
-                       const CorrespondenceSet &corres) const override;
-    Eigen::Matrix4d ComputeTransformation(
-            const geometry::PointCloud &source,
-            const geometry::PointCloud &target,
-            const CorrespondenceSet &corres) const override;
-
-public:
-    double lambda_geometric_;
-
-private:
-    const TransformationEstimationType type_ =
-            TransformationEstimationType::ColoredICP;
-};
+double Intensity(const Eigen::Vector3d &color) {
+    return (color(0) + color(1) + color(2)) / 3.0;
+}
 
-std::shared_ptr<PointCloudForColoredICP> InitializePointCloudForColoredICP(
+std::vector<Eigen::Vector3d> ComputeColorGradients(
         const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &tree,
         const geometry::KDTreeSearchParamHybrid &search_param) {
-    utility::LogDebug("InitializePointCloudForColoredICP\n");
-
-    geometry::KDTreeFlann tree;
-    tree.SetGeometry(target);
-
-    auto output = std::make_shared<PointCloudForColoredICP>();
-    output->colors_ = target.colors_;
-    output->normals_ = target.normals_;
-    output->points_ = target.points_;
-
-    size_t n_points = output->points_.size();
-    output->color_gradient_.resize(n_points, Eigen::Vector3d::Zero());
+    OPEN3D_PROFILE_SCOPE("ComputeColorGradients");
+    utility::LogDebug("ComputeColorGradients\n");
+
+    int n_points = (int)target.points_.size();
+    std::vector<Eigen::Vector3d> color_gradient(n_points,
+                                                Eigen::Vector3d::Zero());
+    if (!target.HasNormals() || !target.HasColors()) {
+        return color_gradient;
+    }
 
-    for (size_t k = 0; k < n_points; k++) {
-        const Eigen::Vector3d &vt = output->points_[k];
-        const Eigen::Vector3d &nt = output->normals_[k];
-        double it = (output->colors_[k](0) + output->colors_[k](1) +
-                     output->colors_[k](2)) /
-                    3.0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int k = 0; k < n_points; k++) {
+        const Eigen::Vector3d &vt = target.points_[k];
+        const Eigen::Vector3d &nt = target.normals_[k];
+        double it = Intensity(target.colors_[k]);
 
         std::vector<int> point_idx;
         std::vector<double> point_squared_distance;
@@ -111,12 +79,9 @@ std::shared_ptr<PointCloudForColoredICP> InitializePointCloudForColoredICP(
             b.setZero();
             for (size_t i = 1; i < nn; i++) {
                 int P_adj_idx = point_idx[i];
-                Eigen::Vector3d vt_adj = output->points_[P_adj_idx];
+                Eigen::Vector3d vt_adj = target.points_[P_adj_idx];
                 Eigen::Vector3d vt_proj = vt_adj - (vt_adj - vt).dot(nt) * nt;
-                double it_adj = (output->colors_[P_adj_idx](0) +
-                                 output->colors_[P_adj_idx](1) +
-                                 output->colors_[P_adj_idx](2)) /
-                                3.0;
+                double it_adj = Intensity(target.colors_[P_adj_idx]);
                 A(i - 1, 0) = (vt_proj(0) - vt(0));
                 A(i - 1, 1) = (vt_proj(1) - vt(1));
                 A(i - 1, 2) = (vt_proj(2) - vt(2));
@@ -133,133 +98,218 @@ std::shared_ptr<PointCloudForColoredICP> InitializePointCloudForColoredICP(
             std::tie(is_success, x) = utility::SolveLinearSystemPSD(
                     A.transpose() * A, A.transpose() * b);
             if (is_success) {
-                output->color_gradient_[k] = x;
+                color_gradient[k] = x;
             }
         }
     }
-    return output;
+    return color_gradient;
 }
 
-Eigen::Matrix4d TransformationEstimationForColoredICP::ComputeTransformation(
-        const geometry::PointCloud &source,
-        const geometry::PointCloud &target,
-        const CorrespondenceSet &corres) const {
-    if (corres.empty() || target.HasNormals() == false ||
-        target.HasColors() == false || source.HasColors() == false)
-        return Eigen::Matrix4d::Identity();
-
-    double sqrt_lambda_geometric = sqrt(lambda_geometric_);
-    double lambda_photometric = 1.0 - lambda_geometric_;
-    double sqrt_lambda_photometric = sqrt(lambda_photometric);
-
-    const auto &target_c = (const PointCloudForColoredICP &)target;
-
-    auto compute_jacobian_and_residual =
-            [&](int i,
-                std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
-                std::vector<double> &r) {
-                size_t cs = corres[i][0];
-                size_t ct = corres[i][1];
-                const Eigen::Vector3d &vs = source.points_[cs];
-                const Eigen::Vector3d &vt = target.points_[ct];
-                const Eigen::Vector3d &nt = target.normals_[ct];
-
-                J_r.resize(2);
-                r.resize(2);
-
-                J_r[0].block<3, 1>(0, 0) = sqrt_lambda_geometric * vs.cross(nt);
-                J_r[0].block<3, 1>(3, 0) = sqrt_lambda_geometric * nt;
-                r[0] = sqrt_lambda_geometric * (vs - vt).dot(nt);
-
-                // project vs into vt's tangential plane
-                Eigen::Vector3d vs_proj = vs - (vs - vt).dot(nt) * nt;
-                double is = (source.colors_[cs](0) + source.colors_[cs](1) +
-                             source.colors_[cs](2)) /
-                            3.0;
-                double it = (target.colors_[ct](0) + target.colors_[ct](1) +
-                             target.colors_[ct](2)) /
-                            3.0;
-                const Eigen::Vector3d &dit = target_c.color_gradient_[ct];
-                double is0_proj = (dit.dot(vs_proj - vt)) + it;
-
-                const Eigen::Matrix3d M =
-                        (Eigen::Matrix3d() << 1.0 - nt(0) * nt(0),
-                         -nt(0) * nt(1), -nt(0) * nt(2), -nt(0) * nt(1),
-                         1.0 - nt(1) * nt(1), -nt(1) * nt(2), -nt(0) * nt(2),
-                         -nt(1) * nt(2), 1.0 - nt(2) * nt(2))
-                                .finished();
-
-                const Eigen::Vector3d &ditM = -dit.transpose() * M;
-                J_r[1].block<3, 1>(0, 0) =
-                        sqrt_lambda_photometric * vs.cross(ditM);
-                J_r[1].block<3, 1>(3, 0) = sqrt_lambda_photometric * ditM;
-                r[1] = sqrt_lambda_photometric * (is - is0_proj);
-            };
-
-    Eigen::Matrix6d JTJ;
-    Eigen::Vector6d JTr;
-    double r2;
-    std::tie(JTJ, JTr, r2) =
-            utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
-                    compute_jacobian_and_residual, (int)corres.size());
-
-    bool is_success;
-    Eigen::Matrix4d extrinsic;
-    std::tie(is_success, extrinsic) =
-            utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ, JTr);
-
-    return is_success ? extrinsic : Eigen::Matrix4d::Identity();
-}
-
-double TransformationEstimationForColoredICP::ComputeRMSE(
-        const geometry::PointCloud &source,
-        const geometry::PointCloud &target,
-        const CorrespondenceSet &corres) const {
-    double sqrt_lambda_geometric = sqrt(lambda_geometric_);
-    double lambda_photometric = 1.0 - lambda_geometric_;
-    double sqrt_lambda_photometric = sqrt(lambda_photometric);
-    const auto &target_c = (const PointCloudForColoredICP &)target;
-
-    double residual = 0.0;
-    for (size_t i = 0; i < corres.size(); i++) {
-        size_t cs = corres[i][0];
-        size_t ct = corres[i][1];
-        const Eigen::Vector3d &vs = source.points_[cs];
-        const Eigen::Vector3d &vt = target.points_[ct];
-        const Eigen::Vector3d &nt = target.normals_[ct];
-        Eigen::Vector3d vs_proj = vs - (vs - vt).dot(nt) * nt;
-        double is = (source.colors_[cs](0) + source.colors_[cs](1) +
-                     source.colors_[cs](2)) /
-                    3.0;
-        double it = (target.colors_[ct](0) + target.colors_[ct](1) +
-                     target.colors_[ct](2)) /
-                    3.0;
-        const Eigen::Vector3d &dit = target_c.color_gradient_[ct];
-        double is0_proj = (dit.dot(vs_proj - vt)) + it;
-        double residual_geometric = sqrt_lambda_geometric * (vs - vt).dot(nt);
-        double residual_photometric = sqrt_lambda_photometric * (is - is0_proj);
-        residual += residual_geometric * residual_geometric +
-                    residual_photometric * residual_photometric;
+/// One Gauss-Newton pass of colored ICP at \param transformation. Every
+/// source point is transformed on the fly and matched to its nearest target
+/// point. Its geometric and photometric residuals are reweighted by
+/// \param kernel and accumulated into \param JTJ and \param JTr with
+/// per-thread sums. The match of every source point, or -1, is stored in
+/// \param target_indices.
+RegistrationResult ComputeColoredICPStep(const geometry::PointCloud &source,
+                                         const ColoredICPTarget &target,
+                                         double max_distance,
+                                         const Eigen::Matrix4d &transformation,
+                                         double lambda_geometric,
+                                         const RobustKernel &kernel,
+                                         Eigen::Matrix6d &JTJ,
+                                         Eigen::Vector6d &JTr,
+                                         std::vector<int> &target_indices) {
+    RegistrationResult result(transformation);
+    const geometry::PointCloud &target_cloud = *target.point_cloud_;
+    const int num_points = (int)source.points_.size();
+    const Eigen::Matrix3d rotation = transformation.block<3, 3>(0, 0);
+    const Eigen::Vector3d translation = transformation.block<3, 1>(0, 3);
+    const double sqrt_lambda_geometric = std::sqrt(lambda_geometric);
+    const double sqrt_lambda_photometric = std::sqrt(1.0 - lambda_geometric);
+    target_indices.resize(num_points);
+    JTJ.setZero();
+    JTr.setZero();
+    double error2 = 0.0;
+    int corres_number = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        Eigen::Matrix6d JTJ_private = Eigen::Matrix6d::Zero();
+        Eigen::Vector6d JTr_private = Eigen::Vector6d::Zero();
+        double error2_private = 0.0;
+        int corres_number_private = 0;
+        std::vector<int> indices(1);
+        std::vector<double> dists(1);
+#ifdef _OPENMP
+#pragma omp for nowait
+#endif
+        for (int i = 0; i < num_points; i++) {
+            const Eigen::Vector3d vs =
+                    rotation * source.points_[i] + translation;
+            if (target.kdtree_->SearchHybrid(vs, max_distance, 1, indices,
+                                             dists) <= 0) {
+                target_indices[i] = -1;
+                continue;
+            }
+            const int ct = indices[0];
+            const Eigen::Vector3d &vt = target_cloud.points_[ct];
+            const Eigen::Vector3d &nt = target_cloud.normals_[ct];
+            const Eigen::Vector3d &dit = target.color_gradient_[ct];
+
+            Eigen::Vector6d J_geometric;
+            J_geometric.block<3, 1>(0, 0) =
+                    sqrt_lambda_geometric * vs.cross(nt);
+            J_geometric.block<3, 1>(3, 0) = sqrt_lambda_geometric * nt;
+            double r_geometric = sqrt_lambda_geometric * (vs - vt).dot(nt);
+
+            // project vs into vt's tangential plane
+            Eigen::Vector3d vs_proj = vs - (vs - vt).dot(nt) * nt;
+            double is = Intensity(source.colors_[i]);
+            double it = Intensity(target_cloud.colors_[ct]);
+            double is0_proj = dit.dot(vs_proj - vt) + it;
+            const Eigen::Matrix3d M =
+                    Eigen::Matrix3d::Identity() - nt * nt.transpose();
+            const Eigen::Vector3d ditM = -(M * dit);
+            Eigen::Vector6d J_photometric;
+            J_photometric.block<3, 1>(0, 0) =
+                    sqrt_lambda_photometric * vs.cross(ditM);
+            J_photometric.block<3, 1>(3, 0) = sqrt_lambda_photometric * ditM;
+            double r_photometric = sqrt_lambda_photometric * (is - is0_proj);
+
+            double w_geometric = kernel.Weight(r_geometric);
+            double w_photometric = kernel.Weight(r_photometric);
+            JTJ_private.noalias() +=
+                    w_geometric * J_geometric * J_geometric.transpose() +
+                    w_photometric * J_photometric * J_photometric.transpose();
+            JTr_private.noalias() +=
+                    w_geometric * r_geometric * J_geometric +
+                    w_photometric * r_photometric * J_photometric;
+            error2_private += dists[0];
+            corres_number_private++;
+            target_indices[i] = ct;
+        }
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        {
+            JTJ += JTJ_private;
+            JTr += JTr_private;
+            error2 += error2_private;
+            corres_number += corres_number_private;
+        }
+#ifdef _OPENMP
     }
-    return residual;
-};
+#endif
+
+    if (corres_number == 0) {
+        result.fitness_ = 0.0;
+        result.inlier_rmse_ = 0.0;
+    } else {
+        result.fitness_ = (double)corres_number / (double)num_points;
+        result.inlier_rmse_ = std::sqrt(error2 / (double)corres_number);
+    }
+    return result;
+}
 
 }  // unnamed namespace
 
 namespace registration {
 
+ColoredICPTarget::ColoredICPTarget(
+        const geometry::PointCloud &target,
+        const geometry::KDTreeSearchParamHybrid &search_param)
+    : ColoredICPTarget(std::make_shared<geometry::PointCloud>(target),
+                       std::make_shared<geometry::KDTreeFlann>(target),
+                       search_param) {}
+
+ColoredICPTarget::ColoredICPTarget(
+        std::shared_ptr<const geometry::PointCloud> target,
+        std::shared_ptr<const geometry::KDTreeFlann> target_kdtree,
+        const geometry::KDTreeSearchParamHybrid &search_param)
+    : point_cloud_(target), kdtree_(target_kdtree) {
+    color_gradient_ = ComputeColorGradients(*point_cloud_, *kdtree_,
+                                            search_param);
+}
+
 RegistrationResult RegistrationColoredICP(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         double max_distance,
         const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
         const ICPConvergenceCriteria &criteria /* = ICPConvergenceCriteria()*/,
-        double lambda_geometric /* = 0.968*/) {
-    auto target_c = InitializePointCloudForColoredICP(
+        double lambda_geometric /* = 0.968*/,
+        const RobustKernel &kernel /* = L2Loss()*/) {
+    ColoredICPTarget target_c(
             target, geometry::KDTreeSearchParamHybrid(max_distance * 2.0, 30));
-    return RegistrationICP(
-            source, *target_c, max_distance, init,
-            TransformationEstimationForColoredICP(lambda_geometric), criteria);
+    return RegistrationColoredICP(source, target_c, max_distance, init,
+                                  criteria, lambda_geometric, kernel);
+}
+
+RegistrationResult RegistrationColoredICP(
+        const geometry::PointCloud &source,
+        const ColoredICPTarget &target,
+        double max_distance,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const ICPConvergenceCriteria &criteria /* = ICPConvergenceCriteria()*/,
+        double lambda_geometric /* = 0.968*/,
+        const RobustKernel &kernel /* = L2Loss()*/) {
+    OPEN3D_PROFILE_SCOPE("RegistrationColoredICP");
+    if (max_distance <= 0.0) {
+        utility::LogWarning("Invalid max_correspondence_distance.\n");
+        return RegistrationResult(init);
+    }
+    const geometry::PointCloud &target_cloud = *target.point_cloud_;
+    if (!source.HasColors() || !target_cloud.HasColors() ||
+        !target_cloud.HasNormals()) {
+        utility::LogWarning(
+                "RegistrationColoredICP requires colors and target normal "
+                "vectors.\n");
+        return EvaluateRegistration(source, target_cloud, max_distance, init);
+    }
+    if (lambda_geometric < 0.0 || lambda_geometric > 1.0) {
+        lambda_geometric = 0.968;
+    }
+
+    Eigen::Matrix4d transformation = init;
+    Eigen::Matrix6d JTJ;
+    Eigen::Vector6d JTr;
+    std::vector<int> target_indices;
+    RegistrationResult result = ComputeColoredICPStep(
+            source, target, max_distance, transformation, lambda_geometric,
+            kernel, JTJ, JTr, target_indices);
+    for (int i = 0; i < criteria.max_iteration_; i++) {
+        utility::LogDebug("ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}\n",
+                          i, result.fitness_, result.inlier_rmse_);
+        OPEN3D_PROFILE_COUNTER("RegistrationICP fitness", result.fitness_);
+        if (result.fitness_ > 0.0) {
+            bool is_success;
+            Eigen::Matrix4d update;
+            std::tie(is_success, update) =
+                    utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ,
+                                                                         JTr);
+            transformation = update * transformation;
+        }
+        RegistrationResult backup = result;
+        result = ComputeColoredICPStep(source, target, max_distance,
+                                       transformation, lambda_geometric,
+                                       kernel, JTJ, JTr, target_indices);
+        if (std::abs(backup.fitness_ - result.fitness_) <
+                    criteria.relative_fitness_ &&
+            std::abs(backup.inlier_rmse_ - result.inlier_rmse_) <
+                    criteria.relative_rmse_) {
+            break;
+        }
+    }
+    for (int i = 0; i < (int)target_indices.size(); i++) {
+        if (target_indices[i] >= 0) {
+            result.correspondence_set_.push_back(
+                    Eigen::Vector2i(i, target_indices[i]));
+        }
+    }
+    return result;
 }
 
 }  // namespace registration
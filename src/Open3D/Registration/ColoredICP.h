@@ -27,29 +27,66 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <memory>
+#include <vector>
 
+#include "Open3D/Geometry/KDTreeSearchParam.h"
 #include "Open3D/Registration/Registration.h"
+#include "Open3D/Registration/RobustKernel.h"
 
 namespace open3d {
 
 namespace geometry {
+class KDTreeFlann;
 class PointCloud;
 }
 
 namespace registration {
 class RegistrationResult;
 
+/// Target of RegistrationColoredICP with its KD-tree and the per-point color
+/// gradients, prepared once for repeated registrations to the same target.
+class ColoredICPTarget {
+public:
+    /// Copies \param target, which needs normals and colors, and fits the
+    /// color gradients over neighbourhoods of \param search_param.
+    ColoredICPTarget(const geometry::PointCloud &target,
+                     const geometry::KDTreeSearchParamHybrid &search_param);
+    /// Shares \param target and the \param target_kdtree built on it.
+    ColoredICPTarget(std::shared_ptr<const geometry::PointCloud> target,
+                     std::shared_ptr<const geometry::KDTreeFlann> target_kdtree,
+                     const geometry::KDTreeSearchParamHybrid &search_param);
+
+public:
+    std::shared_ptr<const geometry::PointCloud> point_cloud_;
+    std::shared_ptr<const geometry::KDTreeFlann> kdtree_;
+    std::vector<Eigen::Vector3d> color_gradient_;
+};
+
 /// Function to align colored point clouds
 /// This is implementation of following paper
 /// J. Park, Q.-Y. Zhou, V. Koltun,
 /// Colored Point Cloud Registration Revisited, ICCV 2017
+/// The geometric and photometric residuals are reweighted by \param kernel
+/// in every Gauss-Newton step.
 RegistrationResult RegistrationColoredICP(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         double max_distance,
         const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
         const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria(),
-        double lambda_geometric = 0.968);
+        double lambda_geometric = 0.968,
+        const RobustKernel &kernel = L2Loss());
+
+/// Function to align colored point clouds against a prepared \param target
+RegistrationResult RegistrationColoredICP(
+        const geometry::PointCloud &source,
+        const ColoredICPTarget &target,
+        double max_distance,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria(),
+        double lambda_geometric = 0.968,
+        const RobustKernel &kernel = L2Loss());
 
 }  // namespace registration
 }  // namespace open3d
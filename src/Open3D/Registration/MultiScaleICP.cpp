@@ -0,0 +1,144 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/MultiScaleICP.h"
+
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/KDTreeSearchParam.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Profiler.h"
+
+namespace open3d {
+namespace registration {
+
+PointCloudPyramid::PointCloudPyramid(
+        const geometry::PointCloud &cloud,
+        const std::vector<double> &voxel_sizes,
+        bool with_color_gradients /* = false*/)
+    : PointCloudPyramid(cloud, voxel_sizes, with_color_gradients, true) {}
+
+std::shared_ptr<PointCloudPyramid> PointCloudPyramid::CreateSource(
+        const geometry::PointCloud &cloud,
+        const std::vector<double> &voxel_sizes) {
+    return std::shared_ptr<PointCloudPyramid>(
+            new PointCloudPyramid(cloud, voxel_sizes, false, false));
+}
+
+PointCloudPyramid::PointCloudPyramid(const geometry::PointCloud &cloud,
+                                     const std::vector<double> &voxel_sizes,
+                                     bool with_color_gradients,
+                                     bool is_target)
+    : is_target_(is_target), voxel_sizes_(voxel_sizes) {
+    OPEN3D_PROFILE_SCOPE("PointCloudPyramid");
+    for (double voxel_size : voxel_sizes_) {
+        auto level = cloud.VoxelDownSample(voxel_size);
+        geometry::KDTreeSearchParamHybrid search_param(voxel_size * 2.0, 30);
+        // point-to-plane ICP checks the normals of both point clouds
+        level->EstimateNormals(search_param);
+        point_clouds_.push_back(level);
+        if (!is_target_) {
+            // sources are only transformed and searched in the target
+            continue;
+        }
+        auto kdtree = std::make_shared<geometry::KDTreeFlann>(*level);
+        if (with_color_gradients) {
+            colored_icp_targets_.push_back(std::make_shared<ColoredICPTarget>(
+                    level, kdtree, search_param));
+        }
+        kdtrees_.push_back(kdtree);
+    }
+}
+
+RegistrationResult RegistrationMultiScaleICP(
+        const PointCloudPyramid &source,
+        const PointCloudPyramid &target,
+        const std::vector<double> &max_correspondence_distances,
+        const std::vector<ICPConvergenceCriteria> &criteria,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        TransformationEstimationType estimation_type
+        /* = TransformationEstimationType::PointToPlane*/,
+        double lambda_geometric /* = 0.968*/) {
+    OPEN3D_PROFILE_SCOPE("RegistrationMultiScaleICP");
+    size_t num_levels = target.NumLevels();
+    if (num_levels == 0 || source.NumLevels() != num_levels ||
+        max_correspondence_distances.size() != num_levels ||
+        criteria.size() != num_levels) {
+        utility::LogWarning(
+                "[RegistrationMultiScaleICP] Pyramids, distances and "
+                "criteria need the same number of levels.\n");
+        return RegistrationResult(init);
+    }
+    if (estimation_type != TransformationEstimationType::PointToPoint &&
+        estimation_type != TransformationEstimationType::PointToPlane &&
+        estimation_type != TransformationEstimationType::ColoredICP) {
+        utility::LogWarning(
+                "[RegistrationMultiScaleICP] Unsupported estimation type.\n");
+        return RegistrationResult(init);
+    }
+    if (!target.IsTarget()) {
+        utility::LogWarning(
+                "[RegistrationMultiScaleICP] The target pyramid was created "
+                "with CreateSource.\n");
+        return RegistrationResult(init);
+    }
+    if (estimation_type == TransformationEstimationType::ColoredICP &&
+        !target.HasColorGradients()) {
+        utility::LogWarning(
+                "[RegistrationMultiScaleICP] Colored ICP needs a target "
+                "pyramid with color gradients.\n");
+        return RegistrationResult(init);
+    }
+
+    TransformationEstimationPointToPoint point_to_point;
+    TransformationEstimationPointToPlane point_to_plane;
+    const TransformationEstimation *estimation = &point_to_plane;
+    if (estimation_type == TransformationEstimationType::PointToPoint) {
+        estimation = &point_to_point;
+    }
+    RegistrationResult result(init);
+    for (size_t level = 0; level < num_levels; level++) {
+        utility::LogDebug("Multi-scale ICP level {:d}, voxel size {:f}\n",
+                          (int)level, target.GetVoxelSize(level));
+        if (estimation_type == TransformationEstimationType::ColoredICP) {
+            result = RegistrationColoredICP(
+                    source.GetPointCloud(level),
+                    target.GetColoredICPTarget(level),
+                    max_correspondence_distances[level], result.transformation_,
+                    criteria[level], lambda_geometric);
+        } else {
+            result = RegistrationICP(
+                    source.GetPointCloud(level), target.GetPointCloud(level),
+                    target.GetKDTree(level),
+                    max_correspondence_distances[level], result.transformation_,
+                    *estimation, criteria[level]);
+        }
+    }
+    return result;
+}
+
+}  // namespace registration
+}  // namespace open3d
@@ -0,0 +1,117 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Registration/ColoredICP.h"
+#include "Open3D/Registration/Registration.h"
+
+namespace open3d {
+
+namespace geometry {
+class KDTreeFlann;
+class PointCloud;
+}  // namespace geometry
+
+namespace registration {
+
+/// A point cloud voxel down-sampled once per level, from coarse to fine, with
+/// normals and a KD-tree on every level and optionally the color gradients of
+/// colored ICP. Built once per point cloud, it serves as source or target of
+/// any number of RegistrationMultiScaleICP calls. A pyramid that is only
+/// used as source can be made with CreateSource, which skips what only
+/// targets need.
+class PointCloudPyramid {
+public:
+    /// Level i is \param cloud down-sampled with voxel size
+    /// \param voxel_sizes[i]. Normals, and the color gradients if
+    /// \param with_color_gradients, are fit within twice the voxel size.
+    PointCloudPyramid(const geometry::PointCloud &cloud,
+                      const std::vector<double> &voxel_sizes,
+                      bool with_color_gradients = false);
+
+    /// Factory function to create a pyramid that can only be the source of
+    /// RegistrationMultiScaleICP. Its levels are \param cloud down-sampled
+    /// with \param voxel_sizes and have normals, but no KD-trees or color
+    /// gradients.
+    static std::shared_ptr<PointCloudPyramid> CreateSource(
+            const geometry::PointCloud &cloud,
+            const std::vector<double> &voxel_sizes);
+
+public:
+    size_t NumLevels() const { return voxel_sizes_.size(); }
+    double GetVoxelSize(size_t level) const { return voxel_sizes_[level]; }
+    const geometry::PointCloud &GetPointCloud(size_t level) const {
+        return *point_clouds_[level];
+    }
+    /// Returns true if the pyramid has KD-trees, so that it can be a target.
+    bool IsTarget() const { return is_target_; }
+    /// Only available if IsTarget().
+    const geometry::KDTreeFlann &GetKDTree(size_t level) const {
+        return *kdtrees_[level];
+    }
+    bool HasColorGradients() const { return !colored_icp_targets_.empty(); }
+    const ColoredICPTarget &GetColoredICPTarget(size_t level) const {
+        return *colored_icp_targets_[level];
+    }
+
+private:
+    PointCloudPyramid(const geometry::PointCloud &cloud,
+                      const std::vector<double> &voxel_sizes,
+                      bool with_color_gradients,
+                      bool is_target);
+
+private:
+    bool is_target_;
+    std::vector<double> voxel_sizes_;
+    std::vector<std::shared_ptr<const geometry::PointCloud>> point_clouds_;
+    std::vector<std::shared_ptr<const geometry::KDTreeFlann>> kdtrees_;
+    std::vector<std::shared_ptr<const ColoredICPTarget>> colored_icp_targets_;
+};
+
+/// Function for coarse-to-fine ICP registration of \param source to
+/// \param target, which have the same number of levels. Level i runs ICP of
+/// \param estimation_type (point-to-point, point-to-plane or colored ICP) with
+/// \param max_correspondence_distances[i] and \param criteria[i], starting
+/// from the result of the previous level. The target can not come from
+/// PointCloudPyramid::CreateSource, and colored ICP needs a target with color
+/// gradients. Returns the result on the finest level.
+RegistrationResult RegistrationMultiScaleICP(
+        const PointCloudPyramid &source,
+        const PointCloudPyramid &target,
+        const std::vector<double> &max_correspondence_distances,
+        const std::vector<ICPConvergenceCriteria> &criteria,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        TransformationEstimationType estimation_type =
+                TransformationEstimationType::PointToPlane,
+        double lambda_geometric = 0.968);
+
+}  // namespace registration
+}  // namespace open3d
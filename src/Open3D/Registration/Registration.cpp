@@ -26,13 +26,19 @@
 
 #include "Open3D/Registration/Registration.h"
 
-#include <cstdlib>
+#include <algorithm>
+#include <cstdint>
 #include <ctime>
+#include <mutex>
+#include <random>
+#include <typeinfo>
 
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Registration/Feature.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Eigen.h"
+#include "Open3D/Utility/Profiler.h"
 
 namespace open3d {
 
@@ -97,6 +103,136 @@ RegistrationResult GetRegistrationResultAndCorrespondences(
     return result;
 }
 
+/// One pass of point-to-plane ICP at \param transformation. Every source
+/// point is transformed on the fly, matched to its nearest target point within
+/// \param max_correspondence_distance and accumulated into the normal
+/// equations \param JTJ and \param JTr with per-thread sums, so neither a
+/// transformed copy of the source nor a correspondence set is built. The match
+/// of every source point, or -1, is stored in \param target_indices.
+RegistrationResult ComputePointToPlaneICPStep(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &target_kdtree,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &transformation,
+        Eigen::Matrix6d &JTJ,
+        Eigen::Vector6d &JTr,
+        std::vector<int> &target_indices) {
+    RegistrationResult result(transformation);
+    const int num_points = (int)source.points_.size();
+    const Eigen::Matrix3d rotation = transformation.block<3, 3>(0, 0);
+    const Eigen::Vector3d translation = transformation.block<3, 1>(0, 3);
+    target_indices.resize(num_points);
+    JTJ.setZero();
+    JTr.setZero();
+    double error2 = 0.0;
+    int corres_number = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        Eigen::Matrix6d JTJ_private = Eigen::Matrix6d::Zero();
+        Eigen::Vector6d JTr_private = Eigen::Vector6d::Zero();
+        double error2_private = 0.0;
+        int corres_number_private = 0;
+        std::vector<int> indices(1);
+        std::vector<double> dists(1);
+#ifdef _OPENMP
+#pragma omp for nowait
+#endif
+        for (int i = 0; i < num_points; i++) {
+            const Eigen::Vector3d vs =
+                    rotation * source.points_[i] + translation;
+            if (target_kdtree.SearchHybrid(vs, max_correspondence_distance, 1,
+                                           indices, dists) <= 0) {
+                target_indices[i] = -1;
+                continue;
+            }
+            const Eigen::Vector3d &vt = target.points_[indices[0]];
+            const Eigen::Vector3d &nt = target.normals_[indices[0]];
+            Eigen::Vector6d J_r;
+            J_r.block<3, 1>(0, 0) = vs.cross(nt);
+            J_r.block<3, 1>(3, 0) = nt;
+            double r = (vs - vt).dot(nt);
+            JTJ_private.noalias() += J_r * J_r.transpose();
+            JTr_private.noalias() += J_r * r;
+            error2_private += dists[0];
+            corres_number_private++;
+            target_indices[i] = indices[0];
+        }
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        {
+            JTJ += JTJ_private;
+            JTr += JTr_private;
+            error2 += error2_private;
+            corres_number += corres_number_private;
+        }
+#ifdef _OPENMP
+    }
+#endif
+
+    if (corres_number == 0) {
+        result.fitness_ = 0.0;
+        result.inlier_rmse_ = 0.0;
+    } else {
+        result.fitness_ = (double)corres_number / (double)num_points;
+        result.inlier_rmse_ = std::sqrt(error2 / (double)corres_number);
+    }
+    return result;
+}
+
+/// RegistrationICP for TransformationEstimationPointToPlane, with the
+/// correspondence search and the linear system fused into one pass per
+/// iteration. The correspondence set is only assembled for the result.
+RegistrationResult RegistrationICPPointToPlane(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &kdtree,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init,
+        const ICPConvergenceCriteria &criteria) {
+    Eigen::Matrix4d transformation = init;
+    Eigen::Matrix6d JTJ;
+    Eigen::Vector6d JTr;
+    std::vector<int> target_indices;
+    RegistrationResult result = ComputePointToPlaneICPStep(
+            source, target, kdtree, max_correspondence_distance,
+            transformation, JTJ, JTr, target_indices);
+    for (int i = 0; i < criteria.max_iteration_; i++) {
+        utility::LogDebug("ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}\n",
+                          i, result.fitness_, result.inlier_rmse_);
+        OPEN3D_PROFILE_COUNTER("RegistrationICP fitness", result.fitness_);
+        if (result.fitness_ > 0.0) {
+            bool is_success;
+            Eigen::Matrix4d update;
+            std::tie(is_success, update) =
+                    utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ,
+                                                                         JTr);
+            transformation = update * transformation;
+        }
+        RegistrationResult backup = result;
+        result = ComputePointToPlaneICPStep(
+                source, target, kdtree, max_correspondence_distance,
+                transformation, JTJ, JTr, target_indices);
+        if (std::abs(backup.fitness_ - result.fitness_) <
+                    criteria.relative_fitness_ &&
+            std::abs(backup.inlier_rmse_ - result.inlier_rmse_) <
+                    criteria.relative_rmse_) {
+            break;
+        }
+    }
+    for (int i = 0; i < (int)target_indices.size(); i++) {
+        if (target_indices[i] >= 0) {
+            result.correspondence_set_.push_back(
+                    Eigen::Vector2i(i, target_indices[i]));
+        }
+    }
+    return result;
+}
+
 RegistrationResult EvaluateRANSACBasedOnCorrespondence(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -153,6 +289,23 @@ RegistrationResult RegistrationICP(
         /* = TransformationEstimationPointToPoint(false)*/,
         const ICPConvergenceCriteria
                 &criteria /* = ICPConvergenceCriteria()*/) {
+    geometry::KDTreeFlann kdtree;
+    kdtree.SetGeometry(target);
+    return RegistrationICP(source, target, kdtree, max_correspondence_distance,
+                           init, estimation, criteria);
+}
+
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &target_kdtree,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        const ICPConvergenceCriteria
+                &criteria /* = ICPConvergenceCriteria()*/) {
+    OPEN3D_PROFILE_SCOPE("RegistrationICP");
     if (max_correspondence_distance <= 0.0) {
         utility::LogWarning("Invalid max_correspondence_distance.\n");
         return RegistrationResult(init);
@@ -165,27 +318,33 @@ RegistrationResult RegistrationICP(
                 "pre-computed normal vectors.\n");
         return RegistrationResult(init);
     }
+    // subclasses may override ComputeTransformation, e.g. from Python
+    if (typeid(estimation) == typeid(TransformationEstimationPointToPlane)) {
+        return RegistrationICPPointToPlane(source, target, target_kdtree,
+                                           max_correspondence_distance, init,
+                                           criteria);
+    }
 
     Eigen::Matrix4d transformation = init;
-    geometry::KDTreeFlann kdtree;
-    kdtree.SetGeometry(target);
     geometry::PointCloud pcd = source;
     if (init.isIdentity() == false) {
         pcd.Transform(init);
     }
     RegistrationResult result;
     result = GetRegistrationResultAndCorrespondences(
-            pcd, target, kdtree, max_correspondence_distance, transformation);
+            pcd, target, target_kdtree, max_correspondence_distance,
+            transformation);
     for (int i = 0; i < criteria.max_iteration_; i++) {
         utility::LogDebug("ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}\n",
                           i, result.fitness_, result.inlier_rmse_);
+        OPEN3D_PROFILE_COUNTER("RegistrationICP fitness", result.fitness_);
         Eigen::Matrix4d update = estimation.ComputeTransformation(
                 pcd, target, result.correspondence_set_);
         transformation = update * transformation;
         pcd.Transform(update);
         RegistrationResult backup = result;
         result = GetRegistrationResultAndCorrespondences(
-                pcd, target, kdtree, max_correspondence_distance,
+                pcd, target, target_kdtree, max_correspondence_distance,
                 transformation);
         if (std::abs(backup.fitness_ - result.fitness_) <
                     criteria.relative_fitness_ &&
@@ -207,11 +366,13 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
         int ransac_n /* = 6*/,
         const RANSACConvergenceCriteria &criteria
         /* = RANSACConvergenceCriteria()*/) {
+    OPEN3D_PROFILE_SCOPE("RegistrationRANSACBasedOnCorrespondence");
     if (ransac_n < 3 || (int)corres.size() < ransac_n ||
         max_correspondence_distance <= 0.0) {
         return RegistrationResult();
     }
-    std::srand((unsigned int)std::time(0));
+    std::mt19937 rng((unsigned int)std::time(0));
+    std::uniform_int_distribution<int> corres_dist(0, (int)corres.size() - 1);
     Eigen::Matrix4d transformation;
     CorrespondenceSet ransac_corres(ransac_n);
     RegistrationResult result;
@@ -219,7 +380,7 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
          itr < criteria.max_iteration_ && itr < criteria.max_validation_;
          itr++) {
         for (int j = 0; j < ransac_n; j++) {
-            ransac_corres[j] = corres[std::rand() % (int)corres.size()];
+            ransac_corres[j] = corres[corres_dist(rng)];
         }
         transformation =
                 estimation.ComputeTransformation(source, target, ransac_corres);
@@ -252,6 +413,7 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
                 &checkers /* = {}*/,
         const RANSACConvergenceCriteria &criteria
         /* = RANSACConvergenceCriteria()*/) {
+    OPEN3D_PROFILE_SCOPE("RegistrationRANSACBasedOnFeatureMatching");
     if (ransac_n < 3 || max_correspondence_distance <= 0.0) {
         return RegistrationResult();
     }
@@ -260,7 +422,37 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
     int total_validation = 0;
     bool finished_validation = false;
     int num_similar_features = 1;
-    std::vector<std::vector<int>> similar_features(source.points_.size());
+    const int num_source_points = (int)source.points_.size();
+
+    // The similar target features of a source point are searched once and
+    // shared by the RANSAC threads. If the samples can cover the source
+    // points, all of them are searched up front, otherwise a point is
+    // searched when it is first sampled.
+    std::vector<std::vector<int>> similar_features(num_source_points);
+    geometry::KDTreeFlann kdtree_feature(target_feature);
+    auto search_similar_features = [&](int i) {
+        std::vector<double> dists(num_similar_features);
+        kdtree_feature.SearchKNN(Eigen::VectorXd(source_feature.data_.col(i)),
+                                 num_similar_features, similar_features[i],
+                                 dists);
+    };
+    const bool search_all = (int64_t)criteria.max_iteration_ * ransac_n >=
+                            (int64_t)num_source_points;
+    std::vector<std::once_flag> searched(search_all ? 0 : num_source_points);
+    if (search_all) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < num_source_points; i++) {
+            search_similar_features(i);
+        }
+    }
+    auto get_similar_features = [&](int i) -> const std::vector<int> & {
+        if (!search_all) {
+            std::call_once(searched[i], search_similar_features, i);
+        }
+        return similar_features[i];
+    };
 
 #ifdef _OPENMP
 #pragma omp parallel
@@ -268,7 +460,6 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
 #endif
         CorrespondenceSet ransac_corres(ransac_n);
         geometry::KDTreeFlann kdtree(target);
-        geometry::KDTreeFlann kdtree_feature(target_feature);
         RegistrationResult result_private;
         unsigned int seed_number;
 #ifdef _OPENMP
@@ -277,38 +468,29 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
 #else
     seed_number = (unsigned int)std::time(0);
 #endif
-        std::srand(seed_number);
+        // a generator per call and thread, std::rand shares its state with
+        // every other caller in the process
+        std::mt19937 rng(seed_number);
+        std::uniform_int_distribution<int> source_dist(
+                0, std::max(num_source_points - 1, 0));
+        std::uniform_int_distribution<int> similar_dist(
+                0, num_similar_features - 1);
 
 #ifdef _OPENMP
 #pragma omp for nowait
 #endif
         for (int itr = 0; itr < criteria.max_iteration_; itr++) {
             if (!finished_validation) {
-                std::vector<double> dists(num_similar_features);
                 Eigen::Matrix4d transformation;
                 for (int j = 0; j < ransac_n; j++) {
-                    int source_sample_id =
-                            std::rand() % (int)source.points_.size();
-                    if (similar_features[source_sample_id].empty()) {
-                        std::vector<int> indices(num_similar_features);
-                        kdtree_feature.SearchKNN(
-                                Eigen::VectorXd(source_feature.data_.col(
-                                        source_sample_id)),
-                                num_similar_features, indices, dists);
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-                        { similar_features[source_sample_id] = indices; }
-                    }
+                    int source_sample_id = source_dist(rng);
                     ransac_corres[j](0) = source_sample_id;
+                    const std::vector<int> &similar =
+                            get_similar_features(source_sample_id);
                     if (num_similar_features == 1)
-                        ransac_corres[j](1) =
-                                similar_features[source_sample_id][0];
+                        ransac_corres[j](1) = similar[0];
                     else
-                        ransac_corres[j](1) =
-                                similar_features[source_sample_id]
-                                                [std::rand() %
-                                                 num_similar_features];
+                        ransac_corres[j](1) = similar[similar_dist(rng)];
                 }
                 bool check = true;
                 for (const auto &checker : checkers) {
@@ -0,0 +1,102 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+
+namespace open3d {
+namespace registration {
+
+/// Base class of the robust loss functions used to reweight residuals in the
+/// Gauss-Newton steps of ICP (iteratively reweighted least squares). A
+/// residual r enters the normal equations with the weight Weight(r).
+/// Weight() is called concurrently from the OpenMP threads of the
+/// registration and must be thread-safe.
+class RobustKernel {
+public:
+    virtual ~RobustKernel() {}
+
+public:
+    virtual double Weight(double residual) const = 0;
+};
+
+/// Plain least squares, every residual has weight 1.
+class L2Loss : public RobustKernel {
+public:
+    double Weight(double /*residual*/) const override { return 1.0; }
+};
+
+/// Quadratic below \param k and linear above it.
+class HuberLoss : public RobustKernel {
+public:
+    explicit HuberLoss(double k) : k_(k) {}
+
+public:
+    double Weight(double residual) const override {
+        double abs_residual = std::abs(residual);
+        return abs_residual <= k_ ? 1.0 : k_ / abs_residual;
+    }
+
+public:
+    double k_;
+};
+
+/// Logarithmic loss, residuals much larger than \param k have little weight.
+class CauchyLoss : public RobustKernel {
+public:
+    explicit CauchyLoss(double k) : k_(k) {}
+
+public:
+    double Weight(double residual) const override {
+        double ratio = residual / k_;
+        return 1.0 / (1.0 + ratio * ratio);
+    }
+
+public:
+    double k_;
+};
+
+/// Tukey's biweight, residuals larger than \param k are ignored.
+class TukeyLoss : public RobustKernel {
+public:
+    explicit TukeyLoss(double k) : k_(k) {}
+
+public:
+    double Weight(double residual) const override {
+        if (std::abs(residual) > k_) {
+            return 0.0;
+        }
+        double ratio = residual / k_;
+        return (1.0 - ratio * ratio) * (1.0 - ratio * ratio);
+    }
+
+public:
+    double k_;
+};
+
+}  // namespace registration
+}  // namespace open3d
@@ -0,0 +1,292 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/Profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <unordered_map>
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace utility {
+
+namespace {
+
+/// Nesting depth of the open ScopeProfilers of the calling thread.
+thread_local int scope_depth = 0;
+
+double SteadyTimeInMicroseconds() {
+    std::chrono::duration<double, std::micro> time =
+            std::chrono::steady_clock::now().time_since_epoch();
+    return time.count();
+}
+
+std::string EscapeJsonString(const char *str) {
+    std::string escaped;
+    for (const char *c = str; *c != '\0'; c++) {
+        if (*c == '"' || *c == '\\') {
+            escaped += '\\';
+            escaped += *c;
+        } else if ((unsigned char)*c < 0x20) {
+            escaped += fmt::format("\\u{:04x}", int(*c));
+        } else {
+            escaped += *c;
+        }
+    }
+    return escaped;
+}
+
+}  // unnamed namespace
+
+struct Profiler::ThreadBuffer {
+    int thread_id_;
+    std::vector<Event> events_;
+    /// Number of events recorded since the last reset, the next event goes
+    /// to events_[num_recorded_ % events_.size()].
+    std::atomic<uint64_t> num_recorded_;
+};
+
+Profiler &Profiler::GetInstance() {
+    static Profiler instance;
+    return instance;
+}
+
+Profiler::Profiler()
+    : enabled_(false),
+      events_per_thread_(1 << 16),
+      epoch_us_(SteadyTimeInMicroseconds()),
+      next_thread_id_(0) {}
+
+Profiler::~Profiler() {}
+
+void Profiler::Enable(size_t events_per_thread /* = 1 << 16*/) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    events_per_thread = std::max(events_per_thread, size_t(1));
+    events_per_thread_.store(events_per_thread);
+    for (auto &buffer : thread_buffers_) {
+        if (buffer->events_.size() != events_per_thread) {
+            buffer->events_.assign(events_per_thread, Event());
+            buffer->num_recorded_.store(0);
+        }
+    }
+    enabled_.store(true);
+}
+
+void Profiler::Disable() { enabled_.store(false); }
+
+void Profiler::Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    thread_buffers_.erase(
+            std::remove_if(thread_buffers_.begin(), thread_buffers_.end(),
+                           [](const std::shared_ptr<ThreadBuffer> &buffer) {
+                               return buffer.use_count() == 1;
+                           }),
+            thread_buffers_.end());
+    for (auto &buffer : thread_buffers_) {
+        buffer->num_recorded_.store(0);
+    }
+}
+
+double Profiler::GetTimeInMicroseconds() const {
+    return SteadyTimeInMicroseconds() - epoch_us_;
+}
+
+Profiler::ThreadBuffer &Profiler::GetThreadBuffer() {
+    // buffers are shared with the profiler and outlive their threads, so
+    // that the events of finished threads can still be exported until the
+    // next Clear()
+    static thread_local std::shared_ptr<ThreadBuffer> thread_buffer;
+    if (thread_buffer == nullptr) {
+        auto buffer = std::make_shared<ThreadBuffer>();
+        buffer->events_.resize(events_per_thread_.load());
+        buffer->num_recorded_.store(0);
+        std::lock_guard<std::mutex> lock(mutex_);
+        buffer->thread_id_ = next_thread_id_++;
+        thread_buffers_.push_back(buffer);
+        thread_buffer = std::move(buffer);
+    }
+    return *thread_buffer;
+}
+
+void Profiler::RecordScope(const char *name, double begin_us, int depth) {
+    ThreadBuffer &buffer = GetThreadBuffer();
+    uint64_t idx = buffer.num_recorded_.load(std::memory_order_relaxed);
+    Event &event = buffer.events_[idx % buffer.events_.size()];
+    event.name_ = name;
+    event.type_ = EventType::Scope;
+    event.depth_ = depth;
+    event.begin_us_ = begin_us;
+    event.value_ = GetTimeInMicroseconds() - begin_us;
+    buffer.num_recorded_.store(idx + 1, std::memory_order_release);
+}
+
+void Profiler::RecordCounter(const char *name, double value) {
+    if (!IsEnabled()) {
+        return;
+    }
+    ThreadBuffer &buffer = GetThreadBuffer();
+    uint64_t idx = buffer.num_recorded_.load(std::memory_order_relaxed);
+    Event &event = buffer.events_[idx % buffer.events_.size()];
+    event.name_ = name;
+    event.type_ = EventType::Counter;
+    event.depth_ = 0;
+    event.begin_us_ = GetTimeInMicroseconds();
+    event.value_ = value;
+    buffer.num_recorded_.store(idx + 1, std::memory_order_release);
+}
+
+std::vector<Profiler::ThreadEvents> Profiler::GetEvents() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<ThreadEvents> thread_events(thread_buffers_.size());
+    for (size_t i = 0; i < thread_buffers_.size(); i++) {
+        const ThreadBuffer &buffer = *thread_buffers_[i];
+        uint64_t num_recorded =
+                buffer.num_recorded_.load(std::memory_order_acquire);
+        uint64_t size = buffer.events_.size();
+        uint64_t first = num_recorded > size ? num_recorded - size : 0;
+        ThreadEvents &events = thread_events[i];
+        events.thread_id_ = buffer.thread_id_;
+        events.num_dropped_ = size_t(first);
+        events.events_.reserve(size_t(num_recorded - first));
+        for (uint64_t idx = first; idx < num_recorded; idx++) {
+            events.events_.push_back(buffer.events_[idx % size]);
+        }
+    }
+    return thread_events;
+}
+
+bool Profiler::WriteChromeTrace(const std::string &filename) const {
+    FILE *file = fopen(filename.c_str(), "w");
+    if (file == NULL) {
+        LogWarning("Write Chrome trace failed: unable to open file: {}\n",
+                   filename);
+        return false;
+    }
+    std::vector<ThreadEvents> thread_events = GetEvents();
+    fmt::print(file, "{{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    bool first = true;
+    for (const auto &events : thread_events) {
+        fmt::print(file,
+                   "{}\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+                   "\"tid\":{},\"args\":{{\"name\":\"thread {}\"}}}}",
+                   first ? "" : ",", events.thread_id_, events.thread_id_);
+        first = false;
+        for (const auto &event : events.events_) {
+            std::string name = EscapeJsonString(event.name_);
+            if (event.type_ == EventType::Scope) {
+                fmt::print(file,
+                           ",\n{{\"name\":\"{}\",\"cat\":\"open3d\","
+                           "\"ph\":\"X\",\"pid\":0,\"tid\":{},\"ts\":{:.3f},"
+                           "\"dur\":{:.3f}}}",
+                           name, events.thread_id_, event.begin_us_,
+                           event.value_);
+            } else {
+                fmt::print(file,
+                           ",\n{{\"name\":\"{}\",\"cat\":\"open3d\","
+                           "\"ph\":\"C\",\"pid\":0,\"tid\":{},\"ts\":{:.3f},"
+                           "\"args\":{{\"value\":{}}}}}",
+                           name, events.thread_id_, event.begin_us_,
+                           event.value_);
+            }
+        }
+    }
+    fmt::print(file, "\n]}}\n");
+    bool success = ferror(file) == 0;
+    fclose(file);
+    if (!success) {
+        LogWarning("Write Chrome trace failed: unable to write file: {}\n",
+                   filename);
+    }
+    return success;
+}
+
+void Profiler::PrintSummary() const {
+    struct ScopeStatistics {
+        std::string name_;
+        size_t count_;
+        double total_us_;
+        double max_us_;
+    };
+    std::vector<ScopeStatistics> statistics;
+    std::unordered_map<std::string, size_t> name_to_statistics;
+    size_t num_dropped = 0;
+    for (const auto &events : GetEvents()) {
+        num_dropped += events.num_dropped_;
+        for (const auto &event : events.events_) {
+            if (event.type_ != EventType::Scope) {
+                continue;
+            }
+            auto it = name_to_statistics
+                              .insert(std::make_pair(std::string(event.name_),
+                                                     statistics.size()))
+                              .first;
+            if (it->second == statistics.size()) {
+                statistics.push_back({it->first, 0, 0.0, 0.0});
+            }
+            ScopeStatistics &scope = statistics[it->second];
+            scope.count_++;
+            scope.total_us_ += event.value_;
+            scope.max_us_ = std::max(scope.max_us_, event.value_);
+        }
+    }
+    std::sort(statistics.begin(), statistics.end(),
+              [](const ScopeStatistics &a, const ScopeStatistics &b) {
+                  return a.total_us_ > b.total_us_;
+              });
+    LogInfo("{:>10} {:>12} {:>12}  {}\n", "calls", "total ms", "max ms",
+            "scope");
+    for (const auto &scope : statistics) {
+        LogInfo("{:>10d} {:>12.3f} {:>12.3f}  {}\n", scope.count_,
+                scope.total_us_ / 1000.0, scope.max_us_ / 1000.0, scope.name_);
+    }
+    if (num_dropped > 0) {
+        LogInfo("{:d} events were dropped from full ring buffers.\n",
+                num_dropped);
+    }
+}
+
+ScopeProfiler::ScopeProfiler(const char *name)
+    : name_(nullptr), begin_us_(0.0), depth_(0) {
+    Profiler &profiler = Profiler::GetInstance();
+    if (profiler.IsEnabled()) {
+        name_ = name;
+        depth_ = scope_depth++;
+        begin_us_ = profiler.GetTimeInMicroseconds();
+    }
+}
+
+ScopeProfiler::~ScopeProfiler() {
+    if (name_ != nullptr) {
+        Profiler::GetInstance().RecordScope(name_, begin_us_, depth_);
+        scope_depth--;
+    }
+}
+
+}  // namespace utility
+}  // namespace open3d
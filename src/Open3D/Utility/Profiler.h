@@ -0,0 +1,174 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Open3D/Open3DConfig.h"
+
+namespace open3d {
+namespace utility {
+
+/// Low-overhead instrumentation of nested named scopes and counters.
+///
+/// Every thread records into its own ring buffer, so recording takes no lock
+/// and, once a buffer is full, overwrites its oldest events. Recording is off
+/// until Enable() is called; while it is off an instrumented scope costs one
+/// relaxed atomic load. Building with ENABLE_PROFILER=OFF compiles the
+/// OPEN3D_PROFILE_* macros away entirely.
+///
+/// Scope and counter names are not copied, they must be string literals or
+/// otherwise outlive the profiler.
+class Profiler {
+public:
+    enum class EventType { Scope = 0, Counter = 1 };
+
+    struct Event {
+        const char *name_;
+        EventType type_;
+        /// Nesting depth of a scope within its thread, 0 for outer scopes.
+        int depth_;
+        /// Microseconds since the profiler was created.
+        double begin_us_;
+        /// Duration of a scope in microseconds, or the value of a counter.
+        double value_;
+    };
+
+    struct ThreadEvents {
+        int thread_id_;
+        /// Events in the order they completed.
+        std::vector<Event> events_;
+        /// Events overwritten because the ring buffer was full.
+        size_t num_dropped_;
+    };
+
+    static Profiler &GetInstance();
+
+    Profiler(Profiler const &) = delete;
+    void operator=(Profiler const &) = delete;
+
+public:
+    /// Starts recording, keeping up to \param events_per_thread events in
+    /// each thread's ring buffer. Changing the buffer size discards the
+    /// recorded events and must not happen while instrumented code runs.
+    void Enable(size_t events_per_thread = 1 << 16);
+    void Disable();
+    bool IsEnabled() const {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    /// Discards all recorded events and frees the buffers of the threads
+    /// that have exited.
+    void Clear();
+
+    /// Returns the time in microseconds since the profiler was created.
+    double GetTimeInMicroseconds() const;
+
+    /// Records a scope \param name that started at \param begin_us and ends
+    /// now. Use ScopeProfiler or OPEN3D_PROFILE_SCOPE instead.
+    void RecordScope(const char *name, double begin_us, int depth);
+    /// Records \param value for the counter \param name if the profiler is
+    /// enabled.
+    void RecordCounter(const char *name, double value);
+
+    /// Returns a copy of the recorded events. Call it while no instrumented
+    /// code runs, events recorded concurrently may be torn.
+    std::vector<ThreadEvents> GetEvents() const;
+
+    /// Writes the recorded events in the Chrome trace event format, which can
+    /// be opened in chrome://tracing or https://ui.perfetto.dev.
+    bool WriteChromeTrace(const std::string &filename) const;
+
+    /// Prints the number of calls, the total and the maximum duration of
+    /// every scope name, sorted by total duration.
+    void PrintSummary() const;
+
+private:
+    struct ThreadBuffer;
+
+    Profiler();
+    ~Profiler();
+
+    ThreadBuffer &GetThreadBuffer();
+
+private:
+    std::atomic<bool> enabled_;
+    std::atomic<size_t> events_per_thread_;
+    double epoch_us_;
+    mutable std::mutex mutex_;
+    /// Shared with the recording threads, a buffer only held here belongs to
+    /// an exited thread.
+    std::vector<std::shared_ptr<ThreadBuffer>> thread_buffers_;
+    int next_thread_id_;
+};
+
+/// Records the lifetime of the enclosing C++ scope as a profiler scope.
+class ScopeProfiler {
+public:
+    explicit ScopeProfiler(const char *name);
+    ~ScopeProfiler();
+
+    ScopeProfiler(ScopeProfiler const &) = delete;
+    void operator=(ScopeProfiler const &) = delete;
+
+private:
+    const char *name_;
+    double begin_us_;
+    int depth_;
+};
+
+}  // namespace utility
+}  // namespace open3d
+
+#define OPEN3D_PROFILE_CONCAT_IMPL(a, b) a##b
+#define OPEN3D_PROFILE_CONCAT(a, b) OPEN3D_PROFILE_CONCAT_IMPL(a, b)
+
+#if OPEN3D_ENABLE_PROFILER
+/// Profiles the rest of the enclosing scope under \p name.
+#define OPEN3D_PROFILE_SCOPE(name)                                    \
+    open3d::utility::ScopeProfiler OPEN3D_PROFILE_CONCAT(             \
+            open3d_profile_scope_, __LINE__)(name)
+/// Records \p value for the counter \p name.
+#define OPEN3D_PROFILE_COUNTER(name, value)                           \
+    do {                                                              \
+        open3d::utility::Profiler &open3d_profiler =                  \
+                open3d::utility::Profiler::GetInstance();             \
+        if (open3d_profiler.IsEnabled()) {                            \
+            open3d_profiler.RecordCounter(name, double(value));       \
+        }                                                             \
+    } while (0)
+#else
+#define OPEN3D_PROFILE_SCOPE(name)
+#define OPEN3D_PROFILE_COUNTER(name, value) \
+    do {                                    \
+    } while (0)
+#endif
@@ -94,20 +94,53 @@ void pybind_image(py::module &m) {
                          "Image can only be initialized from buffer of uint8, "
                          "uint16, or float!");
              }
-             if (info.strides[info.ndim - 1] != bytes_per_channel) {
-                 throw std::runtime_error(
-                         "Image can only be initialized from c-style buffer.");
-             }
              if (info.ndim == 2) {
                  num_of_channels = 1;
              } else if (info.ndim == 3) {
                  num_of_channels = (int)info.shape[2];
+             } else {
+                 throw std::runtime_error(
+                         "Image can only be initialized from buffer of 2 or 3 "
+                         "dimensions!");
              }
              height = (int)info.shape[0];
              width = (int)info.shape[1];
              auto img = new geometry::Image();
              img->Prepare(width, height, num_of_channels, bytes_per_channel);
-             memcpy(img->data_.data(), info.ptr, img->data_.size());
+             const uint8_t *src = (const uint8_t *)info.ptr;
+             auto channel_stride = info.strides[info.ndim - 1];
+             if (info.ndim == 2) {
+                 channel_stride = bytes_per_channel;
+             }
+             const int bytes_per_pixel = num_of_channels * bytes_per_channel;
+             const int bytes_per_line = img->BytesPerLine();
+             // A C-ordered buffer is copied at once, a sliced one row by row
+             // and any other layout, e.g. Fortran order, channel by channel.
+             if (channel_stride == bytes_per_channel &&
+                 info.strides[1] == bytes_per_pixel &&
+                 info.strides[0] == bytes_per_line) {
+                 memcpy(img->data_.data(), src, img->data_.size());
+             } else if (channel_stride == bytes_per_channel &&
+                        info.strides[1] == bytes_per_pixel) {
+                 for (int v = 0; v < height; v++) {
+                     memcpy(img->data_.data() + v * bytes_per_line,
+                            src + v * info.strides[0], bytes_per_line);
+                 }
+             } else {
+                 uint8_t *dst = img->data_.data();
+                 for (int v = 0; v < height; v++) {
+                     for (int u = 0; u < width; u++) {
+                         for (int c = 0; c < num_of_channels; c++) {
+                             memcpy(dst,
+                                    src + v * info.strides[0] +
+                                            u * info.strides[1] +
+                                            c * channel_stride,
+                                    bytes_per_channel);
+                             dst += bytes_per_channel;
+                         }
+                     }
+                 }
+             }
              return img;
          }))
             .def_buffer([](geometry::Image &img) -> py::buffer_info {
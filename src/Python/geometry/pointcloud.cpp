@@ -70,12 +70,14 @@ void pybind_pointcloud(py::module &m) {
                  "invert the selection of indices.",
                  "indices"_a, "invert"_a = false)
             .def("voxel_down_sample", &geometry::PointCloud::VoxelDownSample,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to downsample input pointcloud into output "
                  "pointcloud with "
                  "a voxel",
                  "voxel_size"_a)
             .def("voxel_down_sample_and_trace",
                  &geometry::PointCloud::VoxelDownSampleAndTrace,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to downsample using "
                  "geometry::PointCloud::VoxelDownSample also records point "
                  "cloud index before downsampling",
@@ -98,15 +100,18 @@ void pybind_pointcloud(py::module &m) {
                  "remove_nan"_a = true, "remove_infinite"_a = true)
             .def("remove_radius_outlier",
                  &geometry::PointCloud::RemoveRadiusOutliers,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to remove points that have less than nb_points"
                  " in a given sphere of a given radius",
                  "nb_points"_a, "radius"_a)
             .def("remove_statistical_outlier",
                  &geometry::PointCloud::RemoveStatisticalOutliers,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to remove points that are further away from their "
                  "neighbors in average",
                  "nb_neighbors"_a, "std_ratio"_a)
             .def("estimate_normals", &geometry::PointCloud::EstimateNormals,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to compute the normals of a point cloud. Normals "
                  "are oriented with respect to the input point cloud if "
                  "normals exist",
@@ -122,6 +127,7 @@ void pybind_pointcloud(py::module &m) {
                  "camera_location"_a = Eigen::Vector3d(0.0, 0.0, 0.0))
             .def("compute_point_cloud_distance",
                  &geometry::PointCloud::ComputePointCloudDistance,
+                 py::call_guard<py::gil_scoped_release>(),
                  "For each point in the source point cloud, compute the "
                  "distance to "
                  "the target point cloud.",
@@ -133,18 +139,22 @@ void pybind_pointcloud(py::module &m) {
                  "cloud.")
             .def("compute_mahalanobis_distance",
                  &geometry::PointCloud::ComputeMahalanobisDistance,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to compute the Mahalanobis distance for points in a "
                  "point "
                  "cloud. See: "
                  "https://en.wikipedia.org/wiki/Mahalanobis_distance.")
             .def("compute_nearest_neighbor_distance",
                  &geometry::PointCloud::ComputeNearestNeighborDistance,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to compute the distance from a point to its nearest "
                  "neighbor in the point cloud")
             .def("compute_convex_hull",
                  &geometry::PointCloud::ComputeConvexHull,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Computes the convex hull of the point cloud.")
             .def("cluster_dbscan", &geometry::PointCloud::ClusterDBSCAN,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Cluster PointCloud using the DBSCAN algorithm  Ester et al., "
                  "'A Density-Based Algorithm for Discovering Clusters in Large "
                  "Spatial Databases with Noise', 1996. Returns a list of point "
@@ -153,6 +163,7 @@ void pybind_pointcloud(py::module &m) {
             .def_static(
                     "create_from_depth_image",
                     &geometry::PointCloud::CreateFromDepthImage,
+                    py::call_guard<py::gil_scoped_release>(),
                     R"(Factory function to create a pointcloud from a depth image and a
         camera. Given depth value d at (u, v) image coordinate, the corresponding 3d
         point is:
@@ -168,6 +179,7 @@ void pybind_pointcloud(py::module &m) {
             .def_static(
                     "create_from_rgbd_image",
                     &geometry::PointCloud::CreateFromRGBDImage,
+                    py::call_guard<py::gil_scoped_release>(),
                     R"(Factory function to create a pointcloud from an RGB-D image and a
         camera. Given depth value d at (u, v) image coordinate, the corresponding 3d
         point is:
@@ -178,19 +190,45 @@ void pybind_pointcloud(py::module &m) {
         )",
                     "image"_a, "intrinsic"_a,
                     "extrinsic"_a = Eigen::Matrix4d::Identity())
-            .def_readwrite("points", &geometry::PointCloud::points_,
-                           "``float64`` array of shape ``(num_points, 3)``, "
-                           "use ``numpy.asarray()`` to access data: Points "
-                           "coordinates.")
-            .def_readwrite("normals", &geometry::PointCloud::normals_,
-                           "``float64`` array of shape ``(num_points, 3)``, "
-                           "use ``numpy.asarray()`` to access data: Points "
-                           "normals.")
-            .def_readwrite(
-                    "colors", &geometry::PointCloud::colors_,
-                    "``float64`` array of shape ``(num_points, 3)``, "
-                    "range ``[0, 1]`` , use ``numpy.asarray()`` to access "
-                    "data: RGB colors of points.");
+            .def("back_project_depth_image",
+                 &geometry::PointCloud::BackProjectDepthImage,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Function to back-project a depth image into this point "
+                 "cloud, reusing its memory. Points are computed as in "
+                 "create_from_depth_image, for the pixels inside roi.",
+                 "depth"_a, "intrinsic"_a,
+                 "extrinsic"_a = Eigen::Matrix4d::Identity(),
+                 "depth_scale"_a = 1000.0, "depth_trunc"_a = 1000.0,
+                 "stride"_a = 1,
+                 "roi"_a = Eigen::Vector4i(0, 0,
+                                           std::numeric_limits<int>::max(),
+                                           std::numeric_limits<int>::max()))
+            .def("back_project_rgbd_image",
+                 &geometry::PointCloud::BackProjectRGBDImage,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Function to back-project an RGB-D image into this point "
+                 "cloud, reusing its memory. Points are computed as in "
+                 "create_from_rgbd_image, for the pixels inside roi.",
+                 "image"_a, "intrinsic"_a,
+                 "extrinsic"_a = Eigen::Matrix4d::Identity(), "stride"_a = 1,
+                 "roi"_a = Eigen::Vector4i(0, 0,
+                                           std::numeric_limits<int>::max(),
+                                           std::numeric_limits<int>::max()));
+    py::detail::bind_vector_property(
+            pointcloud, "points", &geometry::PointCloud::points_,
+            "``float64`` array of shape ``(num_points, 3)``, use "
+            "``numpy.asarray()`` to access data without a copy, or assign a "
+            "numpy array: Points coordinates.");
+    py::detail::bind_vector_property(
+            pointcloud, "normals", &geometry::PointCloud::normals_,
+            "``float64`` array of shape ``(num_points, 3)``, use "
+            "``numpy.asarray()`` to access data without a copy, or assign a "
+            "numpy array: Points normals.");
+    py::detail::bind_vector_property(
+            pointcloud, "colors", &geometry::PointCloud::colors_,
+            "``float64`` array of shape ``(num_points, 3)``, range ``[0, 1]`` "
+            ", use ``numpy.asarray()`` to access data without a copy, or "
+            "assign a numpy array: RGB colors of points.");
     docstring::ClassMethodDocInject(m, "PointCloud", "has_colors");
     docstring::ClassMethodDocInject(m, "PointCloud", "has_normals");
     docstring::ClassMethodDocInject(m, "PointCloud", "has_points");
@@ -269,6 +307,26 @@ void pybind_pointcloud(py::module &m) {
               "If true the progress is visualized in the console."}});
     docstring::ClassMethodDocInject(m, "PointCloud", "create_from_depth_image");
     docstring::ClassMethodDocInject(m, "PointCloud", "create_from_rgbd_image");
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "back_project_depth_image",
+            {{"depth", "The input depth image."},
+             {"intrinsic", "Intrinsic parameters of the camera."},
+             {"extrinsic", "Extrinsic parameters of the camera."},
+             {"depth_scale", "Scale of the values of a uint16 depth image."},
+             {"depth_trunc", "Truncation distance of a uint16 depth image."},
+             {"stride", "Sampling stride of the pixels."},
+             {"roi",
+              "Pixels (u, v) with roi[0] <= u < roi[2] and roi[1] <= v < "
+              "roi[3] are used."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "back_project_rgbd_image",
+            {{"image", "The input RGB-D image."},
+             {"intrinsic", "Intrinsic parameters of the camera."},
+             {"extrinsic", "Extrinsic parameters of the camera."},
+             {"stride", "Sampling stride of the pixels."},
+             {"roi",
+              "Pixels (u, v) with roi[0] <= u < roi[2] and roi[1] <= v < "
+              "roi[3] are used."}});
 }
 
 void pybind_pointcloud_methods(py::module &m) {}
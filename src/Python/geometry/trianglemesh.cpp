@@ -88,6 +88,19 @@ void pybind_trianglemesh(py::module &m) {
                  &geometry::TriangleMesh::ComputeAdjacencyList,
                  "Function to compute adjacency list, call before adjacency "
                  "list is needed")
+            .def("enable_topology_cache",
+                 &geometry::TriangleMesh::EnableTopologyCache,
+                 "Function to enable or disable caching of the mesh topology "
+                 "used by the topology queries and the smoothing filters. "
+                 "The cache is rebuilt when the triangles change.",
+                 "enable"_a = true)
+            .def("is_topology_cache_enabled",
+                 &geometry::TriangleMesh::IsTopologyCacheEnabled,
+                 "Returns True if the topology cache is enabled.")
+            .def("invalidate_topology_cache",
+                 &geometry::TriangleMesh::InvalidateTopologyCache,
+                 "Function to drop the cached topology and free its memory, "
+                 "it is rebuilt on demand.")
             .def("remove_duplicated_vertices",
                  &geometry::TriangleMesh::RemoveDuplicatedVertices,
                  "Function that removes duplicated verties, i.e., vertices "
@@ -253,6 +266,12 @@ void pybind_trianglemesh(py::module &m) {
                  "Decimation by "
                  "Garland and Heckbert",
                  "target_number_of_triangles"_a)
+            .def("simplify_quadric_decimation_parallel",
+                 &geometry::TriangleMesh::SimplifyQuadricDecimationParallel,
+                 "Function to simplify mesh using Quadric Error Metric "
+                 "Decimation by Garland and Heckbert, collapsing independent "
+                 "sets of edges in parallel",
+                 "target_number_of_triangles"_a)
             .def("compute_convex_hull",
                  &geometry::TriangleMesh::ComputeConvexHull,
                  "Computes the convex hull of the triangle mesh.")
@@ -337,34 +356,53 @@ void pybind_trianglemesh(py::module &m) {
                         "length_split"_a = 70, "width_split"_a = 15,
                         "twists"_a = 1, "raidus"_a = 1, "flatness"_a = 1,
                         "width"_a = 1, "scale"_a = 1)
-            .def_readwrite("vertices", &geometry::TriangleMesh::vertices_,
-                           "``float64`` array of shape ``(num_vertices, 3)``, "
-                           "use ``numpy.asarray()`` to access data: Vertex "
-                           "coordinates.")
-            .def_readwrite("vertex_normals",
-                           &geometry::TriangleMesh::vertex_normals_,
-                           "``float64`` array of shape ``(num_vertices, 3)``, "
-                           "use ``numpy.asarray()`` to access data: Vertex "
-                           "normals.")
-            .def_readwrite(
-                    "vertex_colors", &geometry::TriangleMesh::vertex_colors_,
-                    "``float64`` array of shape ``(num_vertices, 3)``, "
-                    "range ``[0, 1]`` , use ``numpy.asarray()`` to access "
-                    "data: RGB colors of vertices.")
-            .def_readwrite("triangles", &geometry::TriangleMesh::triangles_,
-                           "``int`` array of shape ``(num_triangles, 3)``, use "
-                           "``numpy.asarray()`` to access data: List of "
-                           "triangles denoted by the index of points forming "
-                           "the triangle.")
-            .def_readwrite("triangle_normals",
-                           &geometry::TriangleMesh::triangle_normals_,
-                           "``float64`` array of shape ``(num_triangles, 3)``, "
-                           "use ``numpy.asarray()`` to access data: Triangle "
-                           "normals.")
             .def_readwrite(
                     "adjacency_list", &geometry::TriangleMesh::adjacency_list_,
                     "List of Sets: The set ``adjacency_list[i]`` contains the "
                     "indices of adjacent vertices of vertex i.");
+    py::detail::bind_vector_property(
+            trianglemesh, "vertices", &geometry::TriangleMesh::vertices_,
+            "``float64`` array of shape ``(num_vertices, 3)``, use "
+            "``numpy.asarray()`` to access data without a copy, or assign a "
+            "numpy array: Vertex coordinates.");
+    py::detail::bind_vector_property(
+            trianglemesh, "vertex_normals",
+            &geometry::TriangleMesh::vertex_normals_,
+            "``float64`` array of shape ``(num_vertices, 3)``, use "
+            "``numpy.asarray()`` to access data without a copy, or assign a "
+            "numpy array: Vertex normals.");
+    py::detail::bind_vector_property(
+            trianglemesh, "vertex_colors",
+            &geometry::TriangleMesh::vertex_colors_,
+            "``float64`` array of shape ``(num_vertices, 3)``, range "
+            "``[0, 1]`` , use ``numpy.asarray()`` to access data without a "
+            "copy, or assign a numpy array: RGB colors of vertices.");
+    // Same as bind_vector_property, assigning the triangles also drops the
+    // cached topology.
+    trianglemesh.def_property(
+            "triangles",
+            [](geometry::TriangleMesh &mesh) -> std::vector<Eigen::Vector3i> & {
+                return mesh.triangles_;
+            },
+            [](geometry::TriangleMesh &mesh, py::object value) {
+                if (py::isinstance<std::vector<Eigen::Vector3i>>(value)) {
+                    mesh.triangles_ =
+                            value.cast<const std::vector<Eigen::Vector3i> &>();
+                } else {
+                    py::detail::copy_array_to_vectors(value, mesh.triangles_);
+                }
+                mesh.InvalidateTopologyCache();
+            },
+            "``int`` array of shape ``(num_triangles, 3)``, use "
+            "``numpy.asarray()`` to access data without a copy, or assign a "
+            "numpy array: List of triangles denoted by the index of points "
+            "forming the triangle.");
+    py::detail::bind_vector_property(
+            trianglemesh, "triangle_normals",
+            &geometry::TriangleMesh::triangle_normals_,
+            "``float64`` array of shape ``(num_triangles, 3)``, use "
+            "``numpy.asarray()`` to access data without a copy, or assign a "
+            "numpy array: Triangle normals.");
     docstring::ClassMethodDocInject(m, "TriangleMesh",
                                     "compute_adjacency_list");
     docstring::ClassMethodDocInject(m, "TriangleMesh",
@@ -372,6 +410,13 @@ void pybind_trianglemesh(py::module &m) {
     docstring::ClassMethodDocInject(m, "TriangleMesh",
                                     "compute_vertex_normals");
     docstring::ClassMethodDocInject(m, "TriangleMesh", "has_adjacency_list");
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "enable_topology_cache",
+            {{"enable", "Set to False to disable and drop the cache."}});
+    docstring::ClassMethodDocInject(m, "TriangleMesh",
+                                    "is_topology_cache_enabled");
+    docstring::ClassMethodDocInject(m, "TriangleMesh",
+                                    "invalidate_topology_cache");
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "has_triangle_normals",
             {{"normalized",
@@ -489,7 +534,12 @@ void pybind_trianglemesh(py::module &m) {
             m, "TriangleMesh", "simplify_quadric_decimation",
             {{"target_number_of_triangles",
               "The number of triangles that the simplified mesh should have. "
-              "It is not guranteed that this number will be reached."}});
+              "It is not guaranteed that this number will be reached."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "simplify_quadric_decimation_parallel",
+            {{"target_number_of_triangles",
+              "The number of triangles that the simplified mesh should have. "
+              "It is not guaranteed that this number will be reached."}});
     docstring::ClassMethodDocInject(m, "TriangleMesh", "compute_convex_hull");
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "create_from_point_cloud_ball_pivoting",
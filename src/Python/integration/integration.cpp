@@ -53,6 +53,17 @@ public:
         PYBIND11_OVERLOAD_PURE(std::shared_ptr<geometry::TriangleMesh>,
                                TSDFVolumeBase, );
     }
+    typedef std::tuple<std::shared_ptr<geometry::RGBDImage>,
+                       std::shared_ptr<geometry::Image>>
+            RayCastResult;
+    RayCastResult RayCast(const camera::PinholeCameraIntrinsic &intrinsic,
+                          const Eigen::Matrix4d &extrinsic,
+                          double depth_max,
+                          bool convert_rgb_to_intensity) override {
+        PYBIND11_OVERLOAD_NAME(RayCastResult, TSDFVolumeBase, "ray_cast",
+                               RayCast, intrinsic, extrinsic, depth_max,
+                               convert_rgb_to_intensity);
+    }
 };
 
 void pybind_integration_classes(py::module &m) {
@@ -86,14 +97,24 @@ In SIGGRAPH, 1996)");
             .def("reset", &integration::TSDFVolume::Reset,
                  "Function to reset the integration::TSDFVolume")
             .def("integrate", &integration::TSDFVolume::Integrate,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to integrate an RGB-D image into the volume",
                  "image"_a, "intrinsic"_a, "extrinsic"_a)
             .def("extract_point_cloud",
                  &integration::TSDFVolume::ExtractPointCloud,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to extract a point cloud with normals")
             .def("extract_triangle_mesh",
                  &integration::TSDFVolume::ExtractTriangleMesh,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to extract a triangle mesh")
+            .def("ray_cast", &integration::TSDFVolume::RayCast,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Function to render the surface seen by a camera into an "
+                 "RGB-D image with float depth in meters, and a normal map "
+                 "in camera coordinates",
+                 "intrinsic"_a, "extrinsic"_a, "depth_max"_a = 3.0,
+                 "convert_rgb_to_intensity"_a = true)
             .def_readwrite("voxel_length",
                            &integration::TSDFVolume::voxel_length_,
                            "float: Voxel size.")
@@ -110,6 +131,14 @@ In SIGGRAPH, 1996)");
             {{"image", "RGBD image."},
              {"intrinsic", "Pinhole camera intrinsic parameters."},
              {"extrinsic", "Extrinsic parameters."}});
+    docstring::ClassMethodDocInject(
+            m, "TSDFVolume", "ray_cast",
+            {{"intrinsic", "Pinhole camera intrinsic parameters."},
+             {"extrinsic", "Extrinsic parameters."},
+             {"depth_max", "Maximum depth of the rendered surface."},
+             {"convert_rgb_to_intensity",
+              "Whether to render the color of an RGB8 volume as float "
+              "intensity, the format of RGB-D odometry."}});
     docstring::ClassMethodDocInject(m, "TSDFVolume", "reset");
 
     // open3d.integration.UniformTSDFVolume: open3d.integration.TSDFVolume
@@ -140,9 +169,11 @@ In SIGGRAPH, 1996)");
                  })  // todo: extend
             .def("extract_voxel_point_cloud",
                  &integration::UniformTSDFVolume::ExtractVoxelPointCloud,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Debug function to extract the voxel data into a point cloud.")
             .def("extract_voxel_grid",
                  &integration::UniformTSDFVolume::ExtractVoxelGrid,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Debug function to extract the voxel data VoxelGrid.")
             .def_readwrite("length", &integration::UniformTSDFVolume::length_,
                            "Total length, where ``voxel_length = length / "
@@ -200,6 +231,7 @@ In SIGGRAPH, 2013)");
                  })
             .def("extract_voxel_point_cloud",
                  &integration::ScalableTSDFVolume::ExtractVoxelPointCloud,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Debug function to extract the voxel data into a point "
                  "cloud.");
     docstring::ClassMethodDocInject(m, "ScalableTSDFVolume",
@@ -50,6 +50,7 @@ using namespace open3d;
 static const std::unordered_map<std::string, std::string>
         map_shared_argument_docstrings = {
                 {"filename", "Path to file."},
+                {"filenames", "Paths to files."},
                 // Write options
                 {"compressed",
                  "Set to ``True`` to write in compressed format."},
@@ -78,6 +79,13 @@ static const std::unordered_map<std::string, std::string>
                 {"mesh", "The ``TriangleMesh`` object for I/O"},
                 {"line_set", "The ``LineSet`` object for I/O"},
                 {"image", "The ``Image`` object for I/O"},
+                {"images", "List of ``Image`` objects for I/O"},
+                {"jpeg_scale_denominator",
+                 "JPEG images are downscaled by this factor while decoding, "
+                 "one of 1, 2, 4 or 8."},
+                {"jpeg_fast",
+                 "Set to ``True`` to decode JPEG images faster at lower "
+                 "accuracy, e.g. for previews."},
                 {"voxel_grid", "The ``VoxelGrid`` object for I/O"},
                 {"trajectory",
                  "The ``PinholeCameraTrajectory`` object for I/O"},
@@ -112,6 +120,33 @@ void pybind_class_io(py::module &m_io) {
     docstring::FunctionDocInject(m_io, "write_image",
                                  map_shared_argument_docstrings);
 
+    m_io.def("read_images",
+             [](const std::vector<std::string> &filenames,
+                int jpeg_scale_denominator, bool jpeg_fast) {
+                 std::vector<geometry::Image> images;
+                 io::ReadImages(filenames, images, jpeg_scale_denominator,
+                                jpeg_fast);
+                 return images;
+             },
+             py::call_guard<py::gil_scoped_release>(),
+             "Function to read a list of Images from files in parallel, "
+             "images that can not be read are empty",
+             "filenames"_a, "jpeg_scale_denominator"_a = 1,
+             "jpeg_fast"_a = false);
+    docstring::FunctionDocInject(m_io, "read_images",
+                                 map_shared_argument_docstrings);
+
+    m_io.def("write_images",
+             [](const std::vector<std::string> &filenames,
+                const std::vector<geometry::Image> &images, int quality) {
+                 return io::WriteImages(filenames, images, quality);
+             },
+             py::call_guard<py::gil_scoped_release>(),
+             "Function to write a list of Images to files in parallel",
+             "filenames"_a, "images"_a, "quality"_a = 90);
+    docstring::FunctionDocInject(m_io, "write_images",
+                                 map_shared_argument_docstrings);
+
     // open3d::geometry::LineSet
     m_io.def("read_line_set",
              [](const std::string &filename, const std::string &format,
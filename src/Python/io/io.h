@@ -32,6 +32,8 @@ void pybind_io(py::module& m);
 
 void pybind_class_io(py::module& m);
 
+void pybind_rgbd_sequence_file(py::module& m);
+
 #ifdef BUILD_AZURE_KINECT
 void pybind_sensor(py::module& m);
 #endif
@@ -0,0 +1,153 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/Sensor/RGBDSequenceFileReader.h"
+#include "Open3D/IO/Sensor/RGBDSequenceFileWriter.h"
+
+#include "Python/docstring.h"
+#include "Python/io/io.h"
+
+using namespace open3d;
+
+void pybind_rgbd_sequence_file(py::module &m) {
+    static const std::unordered_map<std::string, std::string>
+            map_shared_argument_docstrings = {
+                    {"filename", "Path to the RGB-D sequence file."},
+                    {"intrinsic", "Camera intrinsic of the frames."},
+                    {"depth_scale",
+                     "Depth values are in units of 1 / depth_scale meters."},
+                    {"color_codec", "Codec of the color frames."},
+                    {"depth_codec", "Codec of the depth frames, lossless."},
+                    {"color_quality", "JPEG quality of the color frames."},
+                    {"color", "8 bit color image with 1 or 3 channels."},
+                    {"depth", "16 bit depth image."},
+                    {"timestamp", "Capture time of the frame (usec)."},
+                    {"index", "Index of the frame."}};
+
+    py::enum_<io::RGBDSequenceColorCodec> color_codec(
+            m, "RGBDSequenceColorCodec", "Codec of RGB-D sequence colors.");
+    color_codec.value("Raw", io::RGBDSequenceColorCodec::Raw)
+            .value("JPEG", io::RGBDSequenceColorCodec::JPEG)
+            .export_values();
+
+    py::enum_<io::RGBDSequenceDepthCodec> depth_codec(
+            m, "RGBDSequenceDepthCodec", "Codec of RGB-D sequence depths.");
+    depth_codec.value("Raw", io::RGBDSequenceDepthCodec::Raw)
+            .value("DeltaLZF", io::RGBDSequenceDepthCodec::DeltaLZF)
+            .value("D16", io::RGBDSequenceDepthCodec::D16)
+            .export_values();
+
+    py::class_<io::RGBDSequenceFileWriter> writer(
+            m, "RGBDSequenceFileWriter",
+            "Writer of RGB-D sequence files, which hold a captured RGB-D "
+            "stream with its timestamps and camera intrinsic in a single "
+            "file.");
+    writer.def(py::init<>())
+            .def("open", &io::RGBDSequenceFileWriter::Open, "filename"_a,
+                 "intrinsic"_a, "depth_scale"_a = 1000.0,
+                 "color_codec"_a = io::RGBDSequenceColorCodec::JPEG,
+                 "depth_codec"_a = io::RGBDSequenceDepthCodec::D16,
+                 "color_quality"_a = 90,
+                 "Create the file, replacing any existing file.")
+            .def("is_opened", &io::RGBDSequenceFileWriter::IsOpened,
+                 "Is the file opened.")
+            .def("write_frame", &io::RGBDSequenceFileWriter::WriteFrame,
+                 "color"_a, "depth"_a, "timestamp"_a,
+                 "Append a frame. The first frame fixes the image sizes.")
+            .def("close", &io::RGBDSequenceFileWriter::Close,
+                 "Write the frame index and close the file.")
+            .def("num_frames", &io::RGBDSequenceFileWriter::NumFrames,
+                 "Number of frames written.");
+    docstring::ClassMethodDocInject(m, "RGBDSequenceFileWriter", "open",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "RGBDSequenceFileWriter", "is_opened",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "RGBDSequenceFileWriter", "write_frame",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "RGBDSequenceFileWriter", "close",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "RGBDSequenceFileWriter", "num_frames",
+                                    map_shared_argument_docstrings);
+
+    py::class_<io::RGBDSequenceFileReader> reader(
+            m, "RGBDSequenceFileReader",
+            "Memory mapped reader of RGB-D sequence files.");
+    reader.def(py::init<>())
+            .def("open", &io::RGBDSequenceFileReader::Open, "filename"_a,
+                 "Open the file.")
+            .def("close", &io::RGBDSequenceFileReader::Close,
+                 "Close the file.")
+            .def("is_opened", &io::RGBDSequenceFileReader::IsOpened,
+                 "Is the file opened.")
+            .def("num_frames", &io::RGBDSequenceFileReader::NumFrames,
+                 "Number of frames.")
+            .def("get_intrinsic", &io::RGBDSequenceFileReader::GetIntrinsic,
+                 "Camera intrinsic of the frames.")
+            .def("get_depth_scale", &io::RGBDSequenceFileReader::GetDepthScale,
+                 "Depth values are in units of 1 / depth_scale meters.")
+            .def("get_timestamp",
+                 [](const io::RGBDSequenceFileReader &reader, size_t index) {
+                     if (index >= reader.NumFrames()) {
+                         throw py::index_error();
+                     }
+                     return reader.GetTimestamp(index);
+                 },
+                 "index"_a, "Capture time of a frame (usec).")
+            .def("find_frame", &io::RGBDSequenceFileReader::FindFrame,
+                 "timestamp"_a,
+                 "Index of the first frame captured at or after the "
+                 "timestamp, num_frames() if there is none.")
+            .def("read_frame",
+                 [](const io::RGBDSequenceFileReader &reader, size_t index) {
+                     geometry::RGBDImage frame;
+                     reader.ReadFrame(index, frame);
+                     return frame;
+                 },
+                 py::call_guard<py::gil_scoped_release>(), "index"_a,
+                 "Decode a frame, the color and depth images are returned "
+                 "as written.");
+    docstring::ClassMethodDocInject(m, "RGBDSequenceFileReader", "open",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "RGBDSequenceFileReader", "close",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "RGBDSequenceFileReader", "is_opened",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "RGBDSequenceFileReader", "num_frames",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "RGBDSequenceFileReader",
+                                    "get_intrinsic",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "RGBDSequenceFileReader",
+                                    "get_depth_scale",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "RGBDSequenceFileReader",
+                                    "get_timestamp",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "RGBDSequenceFileReader", "find_frame",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "RGBDSequenceFileReader", "read_frame",
+                                    map_shared_argument_docstrings);
+}
@@ -35,6 +35,8 @@
 #include <pybind11/stl.h>
 #include <pybind11/stl_bind.h>
 
+#include <cstring>
+
 #include "Open3D/Registration/PoseGraph.h"
 #include "Open3D/Utility/Eigen.h"
 
@@ -72,5 +74,55 @@ void bind_copy_functions(Class_ &cl) {
     cl.def("__deepcopy__", [](T &v, py::dict &memo) { return T(v); });
 }
 
+/// Copies an array-like \param obj of shape (n, rows) into a std::vector of
+/// Eigen vectors of that size, reusing the memory of \param v. numpy first
+/// converts arrays of another dtype, byte order or layout (e.g. sliced or
+/// Fortran-ordered) into a C-ordered array of the Eigen scalar type. The
+/// result is copied with a single memmove, since Eigen vectors are packed.
+/// The array may be a view of \param v itself.
+template <typename Vector>
+void copy_array_to_vectors(py::handle obj, Vector &v) {
+    typedef typename Vector::value_type EigenVector;
+    typedef typename EigenVector::Scalar Scalar;
+    static_assert(sizeof(EigenVector) ==
+                          EigenVector::SizeAtCompileTime * sizeof(Scalar),
+                  "Eigen vector is not packed.");
+    auto array = py::array_t<Scalar, py::array::c_style |
+                                             py::array::forcecast>::ensure(obj);
+    if (!array) {
+        throw py::type_error("Can not convert to a numeric array.");
+    }
+    if (array.ndim() != 2 ||
+        array.shape(1) != EigenVector::SizeAtCompileTime) {
+        throw py::cast_error();
+    }
+    v.resize(array.shape(0));
+    if (!v.empty()) {
+        std::memmove(v.data(), array.data(), v.size() * sizeof(EigenVector));
+    }
+}
+
+/// Binds a std::vector of Eigen vectors member \param pm as a property.
+/// Reading the property returns the member itself, not a copy, so
+/// numpy.asarray() of it is a view sharing memory with the geometry. The
+/// view keeps the geometry alive but is invalidated when the member is
+/// resized. Assigning the property an Open3D vector or a numpy array copies
+/// the data into the memory of the member.
+template <typename Class_, typename C, typename Vector>
+void bind_vector_property(Class_ &cl,
+                          const char *name,
+                          Vector C::*pm,
+                          const char *doc) {
+    cl.def_property(name, [pm](C &c) -> Vector & { return c.*pm; },
+                    [pm](C &c, py::object value) {
+                        if (py::isinstance<Vector>(value)) {
+                            c.*pm = value.cast<const Vector &>();
+                        } else {
+                            copy_array_to_vectors(value, c.*pm);
+                        }
+                    },
+                    doc);
+}
+
 }  // namespace detail
 }  // namespace pybind11
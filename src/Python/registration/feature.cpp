@@ -63,6 +63,7 @@ void pybind_feature(py::module &m) {
 
 void pybind_feature_methods(py::module &m) {
     m.def("compute_fpfh_feature", &registration::ComputeFPFHFeature,
+          py::call_guard<py::gil_scoped_release>(),
           "Function to compute FPFH feature for a point cloud", "input"_a,
           "search_param"_a);
     docstring::FunctionDocInject(
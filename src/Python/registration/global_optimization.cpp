@@ -360,6 +360,7 @@ void pybind_global_optimization_methods(py::module &m) {
               registration::GlobalOptimization(pose_graph, method, criteria,
                                                option);
           },
+          py::call_guard<py::gil_scoped_release>(),
           "Function to optimize registration::PoseGraph", "pose_graph"_a,
           "method"_a, "criteria"_a, "option"_a);
     docstring::FunctionDocInject(
@@ -31,7 +31,9 @@
 #include "Open3D/Registration/CorrespondenceChecker.h"
 #include "Open3D/Registration/FastGlobalRegistration.h"
 #include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/MultiScaleICP.h"
 #include "Open3D/Registration/Registration.h"
+#include "Open3D/Registration/RobustKernel.h"
 #include "Open3D/Registration/TransformationEstimation.h"
 #include "Python/docstring.h"
 
@@ -157,6 +159,24 @@ void pybind_registration_classes(py::module &m) {
                                         std::to_string(c.max_validation_));
                  });
 
+    // open3d.registration.TransformationEstimationType
+    py::enum_<registration::TransformationEstimationType> te_type(
+            m, "TransformationEstimationType", py::arithmetic());
+    te_type.value("Unspecified",
+                  registration::TransformationEstimationType::Unspecified)
+            .value("PointToPoint",
+                   registration::TransformationEstimationType::PointToPoint)
+            .value("PointToPlane",
+                   registration::TransformationEstimationType::PointToPlane)
+            .value("ColoredICP",
+                   registration::TransformationEstimationType::ColoredICP)
+            .export_values();
+    te_type.attr("__doc__") = docstring::static_property(
+            py::cpp_function([](py::handle arg) -> std::string {
+                return "Enum class for TransformationEstimationType.";
+            }),
+            py::none(), py::none(), "");
+
     // ope3dn.registration.TransformationEstimation
     py::class_<
             registration::TransformationEstimation,
@@ -246,6 +266,63 @@ Sets :math:`c = 1` if ``with_scaling`` is ``False``.
                 return std::string("TransformationEstimationPointToPlane");
             });
 
+    // open3d.registration.RobustKernel
+    // No trampoline: Weight() is called in parallel without the GIL, so the
+    // kernels can not be overridden in Python.
+    py::class_<registration::RobustKernel> robust_kernel(
+            m, "RobustKernel",
+            "Base class of the robust loss functions that reweight residuals "
+            "in colored ICP. Only the built-in L2Loss, HuberLoss, CauchyLoss "
+            "and TukeyLoss are supported, weight() can not be overridden in "
+            "Python.");
+    robust_kernel.def("weight", &registration::RobustKernel::Weight,
+                      "residual"_a, "Weight of a residual.");
+
+    // open3d.registration.L2Loss: RobustKernel
+    py::class_<registration::L2Loss, registration::RobustKernel> l2_loss(
+            m, "L2Loss", "Plain least squares, every residual has weight 1.");
+    py::detail::bind_default_constructor<registration::L2Loss>(l2_loss);
+    l2_loss.def("__repr__", [](const registration::L2Loss &loss) {
+        return std::string("L2Loss");
+    });
+
+    // open3d.registration.HuberLoss: RobustKernel
+    py::class_<registration::HuberLoss, registration::RobustKernel> huber_loss(
+            m, "HuberLoss",
+            "Huber loss, quadratic below ``k`` and linear above it.");
+    huber_loss.def(py::init<double>(), "k"_a)
+            .def_readwrite("k", &registration::HuberLoss::k_,
+                           "float: Threshold of the loss.")
+            .def("__repr__", [](const registration::HuberLoss &loss) {
+                return std::string("HuberLoss with k = ") +
+                       std::to_string(loss.k_);
+            });
+
+    // open3d.registration.CauchyLoss: RobustKernel
+    py::class_<registration::CauchyLoss, registration::RobustKernel>
+            cauchy_loss(m, "CauchyLoss",
+                        "Cauchy loss, residuals much larger than ``k`` have "
+                        "little weight.");
+    cauchy_loss.def(py::init<double>(), "k"_a)
+            .def_readwrite("k", &registration::CauchyLoss::k_,
+                           "float: Scale of the loss.")
+            .def("__repr__", [](const registration::CauchyLoss &loss) {
+                return std::string("CauchyLoss with k = ") +
+                       std::to_string(loss.k_);
+            });
+
+    // open3d.registration.TukeyLoss: RobustKernel
+    py::class_<registration::TukeyLoss, registration::RobustKernel> tukey_loss(
+            m, "TukeyLoss",
+            "Tukey's biweight loss, residuals larger than ``k`` are ignored.");
+    tukey_loss.def(py::init<double>(), "k"_a)
+            .def_readwrite("k", &registration::TukeyLoss::k_,
+                           "float: Threshold of the loss.")
+            .def("__repr__", [](const registration::TukeyLoss &loss) {
+                return std::string("TukeyLoss with k = ") +
+                       std::to_string(loss.k_);
+            });
+
     // ope3dn.registration.CorrespondenceChecker
     py::class_<registration::CorrespondenceChecker,
                PyCorrespondenceChecker<registration::CorrespondenceChecker>>
@@ -450,6 +527,55 @@ must hold true for all edges.)");
                             std::to_string(c.maximum_tuple_count_);
                  });
 
+    // open3d.registration.PointCloudPyramid
+    py::class_<registration::PointCloudPyramid,
+               std::shared_ptr<registration::PointCloudPyramid>>
+            pyramid(m, "PointCloudPyramid",
+                    "Point cloud voxel down-sampled once per level, from "
+                    "coarse to fine, with normals and a KD-tree on every "
+                    "level. It serves as source or target of any number of "
+                    "multi-scale registrations.");
+    pyramid.def(py::init<const geometry::PointCloud &,
+                         const std::vector<double> &, bool>(),
+                "cloud"_a, "voxel_sizes"_a, "with_color_gradients"_a = false)
+            .def_static("create_source",
+                        &registration::PointCloudPyramid::CreateSource,
+                        "Factory function to create a pyramid that can only "
+                        "be a source, without KD-trees or color gradients.",
+                        "cloud"_a, "voxel_sizes"_a)
+            .def("is_target", &registration::PointCloudPyramid::IsTarget,
+                 "Returns ``True`` if the pyramid can be a target.")
+            .def("num_levels", &registration::PointCloudPyramid::NumLevels,
+                 "Returns the number of levels.")
+            .def("get_voxel_size",
+                 &registration::PointCloudPyramid::GetVoxelSize, "level"_a,
+                 "Returns the voxel size of a level.")
+            .def("get_point_cloud",
+                 [](const registration::PointCloudPyramid &pyramid,
+                    size_t level) {
+                     return geometry::PointCloud(pyramid.GetPointCloud(level));
+                 },
+                 "level"_a, "Returns a copy of the point cloud of a level.")
+            .def("has_color_gradients",
+                 &registration::PointCloudPyramid::HasColorGradients,
+                 "Returns ``True`` if the levels can be targets of colored "
+                 "ICP.")
+            .def("__repr__", [](const registration::PointCloudPyramid &p) {
+                return std::string("registration::PointCloudPyramid with ") +
+                       std::to_string(p.NumLevels()) + std::string(" levels");
+            });
+    docstring::ClassMethodDocInject(
+            m, "PointCloudPyramid", "__init__",
+            {{"cloud", "The point cloud."},
+             {"voxel_sizes", "Voxel sizes of the levels, coarse to fine."},
+             {"with_color_gradients",
+              "Set to ``True`` to prepare the levels as colored ICP "
+              "targets."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloudPyramid", "create_source",
+            {{"cloud", "The point cloud."},
+             {"voxel_sizes", "Voxel sizes of the levels, coarse to fine."}});
+
     // ope3dn.registration.RegistrationResult
     py::class_<registration::RegistrationResult> registration_result(
             m, "RegistrationResult",
@@ -506,6 +632,7 @@ static const std::unordered_map<std::string, std::string>
                  "(``registration::TransformationEstimationPointToPoint``, "
                  "``registration::TransformationEstimationPointToPlane``)"},
                 {"init", "Initial transformation estimation"},
+                {"kernel", "Robust loss that reweights the residuals"},
                 {"lambda_geometric", "lambda_geometric value"},
                 {"max_correspondence_distance",
                  "Maximum correspondence points-pair distance."},
@@ -521,13 +648,24 @@ static const std::unordered_map<std::string, std::string>
 
 void pybind_registration_methods(py::module &m) {
     m.def("evaluate_registration", &registration::EvaluateRegistration,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for evaluating registration between point clouds",
           "source"_a, "target"_a, "max_correspondence_distance"_a,
           "transformation"_a = Eigen::Matrix4d::Identity());
     docstring::FunctionDocInject(m, "evaluate_registration",
                                  map_shared_argument_docstrings);
 
-    m.def("registration_icp", &registration::RegistrationICP,
+    m.def("registration_icp",
+          [](const geometry::PointCloud &source,
+             const geometry::PointCloud &target,
+             double max_correspondence_distance, const Eigen::Matrix4d &init,
+             const registration::TransformationEstimation &estimation,
+             const registration::ICPConvergenceCriteria &criteria) {
+              return registration::RegistrationICP(
+                      source, target, max_correspondence_distance, init,
+                      estimation, criteria);
+          },
+          py::call_guard<py::gil_scoped_release>(),
           "Function for ICP registration", "source"_a, "target"_a,
           "max_correspondence_distance"_a,
           "init"_a = Eigen::Matrix4d::Identity(),
@@ -537,17 +675,54 @@ void pybind_registration_methods(py::module &m) {
     docstring::FunctionDocInject(m, "registration_icp",
                                  map_shared_argument_docstrings);
 
-    m.def("registration_colored_icp", &registration::RegistrationColoredICP,
+    m.def("registration_colored_icp",
+          [](const geometry::PointCloud &source,
+             const geometry::PointCloud &target, double max_distance,
+             const Eigen::Matrix4d &init,
+             const registration::ICPConvergenceCriteria &criteria,
+             double lambda_geometric,
+             const registration::RobustKernel &kernel) {
+              return registration::RegistrationColoredICP(
+                      source, target, max_distance, init, criteria,
+                      lambda_geometric, kernel);
+          },
+          py::call_guard<py::gil_scoped_release>(),
           "Function for Colored ICP registration", "source"_a, "target"_a,
           "max_correspondence_distance"_a,
           "init"_a = Eigen::Matrix4d::Identity(),
           "criteria"_a = registration::ICPConvergenceCriteria(),
-          "lambda_geometric"_a = 0.968);
+          "lambda_geometric"_a = 0.968,
+          "kernel"_a = registration::L2Loss());
     docstring::FunctionDocInject(m, "registration_colored_icp",
                                  map_shared_argument_docstrings);
 
+    m.def("registration_multi_scale_icp",
+          &registration::RegistrationMultiScaleICP,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for coarse-to-fine ICP registration between point cloud "
+          "pyramids",
+          "source"_a, "target"_a, "max_correspondence_distances"_a,
+          "criteria"_a, "init"_a = Eigen::Matrix4d::Identity(),
+          "estimation_type"_a =
+                  registration::TransformationEstimationType::PointToPlane,
+          "lambda_geometric"_a = 0.968);
+    docstring::FunctionDocInject(
+            m, "registration_multi_scale_icp",
+            {{"source", "The source point cloud pyramid."},
+             {"target",
+              "The target point cloud pyramid, with the same number of "
+              "levels."},
+             {"max_correspondence_distances",
+              "Maximum correspondence points-pair distance of every level."},
+             {"criteria", "Convergence criteria of every level."},
+             {"init", "Initial transformation estimation"},
+             {"estimation_type",
+              "One of (``PointToPoint``, ``PointToPlane``, ``ColoredICP``)"},
+             {"lambda_geometric", "lambda_geometric value of colored ICP"}});
+
     m.def("registration_ransac_based_on_correspondence",
           &registration::RegistrationRANSACBasedOnCorrespondence,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for global RANSAC registration based on a set of "
           "correspondences",
           "source"_a, "target"_a, "corres"_a, "max_correspondence_distance"_a,
@@ -561,6 +736,7 @@ void pybind_registration_methods(py::module &m) {
 
     m.def("registration_ransac_based_on_feature_matching",
           &registration::RegistrationRANSACBasedOnFeatureMatching,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for global RANSAC registration based on feature matching",
           "source"_a, "target"_a, "source_feature"_a, "target_feature"_a,
           "max_correspondence_distance"_a,
@@ -576,6 +752,7 @@ void pybind_registration_methods(py::module &m) {
 
     m.def("registration_fast_based_on_feature_matching",
           &registration::FastGlobalRegistration,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for fast global registration based on feature matching",
           "source"_a, "target"_a, "source_feature"_a, "target_feature"_a,
           "option"_a = registration::FastGlobalRegistrationOption());
@@ -585,6 +762,7 @@ void pybind_registration_methods(py::module &m) {
 
     m.def("get_information_matrix_from_point_clouds",
           &registration::GetInformationMatrixFromPointClouds,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for computing information matrix from transformation "
           "matrix",
           "source"_a, "target"_a, "max_correspondence_distance"_a,
@@ -0,0 +1,74 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/Profiler.h"
+#include "Python/docstring.h"
+#include "Python/open3d_pybind.h"
+#include "Python/utility/utility.h"
+
+using namespace open3d;
+
+void pybind_profiler(py::module &m) {
+    m.def("enable_profiler",
+          [](size_t events_per_thread) {
+              utility::Profiler::GetInstance().Enable(events_per_thread);
+          },
+          "Start recording the instrumented scopes and counters of Open3D",
+          py::arg("events_per_thread") = 1 << 16);
+    docstring::FunctionDocInject(
+            m, "enable_profiler",
+            {{"events_per_thread",
+              "Size of the ring buffer of every thread, older events are "
+              "overwritten once it is full."}});
+
+    m.def("disable_profiler",
+          []() { utility::Profiler::GetInstance().Disable(); },
+          "Stop recording profiler events");
+    docstring::FunctionDocInject(m, "disable_profiler");
+
+    m.def("clear_profiler", []() { utility::Profiler::GetInstance().Clear(); },
+          "Discard all recorded profiler events");
+    docstring::FunctionDocInject(m, "clear_profiler");
+
+    m.def("write_profiler_trace",
+          [](const std::string &filename) {
+              return utility::Profiler::GetInstance().WriteChromeTrace(
+                      filename);
+          },
+          "Write the recorded profiler events in the Chrome trace format",
+          py::arg("filename"));
+    docstring::FunctionDocInject(
+            m, "write_profiler_trace",
+            {{"filename",
+              "Path of the JSON file, which can be opened in "
+              "chrome://tracing."}});
+
+    m.def("print_profiler_summary",
+          []() { utility::Profiler::GetInstance().PrintSummary(); },
+          "Print the number of calls and the time spent in every profiled "
+          "scope");
+    docstring::FunctionDocInject(m, "print_profiler_summary");
+}
@@ -32,3 +32,4 @@ void pybind_utility(py::module &m);
 
 void pybind_console(py::module &m);
 void pybind_eigen(py::module &m);
+void pybind_profiler(py::module &m);
@@ -0,0 +1,179 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+#include <random>
+
+#include "Open3D/Open3D.h"
+
+void PrintHelp() {
+    using namespace open3d;
+    PrintOpen3DVersion();
+    // clang-format off
+    utility::LogInfo("Usage:\n");
+    utility::LogInfo("    > BenchmarkOutlierRemoval [options]\n");
+    utility::LogInfo("      Time radius and statistical outlier removal against a plain KD tree\n");
+    utility::LogInfo("      search on noisy synthetic scans of a sphere.\n");
+    utility::LogInfo("\n");
+    utility::LogInfo("Options (listed in the order of execution priority):\n");
+    utility::LogInfo("    --help, -h                : Print help information.\n");
+    utility::LogInfo("    --verbose n               : Set verbose level (0-5, default 4).\n");
+    utility::LogInfo("    --sizes [n,...]           : Point counts (default [1e6,1e7,5e7]).\n");
+    utility::LogInfo("    --nb_points n             : Radius outlier neighbour count (default 8).\n");
+    utility::LogInfo("    --nb_neighbors n          : Statistical outlier neighbour count (default 20).\n");
+    utility::LogInfo("    --skip_kdtree             : Only time the default implementation.\n");
+    // clang-format on
+}
+
+namespace {
+
+using namespace open3d;
+
+/// Points on a unit sphere with a little noise, plus one percent of uniform
+/// outliers in the surrounding box.
+std::shared_ptr<geometry::PointCloud> CreateScan(size_t num_points) {
+    auto cloud = std::make_shared<geometry::PointCloud>();
+    cloud->points_.resize(num_points);
+    std::mt19937 rng(0);
+    std::normal_distribution<double> normal(0.0, 1.0);
+    std::uniform_real_distribution<double> uniform(-2.0, 2.0);
+    double spacing = std::sqrt(4.0 * M_PI / double(num_points));
+    for (size_t i = 0; i < num_points; i++) {
+        Eigen::Vector3d &point = cloud->points_[i];
+        if (i % 100 == 0) {
+            point = Eigen::Vector3d(uniform(rng), uniform(rng), uniform(rng));
+        } else {
+            point = Eigen::Vector3d(normal(rng), normal(rng), normal(rng));
+            point = point.normalized() * (1.0 + 0.5 * spacing * normal(rng));
+        }
+    }
+    return cloud;
+}
+
+std::vector<size_t> RadiusInliersKDTree(const geometry::PointCloud &cloud,
+                                        size_t nb_points,
+                                        double radius) {
+    geometry::KDTreeFlann kdtree(cloud);
+    std::vector<char> mask(cloud.points_.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(cloud.points_.size()); i++) {
+        std::vector<int> indices;
+        std::vector<double> dists;
+        mask[i] = size_t(kdtree.SearchRadius(cloud.points_[i], radius, indices,
+                                             dists)) > nb_points;
+    }
+    std::vector<size_t> inliers;
+    for (size_t i = 0; i < mask.size(); i++) {
+        if (mask[i]) {
+            inliers.push_back(i);
+        }
+    }
+    return inliers;
+}
+
+void AverageDistancesKDTree(const geometry::PointCloud &cloud,
+                            size_t nb_neighbors) {
+    geometry::KDTreeFlann kdtree(cloud);
+    std::vector<double> avg_distances(cloud.points_.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(cloud.points_.size()); i++) {
+        std::vector<int> indices;
+        std::vector<double> dists;
+        kdtree.SearchKNN(cloud.points_[i], int(nb_neighbors), indices, dists);
+        double sum = 0.0;
+        for (double dist : dists) {
+            sum += std::sqrt(dist);
+        }
+        avg_distances[i] = sum / dists.size();
+    }
+}
+
+}  // unnamed namespace
+
+int main(int argc, char **argv) {
+    using namespace open3d;
+
+    if (utility::ProgramOptionExists(argc, argv, "--help") ||
+        utility::ProgramOptionExists(argc, argv, "-h")) {
+        PrintHelp();
+        return 0;
+    }
+    int verbose = utility::GetProgramOptionAsInt(argc, argv, "--verbose", 4);
+    utility::SetVerbosityLevel((utility::VerbosityLevel)verbose);
+    Eigen::VectorXd default_sizes(3);
+    default_sizes << 1e6, 1e7, 5e7;
+    Eigen::VectorXd sizes = utility::GetProgramOptionAsEigenVectorXd(
+            argc, argv, "--sizes", default_sizes);
+    size_t nb_points = size_t(
+            utility::GetProgramOptionAsInt(argc, argv, "--nb_points", 8));
+    size_t nb_neighbors = size_t(
+            utility::GetProgramOptionAsInt(argc, argv, "--nb_neighbors", 20));
+    bool skip_kdtree =
+            utility::ProgramOptionExists(argc, argv, "--skip_kdtree");
+
+    for (int s = 0; s < sizes.size(); s++) {
+        size_t num_points = size_t(sizes(s));
+        auto cloud = CreateScan(num_points);
+        // about eight surface samples fall into the search sphere
+        double radius = 1.6 * std::sqrt(4.0 * M_PI / double(num_points));
+        utility::LogInfo("{:d} points, radius {:f}\n", num_points, radius);
+
+        utility::Timer timer;
+        timer.Start();
+        auto radius_result = cloud->RemoveRadiusOutliers(nb_points, radius);
+        timer.Stop();
+        utility::LogInfo("    RemoveRadiusOutliers      {:10.1f} ms\n",
+                         timer.GetDuration());
+        if (!skip_kdtree) {
+            timer.Start();
+            auto inliers = RadiusInliersKDTree(*cloud, nb_points, radius);
+            timer.Stop();
+            utility::LogInfo("    KD tree radius search     {:10.1f} ms{}\n",
+                             timer.GetDuration(),
+                             inliers == std::get<1>(radius_result)
+                                     ? ""
+                                     : "  (inliers differ)");
+        }
+
+        timer.Start();
+        cloud->RemoveStatisticalOutliers(nb_neighbors, 2.0);
+        timer.Stop();
+        utility::LogInfo("    RemoveStatisticalOutliers {:10.1f} ms\n",
+                         timer.GetDuration());
+        if (!skip_kdtree) {
+            timer.Start();
+            AverageDistancesKDTree(*cloud, nb_neighbors);
+            timer.Stop();
+            utility::LogInfo("    KD tree KNN search        {:10.1f} ms\n",
+                             timer.GetDuration());
+        }
+    }
+    return 0;
+}
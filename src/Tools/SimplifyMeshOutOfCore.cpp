@@ -0,0 +1,81 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Open3D.h"
+
+void PrintHelp() {
+    using namespace open3d;
+    PrintOpen3DVersion();
+    // clang-format off
+    utility::LogInfo("Usage:\n");
+    utility::LogInfo("    > SimplifyMeshOutOfCore source_file target_file voxel_size [options]\n");
+    utility::LogInfo("      Simplify a PLY or binary STL mesh file that does not need to fit into\n");
+    utility::LogInfo("      memory by out-of-core vertex clustering.\n");
+    utility::LogInfo("\n");
+    utility::LogInfo("Options (listed in the order of execution priority):\n");
+    utility::LogInfo("    --help, -h                : Print help information.\n");
+    utility::LogInfo("    --verbose n               : Set verbose level (0-4).\n");
+    utility::LogInfo("    --chunk_size n            : Number of triangles read per chunk (default 65536).\n");
+    utility::LogInfo("    --average                 : Place the cell vertices at the average position\n");
+    utility::LogInfo("                                instead of minimizing the quadric error.\n");
+    // clang-format on
+}
+
+int main(int argc, char **argv) {
+    using namespace open3d;
+
+    utility::SetVerbosityLevel(utility::VerbosityLevel::Debug);
+    if (argc <= 3 || utility::ProgramOptionExists(argc, argv, "--help") ||
+        utility::ProgramOptionExists(argc, argv, "-h")) {
+        PrintHelp();
+        return 0;
+    }
+    int verbose = utility::GetProgramOptionAsInt(argc, argv, "--verbose", 2);
+    utility::SetVerbosityLevel((utility::VerbosityLevel)verbose);
+    int chunk_size =
+            utility::GetProgramOptionAsInt(argc, argv, "--chunk_size", 65536);
+    auto contraction =
+            geometry::TriangleMesh::SimplificationContraction::Quadric;
+    if (utility::ProgramOptionExists(argc, argv, "--average")) {
+        contraction =
+                geometry::TriangleMesh::SimplificationContraction::Average;
+    }
+
+    double voxel_size = std::stod(argv[3]);
+    auto mesh_ptr = io::SimplifyTriangleMeshFromFile(
+            argv[1], voxel_size, contraction, size_t(chunk_size),
+            verbose >= 2);
+    if (mesh_ptr->IsEmpty()) {
+        utility::LogWarning("Failed to simplify {}.\n", argv[1]);
+        return 1;
+    }
+    utility::LogInfo("Simplified mesh has {:d} vertices and {:d} triangles.\n",
+                     mesh_ptr->vertices_.size(), mesh_ptr->triangles_.size());
+    if (!io::WriteTriangleMesh(argv[2], *mesh_ptr)) {
+        return 1;
+    }
+    return 0;
+}
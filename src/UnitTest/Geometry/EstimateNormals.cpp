@@ -24,14 +24,62 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cmath>
+#include <random>
+
+#include "Open3D/Geometry/PointCloud.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
-TEST(EstimateNormals, DISABLED_FastEigen3x3) { unit_test::NotImplemented(); }
+TEST(EstimateNormals, FastEigen3x3) {
+    // more points than one block, and not a multiple of the block size,
+    // with some isolated points far away from the surface
+    geometry::PointCloud fast = WavySurface(1000, 0);
+    for (int i = 0; i < 3; i++) {
+        fast.points_.push_back(Eigen::Vector3d(10.0 * (i + 1), 0.0, 0.0));
+    }
+    geometry::PointCloud accurate = fast;
+    const geometry::KDTreeSearchParamHybrid param(0.1, 30);
+    fast.EstimateNormals(param, true);
+    accurate.EstimateNormals(param, false);
+    ASSERT_EQ(fast.points_.size(), fast.normals_.size());
+    for (size_t i = 0; i < fast.normals_.size(); i++) {
+        EXPECT_NEAR(1.0, fast.normals_[i].norm(), THRESHOLD_1E_6);
+        EXPECT_NEAR(1.0, std::abs(fast.normals_[i].dot(accurate.normals_[i])),
+                    THRESHOLD_1E_6);
+    }
+    // isolated points have no neighbours and get the default normal
+    for (size_t i = 1000; i < fast.normals_.size(); i++) {
+        ExpectEQ(Eigen::Vector3d(0.0, 0.0, 1.0), fast.normals_[i]);
+    }
+}
 
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
-TEST(EstimateNormals, DISABLED_ComputeNormal) { unit_test::NotImplemented(); }
+TEST(EstimateNormals, ComputeNormal) {
+    geometry::PointCloud cloud;
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    for (size_t i = 0; i < 200; i++) {
+        double x = uniform(rng);
+        double y = uniform(rng);
+        cloud.points_.push_back(Eigen::Vector3d(x, y, 0.5 * x + 0.2 * y));
+    }
+    const Eigen::Vector3d plane_normal =
+            Eigen::Vector3d(-0.5, -0.2, 1.0).normalized();
+    for (bool fast_normal_computation : {true, false}) {
+        cloud.normals_.clear();
+        cloud.EstimateNormals(geometry::KDTreeSearchParamKNN(10),
+                              fast_normal_computation);
+        for (const Eigen::Vector3d &normal : cloud.normals_) {
+            EXPECT_NEAR(1.0, std::abs(normal.dot(plane_normal)),
+                        THRESHOLD_1E_6);
+        }
+    }
+}
@@ -0,0 +1,176 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <Eigen/Eigenvalues>
+#include <Eigen/Geometry>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "Open3D/Geometry/FastEigen3x3.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+// Covariance of num_points random points spread by the given axis lengths,
+// rotated randomly.
+Eigen::Matrix3d RandomCovariance(std::mt19937 &rng,
+                                 const Eigen::Vector3d &axes,
+                                 int num_points) {
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    Eigen::Quaterniond orientation(uniform(rng), uniform(rng), uniform(rng),
+                                   uniform(rng));
+    const Eigen::Matrix3d rotation = orientation.normalized().matrix();
+    Eigen::Vector3d mean = Eigen::Vector3d::Zero();
+    Eigen::Matrix3d second_moment = Eigen::Matrix3d::Zero();
+    for (int i = 0; i < num_points; i++) {
+        Eigen::Vector3d point(axes(0) * uniform(rng), axes(1) * uniform(rng),
+                              axes(2) * uniform(rng));
+        point = rotation * point;
+        mean += point;
+        second_moment += point * point.transpose();
+    }
+    mean /= num_points;
+    return second_moment / num_points - mean * mean.transpose();
+}
+
+// Matrices with distinct eigenvalues, followed by degenerate ones that the
+// vectorized kernels leave to the scalar solver or solve up to a choice
+// within a repeated eigenvalue.
+std::vector<Eigen::Matrix3d> TestMatrices(int *num_distinct) {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::vector<Eigen::Matrix3d> matrices;
+    for (int i = 0; i < 200; i++) {
+        Eigen::Vector3d axes(1.0 + uniform(rng), 0.5 + 0.3 * uniform(rng),
+                             0.05 + 0.1 * uniform(rng));
+        matrices.push_back(RandomCovariance(rng, axes, 30));
+    }
+    for (double scale : {1e-12, 1e6}) {
+        matrices.push_back(scale * RandomCovariance(
+                                           rng, Eigen::Vector3d(1, 0.5, 0.1),
+                                           30));
+    }
+    *num_distinct = (int)matrices.size();
+
+    matrices.push_back(Eigen::Matrix3d::Zero());
+    matrices.push_back(Eigen::Vector3d(0.3, 0.1, 0.2).asDiagonal());
+    matrices.push_back(Eigen::Matrix3d::Identity());
+    // a plane and a line
+    matrices.push_back(RandomCovariance(rng, Eigen::Vector3d(1, 1, 0), 30));
+    matrices.push_back(RandomCovariance(rng, Eigen::Vector3d(1, 0, 0), 30));
+    // two equal eigenvalues, the third larger or smaller
+    Eigen::Matrix3d rotation =
+            RigidMotion(0.7, Eigen::Vector3d::Zero()).block<3, 3>(0, 0);
+    matrices.push_back(rotation * Eigen::Vector3d(1, 1, 2).asDiagonal() *
+                       rotation.transpose());
+    matrices.push_back(rotation * Eigen::Vector3d(1, 2, 2).asDiagonal() *
+                       rotation.transpose());
+    for (Eigen::Matrix3d &A : matrices) {
+        A = 0.5 * (A + A.transpose()).eval();
+    }
+    return matrices;
+}
+
+std::vector<geometry::FastEigen3x3Kernel> Kernels() {
+    return {geometry::FastEigen3x3Kernel::Scalar,
+            geometry::FastEigen3x3Kernel::SIMD128,
+            geometry::FastEigen3x3Kernel::AVX2};
+}
+
+}  // unnamed namespace
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(FastEigen3x3, FastEigen3x3) {
+    int num_distinct;
+    std::vector<Eigen::Matrix3d> matrices = TestMatrices(&num_distinct);
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver;
+    for (const Eigen::Matrix3d &A : matrices) {
+        Eigen::Vector3d evec = geometry::FastEigen3x3(A);
+        if (A == Eigen::Matrix3d::Zero()) {
+            ExpectEQ(Eigen::Vector3d(0.0, 0.0, 0.0), evec);
+            continue;
+        }
+        solver.compute(A, Eigen::EigenvaluesOnly);
+        EXPECT_NEAR(1.0, evec.norm(), 1e-12);
+        EXPECT_NEAR(solver.eigenvalues()(0), evec.dot(A * evec),
+                    1e-10 * solver.eigenvalues()(2));
+    }
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(FastEigen3x3, Block) {
+    int num_distinct;
+    std::vector<Eigen::Matrix3d> matrices = TestMatrices(&num_distinct);
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver;
+    for (geometry::FastEigen3x3Kernel kernel : Kernels()) {
+        if (kernel > geometry::GetFastEigen3x3Kernel()) {
+            continue;
+        }
+        // blocks of every fill, so that partial packs are covered
+        for (size_t begin = 0; begin < matrices.size();) {
+            const int count = std::min(
+                    (int)(matrices.size() - begin),
+                    int(begin % geometry::kSymmetricMatrix3dBlockSize) + 1);
+            geometry::SymmetricMatrix3dBlock block;
+            for (int l = 0; l < count; l++) {
+                block.Set(l, matrices[begin + l]);
+                ExpectEQ(matrices[begin + l], block.Get(l), 0.0);
+            }
+            Eigen::Vector3d evecs[geometry::kSymmetricMatrix3dBlockSize];
+            geometry::FastEigen3x3(block, count, evecs, kernel);
+            for (int l = 0; l < count; l++) {
+                const Eigen::Matrix3d &A = matrices[begin + l];
+                // the scalar kernel is the per-matrix solver, bit for bit
+                Eigen::Vector3d reference = geometry::FastEigen3x3(A);
+                if (kernel == geometry::FastEigen3x3Kernel::Scalar) {
+                    EXPECT_EQ(reference(0), evecs[l](0));
+                    EXPECT_EQ(reference(1), evecs[l](1));
+                    EXPECT_EQ(reference(2), evecs[l](2));
+                } else if ((int)(begin + l) < num_distinct) {
+                    ExpectEQ(reference, evecs[l], 1e-10);
+                } else if (A == Eigen::Matrix3d::Zero()) {
+                    ExpectEQ(reference, evecs[l], 0.0);
+                } else {
+                    // any eigenvector of a repeated smallest eigenvalue
+                    solver.compute(A, Eigen::EigenvaluesOnly);
+                    EXPECT_NEAR(1.0, evecs[l].norm(), 1e-12);
+                    EXPECT_NEAR(solver.eigenvalues()(0),
+                                evecs[l].dot(A * evecs[l]),
+                                1e-10 * solver.eigenvalues()(2));
+                }
+            }
+            begin += count;
+        }
+    }
+}
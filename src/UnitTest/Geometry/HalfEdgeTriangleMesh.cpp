@@ -289,6 +289,33 @@ TEST(HalfEdgeTriangleMesh, Constructor_Sphere) {
     EXPECT_FALSE(he_mesh->IsEmpty());
 }
 
+TEST(HalfEdgeTriangleMesh, OneRingHalfEdges_Sphere) {
+    auto mesh = geometry::HalfEdgeTriangleMesh::CreateFromMesh(
+            *geometry::TriangleMesh::CreateSphere(1.0, 10));
+    EXPECT_FALSE(mesh->IsEmpty());
+    for (size_t he = 0; he < mesh->half_edges_.size(); ++he) {
+        const auto& half_edge = mesh->half_edges_[he];
+        ASSERT_FALSE(half_edge.IsBoundary());
+        const auto& twin = mesh->half_edges_[half_edge.twin_];
+        EXPECT_EQ(twin.twin_, int(he));
+        EXPECT_EQ(twin.vertex_indices_(0), half_edge.vertex_indices_(1));
+        EXPECT_EQ(twin.vertex_indices_(1), half_edge.vertex_indices_(0));
+        EXPECT_EQ(mesh->half_edges_[half_edge.next_].vertex_indices_(0),
+                  half_edge.vertex_indices_(1));
+    }
+    size_t num_ring_half_edges = 0;
+    for (int vidx = 0; vidx < int(mesh->vertices_.size()); ++vidx) {
+        auto ring = mesh->OneRingHalfEdges(vidx);
+        EXPECT_EQ(std::vector<int>(ring.begin(), ring.end()),
+                  mesh->ordered_half_edge_from_vertex_[vidx]);
+        for (int he : ring) {
+            EXPECT_EQ(mesh->half_edges_[he].vertex_indices_(0), vidx);
+        }
+        num_ring_half_edges += ring.size();
+    }
+    EXPECT_EQ(num_ring_half_edges, mesh->half_edges_.size());
+}
+
 TEST(HalfEdgeTriangleMesh, OrderedHalfEdgesFromVertex_TwoTriangles) {
     auto mesh = geometry::HalfEdgeTriangleMesh::CreateFromMesh(
             get_mesh_two_triangles());
@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <random>
+
 #include "Open3D/Geometry/Image.h"
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
 #include "TestUtility/UnitTest.h"
@@ -1016,3 +1018,94 @@ TEST(Image, CreatePyramid) {
         expected_height /= 2;
     }
 }
+
+// ----------------------------------------------------------------------------
+// Filtering into an existing image gives the same result as the allocating
+// functions and reuses the output buffer.
+// ----------------------------------------------------------------------------
+TEST(Image, FilterIntoOutput) {
+    geometry::Image image;
+    image.Prepare(37, 23, 1, 4);
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    for (int v = 0; v < image.height_; v++) {
+        for (int u = 0; u < image.width_; u++) {
+            *image.PointerAt<float>(u, v) = dist(rng);
+        }
+    }
+
+    geometry::Image output;
+    output.Prepare(image.width_, image.height_, 1, 4);
+    const uint8_t *data = output.data_.data();
+    for (auto type : {FilterType::Gaussian3, FilterType::Gaussian5,
+                      FilterType::Gaussian7, FilterType::Sobel3Dx,
+                      FilterType::Sobel3Dy}) {
+        EXPECT_TRUE(image.Filter(type, output));
+        EXPECT_EQ(data, output.data_.data());
+        EXPECT_EQ(image.Filter(type)->data_, output.data_);
+
+        EXPECT_TRUE(image.FilterAndDownsample(type, output));
+        EXPECT_EQ(image.width_ / 2, output.width_);
+        EXPECT_EQ(image.height_ / 2, output.height_);
+        EXPECT_EQ(image.Filter(type)->Downsample()->data_, output.data_);
+    }
+
+    geometry::Image filtered = image;
+    EXPECT_TRUE(filtered.Filter(FilterType::Gaussian5, filtered));
+    EXPECT_EQ(image.Filter(FilterType::Gaussian5)->data_, filtered.data_);
+
+    geometry::Image color;
+    color.Prepare(5, 5, 3, 1);
+    EXPECT_FALSE(color.Filter(FilterType::Gaussian3, output));
+    EXPECT_TRUE(output.IsEmpty());
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(Image, CreatePyramidIntoOutput) {
+    geometry::Image image;
+    image.Prepare(33, 21, 1, 4);
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    for (int v = 0; v < image.height_; v++) {
+        for (int u = 0; u < image.width_; u++) {
+            *image.PointerAt<float>(u, v) = dist(rng);
+        }
+    }
+
+    for (bool with_gaussian_filter : {true, false}) {
+        geometry::ImagePyramid pyramid;
+        EXPECT_TRUE(image.CreatePyramid(4, with_gaussian_filter, pyramid));
+        vector<geometry::Image *> levels;
+        for (auto &level : pyramid) {
+            levels.push_back(level.get());
+        }
+        EXPECT_TRUE(image.CreatePyramid(4, with_gaussian_filter, pyramid));
+
+        geometry::ImagePyramid ref(1, std::make_shared<geometry::Image>(image));
+        for (size_t i = 1; i < 4; i++) {
+            ref.push_back(with_gaussian_filter
+                                  ? ref[i - 1]
+                                            ->Filter(FilterType::Gaussian3)
+                                            ->Downsample()
+                                  : ref[i - 1]->Downsample());
+        }
+        ASSERT_EQ(ref.size(), pyramid.size());
+        for (size_t i = 0; i < pyramid.size(); i++) {
+            EXPECT_EQ(levels[i], pyramid[i].get());
+            EXPECT_EQ(ref[i]->width_, pyramid[i]->width_);
+            EXPECT_EQ(ref[i]->height_, pyramid[i]->height_);
+            EXPECT_EQ(ref[i]->data_, pyramid[i]->data_);
+        }
+
+        geometry::ImagePyramid filtered;
+        EXPECT_TRUE(geometry::Image::FilterPyramid(
+                pyramid, FilterType::Sobel3Dx, filtered));
+        ASSERT_EQ(pyramid.size(), filtered.size());
+        for (size_t i = 0; i < pyramid.size(); i++) {
+            EXPECT_EQ(pyramid[i]->Filter(FilterType::Sobel3Dx)->data_,
+                      filtered[i]->data_);
+        }
+    }
+}
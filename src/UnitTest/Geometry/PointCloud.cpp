@@ -25,9 +25,12 @@
 // ----------------------------------------------------------------------------
 
 #include <algorithm>
+#include <cmath>
+#include <random>
 
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
 #include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/RGBDImage.h"
 #include "TestUtility/UnitTest.h"
@@ -643,6 +646,115 @@ TEST(PointCloud, CropPointCloud) {
     ExpectGE(maxBound, output_pc->points_);
 }
 
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(PointCloud, RemoveRadiusOutliers) {
+    geometry::PointCloud pc;
+
+    // sparse background plus a dense blob, so that both whole cells and
+    // single points are accepted
+    mt19937 rng(0);
+    uniform_real_distribution<double> uniform(0.0, 1.0);
+    for (int i = 0; i < 4000; i++) {
+        Vector3d point(uniform(rng), uniform(rng), uniform(rng));
+        if (i < 2000) {
+            pc.points_.push_back(point * 100.0);
+        } else {
+            pc.points_.push_back(Vector3d(40.0, 40.0, 40.0) + point * 10.0);
+        }
+    }
+
+    geometry::KDTreeFlann kdtree(pc);
+    for (double radius : {2.0, 7.5, 20.0}) {
+        for (size_t nb_points : {1, 4, 16}) {
+            vector<size_t> ref;
+            for (size_t i = 0; i < pc.points_.size(); i++) {
+                vector<int> indices;
+                vector<double> dists;
+                if (size_t(kdtree.SearchRadius(pc.points_[i], radius, indices,
+                                               dists)) > nb_points) {
+                    ref.push_back(i);
+                }
+            }
+
+            shared_ptr<geometry::PointCloud> output_pc;
+            vector<size_t> indices;
+            tie(output_pc, indices) =
+                    pc.RemoveRadiusOutliers(nb_points, radius);
+            EXPECT_EQ(ref, indices);
+            ASSERT_EQ(ref.size(), output_pc->points_.size());
+            for (size_t i = 0; i < ref.size(); i++) {
+                ExpectEQ(pc.points_[ref[i]], output_pc->points_[i]);
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(PointCloud, RemoveStatisticalOutliers) {
+    geometry::PointCloud pc;
+
+    // noisy sphere with a few far away outliers
+    mt19937 rng(0);
+    normal_distribution<double> normal(0.0, 1.0);
+    for (int i = 0; i < 5000; i++) {
+        Vector3d point(normal(rng), normal(rng), normal(rng));
+        double radius = (i % 100 == 0) ? 30.0 : 10.0 + 0.1 * normal(rng);
+        pc.points_.push_back(point.normalized() * radius);
+    }
+
+    geometry::KDTreeFlann kdtree(pc);
+    for (size_t nb_neighbors : {1, 5, 30}) {
+        vector<double> avg_distances(pc.points_.size());
+        for (size_t i = 0; i < pc.points_.size(); i++) {
+            vector<int> indices;
+            vector<double> dists;
+            kdtree.SearchKNN(pc.points_[i], int(nb_neighbors), indices,
+                             dists);
+            double sum = 0.0;
+            for (double dist : dists) {
+                sum += sqrt(dist);
+            }
+            avg_distances[i] = sum / dists.size();
+        }
+
+        for (double std_ratio : {0.5, 2.0}) {
+            shared_ptr<geometry::PointCloud> output_pc;
+            vector<size_t> indices;
+            tie(output_pc, indices) =
+                    pc.RemoveStatisticalOutliers(nb_neighbors, std_ratio);
+
+            if (nb_neighbors == 1) {
+                // every point is its own nearest neighbour
+                EXPECT_TRUE(indices.empty());
+                continue;
+            }
+            double mean = 0.0;
+            for (double avg : avg_distances) {
+                mean += avg;
+            }
+            mean /= avg_distances.size();
+            double sq_sum = 0.0;
+            for (double avg : avg_distances) {
+                sq_sum += (avg - mean) * (avg - mean);
+            }
+            double std_dev = sqrt(sq_sum / (avg_distances.size() - 1));
+            double threshold = mean + std_ratio * std_dev;
+            vector<size_t> ref;
+            for (size_t i = 0; i < avg_distances.size(); i++) {
+                if (avg_distances[i] < threshold) {
+                    ref.push_back(i);
+                }
+            }
+            EXPECT_EQ(ref, indices);
+            EXPECT_EQ(ref.size(), output_pc->points_.size());
+        }
+    }
+}
+
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
@@ -942,6 +1054,91 @@ TEST(PointCloud, ComputePointCloudNearestNeighborDistance) {
     ExpectEQ(ref, distance);
 }
 
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(PointCloud, ClusterDBSCAN) {
+    int size = 2000;
+
+    geometry::PointCloud pc;
+
+    Vector3d vmin(0.0, 0.0, 0.0);
+    Vector3d vmax(1000.0, 1000.0, 1000.0);
+
+    // the test Rand repeats after a few hundred points, use distinct ones
+    mt19937 rng(0);
+    uniform_real_distribution<double> uniform(0.0, 1.0);
+    pc.points_.resize(size);
+    for (auto &point : pc.points_) {
+        point = Vector3d(uniform(rng), uniform(rng), uniform(rng));
+        point = vmin + point.cwiseProduct(vmax - vmin);
+    }
+
+    // reference: sequential DBSCAN with brute force neighbourhoods
+    auto ClusterReference = [&](double eps, size_t min_points) {
+        vector<vector<int>> nbs(size);
+        for (int i = 0; i < size; ++i) {
+            for (int j = 0; j < size; ++j) {
+                if ((pc.points_[i] - pc.points_[j]).squaredNorm() <
+                    double(float(eps * eps))) {
+                    nbs[i].push_back(j);
+                }
+            }
+        }
+        vector<int> labels(size, -2);
+        int cluster_label = 0;
+        for (int idx = 0; idx < size; ++idx) {
+            if (labels[idx] != -2) {
+                continue;
+            }
+            if (nbs[idx].size() < min_points) {
+                labels[idx] = -1;
+                continue;
+            }
+            vector<int> queue(1, idx);
+            labels[idx] = cluster_label;
+            while (!queue.empty()) {
+                int curr = queue.back();
+                queue.pop_back();
+                for (int nb : nbs[curr]) {
+                    if (labels[nb] == -1) {
+                        labels[nb] = cluster_label;
+                    } else if (labels[nb] == -2) {
+                        labels[nb] = cluster_label;
+                        if (nbs[nb].size() >= min_points) {
+                            queue.push_back(nb);
+                        }
+                    }
+                }
+            }
+            cluster_label++;
+        }
+        return labels;
+    };
+
+    for (double eps : {40.0, 60.0, 80.0}) {
+        vector<int> ref = ClusterReference(eps, 3);
+        vector<int> labels = pc.ClusterDBSCAN(eps, 3);
+        EXPECT_GT(*max_element(ref.begin(), ref.end()), 0);
+        ExpectEQ(ref, labels);
+    }
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(PointCloud, ClusterDBSCANInvalidEps) {
+    geometry::PointCloud pc;
+    pc.points_ = {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1, 0, 0}};
+    ExpectEQ(vector<int>({0, 0, 0, 1}), pc.ClusterDBSCAN(1.0, 1));
+
+    // every point is noise, instead of dividing by eps
+    for (double eps : {0.0, -1.0, std::nan("")}) {
+        vector<int> labels = pc.ClusterDBSCAN(eps, 1);
+        ExpectEQ(vector<int>(pc.points_.size(), -1), labels);
+    }
+}
+
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
@@ -1135,3 +1332,126 @@ TEST(PointCloud, CreatePointCloudFromRGBDImage_1_4) {
                                        color_bytes_per_channel, ref_points,
                                        ref_colors);
 }
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(PointCloud, BackProjectDepthImage) {
+    const int width = 64;
+    const int height = 48;
+    geometry::Image depth;
+    depth.Prepare(width, height, 1, 2);
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int> dist(0, 4000);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            *depth.PointerAt<uint16_t>(u, v) = uint16_t(dist(rng));
+        }
+    }
+    camera::PinholeCameraIntrinsic intrinsic(width, height, 50.0, 52.0, 31.5,
+                                             23.5);
+    Matrix4d extrinsic = Matrix4d::Identity();
+    extrinsic.block<3, 3>(0, 0) =
+            AngleAxisd(0.3, Vector3d(1.0, 2.0, 3.0).normalized()).matrix();
+    extrinsic.block<3, 1>(0, 3) = Vector3d(0.5, -1.0, 2.0);
+    const double depth_scale = 1000.0;
+    const double depth_trunc = 3.0;
+    const int stride = 3;
+    const Vector4i roi(5, 7, 60, 100);
+
+    vector<Vector3d> ref;
+    Matrix4d camera_pose = extrinsic.inverse();
+    for (int v = roi(1); v < height; v += stride) {
+        for (int u = roi(0); u < roi(2); u += stride) {
+            float z = *depth.PointerAt<uint16_t>(u, v) / (float)depth_scale;
+            if (z > 0 && z < depth_trunc) {
+                Vector4d point((u - 31.5) * z / 50.0, (v - 23.5) * z / 52.0,
+                               z, 1.0);
+                ref.push_back((camera_pose * point).block<3, 1>(0, 0));
+            }
+        }
+    }
+
+    geometry::PointCloud pc;
+    EXPECT_TRUE(pc.BackProjectDepthImage(depth, intrinsic, extrinsic,
+                                         depth_scale, depth_trunc, stride,
+                                         roi));
+    ExpectEQ(ref, pc.points_);
+    EXPECT_FALSE(pc.HasColors());
+
+    auto float_depth = depth.ConvertDepthToFloatImage(depth_scale, depth_trunc);
+    geometry::PointCloud pc_float;
+    EXPECT_TRUE(pc_float.BackProjectDepthImage(
+            *float_depth, intrinsic, extrinsic, 1.0, 0.0, stride, roi));
+    ExpectEQ(ref, pc_float.points_);
+
+    auto pc_full =
+            geometry::PointCloud::CreateFromDepthImage(depth, intrinsic);
+    geometry::PointCloud pc_roi;
+    pc_roi.BackProjectDepthImage(depth, intrinsic, Matrix4d::Identity(),
+                                 1000.0, 1000.0, 1,
+                                 Vector4i(-5, -5, 1000, 1000));
+    ExpectEQ(pc_full->points_, pc_roi.points_);
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(PointCloud, BackProjectRGBDImage) {
+    const int width = 32;
+    const int height = 24;
+    geometry::Image depth;
+    geometry::Image color;
+    depth.Prepare(width, height, 1, 4);
+    color.Prepare(width, height, 3, 1);
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> dist(-0.5f, 3.0f);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            *depth.PointerAt<float>(u, v) = std::max(dist(rng), 0.0f);
+        }
+    }
+    Rand(color.data_, 0, 255, 0);
+    geometry::RGBDImage rgbd(color, depth);
+    camera::PinholeCameraIntrinsic intrinsic(width, height, 30.0, 30.0, 15.5,
+                                             11.5);
+    auto ref = geometry::PointCloud::CreateFromRGBDImage(rgbd, intrinsic);
+
+    // Reusing a cloud keeps its memory and drops the stale normals.
+    geometry::PointCloud pc;
+    pc.points_.resize(width * height);
+    pc.normals_.resize(width * height);
+    const Vector3d *data = pc.points_.data();
+    for (int i = 0; i < 3; i++) {
+        EXPECT_TRUE(pc.BackProjectRGBDImage(rgbd, intrinsic));
+        EXPECT_EQ(data, pc.points_.data());
+        ExpectEQ(ref->points_, pc.points_);
+        ExpectEQ(ref->colors_, pc.colors_);
+        EXPECT_FALSE(pc.HasNormals());
+    }
+
+    geometry::PointCloud pc_stride;
+    EXPECT_TRUE(pc_stride.BackProjectRGBDImage(
+            rgbd, intrinsic, Matrix4d::Identity(), 2, Vector4i(4, 4, 20, 20)));
+    size_t cnt = 0;
+    for (int v = 4; v < 20; v += 2) {
+        for (int u = 4; u < 20; u += 2) {
+            float z = *depth.PointerAt<float>(u, v);
+            if (z > 0) {
+                ASSERT_LT(cnt, pc_stride.points_.size());
+                ExpectEQ(Vector3d((u - 15.5) * z / 30.0, (v - 11.5) * z / 30.0,
+                                  z),
+                         pc_stride.points_[cnt]);
+                const uint8_t *p = color.PointerAt<uint8_t>(u, v, 0);
+                ExpectEQ(Vector3d(Vector3d(p[0], p[1], p[2]) / 255.0),
+                         pc_stride.colors_[cnt]);
+                cnt++;
+            }
+        }
+    }
+    EXPECT_EQ(cnt, pc_stride.points_.size());
+
+    geometry::RGBDImage rgbd_uint16(color, color);
+    EXPECT_FALSE(pc.BackProjectRGBDImage(rgbd_uint16, intrinsic));
+    EXPECT_TRUE(pc.IsEmpty());
+}
@@ -489,3 +489,57 @@ TEST(RGBDImage, CreatePyramid) {
         EXPECT_EQ(ref_depth[j], pyramid[j]->depth_.data_);
     }
 }
+
+// ----------------------------------------------------------------------------
+// Creating and filtering into an existing pyramid gives the same result as
+// the allocating functions and reuses the level images.
+// ----------------------------------------------------------------------------
+TEST(RGBDImage, CreatePyramidIntoOutput) {
+    geometry::Image color, depth;
+    color.Prepare(33, 21, 3, 1);
+    depth.Prepare(33, 21, 1, 4);
+    Rand(Cast<float>(&depth.data_[0]), depth.width_ * depth.height_, 0.0, 1.0,
+         0);
+    Rand(color.data_, 0, 255, 0);
+    auto rgbd_image =
+            geometry::RGBDImage::CreateFromColorAndDepth(color, depth);
+
+    const size_t num_of_levels = 4;
+    geometry::RGBDImagePyramid pyramid, filtered;
+    EXPECT_TRUE(rgbd_image->CreatePyramid(num_of_levels, true, false, pyramid));
+    EXPECT_TRUE(geometry::RGBDImage::FilterPyramid(
+            pyramid, geometry::Image::FilterType::Sobel3Dx, filtered));
+    vector<const uint8_t*> data;
+    for (size_t j = 0; j < num_of_levels; j++) {
+        data.push_back(pyramid[j]->color_.data_.data());
+        data.push_back(pyramid[j]->depth_.data_.data());
+        data.push_back(filtered[j]->color_.data_.data());
+        data.push_back(filtered[j]->depth_.data_.data());
+    }
+
+    EXPECT_TRUE(rgbd_image->CreatePyramid(num_of_levels, true, false, pyramid));
+    EXPECT_TRUE(geometry::RGBDImage::FilterPyramid(
+            pyramid, geometry::Image::FilterType::Sobel3Dx, filtered));
+    auto ref_pyramid = rgbd_image->CreatePyramid(num_of_levels);
+    auto ref_filtered = geometry::RGBDImage::FilterPyramid(
+            ref_pyramid, geometry::Image::FilterType::Sobel3Dx);
+    ASSERT_EQ(num_of_levels, pyramid.size());
+    ASSERT_EQ(num_of_levels, filtered.size());
+    for (size_t j = 0; j < num_of_levels; j++) {
+        EXPECT_EQ(data[4 * j], pyramid[j]->color_.data_.data());
+        EXPECT_EQ(data[4 * j + 1], pyramid[j]->depth_.data_.data());
+        EXPECT_EQ(data[4 * j + 2], filtered[j]->color_.data_.data());
+        EXPECT_EQ(data[4 * j + 3], filtered[j]->depth_.data_.data());
+        EXPECT_EQ(ref_pyramid[j]->color_.data_, pyramid[j]->color_.data_);
+        EXPECT_EQ(ref_pyramid[j]->depth_.data_, pyramid[j]->depth_.data_);
+        EXPECT_EQ(ref_filtered[j]->color_.data_, filtered[j]->color_.data_);
+        EXPECT_EQ(ref_filtered[j]->depth_.data_, filtered[j]->depth_.data_);
+    }
+
+    // the levels of the depth image are only downsampled
+    EXPECT_EQ(rgbd_image->depth_.Downsample()->data_, pyramid[1]->depth_.data_);
+
+    geometry::RGBDImage rgb(color, depth);
+    EXPECT_FALSE(rgb.CreatePyramid(num_of_levels, true, false, pyramid));
+    EXPECT_TRUE(pyramid.empty());
+}
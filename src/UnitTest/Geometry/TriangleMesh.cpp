@@ -800,6 +800,135 @@ TEST(TriangleMesh, FilterSmoothTaubin) {
     ExpectEQ(mesh->vertices_, ref2);
 }
 
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(TriangleMesh, FilterIsolatedVertex) {
+    auto mesh = std::make_shared<geometry::TriangleMesh>();
+    mesh->vertices_ = {{0, 0, 0},  {1, 0, 0},  {0, 1, 0},
+                       {-1, 0, 0}, {0, -1, 0}, {3, 3, 3}};
+    mesh->triangles_ = {{0, 1, 2}, {0, 2, 3}, {0, 3, 4}, {0, 4, 1}};
+    mesh->vertex_colors_.assign(6, Vector3d(0.2, 0.4, 0.6));
+    mesh->vertex_colors_[1] = Vector3d(1, 0, 0);
+    mesh->vertex_normals_.assign(6, Vector3d(0, 0, 1));
+
+    std::vector<std::shared_ptr<geometry::TriangleMesh>> filtered = {
+            mesh->FilterSharpen(2, 0.5), mesh->FilterSmoothSimple(2),
+            mesh->FilterSmoothLaplacian(2, 0.5),
+            mesh->FilterSmoothTaubin(2, 0.5, -0.53)};
+    for (const auto &output : filtered) {
+        for (size_t vidx = 0; vidx < output->vertices_.size(); ++vidx) {
+            EXPECT_TRUE(output->vertices_[vidx].allFinite());
+            EXPECT_TRUE(output->vertex_colors_[vidx].allFinite());
+            EXPECT_TRUE(output->vertex_normals_[vidx].allFinite());
+        }
+        // the vertex without neighbours keeps all its attributes
+        ExpectEQ(output->vertices_[5], Vector3d(3, 3, 3));
+        ExpectEQ(output->vertex_colors_[5], Vector3d(0.2, 0.4, 0.6));
+        ExpectEQ(output->vertex_normals_[5], Vector3d(0, 0, 1));
+    }
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(TriangleMesh, FilterScopeVertex) {
+    auto mesh = std::make_shared<geometry::TriangleMesh>();
+    mesh->vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {-1, 0, 0}, {0, -1, 0}};
+    mesh->triangles_ = {{0, 1, 2}, {0, 2, 3}, {0, 3, 4}, {0, 4, 1}};
+    mesh->vertex_colors_ = {
+            {1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {1, 1, 0}, {0, 1, 1}};
+    mesh->vertex_normals_ = {
+            {0, 0, 1}, {0, 1, 0}, {1, 0, 0}, {0, 0, -1}, {0, -1, 0}};
+
+    typedef geometry::TriangleMesh::FilterScope FilterScope;
+    std::vector<std::shared_ptr<geometry::TriangleMesh>> filtered = {
+            mesh->FilterSharpen(1, 1, FilterScope::Vertex),
+            mesh->FilterSmoothSimple(1, FilterScope::Vertex),
+            mesh->FilterSmoothLaplacian(1, 0.5, FilterScope::Vertex),
+            mesh->FilterSmoothTaubin(1, 0.5, -0.53, FilterScope::Vertex)};
+    std::vector<Vector3d> ref_vertices = {
+            {0, 0, 0}, {0.5, 0, 0}, {0, 0.5, 0}, {-0.5, 0, 0}, {0, -0.5, 0}};
+    ExpectEQ(filtered[2]->vertices_, ref_vertices);
+    for (const auto &output : filtered) {
+        EXPECT_TRUE(output->vertex_colors_ == mesh->vertex_colors_);
+        EXPECT_TRUE(output->vertex_normals_ == mesh->vertex_normals_);
+    }
+
+    // and the other way around
+    auto colors = mesh->FilterSmoothSimple(1, FilterScope::Color);
+    EXPECT_TRUE(colors->vertices_ == mesh->vertices_);
+    EXPECT_TRUE(colors->vertex_normals_ == mesh->vertex_normals_);
+    EXPECT_FALSE(colors->vertex_colors_ == mesh->vertex_colors_);
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(TriangleMesh, FilterAdjacencyList) {
+    auto mesh = std::make_shared<geometry::TriangleMesh>();
+    mesh->vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {-1, 0, 0}, {0, -1, 0}};
+    mesh->triangles_ = {{0, 1, 2}, {0, 2, 3}, {0, 3, 4}, {0, 4, 1}};
+
+    // a computed adjacency list gives the same result as the topology
+    auto reference = mesh->FilterSmoothTaubin(3, 0.5, -0.53);
+    mesh->ComputeAdjacencyList();
+    auto adjacency = mesh->FilterSmoothTaubin(3, 0.5, -0.53);
+    ExpectEQ(adjacency->vertices_, reference->vertices_);
+
+    // a preset adjacency list is used instead of the triangles
+    mesh->adjacency_list_ = {{1}, {0}, {}, {}, {}};
+    auto preset = mesh->FilterSmoothSimple(1);
+    std::vector<Vector3d> ref = {
+            {0.5, 0, 0}, {0.5, 0, 0}, {0, 1, 0}, {-1, 0, 0}, {0, -1, 0}};
+    ExpectEQ(preset->vertices_, ref);
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(TriangleMesh, SimplifyQuadricDecimationParallel) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    int target_number_of_triangles = 200;
+
+    auto mesh = sphere->SimplifyQuadricDecimationParallel(
+            target_number_of_triangles);
+    EXPECT_LE(int(mesh->triangles_.size()), target_number_of_triangles);
+    EXPECT_GE(int(mesh->triangles_.size()), target_number_of_triangles - 1);
+    EXPECT_TRUE(mesh->IsEdgeManifold(false));
+    for (const auto &vertex : mesh->vertices_) {
+        EXPECT_NEAR(1.0, vertex.norm(), 0.1);
+    }
+    for (const auto &triangle : mesh->triangles_) {
+        for (int k = 0; k < 3; ++k) {
+            EXPECT_GE(triangle(k), 0);
+            EXPECT_LT(triangle(k), int(mesh->vertices_.size()));
+        }
+    }
+
+    // a planar grid with boundary keeps its outline
+    geometry::TriangleMesh grid;
+    int n = 20;
+    for (int y = 0; y <= n; ++y) {
+        for (int x = 0; x <= n; ++x) {
+            grid.vertices_.push_back(Vector3d(x, y, 0));
+        }
+    }
+    for (int y = 0; y < n; ++y) {
+        for (int x = 0; x < n; ++x) {
+            int v0 = y * (n + 1) + x;
+            grid.triangles_.push_back(Vector3i(v0, v0 + 1, v0 + n + 2));
+            grid.triangles_.push_back(Vector3i(v0, v0 + n + 2, v0 + n + 1));
+        }
+    }
+    mesh = grid.SimplifyQuadricDecimationParallel(100);
+    EXPECT_LE(mesh->triangles_.size(), 100u);
+    EXPECT_GE(mesh->triangles_.size(), 99u);
+    ExpectEQ(Vector3d(0, 0, 0), mesh->GetMinBound());
+    ExpectEQ(Vector3d(n, n, 0), mesh->GetMaxBound());
+    EXPECT_NEAR(n * n, mesh->GetSurfaceArea(), 1e-6);
+}
+
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
@@ -1019,6 +1148,81 @@ TEST(TriangleMesh, IsEdgeManifold) {
     EXPECT_EQ(mesh1.IsEdgeManifold(false), false);
 }
 
+TEST(TriangleMesh, GetNonManifoldEdges) {
+    EXPECT_EQ(geometry::TriangleMesh::CreateSphere()
+                      ->GetNonManifoldEdges(false)
+                      .size(),
+              0u);
+
+    geometry::TriangleMesh mesh0;
+    mesh0.vertices_ = {{0, 0, 0}, {0, 0, 1}, {0, 1, 1}, {0, 0, 2}, {1, 0.5, 1}};
+    mesh0.triangles_ = {{0, 1, 2}, {1, 2, 3}, {1, 2, 4}};
+    std::vector<Eigen::Vector2i> edges0 = mesh0.GetNonManifoldEdges(true);
+    ASSERT_EQ(edges0.size(), 1u);
+    ExpectEQ(edges0[0], Eigen::Vector2i(1, 2));
+    EXPECT_EQ(mesh0.GetNonManifoldEdges(false).size(), 7u);
+
+    geometry::TriangleMesh mesh1;
+    mesh1.vertices_ = {{0, 0, 0}, {0, 0, 1}, {0, 1, 1}, {0, 0, 2}};
+    mesh1.triangles_ = {{0, 1, 2}, {1, 2, 3}};
+    EXPECT_EQ(mesh1.GetNonManifoldEdges(true).size(), 0u);
+    EXPECT_EQ(mesh1.GetNonManifoldEdges(false).size(), 4u);
+}
+
+TEST(TriangleMesh, OrientTriangles) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    std::vector<Eigen::Vector3i> ref = mesh->triangles_;
+    for (size_t tidx = 0; tidx < mesh->triangles_.size(); tidx += 3) {
+        std::swap(mesh->triangles_[tidx](0), mesh->triangles_[tidx](1));
+    }
+    EXPECT_TRUE(mesh->IsOrientable());
+    EXPECT_TRUE(mesh->OrientTriangles());
+
+    // Either all triangles or none are flipped w.r.t. the reference.
+    auto IsFlipped = [&](size_t tidx) {
+        Eigen::Vector3d n0 = (mesh->vertices_[ref[tidx](1)] -
+                              mesh->vertices_[ref[tidx](0)])
+                                     .cross(mesh->vertices_[ref[tidx](2)] -
+                                            mesh->vertices_[ref[tidx](0)]);
+        const Eigen::Vector3i &tria = mesh->triangles_[tidx];
+        Eigen::Vector3d n1 =
+                (mesh->vertices_[tria(1)] - mesh->vertices_[tria(0)])
+                        .cross(mesh->vertices_[tria(2)] -
+                               mesh->vertices_[tria(0)]);
+        return n0.dot(n1) < 0;
+    };
+    bool flipped = IsFlipped(0);
+    for (size_t tidx = 0; tidx < ref.size(); ++tidx) {
+        EXPECT_EQ(IsFlipped(tidx), flipped);
+    }
+
+    // Moebius strip
+    geometry::TriangleMesh moebius;
+    int n = 12;
+    for (int i = 0; i < n; ++i) {
+        double phi = 2 * M_PI * i / n;
+        for (double s : {-0.2, 0.2}) {
+            moebius.vertices_.push_back(Eigen::Vector3d(
+                    (1 + s * std::cos(phi / 2)) * std::cos(phi),
+                    (1 + s * std::cos(phi / 2)) * std::sin(phi),
+                    s * std::sin(phi / 2)));
+        }
+    }
+    for (int i = 0; i < n; ++i) {
+        int a = 2 * i;
+        int b = 2 * i + 1;
+        int c = 2 * ((i + 1) % n);
+        int d = c + 1;
+        if (i == n - 1) {
+            std::swap(c, d);
+        }
+        moebius.triangles_.push_back(Eigen::Vector3i(a, b, d));
+        moebius.triangles_.push_back(Eigen::Vector3i(a, d, c));
+    }
+    EXPECT_TRUE(moebius.IsEdgeManifold(true));
+    EXPECT_FALSE(moebius.IsOrientable());
+}
+
 TEST(TriangleMesh, IsVertexManifold) {
     EXPECT_EQ(geometry::TriangleMesh::CreateBox()->IsVertexManifold(), true);
     EXPECT_EQ(geometry::TriangleMesh::CreateSphere()->IsVertexManifold(), true);
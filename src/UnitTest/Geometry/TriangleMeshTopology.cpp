@@ -0,0 +1,157 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <thread>
+
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Geometry/TriangleMeshTopology.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+TEST(TriangleMeshTopology, Create) {
+    // two triangles sharing edge (1, 2) and a degenerate triangle
+    std::vector<Eigen::Vector3i> triangles = {{0, 1, 2}, {2, 1, 3}, {3, 3, 4}};
+    auto topology = geometry::TriangleMeshTopology::Create(triangles, 6);
+
+    EXPECT_EQ(topology->NumberOfVertices(), 6u);
+    EXPECT_EQ(topology->NumberOfTriangles(), 3u);
+
+    std::vector<Eigen::Vector2i> ref_edges = {{0, 1}, {0, 2}, {1, 2}, {1, 3},
+                                              {2, 3}, {3, 3}, {3, 4}};
+    ASSERT_EQ(topology->NumberOfEdges(), ref_edges.size());
+    for (size_t e = 0; e < ref_edges.size(); ++e) {
+        ExpectEQ(topology->edges_[e], ref_edges[e]);
+    }
+    EXPECT_EQ(topology->EdgeValence(2), 2);
+    EXPECT_EQ(topology->EdgeValence(6), 2);
+    for (size_t tidx = 0; tidx < triangles.size(); ++tidx) {
+        for (int k = 0; k < 3; ++k) {
+            Eigen::Vector2i edge =
+                    topology->edges_[topology->triangle_edges_[tidx](k)];
+            int vidx0 = triangles[tidx](k);
+            int vidx1 = triangles[tidx]((k + 1) % 3);
+            EXPECT_EQ(edge(0), std::min(vidx0, vidx1));
+            EXPECT_EQ(edge(1), std::max(vidx0, vidx1));
+        }
+    }
+
+    ExpectEQ(topology->vertex_triangle_offsets_,
+             std::vector<int>({0, 1, 3, 5, 7, 8, 8}));
+    ExpectEQ(topology->vertex_triangles_,
+             std::vector<int>({0, 0, 1, 0, 1, 1, 2, 2}));
+    ExpectEQ(topology->vertex_vertex_offsets_,
+             std::vector<int>({0, 2, 5, 8, 12, 13, 13}));
+    ExpectEQ(topology->vertex_vertices_,
+             std::vector<int>({1, 2, 0, 2, 3, 0, 1, 3, 1, 2, 3, 4, 3}));
+}
+
+TEST(TriangleMeshTopology, Cache) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    EXPECT_FALSE(mesh->IsTopologyCacheEnabled());
+    EXPECT_NE(mesh->GetTopology(), mesh->GetTopology());
+
+    mesh->EnableTopologyCache();
+    auto topology = mesh->GetTopology();
+    EXPECT_EQ(topology, mesh->GetTopology());
+    EXPECT_TRUE(mesh->IsWatertight());
+    EXPECT_EQ(topology, mesh->GetTopology());
+
+    // filters share the cache with their output
+    auto smoothed = mesh->FilterSmoothTaubin(2);
+    EXPECT_TRUE(smoothed->IsTopologyCacheEnabled());
+    EXPECT_EQ(topology, smoothed->GetTopology());
+
+    // modifying the triangles invalidates the cache
+    mesh->triangles_.push_back(mesh->triangles_[0]);
+    EXPECT_NE(topology, mesh->GetTopology());
+    mesh->RemoveDuplicatedTriangles();
+    EXPECT_EQ(mesh->GetTopology()->NumberOfTriangles(),
+              mesh->triangles_.size());
+    EXPECT_TRUE(mesh->IsEdgeManifold(false));
+
+    mesh->EnableTopologyCache(false);
+    EXPECT_NE(mesh->GetTopology(), mesh->GetTopology());
+}
+
+TEST(TriangleMeshTopology, CacheInPlaceEdit) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    mesh->EnableTopologyCache();
+    auto topology = mesh->GetTopology();
+    EXPECT_TRUE(mesh->IsOrientable());
+
+    // same number of triangles, different connectivity
+    Eigen::Vector3i &triangle = mesh->triangles_[0];
+    std::swap(triangle(0), triangle(1));
+    auto edited = mesh->GetTopology();
+    EXPECT_NE(topology, edited);
+    EXPECT_EQ(edited, mesh->GetTopology());
+    for (int k = 0; k < 3; ++k) {
+        Eigen::Vector2i edge = edited->edges_[edited->triangle_edges_[0](k)];
+        EXPECT_EQ(edge(0), std::min(triangle(k), triangle((k + 1) % 3)));
+        EXPECT_EQ(edge(1), std::max(triangle(k), triangle((k + 1) % 3)));
+    }
+
+    triangle(2) = int(mesh->vertices_.size()) - 1;
+    EXPECT_NE(edited, mesh->GetTopology());
+    EXPECT_EQ(mesh->GetTopology()->triangle_edges_.size(),
+              mesh->triangles_.size());
+
+    // adding a vertex changes the vertex adjacency
+    edited = mesh->GetTopology();
+    mesh->vertices_.push_back(Eigen::Vector3d::Zero());
+    EXPECT_NE(edited, mesh->GetTopology());
+    EXPECT_EQ(mesh->GetTopology()->NumberOfVertices(), mesh->vertices_.size());
+
+    // moving vertices keeps the topology
+    edited = mesh->GetTopology();
+    mesh->vertices_[0] *= 2.0;
+    EXPECT_EQ(edited, mesh->GetTopology());
+}
+
+TEST(TriangleMeshTopology, CacheConcurrent) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    mesh->EnableTopologyCache();
+    const geometry::TriangleMesh &const_mesh = *mesh;
+
+    const int num_threads = 4;
+    std::vector<std::shared_ptr<const geometry::TriangleMeshTopology>>
+            topologies(num_threads);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < num_threads; ++i) {
+        threads.emplace_back(
+                [&, i]() { topologies[i] = const_mesh.GetTopology(); });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (int i = 0; i < num_threads; ++i) {
+        EXPECT_EQ(topologies[0], topologies[i]);
+    }
+    EXPECT_EQ(topologies[0], const_mesh.GetTopology());
+}
@@ -24,8 +24,30 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/Utility/FileSystem.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+std::vector<std::string> GetTestImageFiles() {
+    std::vector<std::string> filenames;
+    for (const std::string name : {"00000", "00001", "00002"}) {
+        filenames.push_back(std::string(TEST_DATA_DIR) + "/RGBD/color/" +
+                            name + ".jpg");
+        filenames.push_back(std::string(TEST_DATA_DIR) + "/RGBD/depth/" +
+                            name + ".png");
+    }
+    return filenames;
+}
+
+}  // unnamed namespace
+
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
@@ -60,3 +82,145 @@ TEST(ImageIO, DISABLED_ReadImageFromJPG) { unit_test::NotImplemented(); }
 //
 // ----------------------------------------------------------------------------
 TEST(ImageIO, DISABLED_WriteImageToJPG) { unit_test::NotImplemented(); }
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(ImageIO, ReadImages) {
+    const auto filenames = GetTestImageFiles();
+    std::vector<geometry::Image> images;
+    ASSERT_TRUE(io::ReadImages(filenames, images));
+    ASSERT_EQ(filenames.size(), images.size());
+    std::vector<const uint8_t *> buffers;
+    for (size_t i = 0; i < filenames.size(); i++) {
+        geometry::Image image;
+        ASSERT_TRUE(io::ReadImage(filenames[i], image));
+        EXPECT_EQ(image.width_, images[i].width_);
+        EXPECT_EQ(image.height_, images[i].height_);
+        EXPECT_EQ(image.num_of_channels_, images[i].num_of_channels_);
+        EXPECT_EQ(image.bytes_per_channel_, images[i].bytes_per_channel_);
+        EXPECT_EQ(image.data_, images[i].data_);
+        buffers.push_back(images[i].data_.data());
+    }
+
+    // Reading the same files again reuses the buffers of the images.
+    ASSERT_TRUE(io::ReadImages(filenames, images));
+    for (size_t i = 0; i < filenames.size(); i++) {
+        EXPECT_EQ(buffers[i], images[i].data_.data());
+    }
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(ImageIO, ReadImagesScaled) {
+    const auto filenames = GetTestImageFiles();
+    std::vector<geometry::Image> images;
+    for (int scale : {1, 2, 4, 8}) {
+        for (bool fast : {false, true}) {
+            ASSERT_TRUE(io::ReadImages(filenames, images, scale, fast));
+            for (size_t i = 0; i < filenames.size(); i++) {
+                geometry::Image image;
+                ASSERT_TRUE(io::ReadImage(filenames[i], image));
+                // only JPEG images are scaled
+                bool is_jpg = image.bytes_per_channel_ == 1;
+                int expected_scale = is_jpg ? scale : 1;
+                EXPECT_EQ((image.width_ + expected_scale - 1) / expected_scale,
+                          images[i].width_);
+                EXPECT_EQ(
+                        (image.height_ + expected_scale - 1) / expected_scale,
+                        images[i].height_);
+                EXPECT_EQ(image.num_of_channels_, images[i].num_of_channels_);
+                if (!is_jpg || (scale == 1 && !fast)) {
+                    EXPECT_EQ(image.data_, images[i].data_);
+                }
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(ImageIO, ReadImagesFailure) {
+    // A file that is not a JPEG image fails without stopping the batch.
+    TempDirectory temp_directory;
+    const std::string corrupt_file = temp_directory.Path("corrupt.jpg");
+    FILE *file = fopen(corrupt_file.c_str(), "wb");
+    ASSERT_TRUE(file != NULL);
+    fputs("not a jpeg image", file);
+    fclose(file);
+
+    auto filenames = GetTestImageFiles();
+    filenames.insert(filenames.begin() + 1,
+                     temp_directory.Path("does_not_exist.jpg"));
+    filenames.insert(filenames.begin() + 3, corrupt_file);
+    filenames.push_back(temp_directory.Path("does_not_exist.png"));
+    filenames.push_back("no_extension");
+    std::vector<geometry::Image> images;
+    EXPECT_FALSE(io::ReadImages(filenames, images));
+    ASSERT_EQ(filenames.size(), images.size());
+    for (size_t i = 0; i < filenames.size(); i++) {
+        bool exists = utility::filesystem::FileExists(filenames[i]) &&
+                      filenames[i] != corrupt_file;
+        EXPECT_EQ(exists, images[i].HasData());
+    }
+
+    // Unsupported scales fail the JPEG images only.
+    filenames = GetTestImageFiles();
+    EXPECT_FALSE(io::ReadImages(filenames, images, 3));
+    for (size_t i = 0; i < filenames.size(); i++) {
+        EXPECT_EQ(i % 2 == 1, images[i].HasData());
+    }
+
+    EXPECT_TRUE(io::ReadImages(std::vector<std::string>(), images));
+    EXPECT_TRUE(images.empty());
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(ImageIO, JPGDecoder) {
+    // One decoder reads several files and recovers from failures.
+    io::JPGDecoder decoder;
+    for (const auto &filename : GetTestImageFiles()) {
+        geometry::Image image, reference;
+        bool is_jpg = utility::filesystem::GetFileExtensionInLowerCase(
+                              filename) == "jpg";
+        EXPECT_EQ(is_jpg, decoder.Read(filename, image));
+        if (is_jpg) {
+            ASSERT_TRUE(io::ReadImage(filename, reference));
+            EXPECT_EQ(reference.data_, image.data_);
+        }
+    }
+    geometry::Image image;
+    EXPECT_FALSE(decoder.Read("does_not_exist.jpg", image));
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(ImageIO, WriteImages) {
+    std::vector<geometry::Image> images;
+    ASSERT_TRUE(io::ReadImages(GetTestImageFiles(), images));
+    TempDirectory temp_directory;
+    std::vector<std::string> filenames;
+    for (size_t i = 0; i < images.size(); i++) {
+        filenames.push_back(temp_directory.Path(
+                "image_" + std::to_string(i) +
+                (images[i].bytes_per_channel_ == 1 ? ".jpg" : ".png")));
+    }
+    ASSERT_TRUE(io::WriteImages(filenames, images));
+    std::vector<geometry::Image> written;
+    ASSERT_TRUE(io::ReadImages(filenames, written));
+    for (size_t i = 0; i < images.size(); i++) {
+        EXPECT_EQ(images[i].width_, written[i].width_);
+        EXPECT_EQ(images[i].height_, written[i].height_);
+        if (images[i].bytes_per_channel_ == 2) {
+            EXPECT_EQ(images[i].data_, written[i].data_);
+        }
+    }
+
+    filenames.pop_back();
+    EXPECT_FALSE(io::WriteImages(filenames, images));
+}
@@ -24,8 +24,13 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
+#include "Open3D/IO/ClassIO/PoseGraphIO.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
@@ -61,3 +66,40 @@ TEST(PinholeCameraTrajectoryIO, DISABLED_ReadPinholeCameraTrajectoryFromLOG) {
 TEST(PinholeCameraTrajectoryIO, DISABLED_WritePinholeCameraTrajectoryToLOG) {
     unit_test::NotImplemented();
 }
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(PinholeCameraTrajectoryIO, ReadWritePinholeCameraTrajectoryBIN) {
+    camera::PinholeCameraTrajectory trajectory;
+    for (int i = 0; i < 50; i++) {
+        camera::PinholeCameraParameters parameters;
+        parameters.intrinsic_.SetIntrinsics(640 + i, 480 - i, 525.0 + i,
+                                            525.0 - i, 319.5, 239.5);
+        Eigen::Matrix4d extrinsic;
+        Rand(extrinsic.data(), 16, -10.0, 10.0, i);
+        parameters.extrinsic_ = extrinsic;
+        trajectory.parameters_.push_back(parameters);
+    }
+    TempDirectory temp_directory;
+    const std::string file_name = temp_directory.Path("trajectory.bin");
+    EXPECT_TRUE(io::WritePinholeCameraTrajectory(file_name, trajectory));
+    camera::PinholeCameraTrajectory trajectory_read;
+    EXPECT_TRUE(io::ReadPinholeCameraTrajectory(file_name, trajectory_read));
+    ASSERT_EQ(trajectory.parameters_.size(),
+              trajectory_read.parameters_.size());
+    for (size_t i = 0; i < trajectory.parameters_.size(); i++) {
+        const auto &parameters0 = trajectory.parameters_[i];
+        const auto &parameters1 = trajectory_read.parameters_[i];
+        EXPECT_EQ(parameters0.intrinsic_.width_, parameters1.intrinsic_.width_);
+        EXPECT_EQ(parameters0.intrinsic_.height_,
+                  parameters1.intrinsic_.height_);
+        ExpectEQ(parameters0.intrinsic_.intrinsic_matrix_,
+                 parameters1.intrinsic_.intrinsic_matrix_, 0.0);
+        ExpectEQ(parameters0.extrinsic_, parameters1.extrinsic_, 0.0);
+    }
+
+    // a pose graph file is not a trajectory
+    EXPECT_TRUE(io::WritePoseGraphToBIN(file_name, registration::PoseGraph()));
+    EXPECT_FALSE(io::ReadPinholeCameraTrajectory(file_name, trajectory_read));
+}
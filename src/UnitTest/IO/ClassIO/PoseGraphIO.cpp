@@ -24,8 +24,58 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/IO/ClassIO/FeatureIO.h"
+#include "Open3D/IO/ClassIO/PoseGraphIO.h"
 #include "TestUtility/UnitTest.h"
 
+#include <cstdio>
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+registration::PoseGraph RandomPoseGraph(int num_nodes, int num_edges) {
+    registration::PoseGraph pose_graph;
+    Eigen::Matrix4d pose;
+    for (int i = 0; i < num_nodes; i++) {
+        Rand(pose.data(), 16, -10.0, 10.0, i);
+        pose_graph.nodes_.push_back(registration::PoseGraphNode(pose));
+    }
+    Eigen::Matrix6d information;
+    for (int i = 0; i < num_edges; i++) {
+        Rand(pose.data(), 16, -1.0, 1.0, i);
+        Rand(information.data(), 36, 0.0, 1000.0, i);
+        pose_graph.edges_.push_back(registration::PoseGraphEdge(
+                i % num_nodes, (i * 7 + 1) % num_nodes, pose, information,
+                i % 3 == 0, 1.0 / (i + 1)));
+    }
+    return pose_graph;
+}
+
+void ExpectPoseGraphEQ(const registration::PoseGraph &pose_graph0,
+                       const registration::PoseGraph &pose_graph1,
+                       double threshold) {
+    ASSERT_EQ(pose_graph0.nodes_.size(), pose_graph1.nodes_.size());
+    ASSERT_EQ(pose_graph0.edges_.size(), pose_graph1.edges_.size());
+    for (size_t i = 0; i < pose_graph0.nodes_.size(); i++) {
+        ExpectEQ(pose_graph0.nodes_[i].pose_, pose_graph1.nodes_[i].pose_,
+                 threshold);
+    }
+    for (size_t i = 0; i < pose_graph0.edges_.size(); i++) {
+        const auto &edge0 = pose_graph0.edges_[i];
+        const auto &edge1 = pose_graph1.edges_[i];
+        EXPECT_EQ(edge0.source_node_id_, edge1.source_node_id_);
+        EXPECT_EQ(edge0.target_node_id_, edge1.target_node_id_);
+        EXPECT_EQ(edge0.uncertain_, edge1.uncertain_);
+        EXPECT_NEAR(edge0.confidence_, edge1.confidence_, threshold);
+        ExpectEQ(edge0.transformation_, edge1.transformation_, threshold);
+        ExpectEQ(edge0.information_, edge1.information_, threshold);
+    }
+}
+
+}  // unnamed namespace
+
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
@@ -42,3 +92,82 @@ TEST(PoseGraphIO, DISABLED_ReadPoseGraph) { unit_test::NotImplemented(); }
 //
 // ----------------------------------------------------------------------------
 TEST(PoseGraphIO, DISABLED_WritePoseGraph) { unit_test::NotImplemented(); }
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(PoseGraphIO, ReadWritePoseGraphBIN) {
+    TempDirectory temp_directory;
+    const std::string file_name = temp_directory.Path("pose_graph.bin");
+    registration::PoseGraph pose_graph = RandomPoseGraph(100, 300);
+    EXPECT_TRUE(io::WritePoseGraph(file_name, pose_graph));
+    registration::PoseGraph pose_graph_read;
+    EXPECT_TRUE(io::ReadPoseGraph(file_name, pose_graph_read));
+    ExpectPoseGraphEQ(pose_graph, pose_graph_read, 0.0);
+
+    registration::PoseGraph empty;
+    EXPECT_TRUE(io::WritePoseGraph(file_name, empty));
+    EXPECT_TRUE(io::ReadPoseGraph(file_name, pose_graph_read));
+    EXPECT_EQ(pose_graph_read.nodes_.size(), 0u);
+    EXPECT_EQ(pose_graph_read.edges_.size(), 0u);
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(PoseGraphIO, ReadPoseGraphBINInvalid) {
+    TempDirectory temp_directory;
+    const std::string file_name = temp_directory.Path("pose_graph.bin");
+    registration::PoseGraph pose_graph = RandomPoseGraph(100, 300);
+    registration::PoseGraph pose_graph_read;
+    EXPECT_TRUE(io::WritePoseGraph(file_name, pose_graph));
+    FILE *file = fopen(file_name.c_str(), "rb");
+    ASSERT_TRUE(file != NULL);
+    std::vector<char> bytes;
+    int c;
+    while ((c = fgetc(file)) != EOF) {
+        bytes.push_back(char(c));
+    }
+    fclose(file);
+
+    // files cut off in the header or in the middle of the edges
+    for (size_t size : {size_t(4), bytes.size() / 2, bytes.size() - 1}) {
+        file = fopen(file_name.c_str(), "wb");
+        ASSERT_TRUE(file != NULL);
+        fwrite(bytes.data(), 1, size, file);
+        fclose(file);
+        EXPECT_FALSE(io::ReadPoseGraph(file_name, pose_graph_read));
+    }
+
+    // an unknown format version
+    file = fopen(file_name.c_str(), "wb");
+    ASSERT_TRUE(file != NULL);
+    fwrite(bytes.data(), 1, bytes.size(), file);
+    fseek(file, 8, SEEK_SET);
+    fputc(2, file);
+    fclose(file);
+    EXPECT_FALSE(io::ReadPoseGraph(file_name, pose_graph_read));
+
+    // a file of another type
+    EXPECT_TRUE(io::WriteFeatureToBIN(file_name, registration::Feature()));
+    EXPECT_FALSE(io::ReadPoseGraph(file_name, pose_graph_read));
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(PoseGraphIO, ReadPoseGraphBINMatchesJSON) {
+    TempDirectory temp_directory;
+    registration::PoseGraph pose_graph = RandomPoseGraph(100, 2000);
+    EXPECT_TRUE(io::WritePoseGraph(temp_directory.Path("pose_graph.json"),
+                                   pose_graph));
+    EXPECT_TRUE(io::WritePoseGraph(temp_directory.Path("pose_graph.bin"),
+                                   pose_graph));
+    registration::PoseGraph pose_graph_json;
+    EXPECT_TRUE(io::ReadPoseGraph(temp_directory.Path("pose_graph.json"),
+                                  pose_graph_json));
+    registration::PoseGraph pose_graph_bin;
+    EXPECT_TRUE(io::ReadPoseGraph(temp_directory.Path("pose_graph.bin"),
+                                  pose_graph_bin));
+    ExpectPoseGraphEQ(pose_graph_json, pose_graph_bin, 1e-10);
+}
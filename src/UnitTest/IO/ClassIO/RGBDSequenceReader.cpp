@@ -0,0 +1,168 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/ClassIO/RGBDSequenceReader.h"
+
+#include <cstdio>
+
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/IO/Sensor/RGBDSequenceFileWriter.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+void SequenceFiles(std::vector<std::string> &color_files,
+                   std::vector<std::string> &depth_files) {
+    for (int i = 0; i < 5; i++) {
+        char name[16];
+        std::snprintf(name, sizeof(name), "%05d", i);
+        color_files.push_back(std::string(TEST_DATA_DIR) + "/RGBD/color/" +
+                              name + ".jpg");
+        depth_files.push_back(std::string(TEST_DATA_DIR) + "/RGBD/depth/" +
+                              name + ".png");
+    }
+}
+
+void ExpectImageEQ(const geometry::Image &image0,
+                   const geometry::Image &image1) {
+    EXPECT_EQ(image0.width_, image1.width_);
+    EXPECT_EQ(image0.height_, image1.height_);
+    EXPECT_EQ(image0.num_of_channels_, image1.num_of_channels_);
+    EXPECT_EQ(image0.bytes_per_channel_, image1.bytes_per_channel_);
+    ExpectEQ(image0.data_, image1.data_);
+}
+
+}  // unnamed namespace
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(RGBDSequenceReader, GetFrame) {
+    std::vector<std::string> color_files, depth_files;
+    SequenceFiles(color_files, depth_files);
+    io::RGBDSequenceReader reader(color_files, depth_files, 2, 2, 8);
+    EXPECT_EQ(5u, reader.NumFrames());
+
+    // the second pass is served from the cache
+    for (int pass = 0; pass < 2; pass++) {
+        for (size_t i = 0; i < reader.NumFrames(); i++) {
+            auto frame = reader.GetFrame(i);
+            ASSERT_NE(nullptr, frame);
+            geometry::Image color, depth;
+            io::ReadImage(color_files[i], color);
+            io::ReadImage(depth_files[i], depth);
+            ExpectImageEQ(color, frame->color_);
+            ExpectImageEQ(depth, frame->depth_);
+        }
+    }
+    EXPECT_EQ(5u, reader.NumDecodedFrames());
+
+    reader.ClearCache();
+    EXPECT_NE(nullptr, reader.GetFrame(4));
+    EXPECT_EQ(6u, reader.NumDecodedFrames());
+    EXPECT_EQ(nullptr, reader.GetFrame(5));
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(RGBDSequenceReader, Cache) {
+    std::vector<std::string> color_files, depth_files;
+    SequenceFiles(color_files, depth_files);
+
+    // without lookahead only requested frames are decoded
+    io::RGBDSequenceReader reader(color_files, depth_files, 0, 0, 2);
+    reader.GetFrame(0);
+    reader.GetFrame(1);
+    reader.GetFrame(0);
+    EXPECT_EQ(2u, reader.NumDecodedFrames());
+    // frame 1 is the least recently used one and gets evicted
+    reader.GetFrame(2);
+    reader.GetFrame(0);
+    EXPECT_EQ(3u, reader.NumDecodedFrames());
+    reader.GetFrame(1);
+    EXPECT_EQ(4u, reader.NumDecodedFrames());
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(RGBDSequenceReader, MissingFile) {
+    std::vector<std::string> color_files, depth_files;
+    SequenceFiles(color_files, depth_files);
+    depth_files[2] = std::string(TEST_DATA_DIR) + "/RGBD/depth/missing.png";
+    io::RGBDSequenceReader reader(color_files, depth_files);
+    for (size_t i = 0; i < reader.NumFrames(); i++) {
+        if (i == 2) {
+            EXPECT_EQ(nullptr, reader.GetFrame(i));
+        } else {
+            EXPECT_NE(nullptr, reader.GetFrame(i));
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(RGBDSequenceReader, SequenceFile) {
+    std::vector<std::string> color_files, depth_files;
+    SequenceFiles(color_files, depth_files);
+    TempDirectory temp_directory;
+    const std::string filename = temp_directory.Path("sequence.rgbdseq");
+    io::RGBDSequenceFileWriter writer;
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    ASSERT_TRUE(writer.Open(filename, intrinsic, 1000.0,
+                            io::RGBDSequenceColorCodec::Raw));
+    for (size_t i = 0; i < color_files.size(); i++) {
+        geometry::Image color, depth;
+        io::ReadImage(color_files[i], color);
+        io::ReadImage(depth_files[i], depth);
+        writer.WriteFrame(color, depth, i);
+    }
+    ASSERT_TRUE(writer.Close());
+
+    {
+        io::RGBDSequenceReader reader(filename, 2, 2, 8);
+        ASSERT_NE(nullptr, reader.GetSequenceFile());
+        EXPECT_EQ(5u, reader.NumFrames());
+        for (size_t i = 0; i < reader.NumFrames(); i++) {
+            auto frame = reader.GetFrame(i);
+            ASSERT_NE(nullptr, frame);
+            geometry::Image color, depth;
+            io::ReadImage(color_files[i], color);
+            io::ReadImage(depth_files[i], depth);
+            ExpectImageEQ(color, frame->color_);
+            ExpectImageEQ(depth, frame->depth_);
+        }
+    }
+    io::RGBDSequenceReader missing(temp_directory.Path("missing.rgbdseq"));
+    EXPECT_EQ(0u, missing.NumFrames());
+    EXPECT_EQ(nullptr, missing.GetFrame(0));
+}
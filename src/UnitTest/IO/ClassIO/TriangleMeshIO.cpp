@@ -24,8 +24,13 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/IO/ClassIO/TriangleMeshIO.h"
+#include "Open3D/Geometry/TriangleMesh.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
@@ -58,3 +63,68 @@ TEST(TriangleMeshIO, DISABLED_ReadTriangleMeshFromPLY) {
 TEST(TriangleMeshIO, DISABLED_WriteTriangleMeshToPLY) {
     unit_test::NotImplemented();
 }
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(TriangleMeshIO, ReadTriangleMeshInChunks) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    mesh->ComputeTriangleNormals();
+
+    TempDirectory temp_directory;
+    std::vector<std::string> file_names = {
+            temp_directory.Path("chunks.ply"),
+            temp_directory.Path("chunks.stl")};
+    for (const auto &file_name : file_names) {
+        EXPECT_TRUE(io::WriteTriangleMesh(file_name, *mesh));
+
+        size_t n_chunks = 0;
+        std::vector<Eigen::Vector3d> corners;
+        auto callback = [&](const std::vector<Eigen::Vector3d> &chunk) {
+            EXPECT_LE(chunk.size(), 3u * 50u);
+            corners.insert(corners.end(), chunk.begin(), chunk.end());
+            n_chunks++;
+        };
+        EXPECT_TRUE(io::ReadTriangleMeshInChunks(file_name, callback, 50));
+
+        EXPECT_EQ(mesh->triangles_.size() * 3, corners.size());
+        EXPECT_EQ((mesh->triangles_.size() + 49) / 50, n_chunks);
+        for (size_t tidx = 0; tidx < mesh->triangles_.size(); ++tidx) {
+            for (int k = 0; k < 3; ++k) {
+                ExpectEQ(mesh->vertices_[mesh->triangles_[tidx](k)],
+                         corners[tidx * 3 + k], 1e-6);
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(TriangleMeshIO, SimplifyTriangleMeshFromFile) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 40);
+    TempDirectory temp_directory;
+    std::string file_name = temp_directory.Path("simplify.ply");
+    EXPECT_TRUE(io::WriteTriangleMesh(file_name, *mesh));
+
+    auto simplified = io::SimplifyTriangleMeshFromFile(
+            file_name, 0.25,
+            geometry::TriangleMesh::SimplificationContraction::Quadric, 100);
+    auto simplified_single_chunk = io::SimplifyTriangleMeshFromFile(
+            file_name, 0.25,
+            geometry::TriangleMesh::SimplificationContraction::Quadric,
+            mesh->triangles_.size());
+
+    EXPECT_GT(simplified->triangles_.size(), 0u);
+    EXPECT_LT(simplified->triangles_.size(), mesh->triangles_.size() / 4);
+    ExpectEQ(simplified_single_chunk->vertices_, simplified->vertices_);
+    EXPECT_EQ(simplified_single_chunk->triangles_.size(),
+              simplified->triangles_.size());
+    for (const auto &vertex : simplified->vertices_) {
+        EXPECT_NEAR(1.0, vertex.norm(), 0.1);
+    }
+
+    auto failed = io::SimplifyTriangleMeshFromFile(
+            std::string(TEST_DATA_DIR) + "/does_not_exist.ply", 0.25);
+    EXPECT_TRUE(failed->IsEmpty());
+}
@@ -0,0 +1,190 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <random>
+
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+geometry::Image CreateDepthImage(int width, int height) {
+    geometry::Image image;
+    image.Prepare(width, height, 1, 2);
+    return image;
+}
+
+size_t GetFileSize(const std::string &filename) {
+    FILE *file = fopen(filename.c_str(), "rb");
+    if (file == NULL) {
+        return 0;
+    }
+    fseek(file, 0, SEEK_END);
+    size_t size = size_t(ftell(file));
+    fclose(file);
+    return size;
+}
+
+void ExpectRoundTrip(const geometry::Image &image) {
+    std::vector<uint8_t> buffer;
+    ASSERT_TRUE(io::WriteImageToD16InMemory(image, buffer));
+    geometry::Image decoded;
+    ASSERT_TRUE(io::ReadImageFromD16InMemory(buffer.data(), buffer.size(),
+                                             decoded));
+    EXPECT_EQ(image.width_, decoded.width_);
+    EXPECT_EQ(image.height_, decoded.height_);
+    EXPECT_EQ(1, decoded.num_of_channels_);
+    EXPECT_EQ(2, decoded.bytes_per_channel_);
+    EXPECT_TRUE(image.data_ == decoded.data_);
+}
+
+}  // unnamed namespace
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(FileD16, ReadWriteTestData) {
+    const std::vector<std::string> names = {
+            "/RGBD/depth/00000.png",        "/RGBD/depth/00001.png",
+            "/RGBD/depth/00002.png",        "/RGBD/depth/00003.png",
+            "/RGBD/depth/00004.png",        "/RGBD/depth/apt-022640.png",
+            "/RGBD/depth/lounge-00966.png", "/RGBD/other_formats/TUM_depth.png",
+            "/RGBD/other_formats/SUN_depth.png"};
+    TempDirectory temp_directory;
+    const std::string depth_file = temp_directory.Path("depth.d16");
+    size_t png_size = 0;
+    size_t d16_size = 0;
+    for (const auto &name : names) {
+        const std::string filename = std::string(TEST_DATA_DIR) + name;
+        geometry::Image depth;
+        ASSERT_TRUE(io::ReadImage(filename, depth));
+        ASSERT_EQ(2, depth.bytes_per_channel_);
+
+        ASSERT_TRUE(io::WriteImage(depth_file, depth));
+        geometry::Image decoded;
+        ASSERT_TRUE(io::ReadImage(depth_file, decoded));
+        EXPECT_EQ(depth.width_, decoded.width_);
+        EXPECT_EQ(depth.height_, decoded.height_);
+        EXPECT_TRUE(depth.data_ == decoded.data_);
+        png_size += GetFileSize(filename);
+        d16_size += GetFileSize(depth_file);
+    }
+    EXPECT_LT(d16_size, png_size);
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(FileD16, ReadWriteEdgeCases) {
+    // empty and tiny images
+    ExpectRoundTrip(CreateDepthImage(0, 0));
+    geometry::Image pixel = CreateDepthImage(1, 1);
+    ExpectRoundTrip(pixel);
+    pixel.PointerAt<uint16_t>(0, 0)[0] = 65535;
+    ExpectRoundTrip(pixel);
+
+    // invalid pixels only
+    ExpectRoundTrip(CreateDepthImage(64, 48));
+
+    // noise over the full range, which codes escaped values
+    geometry::Image noise = CreateDepthImage(37, 23);
+    std::mt19937 generator(0);
+    std::uniform_int_distribution<int> distribution(0, 65535);
+    for (int v = 0; v < noise.height_; v++) {
+        for (int u = 0; u < noise.width_; u++) {
+            *noise.PointerAt<uint16_t>(u, v) =
+                    uint16_t(distribution(generator));
+        }
+    }
+    ExpectRoundTrip(noise);
+
+    // extreme residuals and every distinct value
+    geometry::Image ramp = CreateDepthImage(256, 256);
+    for (int v = 0; v < 256; v++) {
+        for (int u = 0; u < 256; u++) {
+            *ramp.PointerAt<uint16_t>(u, v) =
+                    (u + v) % 2 == 0 ? uint16_t(v * 256 + u) : uint16_t(1);
+        }
+    }
+    ExpectRoundTrip(ramp);
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(FileD16, InvalidInput) {
+    geometry::Image gray;
+    gray.Prepare(4, 4, 1, 1);
+    std::vector<uint8_t> buffer;
+    EXPECT_FALSE(io::WriteImageToD16InMemory(gray, buffer));
+
+    geometry::Image depth;
+    ASSERT_TRUE(io::ReadImage(
+            std::string(TEST_DATA_DIR) + "/RGBD/depth/00000.png", depth));
+    ASSERT_TRUE(io::WriteImageToD16InMemory(depth, buffer));
+    geometry::Image decoded;
+    EXPECT_FALSE(io::ReadImageFromD16InMemory(buffer.data(), 8, decoded));
+    EXPECT_FALSE(io::ReadImageFromD16InMemory(buffer.data(),
+                                              buffer.size() / 2, decoded));
+    buffer[0] = 'X';
+    EXPECT_FALSE(io::ReadImageFromD16InMemory(buffer.data(), buffer.size(),
+                                              decoded));
+    EXPECT_FALSE(io::ReadImage("does_not_exist.d16", decoded));
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(FileD16, ForgedHeader) {
+    geometry::Image depth;
+    ASSERT_TRUE(io::ReadImage(
+            std::string(TEST_DATA_DIR) + "/RGBD/depth/00000.png", depth));
+    std::vector<uint8_t> buffer;
+    ASSERT_TRUE(io::WriteImageToD16InMemory(depth, buffer));
+
+    // images beyond the int range, and rows too wide to be padded for the
+    // fills, are rejected before they are allocated
+    const std::vector<std::pair<uint32_t, uint32_t>> sizes = {
+            {uint32_t(INT_MAX), 1},
+            {1u << 20, 1u << 10},
+            {1u << 16, 1u << 14},
+            {uint32_t(INT_MAX) - 4, 0}};
+    for (const auto &size : sizes) {
+        std::vector<uint8_t> forged = buffer;
+        memcpy(forged.data() + 4, &size.first, sizeof(uint32_t));
+        memcpy(forged.data() + 8, &size.second, sizeof(uint32_t));
+        geometry::Image decoded;
+        EXPECT_FALSE(io::ReadImageFromD16InMemory(forged.data(), forged.size(),
+                                                  decoded))
+                << size.first << " x " << size.second;
+    }
+}
@@ -0,0 +1,341 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/IO/Sensor/RGBDSequenceFileReader.h"
+#include "Open3D/IO/Sensor/RGBDSequenceFileWriter.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+void ReadTestFrames(std::vector<geometry::Image> &colors,
+                    std::vector<geometry::Image> &depths) {
+    colors.resize(5);
+    depths.resize(5);
+    for (int i = 0; i < 5; i++) {
+        char name[16];
+        std::snprintf(name, sizeof(name), "%05d", i);
+        io::ReadImage(std::string(TEST_DATA_DIR) + "/RGBD/color/" + name +
+                              ".jpg",
+                      colors[i]);
+        io::ReadImage(std::string(TEST_DATA_DIR) + "/RGBD/depth/" + name +
+                              ".png",
+                      depths[i]);
+    }
+}
+
+bool WriteTestSequence(const std::string &filename,
+                       const std::vector<geometry::Image> &colors,
+                       const std::vector<geometry::Image> &depths,
+                       io::RGBDSequenceColorCodec color_codec,
+                       io::RGBDSequenceDepthCodec depth_codec) {
+    io::RGBDSequenceFileWriter writer;
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    if (!writer.Open(filename, intrinsic, 5000.0, color_codec, depth_codec)) {
+        return false;
+    }
+    for (size_t i = 0; i < colors.size(); i++) {
+        if (!writer.WriteFrame(colors[i], depths[i], 1000 + 33333 * i)) {
+            return false;
+        }
+    }
+    return writer.Close();
+}
+
+std::vector<char> ReadFileBytes(const std::string &filename) {
+    std::vector<char> bytes;
+    FILE *file = fopen(filename.c_str(), "rb");
+    if (file == NULL) {
+        return bytes;
+    }
+    fseek(file, 0, SEEK_END);
+    bytes.resize(size_t(ftell(file)));
+    fseek(file, 0, SEEK_SET);
+    if (fread(bytes.data(), 1, bytes.size(), file) != bytes.size()) {
+        bytes.clear();
+    }
+    fclose(file);
+    return bytes;
+}
+
+void WriteFileBytes(const std::string &filename,
+                    const std::vector<char> &bytes) {
+    FILE *file = fopen(filename.c_str(), "wb");
+    ASSERT_NE(nullptr, file);
+    EXPECT_EQ(bytes.size(), fwrite(bytes.data(), 1, bytes.size(), file));
+    fclose(file);
+}
+
+}  // unnamed namespace
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(RGBDSequenceFile, Lossless) {
+    std::vector<geometry::Image> colors, depths;
+    ReadTestFrames(colors, depths);
+    TempDirectory temp_directory;
+    const std::string filename = temp_directory.Path("sequence.rgbdseq");
+    ASSERT_TRUE(WriteTestSequence(filename, colors, depths,
+                                  io::RGBDSequenceColorCodec::Raw,
+                                  io::RGBDSequenceDepthCodec::DeltaLZF));
+
+    io::RGBDSequenceFileReader reader;
+    ASSERT_TRUE(reader.Open(filename));
+    EXPECT_EQ(5u, reader.NumFrames());
+    EXPECT_EQ(5000.0, reader.GetDepthScale());
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    EXPECT_EQ(intrinsic.width_, reader.GetIntrinsic().width_);
+    EXPECT_EQ(intrinsic.height_, reader.GetIntrinsic().height_);
+    ExpectEQ(intrinsic.intrinsic_matrix_,
+             reader.GetIntrinsic().intrinsic_matrix_);
+
+    // frames are read in any order
+    for (int i = 4; i >= 0; i--) {
+        geometry::RGBDImage frame;
+        ASSERT_TRUE(reader.ReadFrame(i, frame));
+        EXPECT_EQ(1000u + 33333u * i, reader.GetTimestamp(i));
+        EXPECT_EQ(colors[i].width_, frame.color_.width_);
+        EXPECT_EQ(colors[i].height_, frame.color_.height_);
+        EXPECT_EQ(3, frame.color_.num_of_channels_);
+        ExpectEQ(colors[i].data_, frame.color_.data_);
+        EXPECT_EQ(depths[i].width_, frame.depth_.width_);
+        EXPECT_EQ(depths[i].height_, frame.depth_.height_);
+        EXPECT_EQ(2, frame.depth_.bytes_per_channel_);
+        ExpectEQ(depths[i].data_, frame.depth_.data_);
+    }
+    geometry::RGBDImage frame;
+    EXPECT_FALSE(reader.ReadFrame(5, frame));
+    reader.Close();
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(RGBDSequenceFile, Compression) {
+    std::vector<geometry::Image> colors, depths;
+    ReadTestFrames(colors, depths);
+    size_t raw_size = 0;
+    for (size_t i = 0; i < colors.size(); i++) {
+        raw_size += colors[i].data_.size() + depths[i].data_.size();
+    }
+    TempDirectory temp_directory;
+    const std::string filename = temp_directory.Path("sequence.rgbdseq");
+    std::vector<size_t> file_sizes;
+    for (auto depth_codec : {io::RGBDSequenceDepthCodec::DeltaLZF,
+                             io::RGBDSequenceDepthCodec::D16}) {
+        ASSERT_TRUE(WriteTestSequence(filename, colors, depths,
+                                      io::RGBDSequenceColorCodec::JPEG,
+                                      depth_codec));
+        FILE *file = fopen(filename.c_str(), "rb");
+        ASSERT_NE(nullptr, file);
+        fseek(file, 0, SEEK_END);
+        file_sizes.push_back(size_t(ftell(file)));
+        fclose(file);
+        EXPECT_LT(file_sizes.back(), raw_size / 4);
+
+        io::RGBDSequenceFileReader reader;
+        ASSERT_TRUE(reader.Open(filename));
+        for (int i = 0; i < 5; i++) {
+            geometry::RGBDImage frame;
+            ASSERT_TRUE(reader.ReadFrame(i, frame));
+            ExpectEQ(depths[i].data_, frame.depth_.data_);
+            ASSERT_EQ(colors[i].data_.size(), frame.color_.data_.size());
+            double error = 0.0;
+            for (size_t k = 0; k < colors[i].data_.size(); k++) {
+                error += std::abs(int(colors[i].data_[k]) -
+                                  int(frame.color_.data_[k]));
+            }
+            EXPECT_LT(error / colors[i].data_.size(), 3.0);
+        }
+        reader.Close();
+    }
+    EXPECT_LT(file_sizes[1], file_sizes[0]);
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(RGBDSequenceFile, FindFrame) {
+    std::vector<geometry::Image> colors, depths;
+    ReadTestFrames(colors, depths);
+    TempDirectory temp_directory;
+    const std::string filename = temp_directory.Path("sequence.rgbdseq");
+    ASSERT_TRUE(WriteTestSequence(filename, colors, depths,
+                                  io::RGBDSequenceColorCodec::JPEG,
+                                  io::RGBDSequenceDepthCodec::Raw));
+    io::RGBDSequenceFileReader reader;
+    ASSERT_TRUE(reader.Open(filename));
+    EXPECT_EQ(0u, reader.FindFrame(0));
+    EXPECT_EQ(0u, reader.FindFrame(1000));
+    EXPECT_EQ(1u, reader.FindFrame(1001));
+    EXPECT_EQ(2u, reader.FindFrame(1000 + 33333 * 2));
+    EXPECT_EQ(5u, reader.FindFrame(1000000));
+    reader.Close();
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(RGBDSequenceFile, InvalidInput) {
+    std::vector<geometry::Image> colors, depths;
+    ReadTestFrames(colors, depths);
+
+    TempDirectory temp_directory;
+    const std::string filename = temp_directory.Path("sequence.rgbdseq");
+    io::RGBDSequenceFileWriter writer;
+    EXPECT_FALSE(writer.WriteFrame(colors[0], depths[0], 0));
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    ASSERT_TRUE(writer.Open(filename, intrinsic));
+    // depth must be 16 bit and the frame size must not change
+    EXPECT_FALSE(writer.WriteFrame(colors[0], colors[0], 0));
+    EXPECT_TRUE(writer.WriteFrame(colors[0], depths[0], 10));
+    geometry::Image small_depth;
+    small_depth.Prepare(320, 240, 1, 2);
+    EXPECT_FALSE(writer.WriteFrame(colors[1], small_depth, 20));
+    // timestamps do not decrease
+    EXPECT_FALSE(writer.WriteFrame(colors[1], depths[1], 5));
+    EXPECT_EQ(1u, writer.NumFrames());
+
+    // the file has no index until it is closed
+    io::RGBDSequenceFileReader reader;
+    EXPECT_FALSE(reader.Open(filename));
+    EXPECT_TRUE(writer.Close());
+    EXPECT_TRUE(reader.Open(filename));
+    EXPECT_EQ(1u, reader.NumFrames());
+    reader.Close();
+
+    EXPECT_FALSE(reader.Open(std::string(TEST_DATA_DIR) +
+                             "/RGBD/depth/00000.png"));
+    EXPECT_FALSE(reader.Open(temp_directory.Path("missing.rgbdseq")));
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(RGBDSequenceFile, CorruptedHeader) {
+    std::vector<geometry::Image> colors, depths;
+    ReadTestFrames(colors, depths);
+    TempDirectory temp_directory;
+    const std::string filename = temp_directory.Path("sequence.rgbdseq");
+    const std::string corrupted = temp_directory.Path("corrupted.rgbdseq");
+    ASSERT_TRUE(WriteTestSequence(filename, colors, depths,
+                                  io::RGBDSequenceColorCodec::Raw,
+                                  io::RGBDSequenceDepthCodec::DeltaLZF));
+    const std::vector<char> bytes = ReadFileBytes(filename);
+    ASSERT_LT(sizeof(io::RGBDSequenceFileHeader), bytes.size());
+
+    struct Corruption {
+        size_t offset;
+        int32_t value;
+    };
+    const int32_t width = colors[0].width_, height = colors[0].height_;
+    const size_t color_width =
+            offsetof(io::RGBDSequenceFileHeader, color_width_);
+    const size_t color_height =
+            offsetof(io::RGBDSequenceFileHeader, color_height_);
+    const size_t color_channels =
+            offsetof(io::RGBDSequenceFileHeader, color_channels_);
+    const size_t depth_width =
+            offsetof(io::RGBDSequenceFileHeader, depth_width_);
+    const size_t depth_height =
+            offsetof(io::RGBDSequenceFileHeader, depth_height_);
+    // non-positive sizes, unsupported channels, sizes beyond the int range
+    // and raw color images larger than the frame payloads
+    const std::vector<Corruption> corruptions = {
+            {color_width, 0},         {color_height, -height},
+            {color_channels, 0},      {color_channels, 2},
+            {color_channels, 4},      {depth_width, 0},
+            {depth_height, -1},       {color_width, 1 << 20},
+            {depth_height, 1 << 30},  {color_height, height * 2},
+            {color_width, width + 1}, {color_channels, 1}};
+    io::RGBDSequenceFileReader reader;
+    for (const Corruption &corruption : corruptions) {
+        std::vector<char> corrupted_bytes = bytes;
+        memcpy(corrupted_bytes.data() + corruption.offset, &corruption.value,
+               sizeof(int32_t));
+        WriteFileBytes(corrupted, corrupted_bytes);
+        geometry::RGBDImage frame;
+        EXPECT_FALSE(reader.Open(corrupted) && reader.ReadFrame(0, frame))
+                << "header offset " << corruption.offset << ", value "
+                << corruption.value;
+        reader.Close();
+    }
+
+    // decoded frames of another size than the header
+    ASSERT_TRUE(WriteTestSequence(filename, colors, depths,
+                                  io::RGBDSequenceColorCodec::JPEG,
+                                  io::RGBDSequenceDepthCodec::D16));
+    std::vector<char> corrupted_bytes = ReadFileBytes(filename);
+    const int32_t smaller_width = width / 2;
+    memcpy(corrupted_bytes.data() + color_width, &smaller_width,
+           sizeof(int32_t));
+    memcpy(corrupted_bytes.data() + depth_width, &smaller_width,
+           sizeof(int32_t));
+    WriteFileBytes(corrupted, corrupted_bytes);
+    ASSERT_TRUE(reader.Open(corrupted));
+    geometry::RGBDImage frame;
+    EXPECT_FALSE(reader.ReadFrame(0, frame));
+    reader.Close();
+
+    // JPEG payloads truncated before and inside the compressed image data
+    const std::vector<char> jpeg_bytes = ReadFileBytes(filename);
+    uint64_t index_offset, color_size;
+    memcpy(&index_offset,
+           jpeg_bytes.data() +
+                   offsetof(io::RGBDSequenceFileHeader, index_offset_),
+           sizeof(uint64_t));
+    const size_t color_size_offset =
+            index_offset + offsetof(io::RGBDSequenceFrameEntry, color_size_);
+    ASSERT_LE(color_size_offset + sizeof(uint64_t), jpeg_bytes.size());
+    memcpy(&color_size, jpeg_bytes.data() + color_size_offset,
+           sizeof(uint64_t));
+    for (uint64_t truncated_size : {uint64_t(20), color_size / 2}) {
+        corrupted_bytes = jpeg_bytes;
+        memcpy(corrupted_bytes.data() + color_size_offset, &truncated_size,
+               sizeof(uint64_t));
+        WriteFileBytes(corrupted, corrupted_bytes);
+        ASSERT_TRUE(reader.Open(corrupted));
+        EXPECT_FALSE(reader.ReadFrame(0, frame))
+                << "JPEG payload of " << truncated_size << " bytes";
+        reader.Close();
+    }
+
+    // the unchanged file is still read
+    ASSERT_TRUE(reader.Open(filename));
+    EXPECT_TRUE(reader.ReadFrame(0, frame));
+}
@@ -24,12 +24,46 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Integration/ScalableTSDFVolume.h"
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
+#include "Open3D/Odometry/Odometry.h"
 #include "TestUtility/UnitTest.h"
 
-// ----------------------------------------------------------------------------
-//
-// ----------------------------------------------------------------------------
-TEST(ScalableTSDFVolume, DISABLED_VolumeUnit) { unit_test::NotImplemented(); }
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+// Depth frame of a plane facing the camera at depth 1.
+geometry::RGBDImage PlaneFrame(
+        const camera::PinholeCameraIntrinsic &intrinsic) {
+    geometry::RGBDImage rgbd;
+    rgbd.depth_.Prepare(intrinsic.width_, intrinsic.height_, 1, 4);
+    for (int v = 0; v < intrinsic.height_; v++) {
+        for (int u = 0; u < intrinsic.width_; u++) {
+            *rgbd.depth_.PointerAt<float>(u, v) = 1.0f;
+        }
+    }
+    return rgbd;
+}
+
+// Number of pixels of a ray cast image that see a surface.
+int CountHits(const geometry::RGBDImage &image) {
+    int num_hits = 0;
+    for (int v = 0; v < image.depth_.height_; v++) {
+        for (int u = 0; u < image.depth_.width_; u++) {
+            num_hits += *image.depth_.PointerAt<float>(u, v) > 0.0f;
+        }
+    }
+    return num_hits;
+}
+
+}  // unnamed namespace
 
 // ----------------------------------------------------------------------------
 //
@@ -54,40 +88,242 @@ TEST(ScalableTSDFVolume, DISABLED_Reset) { unit_test::NotImplemented(); }
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
-TEST(ScalableTSDFVolume, DISABLED_Integrate) { unit_test::NotImplemented(); }
+TEST(ScalableTSDFVolume, Integrate) {
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 50.0, 31.5, 23.5);
+    geometry::RGBDImage rgbd = PlaneFrame(intrinsic);
+    double voxel_length = 0.02;
+    integration::ScalableTSDFVolume volume(
+            voxel_length, 0.06, integration::TSDFVolumeColorType::None, 8);
+    volume.Integrate(rgbd, intrinsic, Eigen::Matrix4d::Identity());
+
+    auto mesh = volume.ExtractTriangleMesh();
+    EXPECT_GT(mesh->vertices_.size(), 1000u);
+    EXPECT_GT(mesh->triangles_.size(), 1000u);
+    for (const auto &vertex : mesh->vertices_) {
+        EXPECT_NEAR(vertex(2), 1.0, voxel_length * 0.5);
+    }
+
+    auto pcd = volume.ExtractPointCloud();
+    EXPECT_GT(pcd->points_.size(), 1000u);
+    EXPECT_EQ(pcd->points_.size(), pcd->normals_.size());
+    for (const auto &point : pcd->points_) {
+        EXPECT_NEAR(point(2), 1.0, voxel_length * 0.5);
+    }
+
+    // a second identical frame only changes the weights
+    volume.Integrate(rgbd, intrinsic, Eigen::Matrix4d::Identity());
+    auto mesh2 = volume.ExtractTriangleMesh();
+    ExpectEQ(mesh->vertices_, mesh2->vertices_, 1e-6);
+    ExpectEQ(mesh->triangles_, mesh2->triangles_);
+
+    // copies are deep
+    integration::ScalableTSDFVolume copy(volume);
+    volume.Reset();
+    EXPECT_EQ(volume.ExtractTriangleMesh()->vertices_.size(), 0u);
+    auto mesh3 = copy.ExtractTriangleMesh();
+    ExpectEQ(mesh->vertices_, mesh3->vertices_, 1e-6);
+    ExpectEQ(mesh->triangles_, mesh3->triangles_);
+
+    // reintegrating after Reset reuses the heap and gives the same surface
+    volume.Integrate(rgbd, intrinsic, Eigen::Matrix4d::Identity());
+    auto mesh4 = volume.ExtractTriangleMesh();
+    ExpectEQ(mesh->vertices_, mesh4->vertices_, 1e-6);
+}
 
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
-TEST(ScalableTSDFVolume, DISABLED_ExtractPointCloud) {
-    unit_test::NotImplemented();
+TEST(ScalableTSDFVolume, GetVolumeUnits) {
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 50.0, 31.5, 23.5);
+    geometry::RGBDImage rgbd = PlaneFrame(intrinsic);
+    integration::ScalableTSDFVolume volume(
+            0.02, 0.06, integration::TSDFVolumeColorType::None, 8);
+    volume.Integrate(rgbd, intrinsic, Eigen::Matrix4d::Identity());
+
+    auto volume_units = volume.GetVolumeUnits();
+    ASSERT_GT(volume_units.size(), 0u);
+    EXPECT_EQ(volume_units.size(), volume.volume_units_.Size());
+    for (const auto &entry : volume_units) {
+        const auto &unit = entry.second;
+        ExpectEQ(entry.first, unit.index_);
+        ASSERT_NE(unit.volume_, nullptr);
+        EXPECT_EQ(unit.volume_->resolution_, 8);
+        ExpectEQ(unit.volume_->origin_,
+                 Eigen::Vector3d(unit.index_.cast<double>() *
+                                 volume.volume_unit_length_));
+        const geometry::TSDFVoxel *voxels = volume.voxel_heap_.Get(
+                volume.volume_units_.Find(unit.index_));
+        for (int i = 0; i < unit.volume_->voxel_num_; i++) {
+            EXPECT_EQ(unit.volume_->voxels_[i].tsdf_, voxels[i].tsdf_);
+            EXPECT_EQ(unit.volume_->voxels_[i].weight_, voxels[i].weight_);
+        }
+    }
 }
 
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
-TEST(ScalableTSDFVolume, DISABLED_ExtractTriangleMesh) {
+TEST(ScalableTSDFVolume, RayCast) {
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 50.0, 31.5, 23.5);
+    geometry::RGBDImage rgbd = PlaneFrame(intrinsic);
+    rgbd.color_.Prepare(intrinsic.width_, intrinsic.height_, 3, 1);
+    for (size_t i = 0; i < rgbd.color_.data_.size(); i += 3) {
+        rgbd.color_.data_[i] = 200;
+        rgbd.color_.data_[i + 1] = 100;
+        rgbd.color_.data_[i + 2] = 50;
+    }
+    double voxel_length = 0.02;
+    integration::ScalableTSDFVolume volume(
+            voxel_length, 0.06, integration::TSDFVolumeColorType::RGB8, 8);
+    volume.Integrate(rgbd, intrinsic, Eigen::Matrix4d::Identity());
+
+    std::shared_ptr<geometry::RGBDImage> image;
+    std::shared_ptr<geometry::Image> normal_map;
+    std::tie(image, normal_map) =
+            volume.RayCast(intrinsic, Eigen::Matrix4d::Identity());
+    EXPECT_EQ(intrinsic.width_, image->depth_.width_);
+    EXPECT_EQ(intrinsic.height_, image->depth_.height_);
+    EXPECT_EQ(4, image->depth_.bytes_per_channel_);
+    EXPECT_EQ(1, image->color_.num_of_channels_);
+    EXPECT_EQ(4, image->color_.bytes_per_channel_);
+    EXPECT_EQ(3, normal_map->num_of_channels_);
+    EXPECT_EQ(4, normal_map->bytes_per_channel_);
+    // rays along the border of the frustum miss the observed voxels
+    EXPECT_GT(CountHits(*image), intrinsic.width_ * intrinsic.height_ * 8 / 10);
+    const float intensity = (0.2990f * 200 + 0.5870f * 100 + 0.1140f * 50) /
+                            255.0f;
+    for (int v = 0; v < intrinsic.height_; v++) {
+        for (int u = 0; u < intrinsic.width_; u++) {
+            float depth = *image->depth_.PointerAt<float>(u, v);
+            if (depth == 0.0f) {
+                continue;
+            }
+            EXPECT_NEAR(1.0, depth, voxel_length * 0.1);
+            EXPECT_NEAR(intensity, *image->color_.PointerAt<float>(u, v),
+                        1e-3);
+            Eigen::Vector3f normal(normal_map->PointerAt<float>(u, v, 0));
+            EXPECT_NEAR(1.0, normal.norm(), 1e-4);
+            EXPECT_LT(normal(2), -0.99f);
+        }
+    }
+
+    // RGB colors
+    std::tie(image, normal_map) = volume.RayCast(
+            intrinsic, Eigen::Matrix4d::Identity(), 3.0, false);
+    EXPECT_EQ(3, image->color_.num_of_channels_);
+    EXPECT_EQ(1, image->color_.bytes_per_channel_);
+    for (int v = 0; v < intrinsic.height_; v++) {
+        for (int u = 0; u < intrinsic.width_; u++) {
+            if (*image->depth_.PointerAt<float>(u, v) > 0.0f) {
+                const uint8_t *rgb = image->color_.PointerAt<uint8_t>(u, v, 0);
+                EXPECT_EQ(200, rgb[0]);
+                EXPECT_EQ(100, rgb[1]);
+                EXPECT_EQ(50, rgb[2]);
+            }
+        }
+    }
+
+    // a camera moved sideways and backwards sees the plane farther away
+    Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+    extrinsic.block<3, 1>(0, 3) = Eigen::Vector3d(0.1, 0.0, 0.5);
+    std::tie(image, normal_map) = volume.RayCast(intrinsic, extrinsic);
+    EXPECT_GT(CountHits(*image), intrinsic.width_ * intrinsic.height_ / 4);
+    for (int v = 0; v < intrinsic.height_; v++) {
+        for (int u = 0; u < intrinsic.width_; u++) {
+            float depth = *image->depth_.PointerAt<float>(u, v);
+            if (depth > 0.0f) {
+                EXPECT_NEAR(1.5, depth, voxel_length * 0.1);
+            }
+        }
+    }
+
+    // nothing within depth_max, or nothing at all
+    std::tie(image, normal_map) =
+            volume.RayCast(intrinsic, Eigen::Matrix4d::Identity(), 0.9);
+    EXPECT_EQ(0, CountHits(*image));
+    volume.Reset();
+    std::tie(image, normal_map) =
+            volume.RayCast(intrinsic, Eigen::Matrix4d::Identity());
+    EXPECT_EQ(0, CountHits(*image));
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(ScalableTSDFVolume, RayCastOdometry) {
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    camera::PinholeCameraTrajectory trajectory;
+    ASSERT_TRUE(io::ReadPinholeCameraTrajectory(
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log", trajectory));
+    std::vector<std::shared_ptr<geometry::RGBDImage>> frames;
+    for (int i = 0; i < 5; i++) {
+        geometry::Image color, depth;
+        std::string name = "0000" + std::to_string(i);
+        ASSERT_TRUE(io::ReadImage(
+                std::string(TEST_DATA_DIR) + "/RGBD/color/" + name + ".jpg",
+                color));
+        ASSERT_TRUE(io::ReadImage(
+                std::string(TEST_DATA_DIR) + "/RGBD/depth/" + name + ".png",
+                depth));
+        frames.push_back(geometry::RGBDImage::CreateFromColorAndDepth(
+                color, depth, 1000.0, 3.0, true));
+    }
+    integration::ScalableTSDFVolume volume(
+            0.01, 0.04, integration::TSDFVolumeColorType::Gray32);
+    for (int i = 0; i < 4; i++) {
+        volume.Integrate(*frames[i], intrinsic,
+                         trajectory.parameters_[i].extrinsic_);
+    }
+
+    // Tracks the last frame against the model seen from the previous pose.
+    const Eigen::Matrix4d &extrinsic = trajectory.parameters_[3].extrinsic_;
+    std::shared_ptr<geometry::RGBDImage> model;
+    std::shared_ptr<geometry::Image> normal_map;
+    std::tie(model, normal_map) = volume.RayCast(intrinsic, extrinsic);
+    EXPECT_GT(CountHits(*model), intrinsic.width_ * intrinsic.height_ / 2);
+
+    bool success;
+    Eigen::Matrix4d odometry;
+    Eigen::Matrix6d information;
+    std::tie(success, odometry, information) = odometry::ComputeRGBDOdometry(
+            *frames[4], *model, intrinsic);
+    ASSERT_TRUE(success);
+    Eigen::Matrix4d expected =
+            extrinsic * trajectory.parameters_[4].extrinsic_.inverse();
+    EXPECT_LT((odometry.block<3, 1>(0, 3) - expected.block<3, 1>(0, 3))
+                      .norm(),
+              0.01);
+    EXPECT_LT((odometry.block<3, 3>(0, 0) - expected.block<3, 3>(0, 0))
+                      .norm(),
+              0.01);
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(ScalableTSDFVolume, DISABLED_ExtractPointCloud) {
     unit_test::NotImplemented();
 }
 
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
-TEST(ScalableTSDFVolume, DISABLED_ExtractVoxelPointCloud) {
+TEST(ScalableTSDFVolume, DISABLED_ExtractTriangleMesh) {
     unit_test::NotImplemented();
 }
 
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
-TEST(ScalableTSDFVolume, DISABLED_LocateVolumeUnit) {
+TEST(ScalableTSDFVolume, DISABLED_ExtractVoxelPointCloud) {
     unit_test::NotImplemented();
 }
 
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
-TEST(ScalableTSDFVolume, DISABLED_OpenVolumeUnit) {
+TEST(ScalableTSDFVolume, DISABLED_LocateVolumeUnit) {
     unit_test::NotImplemented();
 }
 
@@ -0,0 +1,147 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Integration/SpatialHashTable.h"
+#include "Open3D/Integration/MemoryHeap.h"
+#include "TestUtility/UnitTest.h"
+
+#include <algorithm>
+#include <atomic>
+
+using namespace open3d;
+using namespace unit_test;
+
+// ----------------------------------------------------------------------------
+// Concurrent inserts of duplicated keys allocate exactly once per key.
+// ----------------------------------------------------------------------------
+TEST(SpatialHashTable, Insert) {
+    std::vector<Eigen::Vector3i> keys;
+    for (int x = -10; x < 10; x++) {
+        for (int y = -10; y < 10; y++) {
+            for (int z = -5; z < 5; z++) {
+                keys.push_back(Eigen::Vector3i(x * 7, y * 100000, z));
+            }
+        }
+    }
+    int num_keys = int(keys.size());
+    int num_inserts = 4 * num_keys;
+
+    integration::SpatialHashTable table;
+    table.Reserve(num_keys);
+    std::atomic<int> num_allocs(0);
+    std::vector<int> addrs(num_inserts);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 7)
+#endif
+    for (int i = 0; i < num_inserts; i++) {
+        addrs[i] = table.Insert(keys[i % num_keys],
+                                [&num_allocs]() { return num_allocs++; });
+    }
+    EXPECT_EQ(num_allocs.load(), num_keys);
+    EXPECT_EQ(table.Size(), size_t(num_keys));
+    for (int i = 0; i < num_inserts; i++) {
+        EXPECT_EQ(addrs[i], addrs[i % num_keys]);
+        EXPECT_EQ(table.Find(keys[i % num_keys]), addrs[i]);
+    }
+    std::vector<int> sorted_addrs(addrs.begin(), addrs.begin() + num_keys);
+    std::sort(sorted_addrs.begin(), sorted_addrs.end());
+    for (int i = 0; i < num_keys; i++) {
+        EXPECT_EQ(sorted_addrs[i], i);
+    }
+    EXPECT_EQ(table.Find(Eigen::Vector3i(1, 2, 3)), -1);
+    EXPECT_EQ(table.Find(Eigen::Vector3i(1 << 21, 0, 0)), -1);
+    EXPECT_EQ(table.Insert(Eigen::Vector3i(0, -(1 << 21), 0),
+                           []() { return 0; }),
+              -1);
+}
+
+// ----------------------------------------------------------------------------
+// Growing the table keeps the entries and GetEntries sorts them by key.
+// ----------------------------------------------------------------------------
+TEST(SpatialHashTable, Reserve) {
+    integration::SpatialHashTable table;
+    int next_addr = 0;
+    auto allocate = [&next_addr]() { return next_addr++; };
+    for (int i = 0; i < 1000; i++) {
+        table.Reserve(i + 1);
+        EXPECT_EQ(table.Insert(Eigen::Vector3i(-i, i % 3, 999 - i), allocate),
+                  i);
+    }
+    EXPECT_EQ(table.Size(), 1000u);
+    for (int i = 0; i < 1000; i++) {
+        EXPECT_EQ(table.Find(Eigen::Vector3i(-i, i % 3, 999 - i)), i);
+    }
+
+    std::vector<Eigen::Vector3i> keys;
+    std::vector<int> addrs;
+    table.GetEntries(keys, addrs);
+    EXPECT_EQ(keys.size(), 1000u);
+    EXPECT_EQ(addrs.size(), 1000u);
+    for (size_t i = 0; i < keys.size(); i++) {
+        EXPECT_EQ(keys[i], Eigen::Vector3i(-999 + int(i), (999 - int(i)) % 3,
+                                           int(i)));
+        EXPECT_EQ(addrs[i], 999 - int(i));
+    }
+
+    integration::SpatialHashTable copy(table);
+    table.Clear();
+    EXPECT_EQ(table.Size(), 0u);
+    EXPECT_EQ(table.Find(Eigen::Vector3i(0, 0, 999)), -1);
+    EXPECT_EQ(copy.Size(), 1000u);
+    EXPECT_EQ(copy.Find(Eigen::Vector3i(0, 0, 999)), 0);
+}
+
+// ----------------------------------------------------------------------------
+// Blocks keep their address across Reserve() and are reused after Reset().
+// ----------------------------------------------------------------------------
+TEST(SpatialHashTable, MemoryHeap) {
+    integration::MemoryHeap<float> heap(10, 4);
+    EXPECT_EQ(heap.BlockSize(), 10);
+    EXPECT_EQ(heap.Capacity(), 0);
+    heap.Reserve(3);
+    EXPECT_EQ(heap.Capacity(), 4);
+    for (int i = 0; i < 4; i++) {
+        int addr = heap.Malloc();
+        EXPECT_EQ(addr, i);
+        std::fill(heap.Get(addr), heap.Get(addr) + 10, float(i));
+    }
+    const float *block = heap.Get(2);
+    heap.Reserve(9);
+    EXPECT_EQ(heap.Capacity(), 12);
+    EXPECT_EQ(heap.Get(2), block);
+    EXPECT_EQ(heap.Malloc(), 4);
+    EXPECT_EQ(heap.NumberOfBlocks(), 5);
+    EXPECT_EQ(heap.Get(3)[9], 3.0f);
+    EXPECT_EQ(heap.Get(4)[0], 0.0f);
+
+    integration::MemoryHeap<float> copy(heap);
+    heap.Reset();
+    EXPECT_EQ(heap.NumberOfBlocks(), 0);
+    EXPECT_EQ(heap.Malloc(), 0);
+    EXPECT_EQ(heap.Get(0)[5], 0.0f);
+    EXPECT_EQ(copy.NumberOfBlocks(), 5);
+    EXPECT_EQ(copy.Get(1)[5], 1.0f);
+}
@@ -0,0 +1,70 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "Open3D/Integration/TSDFVolume.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+// A volume that implements only the pure virtual functions, as subclasses
+// written before RayCast was added.
+class MinimalTSDFVolume : public integration::TSDFVolume {
+public:
+    MinimalTSDFVolume()
+        : integration::TSDFVolume(
+                  0.01, 0.04, integration::TSDFVolumeColorType::None) {}
+
+public:
+    void Reset() override {}
+    void Integrate(const geometry::RGBDImage &image,
+                   const camera::PinholeCameraIntrinsic &intrinsic,
+                   const Eigen::Matrix4d &extrinsic) override {}
+    std::shared_ptr<geometry::PointCloud> ExtractPointCloud() override {
+        return std::make_shared<geometry::PointCloud>();
+    }
+    std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMesh() override {
+        return std::make_shared<geometry::TriangleMesh>();
+    }
+};
+
+}  // unnamed namespace
+
+TEST(TSDFVolume, RayCastNotSupported) {
+    MinimalTSDFVolume volume;
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 50.0, 31.5, 23.5);
+    std::shared_ptr<geometry::RGBDImage> image;
+    std::shared_ptr<geometry::Image> normal_map;
+    std::tie(image, normal_map) =
+            volume.RayCast(intrinsic, Eigen::Matrix4d::Identity());
+    ASSERT_NE(nullptr, image);
+    ASSERT_NE(nullptr, normal_map);
+    EXPECT_TRUE(image->IsEmpty());
+    EXPECT_TRUE(normal_map->IsEmpty());
+}
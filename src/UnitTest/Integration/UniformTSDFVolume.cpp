@@ -194,6 +194,67 @@ TEST(UniformTSDFVolume, RealData) {
              /*threshold*/ 0.1);
 }
 
+TEST(UniformTSDFVolume, RayCast) {
+    // a plane facing the camera at depth 1
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 50.0, 31.5, 23.5);
+    geometry::RGBDImage rgbd;
+    rgbd.depth_.Prepare(intrinsic.width_, intrinsic.height_, 1, 4);
+    for (int v = 0; v < intrinsic.height_; v++) {
+        for (int u = 0; u < intrinsic.width_; u++) {
+            *rgbd.depth_.PointerAt<float>(u, v) = 1.0f;
+        }
+    }
+    integration::UniformTSDFVolume volume(
+            2.0, 100, 0.06, integration::TSDFVolumeColorType::None,
+            Eigen::Vector3d(-1.0, -1.0, 0.0));
+    volume.Integrate(rgbd, intrinsic, Eigen::Matrix4d::Identity());
+
+    // The camera stands outside of the volume.
+    Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+    extrinsic(2, 3) = 0.5;
+    std::shared_ptr<geometry::RGBDImage> image;
+    std::shared_ptr<geometry::Image> normal_map;
+    std::tie(image, normal_map) = volume.RayCast(intrinsic, extrinsic);
+    int num_hits = 0;
+    for (int v = 0; v < intrinsic.height_; v++) {
+        for (int u = 0; u < intrinsic.width_; u++) {
+            float depth = *image->depth_.PointerAt<float>(u, v);
+            EXPECT_EQ(0.0f, *image->color_.PointerAt<float>(u, v));
+            if (depth == 0.0f) {
+                continue;
+            }
+            num_hits++;
+            EXPECT_NEAR(1.5, depth, 0.002);
+            Eigen::Vector3f normal(normal_map->PointerAt<float>(u, v, 0));
+            EXPECT_NEAR(1.0, normal.norm(), 1e-4);
+            EXPECT_LT(normal(2), -0.99f);
+        }
+    }
+    // the observed part of the plane covers 44% of the view
+    EXPECT_GT(num_hits, intrinsic.width_ * intrinsic.height_ * 4 / 10);
+
+    // looking away from the plane
+    extrinsic = Eigen::Matrix4d::Identity();
+    extrinsic(0, 0) = -1.0;
+    extrinsic(2, 2) = -1.0;
+    std::tie(image, normal_map) = volume.RayCast(intrinsic, extrinsic);
+    for (int v = 0; v < intrinsic.height_; v++) {
+        for (int u = 0; u < intrinsic.width_; u++) {
+            EXPECT_EQ(0.0f, *image->depth_.PointerAt<float>(u, v));
+        }
+    }
+
+    // nothing after Reset
+    volume.Reset();
+    std::tie(image, normal_map) =
+            volume.RayCast(intrinsic, Eigen::Matrix4d::Identity());
+    for (int v = 0; v < intrinsic.height_; v++) {
+        for (int u = 0; u < intrinsic.width_; u++) {
+            EXPECT_EQ(0.0f, *image->depth_.PointerAt<float>(u, v));
+        }
+    }
+}
+
 TEST(UniformTSDFVolume, DISABLED_Destructor) {}
 
 TEST(UniformTSDFVolume, DISABLED_MemberData) {}
@@ -0,0 +1,63 @@
+# ----------------------------------------------------------------------------
+# -                        Open3D: www.open3d.org                            -
+# ----------------------------------------------------------------------------
+# The MIT License (MIT)
+#
+# Copyright (c) 2018 www.open3d.org
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+# ----------------------------------------------------------------------------
+
+import open3d as o3d
+import numpy as np
+from concurrent.futures import ThreadPoolExecutor
+
+
+def _wavy_surface(seed):
+    rng = np.random.RandomState(seed)
+    xy = rng.uniform(0.0, 1.0, size=(2000, 2))
+    z = 0.1 * np.sin(6.0 * xy[:, 0]) * np.cos(4.0 * xy[:, 1])
+    pcd = o3d.geometry.PointCloud()
+    pcd.points = o3d.utility.Vector3dVector(np.column_stack((xy, z)))
+    return pcd
+
+
+def _process(pcd):
+    # every call below releases the GIL
+    down = pcd.voxel_down_sample(0.02)
+    down.estimate_normals(o3d.geometry.KDTreeSearchParamKNN(20))
+    fpfh = o3d.registration.compute_fpfh_feature(
+        down, o3d.geometry.KDTreeSearchParamHybrid(radius=0.1, max_nn=50))
+    target = o3d.geometry.PointCloud(down)
+    target.translate([0.01, -0.02, 0.0])
+    result = o3d.registration.registration_icp(
+        down, target, 0.05, np.identity(4),
+        o3d.registration.TransformationEstimationPointToPlane())
+    return (np.asarray(down.points), np.asarray(down.normals), fpfh.data,
+            result.transformation)
+
+
+def test_concurrent_processing():
+    clouds = [_wavy_surface(seed) for seed in range(8)]
+    serial = [_process(pcd) for pcd in clouds]
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        concurrent = list(executor.map(_process, clouds))
+    for s, c in zip(serial, concurrent):
+        for s_array, c_array in zip(s, c):
+            np.testing.assert_array_equal(s_array, c_array)
@@ -44,9 +44,14 @@ import pytest
         (np.array([[1, 2, 3], [4, 5, 6]], dtype=np.float64), False),
         (np.array([[1, 2, 3], [4, 5, 6]], dtype=np.int32), False),
         (np.array([[1, 2, 3], [4, 5, 6]], dtype=np.int32), False),
+        (np.array([[1, 2, 3], [4, 5, 6]], dtype=np.float32), False),
+        (np.array([[1, 2, 3], [4, 5, 6]], dtype=">f8"), False),
+        (np.array([["a", "b", "c"]]), True),
+        (np.array([[None, None, None]], dtype=object), True),
         # Slice non-contiguous memory
         (np.array([[1, 2, 3, 4, 5], [6, 7, 8, 9, 10]],
                   dtype=np.float64)[:, 0:6:2], False),
+        (np.arange(30, dtype=np.float64).reshape(10, 3)[::-3], False),
         # Transpose view
         (np.array([[1, 4], [2, 5], [3, 6]], dtype=np.float64).T, False),
         # Fortran layout
@@ -81,6 +86,9 @@ def test_Vector3dVector(input_array, expect_exception):
         (np.array([[1, 2, 3], [4, 5, 6]], dtype=np.float64), False),
         (np.array([[1, 2, 3], [4, 5, 6]], dtype=np.int32), False),
         (np.array([[1, 2, 3], [4, 5, 6]], dtype=np.int32), False),
+        (np.array([[1, 2, 3], [4, 5, 6]], dtype=np.int64), False),
+        (np.array([[1, 2, 3], [4, 5, 6]], dtype=">i4"), False),
+        (np.array([["a", "b", "c"]]), True),
         # Slice non-contiguous memory
         (np.array([[1, 2, 3, 4, 5], [6, 7, 8, 9, 10]],
                   dtype=np.int32)[:, 0:6:2], False),
@@ -208,3 +216,104 @@ def test_benchmark():
     z = np.asarray(y)
     print("numpy -> open3d: %.6fs" % (time.time() - start_time))
     np.testing.assert_allclose(x, z)
+
+
+def test_PointCloud_numpy_assignment():
+    pcd = o3d.geometry.PointCloud()
+    x = np.random.rand(100, 3)
+    pcd.points = x
+    np.testing.assert_equal(np.asarray(pcd.points), x)
+
+    # Reading is a view sharing memory with the point cloud.
+    view = np.asarray(pcd.points)
+    view[0] = [1.0, 2.0, 3.0]
+    np.testing.assert_equal(np.asarray(pcd.points)[0], [1.0, 2.0, 3.0])
+
+    # Assigning copies, the array stays owned by numpy.
+    x[1] = [4.0, 5.0, 6.0]
+    assert not np.array_equal(np.asarray(pcd.points)[1], x[1])
+
+    # Assigning a view of the point cloud itself.
+    pcd.points = np.asarray(pcd.points)[10:]
+    np.testing.assert_equal(np.asarray(pcd.points), x[10:])
+
+    # Other dtypes and layouts are converted.
+    pcd.colors = np.asfortranarray(x[10:].astype(np.float32))
+    np.testing.assert_allclose(np.asarray(pcd.colors), x[10:], rtol=1e-6)
+    pcd.normals = o3d.utility.Vector3dVector(x[10:])
+    np.testing.assert_equal(np.asarray(pcd.normals), x[10:])
+
+    # Non-contiguous, Fortran-ordered and wrongly-typed arrays.
+    y = np.random.rand(60, 6)
+    pcd.points = y[::2, 1:4]
+    np.testing.assert_equal(np.asarray(pcd.points), y[::2, 1:4])
+    pcd.points = np.asfortranarray(y[:, :3])
+    np.testing.assert_equal(np.asarray(pcd.points), y[:, :3])
+    pcd.points = y[:, :3].astype(">f8")
+    np.testing.assert_equal(np.asarray(pcd.points), y[:, :3])
+    pcd.points = (y[:, :3] * 10).astype(np.int32)
+    np.testing.assert_equal(np.asarray(pcd.points),
+                            (y[:, :3] * 10).astype(np.int32))
+
+    # A failed assignment keeps the points.
+    points = np.asarray(pcd.points).copy()
+    with pytest.raises(Exception):
+        pcd.points = np.ones((2, 4))
+    with pytest.raises(Exception):
+        pcd.points = np.ones(3)
+    with pytest.raises(Exception):
+        pcd.points = np.array([["a", "b", "c"]])
+    with pytest.raises(Exception):
+        pcd.points = np.array([[None, None, None]], dtype=object)
+    np.testing.assert_equal(np.asarray(pcd.points), points)
+
+
+def test_TriangleMesh_numpy_assignment():
+    mesh = o3d.geometry.TriangleMesh.create_box()
+    triangles = np.asarray(mesh.triangles)[::-1].copy()
+    mesh.triangles = triangles
+    np.testing.assert_equal(np.asarray(mesh.triangles), triangles)
+    mesh.vertices = np.asarray(mesh.vertices) * 2.0
+    np.testing.assert_equal(np.asarray(mesh.get_max_bound()), [2.0, 2.0, 2.0])
+
+    triangles = np.asfortranarray(np.asarray(mesh.triangles)[::2])
+    mesh.triangles = triangles.astype(np.int64)
+    np.testing.assert_equal(np.asarray(mesh.triangles), triangles)
+    with pytest.raises(Exception):
+        mesh.triangles = np.ones((2, 4), dtype=np.int32)
+    np.testing.assert_equal(np.asarray(mesh.triangles), triangles)
+
+
+@pytest.mark.parametrize(
+    "input_array",
+    [
+        np.random.rand(20, 30).astype(np.float32),
+        # Sliced rows and columns
+        np.random.rand(20, 30).astype(np.float32)[::2],
+        np.random.rand(20, 30).astype(np.float32)[:, 5:25],
+        np.random.rand(20, 30).astype(np.float32)[::-1, ::3],
+        # Transpose view and Fortran layout
+        np.random.rand(20, 30).astype(np.float32).T,
+        np.asfortranarray(np.random.rand(20, 30).astype(np.float32)),
+        np.random.randint(65536, size=(20, 30)).astype(np.uint16)[:, ::2],
+        # Color images
+        np.random.randint(256, size=(20, 30, 3)).astype(np.uint8),
+        np.random.randint(256, size=(20, 30, 3)).astype(np.uint8)[:, :, ::-1],
+        np.random.randint(256, size=(20, 30, 3)).astype(np.uint8)[2:10, 4:20],
+        np.asfortranarray(
+            np.random.randint(256, size=(20, 30, 3)).astype(np.uint8)),
+    ])
+def test_Image_strided_buffer(input_array):
+    np.testing.assert_equal(np.asarray(o3d.geometry.Image(input_array)),
+                            input_array)
+
+
+@pytest.mark.parametrize("input_array", [
+    np.ones((20, 30), dtype=np.float64),
+    np.ones((20, 30), dtype=np.int32),
+    np.ones(30, dtype=np.uint8),
+    np.ones((2, 20, 30, 3), dtype=np.uint8),
+])
+def test_Image_invalid_buffer(input_array):
+    with pytest.raises(Exception):
+        o3d.geometry.Image(input_array)
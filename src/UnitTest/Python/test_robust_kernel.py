@@ -0,0 +1,91 @@
+# ----------------------------------------------------------------------------
+# -                        Open3D: www.open3d.org                            -
+# ----------------------------------------------------------------------------
+# The MIT License (MIT)
+#
+# Copyright (c) 2018 www.open3d.org
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+# ----------------------------------------------------------------------------
+
+import open3d as o3d
+import numpy as np
+import pytest
+
+
+def _colored_surface(seed):
+    rng = np.random.RandomState(seed)
+    xy = rng.uniform(0.0, 1.0, size=(5000, 2))
+    z = 0.1 * np.sin(6.0 * xy[:, 0]) * np.cos(4.0 * xy[:, 1])
+    pcd = o3d.geometry.PointCloud()
+    pcd.points = o3d.utility.Vector3dVector(np.column_stack((xy, z)))
+    pcd.colors = o3d.utility.Vector3dVector(
+        np.column_stack((xy, np.full(len(xy), 0.5))))
+    pcd.estimate_normals(o3d.geometry.KDTreeSearchParamKNN(20))
+    return pcd
+
+
+def test_builtin_kernels():
+    residuals = [0.0, 0.5, 1.0, 2.0]
+    np.testing.assert_allclose(
+        [o3d.registration.L2Loss().weight(r) for r in residuals], 1.0)
+    np.testing.assert_allclose(
+        [o3d.registration.HuberLoss(1.0).weight(r) for r in residuals],
+        [1.0, 1.0, 1.0, 0.5])
+    assert o3d.registration.TukeyLoss(1.0).weight(2.0) == 0.0
+
+
+def test_python_subclass_is_rejected():
+    # Weight() runs in the OpenMP loop without the GIL, a Python kernel
+    # can not be constructed
+    class PyLoss(o3d.registration.RobustKernel):
+
+        def weight(self, residual):
+            return 1.0
+
+    with pytest.raises(TypeError):
+        PyLoss()
+
+
+def test_python_override_is_not_called():
+    # subclasses of the built-in kernels keep the C++ weight, so colored ICP
+    # never calls back into Python
+    class PyHuberLoss(o3d.registration.HuberLoss):
+
+        def __init__(self, k):
+            o3d.registration.HuberLoss.__init__(self, k)
+            self.calls = 0
+
+        def weight(self, residual):
+            self.calls += 1
+            return 0.0
+
+    source = _colored_surface(0)
+    target = o3d.geometry.PointCloud(source)
+    target.translate([0.01, -0.01, 0.0])
+    criteria = o3d.registration.ICPConvergenceCriteria(max_iteration=10)
+    py_loss = PyHuberLoss(0.1)
+    result = o3d.registration.registration_colored_icp(
+        source, target, 0.05, np.identity(4), criteria, kernel=py_loss)
+    expected = o3d.registration.registration_colored_icp(
+        source, target, 0.05, np.identity(4), criteria,
+        kernel=o3d.registration.HuberLoss(0.1))
+    assert py_loss.calls == 0
+    np.testing.assert_array_equal(result.transformation,
+                                  expected.transformation)
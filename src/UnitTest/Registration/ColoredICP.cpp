@@ -24,13 +24,96 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cmath>
+#include <random>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/ColoredICP.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+// Colored samples of the wavy test surface, with normals.
+geometry::PointCloud ColoredSurface(size_t num_points, unsigned int seed) {
+    geometry::PointCloud cloud = WavySurface(num_points, seed, true);
+    cloud.EstimateNormals(geometry::KDTreeSearchParamKNN(20));
+    return cloud;
+}
+
+}  // unnamed namespace
+
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
-TEST(ColoredICP, DISABLED_RegistrationColoredICP) {
-    unit_test::NotImplemented();
+TEST(ColoredICP, RegistrationColoredICP) {
+    geometry::PointCloud source = ColoredSurface(3000, 0);
+    geometry::PointCloud target = ColoredSurface(3000, 1);
+    const Eigen::Matrix4d motion =
+            RigidMotion(0.03, Eigen::Vector3d(0.01, -0.01, 0.005));
+    target.Transform(motion);
+    const double max_distance = 0.05;
+
+    registration::RegistrationResult result =
+            registration::RegistrationColoredICP(source, target, max_distance);
+    ExpectEQ(motion, Eigen::Matrix4d(result.transformation_), 1e-2);
+    EXPECT_GT(result.fitness_, 0.9);
+
+    // a prepared target gives the same result and can be reused
+    registration::ColoredICPTarget colored_target(
+            target, geometry::KDTreeSearchParamHybrid(max_distance * 2.0, 30));
+    EXPECT_EQ(target.points_.size(), colored_target.color_gradient_.size());
+    for (int i = 0; i < 2; i++) {
+        registration::RegistrationResult prepared_result =
+                registration::RegistrationColoredICP(source, colored_target,
+                                                     max_distance);
+        ExpectEQ(Eigen::Matrix4d(result.transformation_),
+                 Eigen::Matrix4d(prepared_result.transformation_));
+        EXPECT_EQ(result.fitness_, prepared_result.fitness_);
+        EXPECT_NEAR(result.inlier_rmse_, prepared_result.inlier_rmse_,
+                    1e-12);
+    }
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(ColoredICP, RegistrationColoredICPRobustKernel) {
+    geometry::PointCloud source = ColoredSurface(3000, 0);
+    geometry::PointCloud target = ColoredSurface(3000, 1);
+    const Eigen::Matrix4d motion =
+            RigidMotion(0.03, Eigen::Vector3d(0.01, -0.01, 0.005));
+    target.Transform(motion);
+    const double max_distance = 0.05;
+
+    // off-surface points with random colors, all within max_distance
+    std::mt19937 rng(2);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    for (size_t i = 0; i < 1000; i++) {
+        double x = uniform(rng);
+        double y = uniform(rng);
+        double z = 0.1 * std::sin(6.0 * x) * std::cos(4.0 * y) + 0.03;
+        source.points_.push_back(Eigen::Vector3d(x, y, z));
+        source.colors_.push_back(
+                Eigen::Vector3d(uniform(rng), uniform(rng), uniform(rng)));
+    }
+    source.normals_.clear();
+
+    registration::RegistrationResult l2_result =
+            registration::RegistrationColoredICP(source, target, max_distance);
+    registration::RegistrationResult tukey_result =
+            registration::RegistrationColoredICP(
+                    source, target, max_distance, Eigen::Matrix4d::Identity(),
+                    registration::ICPConvergenceCriteria(), 0.968,
+                    registration::TukeyLoss(0.01));
+    double l2_error =
+            (motion - Eigen::Matrix4d(l2_result.transformation_)).norm();
+    double tukey_error =
+            (motion - Eigen::Matrix4d(tukey_result.transformation_)).norm();
+    ExpectEQ(motion, Eigen::Matrix4d(tukey_result.transformation_), 1e-2);
+    EXPECT_LT(tukey_error, l2_error);
 }
 
 // ----------------------------------------------------------------------------
@@ -0,0 +1,151 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <vector>
+
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/MultiScaleICP.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(MultiScaleICP, PointCloudPyramid) {
+    geometry::PointCloud cloud = WavySurface(20000, 0, true);
+    std::vector<double> voxel_sizes = {0.04, 0.02, 0.01};
+
+    registration::PointCloudPyramid pyramid(cloud, voxel_sizes);
+    EXPECT_EQ(3u, pyramid.NumLevels());
+    EXPECT_FALSE(pyramid.HasColorGradients());
+    size_t previous_size = 0;
+    for (size_t level = 0; level < pyramid.NumLevels(); level++) {
+        EXPECT_EQ(voxel_sizes[level], pyramid.GetVoxelSize(level));
+        const geometry::PointCloud &level_cloud = pyramid.GetPointCloud(level);
+        EXPECT_GT(level_cloud.points_.size(), previous_size);
+        EXPECT_LT(level_cloud.points_.size(), cloud.points_.size());
+        EXPECT_TRUE(level_cloud.HasNormals());
+        EXPECT_TRUE(level_cloud.HasColors());
+        previous_size = level_cloud.points_.size();
+
+        std::vector<int> indices;
+        std::vector<double> distance2;
+        pyramid.GetKDTree(level).SearchKNN(level_cloud.points_[7], 1, indices,
+                                           distance2);
+        EXPECT_EQ(7, indices[0]);
+    }
+
+    EXPECT_TRUE(pyramid.IsTarget());
+
+    // sources keep the down-sampled points and normals only
+    auto source_pyramid =
+            registration::PointCloudPyramid::CreateSource(cloud, voxel_sizes);
+    EXPECT_EQ(3u, source_pyramid->NumLevels());
+    EXPECT_FALSE(source_pyramid->IsTarget());
+    EXPECT_FALSE(source_pyramid->HasColorGradients());
+    for (size_t level = 0; level < source_pyramid->NumLevels(); level++) {
+        const geometry::PointCloud &level_cloud =
+                source_pyramid->GetPointCloud(level);
+        ExpectEQ(pyramid.GetPointCloud(level).points_, level_cloud.points_);
+        EXPECT_TRUE(level_cloud.HasNormals());
+        EXPECT_TRUE(level_cloud.HasColors());
+    }
+
+    registration::PointCloudPyramid colored_pyramid(cloud, voxel_sizes, true);
+    EXPECT_TRUE(colored_pyramid.HasColorGradients());
+    for (size_t level = 0; level < colored_pyramid.NumLevels(); level++) {
+        const registration::ColoredICPTarget &target =
+                colored_pyramid.GetColoredICPTarget(level);
+        EXPECT_EQ(&colored_pyramid.GetPointCloud(level),
+                  target.point_cloud_.get());
+        EXPECT_EQ(target.point_cloud_->points_.size(),
+                  target.color_gradient_.size());
+    }
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(MultiScaleICP, RegistrationMultiScaleICP) {
+    geometry::PointCloud source = WavySurface(20000, 0, true);
+    geometry::PointCloud target = WavySurface(20000, 1, true);
+    const Eigen::Matrix4d motion =
+            RigidMotion(0.05, Eigen::Vector3d(0.02, -0.01, 0.01));
+    target.Transform(motion);
+    std::vector<double> voxel_sizes = {0.04, 0.02, 0.01};
+    std::vector<double> distances = {0.08, 0.04, 0.02};
+    std::vector<registration::ICPConvergenceCriteria> criteria = {
+            registration::ICPConvergenceCriteria(1e-6, 1e-6, 50),
+            registration::ICPConvergenceCriteria(1e-6, 1e-6, 30),
+            registration::ICPConvergenceCriteria(1e-6, 1e-6, 14)};
+    auto source_pyramid =
+            registration::PointCloudPyramid::CreateSource(source, voxel_sizes);
+    registration::PointCloudPyramid target_pyramid(target, voxel_sizes, true);
+
+    std::vector<registration::TransformationEstimationType> types = {
+            registration::TransformationEstimationType::PointToPoint,
+            registration::TransformationEstimationType::PointToPlane,
+            registration::TransformationEstimationType::ColoredICP};
+    for (auto type : types) {
+        registration::RegistrationResult result =
+                registration::RegistrationMultiScaleICP(
+                        *source_pyramid, target_pyramid, distances, criteria,
+                        Eigen::Matrix4d::Identity(), type);
+        ExpectEQ(motion, Eigen::Matrix4d(result.transformation_), 5e-3);
+        EXPECT_GT(result.fitness_, 0.9);
+        EXPECT_FALSE(result.correspondence_set_.empty());
+
+        // pyramids are only read, registering again gives the same result
+        registration::RegistrationResult again =
+                registration::RegistrationMultiScaleICP(
+                        *source_pyramid, target_pyramid, distances, criteria,
+                        Eigen::Matrix4d::Identity(), type);
+        ExpectEQ(Eigen::Matrix4d(result.transformation_),
+                 Eigen::Matrix4d(again.transformation_));
+        EXPECT_EQ(result.fitness_, again.fitness_);
+    }
+
+    // mismatched levels, source-only targets and colored ICP without
+    // gradients keep the init
+    Eigen::Matrix4d init = Eigen::Matrix4d::Identity();
+    init(0, 3) = 0.01;
+    registration::RegistrationResult result =
+            registration::RegistrationMultiScaleICP(
+                    *source_pyramid, target_pyramid, {0.08, 0.04}, criteria,
+                    init);
+    ExpectEQ(init, Eigen::Matrix4d(result.transformation_));
+    result = registration::RegistrationMultiScaleICP(
+            target_pyramid, *source_pyramid, distances, criteria, init);
+    ExpectEQ(init, Eigen::Matrix4d(result.transformation_));
+    registration::PointCloudPyramid plain_pyramid(source, voxel_sizes);
+    result = registration::RegistrationMultiScaleICP(
+            target_pyramid, plain_pyramid, distances, criteria, init,
+            registration::TransformationEstimationType::ColoredICP);
+    ExpectEQ(init, Eigen::Matrix4d(result.transformation_));
+}
@@ -24,8 +24,33 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/Registration.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+// Samples of the wavy test surface, with normals.
+geometry::PointCloud SurfaceWithNormals(size_t num_points, unsigned int seed) {
+    geometry::PointCloud cloud = WavySurface(num_points, seed);
+    cloud.EstimateNormals(geometry::KDTreeSearchParamKNN(20));
+    return cloud;
+}
+
+bool LessCorrespondence(const Eigen::Vector2i &c0, const Eigen::Vector2i &c1) {
+    return c0(0) < c1(0) || (c0(0) == c1(0) && c0(1) < c1(1));
+}
+
+}  // unnamed namespace
+
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
@@ -70,7 +95,61 @@ TEST(Registration, DISABLED_EvaluateRegistration) {
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
-TEST(Registration, DISABLED_RegistrationICP) { unit_test::NotImplemented(); }
+TEST(Registration, RegistrationICP) {
+    geometry::PointCloud source = SurfaceWithNormals(2000, 0);
+    geometry::PointCloud target = SurfaceWithNormals(2000, 1);
+    const Eigen::Matrix4d init =
+            RigidMotion(0.05, Eigen::Vector3d(0.02, -0.01, 0.01));
+    const double max_distance = 0.05;
+    registration::ICPConvergenceCriteria criteria(1e-6, 1e-6, 30);
+    registration::TransformationEstimationPointToPlane estimation;
+
+    // reference with an explicit correspondence set in every iteration
+    Eigen::Matrix4d transformation = init;
+    registration::RegistrationResult reference = registration::
+            EvaluateRegistration(source, target, max_distance, transformation);
+    for (int i = 0; i < criteria.max_iteration_; i++) {
+        geometry::PointCloud pcd = source;
+        pcd.Transform(transformation);
+        transformation =
+                estimation.ComputeTransformation(
+                        pcd, target, reference.correspondence_set_) *
+                transformation;
+        registration::RegistrationResult backup = reference;
+        reference = registration::EvaluateRegistration(
+                source, target, max_distance, transformation);
+        if (std::abs(backup.fitness_ - reference.fitness_) <
+                    criteria.relative_fitness_ &&
+            std::abs(backup.inlier_rmse_ - reference.inlier_rmse_) <
+                    criteria.relative_rmse_) {
+            break;
+        }
+    }
+
+    registration::RegistrationResult result = registration::RegistrationICP(
+            source, target, max_distance, init, estimation, criteria);
+    EXPECT_EQ(reference.fitness_, result.fitness_);
+    EXPECT_NEAR(reference.inlier_rmse_, result.inlier_rmse_, 1e-12);
+    ExpectEQ(Eigen::Matrix4d(reference.transformation_),
+             Eigen::Matrix4d(result.transformation_), 1e-9);
+    EXPECT_GT(result.fitness_, 0.9);
+    EXPECT_LT(result.inlier_rmse_, 0.02);
+
+    auto reference_corres = reference.correspondence_set_;
+    auto corres = result.correspondence_set_;
+    std::sort(reference_corres.begin(), reference_corres.end(),
+              LessCorrespondence);
+    std::sort(corres.begin(), corres.end(), LessCorrespondence);
+    EXPECT_EQ(reference_corres, corres);
+
+    // without normals point-to-plane ICP returns the initial guess
+    geometry::PointCloud no_normals = target;
+    no_normals.normals_.clear();
+    result = registration::RegistrationICP(source, no_normals, max_distance,
+                                           init, estimation, criteria);
+    ExpectEQ(init, Eigen::Matrix4d(result.transformation_));
+    EXPECT_EQ(0.0, result.fitness_);
+}
 
 // ----------------------------------------------------------------------------
 //
@@ -82,15 +161,62 @@ TEST(Registration, DISABLED_TransformationEstimationPointToPoint) {
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
-TEST(Registration, DISABLED_RegistrationRANSACBasedOnCorrespondence) {
-    unit_test::NotImplemented();
+TEST(Registration, RegistrationRANSACBasedOnCorrespondence) {
+    geometry::PointCloud source = SurfaceWithNormals(500, 0);
+    const Eigen::Matrix4d transformation =
+            RigidMotion(0.5, Eigen::Vector3d(0.3, -0.2, 0.1));
+    geometry::PointCloud target = source;
+    target.Transform(transformation);
+
+    // a third of the correspondences are wrong
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int> dist(0, 499);
+    registration::CorrespondenceSet corres;
+    for (int i = 0; i < 500; i++) {
+        corres.push_back(Eigen::Vector2i(i, i % 3 == 0 ? dist(rng) : i));
+    }
+
+    registration::RegistrationResult result =
+            registration::RegistrationRANSACBasedOnCorrespondence(
+                    source, target, corres, 0.01,
+                    registration::TransformationEstimationPointToPoint(), 3,
+                    registration::RANSACConvergenceCriteria(1000, 1000));
+    EXPECT_GT(result.fitness_, 0.6);
+    ExpectEQ(transformation, Eigen::Matrix4d(result.transformation_), 1e-6);
 }
 
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
-TEST(Registration, DISABLED_RegistrationRANSACBasedOnFeatureMatching) {
-    unit_test::NotImplemented();
+TEST(Registration, RegistrationRANSACBasedOnFeatureMatching) {
+    geometry::PointCloud source = SurfaceWithNormals(500, 0);
+    const Eigen::Matrix4d transformation =
+            RigidMotion(0.5, Eigen::Vector3d(0.3, -0.2, 0.1));
+    geometry::PointCloud target = source;
+    target.Transform(transformation);
+
+    // features that match every source point to its target point
+    registration::Feature source_feature, target_feature;
+    source_feature.Resize(3, 500);
+    for (int i = 0; i < 500; i++) {
+        source_feature.data_.col(i) = source.points_[i];
+    }
+    target_feature = source_feature;
+
+    // 1000 iterations search the features of all source points up front,
+    // 100 iterations only those of the sampled points
+    for (int max_iteration : {1000, 100}) {
+        registration::RegistrationResult result =
+                registration::RegistrationRANSACBasedOnFeatureMatching(
+                        source, target, source_feature, target_feature, 0.01,
+                        registration::TransformationEstimationPointToPoint(), 3,
+                        {},
+                        registration::RANSACConvergenceCriteria(max_iteration,
+                                                                100));
+        EXPECT_EQ(1.0, result.fitness_);
+        ExpectEQ(transformation, Eigen::Matrix4d(result.transformation_),
+                 1e-6);
+    }
 }
 
 // ----------------------------------------------------------------------------
@@ -0,0 +1,58 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/RobustKernel.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(RobustKernel, Weight) {
+    registration::L2Loss l2;
+    EXPECT_DOUBLE_EQ(1.0, l2.Weight(0.0));
+    EXPECT_DOUBLE_EQ(1.0, l2.Weight(-100.0));
+
+    registration::HuberLoss huber(0.5);
+    EXPECT_DOUBLE_EQ(1.0, huber.Weight(0.25));
+    EXPECT_DOUBLE_EQ(1.0, huber.Weight(-0.5));
+    EXPECT_DOUBLE_EQ(0.25, huber.Weight(2.0));
+    EXPECT_DOUBLE_EQ(0.25, huber.Weight(-2.0));
+
+    registration::CauchyLoss cauchy(0.5);
+    EXPECT_DOUBLE_EQ(1.0, cauchy.Weight(0.0));
+    EXPECT_DOUBLE_EQ(0.5, cauchy.Weight(0.5));
+    EXPECT_DOUBLE_EQ(0.2, cauchy.Weight(-1.0));
+
+    registration::TukeyLoss tukey(0.5);
+    EXPECT_DOUBLE_EQ(1.0, tukey.Weight(0.0));
+    EXPECT_DOUBLE_EQ(0.5625, tukey.Weight(0.25));
+    EXPECT_DOUBLE_EQ(0.5625, tukey.Weight(-0.25));
+    EXPECT_DOUBLE_EQ(0.0, tukey.Weight(0.5));
+    EXPECT_DOUBLE_EQ(0.0, tukey.Weight(1.0));
+}
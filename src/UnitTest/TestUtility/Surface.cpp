@@ -0,0 +1,70 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "UnitTest/TestUtility/Surface.h"
+
+#include <Eigen/Geometry>
+#include <cmath>
+#include <random>
+
+// ----------------------------------------------------------------------------
+// Points drawn uniformly over the unit square and lifted onto the wavy surface
+// z = 0.1 * sin(6x) * cos(4y), with optional smooth colors.
+// ----------------------------------------------------------------------------
+open3d::geometry::PointCloud unit_test::WavySurface(size_t num_points,
+                                                    unsigned int seed,
+                                                    bool with_colors) {
+    open3d::geometry::PointCloud cloud;
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    for (size_t i = 0; i < num_points; i++) {
+        double x = uniform(rng);
+        double y = uniform(rng);
+        double z = 0.1 * std::sin(6.0 * x) * std::cos(4.0 * y);
+        cloud.points_.push_back(Eigen::Vector3d(x, y, z));
+        if (with_colors) {
+            cloud.colors_.push_back(
+                    Eigen::Vector3d(0.5 + 0.4 * std::sin(9.0 * x),
+                                    0.5 + 0.4 * std::cos(11.0 * y),
+                                    0.5 + 0.4 * std::sin(7.0 * (x + y))));
+        }
+    }
+    return cloud;
+}
+
+// ----------------------------------------------------------------------------
+// Rigid motion rotating about the axis (1, 2, 3), then translating.
+// ----------------------------------------------------------------------------
+Eigen::Matrix4d unit_test::RigidMotion(double angle,
+                                       const Eigen::Vector3d& translation) {
+    Eigen::Matrix4d motion = Eigen::Matrix4d::Identity();
+    motion.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(angle,
+                              Eigen::Vector3d(1.0, 2.0, 3.0).normalized())
+                    .toRotationMatrix();
+    motion.block<3, 1>(0, 3) = translation;
+    return motion;
+}
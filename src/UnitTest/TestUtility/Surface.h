@@ -0,0 +1,44 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+
+#include "Open3D/Geometry/PointCloud.h"
+
+namespace unit_test {
+// Points drawn uniformly over the unit square and lifted onto the wavy surface
+// z = 0.1 * sin(6x) * cos(4y). Different seeds give different samples of the
+// same surface. The optional colors vary smoothly over the surface.
+open3d::geometry::PointCloud WavySurface(size_t num_points,
+                                         unsigned int seed,
+                                         bool with_colors = false);
+
+// Rigid motion rotating by angle (in radians) about the axis (1, 2, 3),
+// followed by the translation.
+Eigen::Matrix4d RigidMotion(double angle, const Eigen::Vector3d& translation);
+}  // namespace unit_test
@@ -0,0 +1,77 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "UnitTest/TestUtility/TempDirectory.h"
+
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "Open3D/Utility/FileSystem.h"
+
+using namespace open3d::utility;
+
+unit_test::TempDirectory::TempDirectory() {
+    std::string root = "/tmp";
+    for (const char* variable : {"TMPDIR", "TMP", "TEMP"}) {
+        const char* value = std::getenv(variable);
+        if (value != nullptr && value[0] != '\0') {
+            root = value;
+            break;
+        }
+    }
+    std::random_device random_device;
+    std::mt19937 generator(random_device());
+    for (int attempt = 0; attempt < 100; attempt++) {
+        // creating the directory fails if it exists already
+        std::string directory = filesystem::GetRegularizedDirectoryName(root) +
+                                "open3d_unit_test_" +
+                                std::to_string(generator());
+        if (filesystem::MakeDirectory(directory)) {
+            directory_ = directory;
+            return;
+        }
+    }
+    ADD_FAILURE() << "Unable to create a temporary directory in " << root;
+}
+
+unit_test::TempDirectory::~TempDirectory() {
+    if (directory_.empty()) {
+        return;
+    }
+    std::vector<std::string> filenames;
+    if (filesystem::ListFilesInDirectory(directory_, filenames)) {
+        for (const auto& filename : filenames) {
+            filesystem::RemoveFile(filename);
+        }
+    }
+    filesystem::DeleteDirectory(directory_);
+}
+
+std::string unit_test::TempDirectory::Path(const std::string& file_name) const {
+    return filesystem::GetRegularizedDirectoryName(directory_) + file_name;
+}
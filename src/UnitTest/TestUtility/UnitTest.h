@@ -39,6 +39,8 @@
 #include "UnitTest/TestUtility/Print.h"
 #include "UnitTest/TestUtility/Rand.h"
 #include "UnitTest/TestUtility/Sort.h"
+#include "UnitTest/TestUtility/Surface.h"
+#include "UnitTest/TestUtility/TempDirectory.h"
 
 namespace unit_test {
 // thresholds for comparing floating point values
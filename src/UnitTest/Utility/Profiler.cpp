@@ -0,0 +1,184 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/Profiler.h"
+#include "TestUtility/UnitTest.h"
+
+#include <json/json.h>
+#include <fstream>
+#include <thread>
+
+using namespace open3d;
+using namespace unit_test;
+
+// ----------------------------------------------------------------------------
+// Nested scopes and counters are recorded per thread.
+// ----------------------------------------------------------------------------
+TEST(Profiler, RecordScopes) {
+    utility::Profiler &profiler = utility::Profiler::GetInstance();
+    profiler.Enable(1024);
+    profiler.Clear();
+
+    auto work = [](int count) {
+        utility::ScopeProfiler outer("outer");
+        for (int i = 0; i < count; i++) {
+            utility::ScopeProfiler inner("inner");
+            utility::Profiler::GetInstance().RecordCounter("count", i);
+        }
+    };
+    work(3);
+    std::thread thread(work, 5);
+    thread.join();
+    profiler.Disable();
+    work(7);
+
+    std::vector<utility::Profiler::ThreadEvents> thread_events =
+            profiler.GetEvents();
+    size_t num_outer = 0, num_inner = 0, num_counters = 0;
+    for (const auto &events : thread_events) {
+        EXPECT_EQ(events.num_dropped_, 0u);
+        for (size_t i = 0; i < events.events_.size(); i++) {
+            const auto &event = events.events_[i];
+            std::string name = event.name_;
+            if (name == "outer") {
+                num_outer++;
+                EXPECT_EQ(event.depth_, 0);
+                // the outer scope completes last and encloses the others
+                EXPECT_EQ(i + 1, events.events_.size());
+                for (const auto &nested : events.events_) {
+                    EXPECT_GE(nested.begin_us_, event.begin_us_);
+                }
+            } else if (name == "inner") {
+                num_inner++;
+                EXPECT_EQ(event.depth_, 1);
+                EXPECT_GE(event.value_, 0.0);
+            } else if (name == "count") {
+                num_counters++;
+                EXPECT_EQ(event.type_, utility::Profiler::EventType::Counter);
+            }
+        }
+    }
+    EXPECT_EQ(num_outer, 2u);
+    EXPECT_EQ(num_inner, 8u);
+    EXPECT_EQ(num_counters, 8u);
+}
+
+// ----------------------------------------------------------------------------
+// Full ring buffers keep the most recent events.
+// ----------------------------------------------------------------------------
+TEST(Profiler, RingBuffer) {
+    utility::Profiler &profiler = utility::Profiler::GetInstance();
+    profiler.Enable(4);
+    profiler.Clear();
+    for (int i = 0; i < 10; i++) {
+        profiler.RecordCounter("ring", i);
+    }
+    profiler.Disable();
+
+    bool found = false;
+    for (const auto &events : profiler.GetEvents()) {
+        if (events.events_.empty()) {
+            continue;
+        }
+        found = true;
+        EXPECT_EQ(events.num_dropped_, 6u);
+        ASSERT_EQ(events.events_.size(), 4u);
+        for (int i = 0; i < 4; i++) {
+            EXPECT_EQ(events.events_[i].value_, double(6 + i));
+        }
+    }
+    EXPECT_TRUE(found);
+    profiler.Enable();
+    profiler.Clear();
+    profiler.Disable();
+}
+
+// ----------------------------------------------------------------------------
+// The events of exited threads are kept until the next Clear().
+// ----------------------------------------------------------------------------
+TEST(Profiler, ClearExitedThreads) {
+    utility::Profiler &profiler = utility::Profiler::GetInstance();
+    profiler.Enable(16);
+    profiler.Clear();
+    const size_t num_threads = profiler.GetEvents().size();
+
+    std::thread thread([]() {
+        utility::Profiler::GetInstance().RecordCounter("exited", 1.0);
+    });
+    thread.join();
+    std::vector<utility::Profiler::ThreadEvents> thread_events =
+            profiler.GetEvents();
+    ASSERT_EQ(thread_events.size(), num_threads + 1);
+    ASSERT_EQ(thread_events.back().events_.size(), 1u);
+    EXPECT_STREQ(thread_events.back().events_[0].name_, "exited");
+
+    profiler.Clear();
+    EXPECT_EQ(profiler.GetEvents().size(), num_threads);
+    profiler.Enable();
+    profiler.Clear();
+    profiler.Disable();
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(Profiler, WriteChromeTrace) {
+    utility::Profiler &profiler = utility::Profiler::GetInstance();
+    profiler.Enable();
+    profiler.Clear();
+    {
+        utility::ScopeProfiler scope("scope \"quoted\"");
+        profiler.RecordCounter("counter", 42.0);
+    }
+    profiler.Disable();
+    TempDirectory temp_directory;
+    const std::string filename = temp_directory.Path("trace.json");
+    EXPECT_TRUE(profiler.WriteChromeTrace(filename));
+
+    std::ifstream file(filename);
+    Json::Value root;
+    Json::CharReaderBuilder builder;
+    std::string errors;
+    EXPECT_TRUE(Json::parseFromStream(builder, file, &root, &errors));
+    const Json::Value &trace_events = root["traceEvents"];
+    int num_scopes = 0, num_counters = 0;
+    for (const auto &event : trace_events) {
+        if (event["ph"].asString() == "X") {
+            num_scopes++;
+            EXPECT_EQ(event["name"].asString(), "scope \"quoted\"");
+            EXPECT_GE(event["dur"].asDouble(), 0.0);
+        } else if (event["ph"].asString() == "C") {
+            num_counters++;
+            EXPECT_EQ(event["name"].asString(), "counter");
+            EXPECT_EQ(event["args"]["value"].asDouble(), 42.0);
+        }
+    }
+    EXPECT_EQ(num_scopes, 1);
+    EXPECT_EQ(num_counters, 1);
+    profiler.Enable();
+    profiler.Clear();
+    profiler.Disable();
+}